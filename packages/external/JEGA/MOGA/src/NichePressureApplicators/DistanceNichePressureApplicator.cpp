@@ -65,6 +65,7 @@ Includes
 #include <../Utilities/include/DesignGroup.hpp>
 #include <utilities/include/numeric_limits.hpp>
 #include <utilities/include/EDDY_DebugScope.hpp>
+#include <../Utilities/include/DesignNeighborGrid.hpp>
 #include <../Utilities/include/ParameterExtractor.hpp>
 #include <../Utilities/include/MultiObjectiveStatistician.hpp>
 #include <../MOGA/include/NichePressureApplicators/DistanceNichePressureApplicator.hpp>
@@ -534,67 +535,63 @@ DistanceNichePressureApplicator::ApplyNichePressure(
     // now for all designs.
     JEGA::DoubleVector dists(this->ComputeCutoffDistances(paretoExtremes));
 
-    // now, we start with the first design and search the range for all
-    // those that are too close.  We remove those that are too close but, if we
-    // are caching, put them in a temporary storage container so that they are
-    // not lost.  We also never remove an extreme Design.  Since there can only
-    // be as many extreme designs as there are objectives, keep the count of
-    // the number encountered to possibly reduce the cost of testing for
-    // extremes.
-    size_t nExtremesFound = 0;
-
     // prepare to output the number of designs cut out.
     JEGA_LOGGING_IF_ON(prevParetoSize = pareto.size();)
 
-    // We can bound our search range by noting that once the first objective
-    // distance is too big, we needn't look any further.  That is true because
-    // of the sorting of the DesignOFSortSet.
-    for(DesignOFSortSet::iterator curr(pareto.begin());
-        curr!=pareto.end(); ++curr)
+    // We visit the designs in sorted order and remove each one that is too
+    // close to a design that was visited before it and kept.  The kept
+    // designs are placed in a grid whose cells are as wide as the cutoff
+    // distances so that each design need only be compared with the kept
+    // designs in its own and the adjacent cells.  We remove those that are
+    // too close but, if we are caching, put them in a temporary storage
+    // container so that they are not lost.  We also never remove an extreme
+    // Design.  Since there can only be as many extreme designs as there are
+    // objectives, keep the count of the number encountered to possibly
+    // reduce the cost of testing for extremes.
+    DesignNeighborGrid kept(dists);
+    DesignNeighborGrid::DesignVector nearby;
+    size_t nExtremesFound = 0;
+
+    for(DesignOFSortSet::iterator curr(pareto.begin()); curr!=pareto.end();)
     {
-        // Iterate all designs beyond curr until we are done and see if we keep
-        // or discard them.
-        DesignOFSortSet::iterator next(curr);
-        for(++next; next!=pareto.end();)
+        // if curr is an extreme design, we keep it no matter what.
+        bool keep = nExtremesFound < nof &&
+            MultiObjectiveStatistician::IsExtremeDesign(**curr, paretoExtremes);
+
+        if(keep) ++nExtremesFound;
+
+        else
         {
-            double obj0Dist = this->ComputeObjectiveDistance(**curr, **next, 0);
-
-            // If the distance at obj0 is large enough, we can get out of this
-            // inner loop and move onto the next "curr".
-            if(obj0Dist > dists[0]) break;
-
-            // if next is an extreme design, we keep it no matter what.
-            if(nExtremesFound < nof &&
-               MultiObjectiveStatistician::IsExtremeDesign(
-                **next, paretoExtremes
-                )){ ++next; ++nExtremesFound; continue; }
-
-            // prepare to store whether or not we will be keeping next.
-            bool keep = false;
-
-            // We need to see if the distances are all too small
-            for(size_t of=1; of<nof; ++of)
-                // if the distance at this objective is large enough, we will
-                // be keeping the design so we can continue on our way with
-                // the loop iterating curr.
-                if(this->ComputeObjectiveDistance(
-                    **curr, **next, of
-                    ) > dists[of]) { keep = true; break; }
-
-            // If we are keeping it, we can go to the next design.
-            if(keep) { ++next; continue; }
-
-            // If we make it here, it is too close on all dimensions so we kill
-            // off next by removing it from the population and putting it into
-            // our design buffer.  It also comes out of pareto so that we don't
-            // consider it anymore.
-            population.Erase(*next);
-
-            // if we are caching, put design in our buffer.  If not,
-            // give it back to the target.
-            if(!this->BufferDesign(*next)) target.TakeDesign(*next);
-            pareto.erase(next++);
+            nearby.clear();
+            kept.GetCandidates(**curr, nearby);
+
+            // We keep curr unless the distances to some kept design are all
+            // too small.
+            keep = true;
+            for(DesignNeighborGrid::DesignVector::const_iterator it(
+                nearby.begin()); keep && it!=nearby.end(); ++it)
+            {
+                keep = false;
+                for(size_t of=0; of<nof; ++of)
+                    if(this->ComputeObjectiveDistance(
+                        **it, **curr, of
+                        ) > dists[of]) { keep = true; break; }
+            }
         }
+
+        // If we are keeping it, record it and go to the next design.
+        if(keep) { kept.Insert(**curr); ++curr; continue; }
+
+        // If we make it here, it is too close on all dimensions so we kill
+        // off curr by removing it from the population and putting it into
+        // our design buffer.  It also comes out of pareto so that we don't
+        // consider it anymore.
+        population.Erase(*curr);
+
+        // if we are caching, put design in our buffer.  If not,
+        // give it back to the target.
+        if(!this->BufferDesign(*curr)) target.TakeDesign(*curr);
+        pareto.erase(curr++);
     }
 
     JEGALOG_II(this->GetLogger(), lverbose(), this,
@@ -64,6 +64,7 @@ Includes
 #include <../Utilities/include/Logging.hpp>
 #include <../Utilities/include/DesignGroup.hpp>
 #include <utilities/include/EDDY_DebugScope.hpp>
+#include <../Utilities/include/DesignNeighborGrid.hpp>
 #include <../Utilities/include/ParameterExtractor.hpp>
 #include <utilities/include/RandomNumberGenerator.hpp>
 #include <../Utilities/include/MultiObjectiveStatistician.hpp>
@@ -740,48 +741,54 @@ MaxDesignsNichePressureApplicator::ComputeNicheCounts(
 
     const size_t nof = this->GetDesignTarget().GetNOF();
 
+    // Each design is compared only with the designs before it that lie in
+    // its own or an adjacent cell of a grid whose cells are as wide as the
+    // cutoff distances.  Any design that is too close is certain to be in
+    // one of those cells.
+    DesignNeighborGrid visited(dists);
+    DesignNeighborGrid::DesignVector nearby;
+
     for(
         DesignOFSortSet::const_iterator iit(designs.begin());
         iit!=designs.end(); ++iit
         )
     {
-        size_t ncAfter = 1; // 1 to count self
+        size_t ncBefore = 1; // 1 to count self
         const Design& id = **iit;
 
-        DesignOFSortSet::const_iterator jit(iit);
-        for(++jit; jit!=designs.end(); ++jit)
+        nearby.clear();
+        visited.GetCandidates(id, nearby);
+
+        for(
+            DesignNeighborGrid::DesignVector::const_iterator jit(
+                nearby.begin()
+                );
+            jit!=nearby.end(); ++jit
+            )
         {
             const Design& jd = **jit;
 
-            // If jit is too close to iit, then we increment ncAfter and
-            // increment the count for jit stored in ncm.  That way, ncm will
-            // always have record of those that are too close prior to iit at
-            // the beginning of an iit loop.
-            double obj0Dist = this->ComputeObjectiveDistance(id, jd, 0);
-
-            // If the distance at obj0 is large enough, we can get out of this
-            // inner loop and move onto the next "iit".  This is b/c of the
-            // hierarchical sorting by obj0.
-            if(obj0Dist > dists[0]) break;
-
             // prepare to store whether or not jit is too close.
             bool tooClose = true;
 
             // We need to see if the distances are all too small.  If any are
             // larger than the cutoff, then jit is far enough away.
-            for(size_t of=1; of<nof; ++of)
+            for(size_t of=0; of<nof; ++of)
                 if(this->ComputeObjectiveDistance(id, jd, of) > dists[of])
                 { tooClose = false; break; }
 
-            // If it is too close, we mark it as such.  Otherwise we move on.
+            // If it is too close, we increment ncBefore and increment the
+            // count for jit stored in ncm.  That way, every too close pair
+            // is counted for both designs exactly once.
             if(tooClose)
             {
-                ++ncAfter;
+                ++ncBefore;
                 ncm.AddToValue(jd, 1);
             }
         }
 
-        ncm.AddToValue(id, ncAfter);
+        ncm.AddToValue(id, ncBefore);
+        visited.Insert(id);
     }
 
     ncm.ResumeStatistics(true);
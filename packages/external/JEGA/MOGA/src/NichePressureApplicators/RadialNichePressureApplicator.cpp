@@ -64,6 +64,7 @@ Includes
 #include <utilities/include/extremes.hpp>
 #include <../Utilities/include/Logging.hpp>
 #include <../Utilities/include/DesignGroup.hpp>
+#include <../Utilities/include/DesignNeighborGrid.hpp>
 #include <../Utilities/include/ParameterExtractor.hpp>
 #include <../Utilities/include/MultiObjectiveStatistician.hpp>
 #include <../MOGA/include/NichePressureApplicators/RadialNichePressureApplicator.hpp>
@@ -547,63 +548,67 @@ RadialNichePressureApplicator::ApplyNichePressure(
     // in case we are not caching, we will need the target below.
     DesignTarget& target = this->GetDesignTarget();
 
-    // now, we start with the first design and search the range for all
-    // those that are too close.  We remove those that are too close but
-    // put them in a temporary storage container so that they are not lost.
-    // We also never remove an extreme Design.  Since there can only
-    // be as many extreme designs as there are objectives, keep the count of
-    // the number encountered to possibly reduce the cost of testing for
-    // extremes.
-    size_t nExtremesFound = 0;
-
     // prepare to output the number of designs cut out.
     JEGA_LOGGING_IF_ON(prevParetoSize = pareto.size();)
 
-    // We can bound our search range by noting that once the first objective
-    // distanceis too big, we needn't look any further.  That is true because
-    // of the sorting of the DesignOFSortSet.
-    for(DesignOFSortSet::iterator curr(pareto.begin());
-        curr!=pareto.end(); ++curr)
+    // A design can only be within the cutoff of another if it is within the
+    // cutoff in each normalized objective.  So we can place the kept designs
+    // in a grid whose cells are that wide in each objective and need only
+    // compare each design with the kept designs in its own and the adjacent
+    // cells.
+    JEGA::DoubleVector widths(nof);
+    for(size_t of=0; of<nof; ++of)
+        widths[of] = cutoffDist * paretoExtremes.get_range(
+            static_cast<DoubleExtremes::size_type>(of)
+            );
+
+    DesignNeighborGrid kept(widths);
+    DesignNeighborGrid::DesignVector nearby;
+
+    // now, we visit the designs in sorted order and remove each one that is
+    // too close to a design that was visited before it and kept.  We remove
+    // those that are too close but put them in a temporary storage container
+    // so that they are not lost.  We also never remove an extreme Design.
+    // Since there can only be as many extreme designs as there are
+    // objectives, keep the count of the number encountered to possibly
+    // reduce the cost of testing for extremes.
+    size_t nExtremesFound = 0;
+
+    for(DesignOFSortSet::iterator curr(pareto.begin()); curr!=pareto.end();)
     {
-        // Iterate all designs beyond curr until we are done and see if we keep
-        // or discard them.
-        DesignOFSortSet::iterator next(curr);
-        for(++next; next!=pareto.end();)
+        // if curr is an extreme design, we keep it no matter what.
+        bool keep = nExtremesFound < nof &&
+            MultiObjectiveStatistician::IsExtremeDesign(**curr, paretoExtremes);
+
+        if(keep) ++nExtremesFound;
+
+        else
         {
-            double obj0Dist = this->GetNormalizedObjectiveDistance(
-                **curr, **next, 0, paretoExtremes.get_range(0)
-                );
-
-            // If the distance at obj0 is large enough, we can get out of this
-            // inner loop and move onto the next "curr".
-            if(obj0Dist > cutoffDist) break;
-
-            // if next is an extreme design, we keep it no matter what.
-            if(nExtremesFound < nof &&
-               MultiObjectiveStatistician::IsExtremeDesign(
-                **next, paretoExtremes
-                )){ ++next; ++nExtremesFound; continue; }
-
-            // Otherwise, we need to see if the overall distance is too small
-            double dist =
-                this->GetNormalizedDistance(**curr, **next, paretoExtremes);
-
-            // If it is too small, we kill off next by removing it from the
-            // population and putting it into our design buffer.  It also
-            // comes out of pareto so that we don't consider it anymore.
-            if(dist < cutoffDist)
-            {
-                population.Erase(*next);
-
-                // if we are caching, put design in our buffer.  If not,
-                // give it back to the target.
-                if(!this->BufferDesign(*next)) target.TakeDesign(*next);
-                pareto.erase(next++);
-            }
-
-            // otherwise we go onto the next design.
-            else ++next;
+            nearby.clear();
+            kept.GetCandidates(**curr, nearby);
+
+            // Otherwise, we keep it unless the overall distance to some kept
+            // design is too small.
+            keep = true;
+            for(DesignNeighborGrid::DesignVector::const_iterator it(
+                nearby.begin()); keep && it!=nearby.end(); ++it)
+                    keep = !(this->GetNormalizedDistance(
+                        **it, **curr, paretoExtremes
+                        ) < cutoffDist);
         }
+
+        // If we are keeping it, record it and go to the next design.
+        if(keep) { kept.Insert(**curr); ++curr; continue; }
+
+        // If it is too close, we kill off curr by removing it from the
+        // population and putting it into our design buffer.  It also
+        // comes out of pareto so that we don't consider it anymore.
+        population.Erase(*curr);
+
+        // if we are caching, put design in our buffer.  If not,
+        // give it back to the target.
+        if(!this->BufferDesign(*curr)) target.TakeDesign(*curr);
+        pareto.erase(curr++);
     }
 
     JEGALOG_II(this->GetLogger(), lverbose(), this,
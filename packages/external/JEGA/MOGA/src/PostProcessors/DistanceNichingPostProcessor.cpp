@@ -64,6 +64,7 @@ Includes
 #include <../Utilities/include/Logging.hpp>
 #include <../Utilities/include/DesignGroup.hpp>
 #include <utilities/include/EDDY_DebugScope.hpp>
+#include <../Utilities/include/DesignNeighborGrid.hpp>
 #include <../Utilities/include/DesignStatistician.hpp>
 #include <../Utilities/include/ParameterExtractor.hpp>
 #include <../Utilities/include/MultiObjectiveStatistician.hpp>
@@ -416,59 +417,52 @@ DistanceNichingPostProcessor::PostProcess(
     // we will need the target below.
     DesignTarget& target = this->GetDesignTarget();
 
-    // now, we start with the first design and search the range for all
-    // those that are too close.  We never extract an extreme Design.
+    // now, we visit the designs in sorted order and remove each one that is
+    // too close to a design that was visited before it and kept.  The kept
+    // designs are placed in a grid whose cells are as wide as the cutoff
+    // distances so that each design need only be compared with the kept
+    // designs in its own and the adjacent cells.  We never extract an
+    // extreme Design.
+    DesignNeighborGrid kept(dists);
+    DesignNeighborGrid::DesignVector nearby;
 
     // prepare to output the number of designs cut out.
     JEGA_LOGGING_IF_ON(DesignOFSortSet::size_type prevSize = designs.size();)
 
-    // We can bound our search range by noting that once the first objective
-    // distance is too big, we needn't look any further.  That is true because
-    // of the sorting of the DesignOFSortSet.
-    for(DesignOFSortSet::iterator curr(designs.begin());
-        curr!=designs.end(); ++curr)
+    for(DesignOFSortSet::iterator curr(designs.begin()); curr!=designs.end();)
     {
-        // Iterate all designs beyond curr until we are done and see if we keep
-        // or discard them.
-        DesignOFSortSet::iterator next(curr);
-        for(++next; next!=designs.end();)
+        // if curr is an extreme design, we keep it no matter what.
+        bool keep =
+            MultiObjectiveStatistician::IsExtremeDesign(**curr, objExtremes);
+
+        if(!keep)
         {
-            double obj0Dist = ComputeObjectiveDistance(**curr, **next, 0);
-
-            // If the distance at obj0 is large enough, we can get out of this
-            // inner loop and move onto the next "curr".
-            if(obj0Dist > dists.at(0)) break;
-
-            // if next is an extreme design, we keep it no matter what.
-            if(MultiObjectiveStatistician::IsExtremeDesign(
-                **next, objExtremes
-                )){ ++next; continue; }
-
-            // prepare to store whether or not we will be keeping next.
-            bool keep = false;
-
-            // We need to see if the distances are all too small
-            for(size_t of=1; of<nof; ++of)
-                // if the distance at this objective is large enough, we will
-                // be keeping the design so we can continue on our way with
-                // the loop iterating curr.
-                if(ComputeObjectiveDistance(**curr, **next, of) > dists[of])
-                { keep = true; break; }
-
-            // If we are keeping it, we can go to the next design.
-            if(keep) { ++next; continue; }
-
-            // If we make it here, it is too close on all dimensions so we kill
-            // off next by removing it from the group and giving it to the
-            // design target.  It also comes out of designs so that we don't
-            // consider it anymore.
-            group.Erase(*next);
-
-            // if we are caching, put design in our buffer.  If not,
-            // give it back to the target.
-            target.TakeDesign(*next);
-            designs.erase(next++);
+            nearby.clear();
+            kept.GetCandidates(**curr, nearby);
+
+            // We keep curr unless the distances to some kept design are all
+            // too small.
+            keep = true;
+            for(DesignNeighborGrid::DesignVector::const_iterator it(
+                nearby.begin()); keep && it!=nearby.end(); ++it)
+            {
+                keep = false;
+                for(size_t of=0; of<nof; ++of)
+                    if(ComputeObjectiveDistance(**it, **curr, of) > dists[of])
+                    { keep = true; break; }
+            }
         }
+
+        // If we are keeping it, record it and go to the next design.
+        if(keep) { kept.Insert(**curr); ++curr; continue; }
+
+        // If we make it here, it is too close on all dimensions so we kill
+        // off curr by removing it from the group and giving it to the
+        // design target.  It also comes out of designs so that we don't
+        // consider it anymore.
+        group.Erase(*curr);
+        target.TakeDesign(*curr);
+        designs.erase(curr++);
     }
 
     JEGALOG_II(GetLogger(), lverbose(), this,
@@ -0,0 +1,399 @@
+/*
+================================================================================
+    PROJECT:
+
+        John Eddy's Genetic Algorithms (JEGA)
+
+    CONTENTS:
+
+        Definition of class DesignNeighborGrid.
+
+    NOTES:
+
+        See notes under Class Definition section of this file.
+
+    PROGRAMMERS:
+
+        John Eddy (jpeddy@sandia.gov) (JE)
+
+    ORGANIZATION:
+
+        Sandia National Laboratories
+
+    COPYRIGHT:
+
+        See the LICENSE file in the top level JEGA directory.
+
+    VERSION:
+
+        1.0.0
+
+    CHANGES:
+
+        Mon Oct 19 10:02:17 2026 - Original Version
+
+================================================================================
+*/
+
+
+
+
+/*
+================================================================================
+Document This File
+================================================================================
+*/
+/** \file
+ * \brief Contains the definition of the DesignNeighborGrid class.
+ */
+
+
+
+
+/*
+================================================================================
+Prevent Multiple Inclusions
+================================================================================
+*/
+#ifndef JEGA_UTILITIES_DESIGNNEIGHBORGRID_HPP
+#define JEGA_UTILITIES_DESIGNNEIGHBORGRID_HPP
+
+
+
+
+
+
+
+/*
+================================================================================
+Includes
+================================================================================
+*/
+// JEGAConfig.hpp should be the first include in all JEGA files.
+#include <../Utilities/include/JEGAConfig.hpp>
+
+#include <map>
+#include <vector>
+#include <../Utilities/include/JEGATypes.hpp>
+
+
+
+
+
+
+/*
+================================================================================
+Pre-Namespace Forward Declares
+================================================================================
+*/
+
+
+
+
+
+
+
+/*
+================================================================================
+Namespace Aliases
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Begin Namespace
+================================================================================
+*/
+namespace JEGA {
+    namespace Utilities {
+
+
+
+
+
+
+
+/*
+================================================================================
+In-Namespace Forward Declares
+================================================================================
+*/
+class Design;
+class DesignNeighborGrid;
+
+
+
+
+
+
+/*
+================================================================================
+In-Namespace File Scope Typedefs
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Class Definition
+================================================================================
+*/
+
+/**
+ * \brief A uniform grid over objective space used to find the Designs that
+ *        may lie within a fixed distance of a given Design.
+ *
+ * The grid is built from a vector of cell widths, one per objective.  Any
+ * two Designs whose objective values differ by no more than the width in
+ * each gridded objective are guaranteed to lie in the same or in adjacent
+ * cells.  A neighbor query therefore only has to visit the 3^k cells around
+ * the Design of interest where k is the number of gridded objectives.
+ *
+ * Only objectives with a positive width are gridded and at most
+ * MAX_GRID_DIMS of them are used so that the number of visited cells stays
+ * small for problems with many objectives.  The candidates returned by
+ * GetCandidates are a superset of the true neighbors and the caller is
+ * responsible for applying its own exact distance test to them.
+ *
+ * Cells are stored sparsely so the memory required is proportional to the
+ * number of inserted Designs and not to the extent of the objective space.
+ */
+class DesignNeighborGrid
+{
+    /*
+    ============================================================================
+    Class Scope Typedefs
+    ============================================================================
+    */
+    public:
+
+        /// The type of the container of candidates returned by queries.
+        typedef
+        std::vector<const Design*>
+        DesignVector;
+
+    private:
+
+        /// The type used to identify a single cell of the grid.
+        typedef
+        std::vector<long>
+        CellKey;
+
+        /// The type of the sparse map of occupied cells.
+        typedef
+        std::map<CellKey, DesignVector>
+        CellMap;
+
+    /*
+    ============================================================================
+    Class Data Declarations
+    ============================================================================
+    */
+    public:
+
+        /// The largest number of objectives that will be gridded.
+        static const std::size_t MAX_GRID_DIMS;
+
+    /*
+    ============================================================================
+    Member Data Declarations
+    ============================================================================
+    */
+    private:
+
+        /// The indices of the objectives that are gridded.
+        JEGA::SizeTVector _dims;
+
+        /// The cell widths of the gridded objectives.
+        JEGA::DoubleVector _widths;
+
+        /// The objective values of the first inserted Design.
+        /**
+         * Cell coordinates are computed relative to this point to keep
+         * them small and the round off in computing them negligible.
+         */
+        JEGA::DoubleVector _origin;
+
+        /// The occupied cells of this grid.
+        CellMap _cells;
+
+        /// The number of Designs inserted into this grid.
+        std::size_t _size;
+
+    /*
+    ============================================================================
+    Mutators
+    ============================================================================
+    */
+    public:
+
+
+
+
+
+    /*
+    ============================================================================
+    Accessors
+    ============================================================================
+    */
+    public:
+
+        /// Returns the number of Designs in this grid.
+        /**
+         * \return The number of Designs that have been inserted into this
+         *         grid since construction or the last call to Clear.
+         */
+        inline
+        std::size_t
+        GetSize(
+            ) const;
+
+        /// Returns the number of objectives being gridded.
+        /**
+         * \return The number of objectives used to partition the Designs.
+         *         If this is 0, all Designs share a single cell.
+         */
+        inline
+        std::size_t
+        GetNumberOfGriddedDimensions(
+            ) const;
+
+    /*
+    ============================================================================
+    Public Methods
+    ============================================================================
+    */
+    public:
+
+        /// Adds \a des to the cell containing its objective values.
+        /**
+         * \param des The evaluated Design to insert into this grid.
+         */
+        void
+        Insert(
+            const Design& des
+            );
+
+        /// Collects all Designs that may be neighbors of \a des.
+        /**
+         * Every Design in this grid that is within the cell width of \a des
+         * in all gridded objectives is appended to \a into.  Others may be
+         * appended as well.
+         *
+         * \param des The Design whose neighbors are sought.
+         * \param into The container into which to append the candidates.
+         */
+        void
+        GetCandidates(
+            const Design& des,
+            DesignVector& into
+            ) const;
+
+        /// Removes all Designs from this grid.
+        void
+        Clear(
+            );
+
+    /*
+    ============================================================================
+    Subclass Visible Methods
+    ============================================================================
+    */
+    protected:
+
+
+
+    /*
+    ============================================================================
+    Subclass Overridable Methods
+    ============================================================================
+    */
+    public:
+
+
+    protected:
+
+
+    private:
+
+
+    /*
+    ============================================================================
+    Private Methods
+    ============================================================================
+    */
+    private:
+
+        /// Computes the key of the cell in which \a des lies.
+        /**
+         * \param des The Design whose cell is sought.
+         * \param into The key into which to write the cell coordinates.
+         */
+        void
+        ComputeCell(
+            const Design& des,
+            CellKey& into
+            ) const;
+
+    /*
+    ============================================================================
+    Structors
+    ============================================================================
+    */
+    public:
+
+        /// Constructs a DesignNeighborGrid using the supplied cell widths.
+        /**
+         * \param widths The neighborhood size in each objective.  Objectives
+         *               with a width that is not positive are not gridded.
+         */
+        DesignNeighborGrid(
+            const JEGA::DoubleVector& widths
+            );
+
+}; // class DesignNeighborGrid
+
+
+
+/*
+================================================================================
+End Namespace
+================================================================================
+*/
+    } // namespace Utilities
+} // namespace JEGA
+
+
+
+
+
+
+
+/*
+================================================================================
+Include Inlined Methods File
+================================================================================
+*/
+#include "./inline/DesignNeighborGrid.hpp.inl"
+
+
+
+/*
+================================================================================
+End of Multiple Inclusion Check
+================================================================================
+*/
+#endif // JEGA_UTILITIES_DESIGNNEIGHBORGRID_HPP
@@ -376,6 +376,20 @@ class MultiObjectiveStatistician
     private:
 
 
+    /*
+    ============================================================================
+    Nested Utility Class Declarations
+    ============================================================================
+    */
+    private:
+
+        /**
+         * \brief A flat, contiguous copy of the objective values of a set of
+         *        Designs used by the bulk layer and domination count
+         *        computations.
+         */
+        class FlatObjectiveSet;
+
     /*
     ============================================================================
     Member Data Declarations
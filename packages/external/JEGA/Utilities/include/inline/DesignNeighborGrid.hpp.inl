@@ -0,0 +1,178 @@
+/*
+================================================================================
+    PROJECT:
+
+        John Eddy's Genetic Algorithms (JEGA)
+
+    CONTENTS:
+
+        Inline methods of class DesignNeighborGrid.
+
+    NOTES:
+
+        See notes of DesignNeighborGrid.hpp.
+
+    PROGRAMMERS:
+
+        John Eddy (jpeddy@sandia.gov) (JE)
+
+    ORGANIZATION:
+
+        Sandia National Laboratories
+
+    COPYRIGHT:
+
+        See the LICENSE file in the top level JEGA directory.
+
+    VERSION:
+
+        1.0.0
+
+    CHANGES:
+
+        Mon Oct 19 10:02:17 2026 - Original Version
+
+================================================================================
+*/
+
+
+
+
+/*
+================================================================================
+Document This File
+================================================================================
+*/
+/** \file
+ * \brief Contains the inline methods of the DesignNeighborGrid class.
+ */
+
+
+
+
+/*
+================================================================================
+Includes
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Begin Namespace
+================================================================================
+*/
+namespace JEGA {
+    namespace Utilities {
+
+
+
+
+
+/*
+================================================================================
+Inline Mutators
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Accessors
+================================================================================
+*/
+
+inline
+std::size_t
+DesignNeighborGrid::GetSize(
+    ) const
+{
+    return this->_size;
+}
+
+inline
+std::size_t
+DesignNeighborGrid::GetNumberOfGriddedDimensions(
+    ) const
+{
+    return this->_dims.size();
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Public Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Subclass Visible Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Private Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Structors
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+End Namespace
+================================================================================
+*/
+    } // namespace Utilities
+} // namespace JEGA
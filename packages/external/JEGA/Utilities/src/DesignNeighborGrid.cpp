@@ -0,0 +1,346 @@
+/*
+================================================================================
+    PROJECT:
+
+        John Eddy's Genetic Algorithms (JEGA)
+
+    CONTENTS:
+
+        Implementation of class DesignNeighborGrid.
+
+    NOTES:
+
+        See notes of DesignNeighborGrid.hpp.
+
+    PROGRAMMERS:
+
+        John Eddy (jpeddy@sandia.gov) (JE)
+
+    ORGANIZATION:
+
+        Sandia National Laboratories
+
+    COPYRIGHT:
+
+        See the LICENSE file in the top level JEGA directory.
+
+    VERSION:
+
+        1.0.0
+
+    CHANGES:
+
+        Mon Oct 19 10:02:17 2026 - Original Version
+
+================================================================================
+*/
+
+
+
+
+/*
+================================================================================
+Document This File
+================================================================================
+*/
+/** \file
+ * \brief Contains the implementation of the DesignNeighborGrid class.
+ */
+
+
+
+
+/*
+================================================================================
+Includes
+================================================================================
+*/
+// JEGAConfig.hpp should be the first include in all JEGA files.
+#include <../Utilities/include/JEGAConfig.hpp>
+
+#include <limits>
+#include <utilities/include/Math.hpp>
+#include <../Utilities/include/Design.hpp>
+#include <utilities/include/EDDY_DebugScope.hpp>
+#include <../Utilities/include/DesignNeighborGrid.hpp>
+
+
+
+
+
+
+
+/*
+================================================================================
+Namespace Using Directives
+================================================================================
+*/
+using namespace std;
+using namespace JEGA;
+using namespace eddy::utilities;
+
+
+
+
+
+
+
+/*
+================================================================================
+Begin Namespace
+================================================================================
+*/
+namespace JEGA {
+    namespace Utilities {
+
+
+
+
+
+/*
+================================================================================
+Static Member Data Definitions
+================================================================================
+*/
+
+const std::size_t DesignNeighborGrid::MAX_GRID_DIMS = 3;
+
+/**
+ * \brief The relative amount by which the cell widths are enlarged.
+ *
+ * This guarantees that round off in computing cell coordinates cannot put
+ * two Designs that are exactly one width apart into non-adjacent cells.
+ */
+static const double WIDTH_PAD = 1.0e-6;
+
+/**
+ * \brief The largest magnitude allowed for a cell coordinate.
+ *
+ * Coordinates are clamped to this so that the conversion to long is always
+ * well defined.  Clamping only ever merges distant cells which can add
+ * candidates but never lose them.
+ */
+static const double MAX_CELL_COORD = 1.0e9;
+
+
+
+
+
+
+
+/*
+================================================================================
+Mutators
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Accessors
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Public Methods
+================================================================================
+*/
+
+void
+DesignNeighborGrid::Insert(
+    const Design& des
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    // The first Design in sets the origin for all cell coordinates.
+    if(this->_size == 0)
+        for(SizeTVector::size_type i=0; i<this->_dims.size(); ++i)
+            this->_origin[i] = des.GetObjective(this->_dims[i]);
+
+    CellKey key;
+    this->ComputeCell(des, key);
+    this->_cells[key].push_back(&des);
+    ++this->_size;
+}
+
+void
+DesignNeighborGrid::GetCandidates(
+    const Design& des,
+    DesignVector& into
+    ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    if(this->_size == 0) return;
+
+    const CellKey::size_type nDims = this->_dims.size();
+
+    CellKey center;
+    this->ComputeCell(des, center);
+
+    // Visit every combination of offsets in {-1, 0, 1} for each gridded
+    // dimension.  The offsets are advanced like an odometer.
+    std::vector<int> offsets(nDims, -1);
+    CellKey key(center);
+
+    for(;;)
+    {
+        for(CellKey::size_type i=0; i<nDims; ++i)
+            key[i] = center[i] + offsets[i];
+
+        CellMap::const_iterator it(this->_cells.find(key));
+        if(it != this->_cells.end())
+            into.insert(into.end(), it->second.begin(), it->second.end());
+
+        CellKey::size_type d = 0;
+        for(; d<nDims; ++d)
+        {
+            if(offsets[d] < 1) { ++offsets[d]; break; }
+            offsets[d] = -1;
+        }
+
+        // When every offset has rolled over, all cells have been visited.
+        if(d == nDims) break;
+    }
+}
+
+void
+DesignNeighborGrid::Clear(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+    this->_cells.clear();
+    this->_size = 0;
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Subclass Visible Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Subclass Overridable Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Private Methods
+================================================================================
+*/
+
+void
+DesignNeighborGrid::ComputeCell(
+    const Design& des,
+    CellKey& into
+    ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    into.resize(this->_dims.size());
+
+    for(SizeTVector::size_type i=0; i<this->_dims.size(); ++i)
+    {
+        double coord = Math::Floor(
+            (des.GetObjective(this->_dims[i]) - this->_origin[i]) /
+            this->_widths[i]
+            );
+
+        if(coord > MAX_CELL_COORD) coord = MAX_CELL_COORD;
+        else if(coord < -MAX_CELL_COORD) coord = -MAX_CELL_COORD;
+
+        into[i] = static_cast<long>(coord);
+    }
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Structors
+================================================================================
+*/
+
+DesignNeighborGrid::DesignNeighborGrid(
+    const JEGA::DoubleVector& widths
+    ) :
+        _dims(),
+        _widths(),
+        _origin(),
+        _cells(),
+        _size(0)
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    // Grid the first few objectives that have a usable width.  Those with
+    // a zero width can only match identical values and are left to the
+    // caller's exact test.
+    for(DoubleVector::size_type i=0;
+        i<widths.size() && this->_dims.size()<MAX_GRID_DIMS; ++i)
+    {
+        if(!(widths[i] > 0.0) ||
+           widths[i] >= numeric_limits<double>::max()) continue;
+
+        this->_dims.push_back(i);
+        this->_widths.push_back(widths[i] * (1.0 + WIDTH_PAD));
+    }
+
+    this->_origin.assign(this->_dims.size(), 0.0);
+}
+
+
+
+
+
+
+
+/*
+================================================================================
+End Namespace
+================================================================================
+*/
+    } // namespace Utilities
+} // namespace JEGA
@@ -67,6 +67,15 @@ Includes
 #include <../Utilities/include/ObjectiveFunctionInfo.hpp>
 #include <../Utilities/include/MultiObjectiveStatistician.hpp>
 
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#ifdef JEGA_THREADSAFE
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 
 /*
 ================================================================================
@@ -110,6 +119,557 @@ const size_t MultiObjectiveStatistician::MARK = 6;
 
 
 
+/*
+================================================================================
+Nested Utility Class Implementations
+================================================================================
+*/
+/**
+ * The objectives of a set of Designs are copied once, in minimization form,
+ * into a single row-major array (one row of nof values per Design) so that
+ * the domination tests of the bulk computations run over contiguous memory
+ * rather than through the Design and ObjectiveFunctionInfo interfaces.
+ *
+ * Rows keep the order of the DesignOFSortSet they were taken from, which is
+ * lexicographic in the minimization form of the objectives.  In that order a
+ * row can only be dominated by rows ahead of it.  For a set of infeasible
+ * Designs, the rows are additionally (stably) grouped by total percentage
+ * violation since DominationCompare prefers the lesser violation outright
+ * and only compares objectives between equally violated Designs.  So every
+ * row of a group dominates every row of the groups that follow it.
+ *
+ * Layers are assigned by an efficient non-dominated sort (ENS) with a binary
+ * search over the fronts found so far.  With two objectives, only the last
+ * row of each front need be tested, which makes the sort O(N log N).
+ * Domination counts with two objectives are computed by a sweep with a
+ * binary indexed tree over the ranks of the second objective, also
+ * O(N log N).  For more objectives, the counts are computed pairwise over the
+ * flat array and, in thread safe builds, split across threads.
+ */
+class MultiObjectiveStatistician::FlatObjectiveSet
+{
+    /*
+    ============================================================================
+    Class Scope Typedefs
+    ============================================================================
+    */
+    public:
+
+        /// A vector of counts or layers, one per row.
+        typedef
+        std::vector<eddy::utilities::uint64_t>
+        CountVector;
+
+    private:
+
+        /// The arguments passed to each thread of a threaded count.
+        struct CountJob
+        {
+            /// The set whose rows are being counted.
+            const FlatObjectiveSet* _set;
+
+            /// The first row for which this job counts.
+            std::size_t _first;
+
+            /// The distance between successive rows of this job.
+            std::size_t _stride;
+
+            /// The "dominates" counts to fill in or null.
+            CountVector* _dominating;
+
+            /// The "dominated by" counts to fill in or null.
+            CountVector* _dominatedBy;
+
+            /// The count at which to stop counting or -1 for no limit.
+            int _cutoff;
+        };
+
+    /*
+    ============================================================================
+    Member Data Declarations
+    ============================================================================
+    */
+    private:
+
+        /// The number of objectives (the length of each row).
+        std::size_t _nof;
+
+        /// The Designs in the order of the rows of _of.
+        std::vector<Design*> _des;
+
+        /// The objective values in minimization form, one row per Design.
+        std::vector<double> _of;
+
+        /**
+         * \brief The first row of each group of equally violated rows
+         *        followed by the total number of rows.
+         */
+        std::vector<std::size_t> _groups;
+
+    /*
+    ============================================================================
+    Accessors
+    ============================================================================
+    */
+    public:
+
+        /// Returns the number of rows (Designs) in this set.
+        inline
+        std::size_t
+        GetSize(
+            ) const
+        {
+            return this->_des.size();
+        }
+
+        /// Returns the Design whose objectives are in row \a i.
+        inline
+        Design*
+        GetDesign(
+            std::size_t i
+            ) const
+        {
+            return this->_des[i];
+        }
+
+    /*
+    ============================================================================
+    Public Methods
+    ============================================================================
+    */
+    public:
+
+        /// Computes the layer of each row.
+        /**
+         * \param layers The vector to fill with the layer of each row.
+         * \param first The layer value given to the non-dominated rows.
+         * \return The layer value that follows the last layer assigned.
+         */
+        eddy::utilities::uint64_t
+        ComputeLayers(
+            CountVector& layers,
+            eddy::utilities::uint64_t first
+            ) const
+        {
+            EDDY_FUNC_DEBUGSCOPE
+
+            layers.assign(this->GetSize(), 0);
+
+            // Each group is layered on its own starting after the last
+            // layer of the group before it.
+            std::vector<std::vector<std::size_t> > fronts;
+
+            for(std::size_t g=0; g+1<this->_groups.size(); ++g)
+            {
+                const std::size_t b = this->_groups[g];
+                const std::size_t e = this->_groups[g+1];
+
+                fronts.clear();
+
+                for(std::size_t p=b; p<e; ++p)
+                {
+                    // The fronts are ordered such that if front k does not
+                    // dominate p, neither does any later front.  Search for
+                    // the first that does not.
+                    std::size_t lo = 0, hi = fronts.size();
+                    while(lo < hi)
+                    {
+                        const std::size_t mid = (lo + hi) / 2;
+                        if(this->FrontDominates(fronts[mid], p)) lo = mid + 1;
+                        else hi = mid;
+                    }
+
+                    if(lo == fronts.size())
+                        fronts.push_back(std::vector<std::size_t>());
+
+                    fronts[lo].push_back(p);
+                    layers[p] = first + lo;
+                }
+
+                first += fronts.size();
+            }
+
+            return first;
+        }
+
+        /**
+         * \brief Computes the number of rows dominated by each row and/or
+         *        the number of rows that dominate each row.
+         *
+         * \param dominating The vector to fill with the number of rows each
+         *                   row dominates or null to skip that count.
+         * \param dominatedBy The vector to fill with the number of rows that
+         *                    dominate each row or null to skip that count.
+         * \param cutoff The count at which to stop counting or -1 for no
+         *               limit.
+         */
+        void
+        CountDomination(
+            CountVector* dominating,
+            CountVector* dominatedBy,
+            int cutoff
+            ) const
+        {
+            EDDY_FUNC_DEBUGSCOPE
+
+            if(dominating != 0x0) dominating->assign(this->GetSize(), 0);
+            if(dominatedBy != 0x0) dominatedBy->assign(this->GetSize(), 0);
+            if(this->GetSize() == 0) return;
+
+            if(this->_nof == 2)
+            {
+                for(std::size_t g=0; g+1<this->_groups.size(); ++g)
+                    this->SweepCount2(
+                        this->_groups[g], this->_groups[g+1],
+                        dominating, dominatedBy, cutoff
+                        );
+                return;
+            }
+
+            std::size_t nThreads = 1;
+
+#ifdef JEGA_THREADSAFE
+#ifdef _SC_NPROCESSORS_ONLN
+            // Only bother with threads if each has a reasonable share.
+            const long nProcs = sysconf(_SC_NPROCESSORS_ONLN);
+            if(nProcs > 1) nThreads = std::min<std::size_t>(
+                static_cast<std::size_t>(nProcs), this->GetSize() / 512
+                );
+#endif
+            if(nThreads > 1)
+            {
+                std::vector<pthread_t> threads(nThreads);
+                std::vector<CountJob> jobs(nThreads);
+
+                for(std::size_t t=0; t<nThreads; ++t)
+                {
+                    CountJob job = {
+                        this, t, nThreads, dominating, dominatedBy, cutoff
+                        };
+                    jobs[t] = job;
+                    pthread_create(&threads[t], 0x0, &RunCountJob, &jobs[t]);
+                }
+
+                for(std::size_t t=0; t<nThreads; ++t)
+                    pthread_join(threads[t], 0x0);
+
+                return;
+            }
+#endif
+            this->CountRows(0, 1, dominating, dominatedBy, cutoff);
+        }
+
+    /*
+    ============================================================================
+    Private Methods
+    ============================================================================
+    */
+    private:
+
+        /// Returns true if row \a i dominates row \a j.
+        /**
+         * Rows in different violation groups are not compared here.
+         */
+        inline
+        bool
+        Dominates(
+            std::size_t i,
+            std::size_t j
+            ) const
+        {
+            const double* a = &this->_of[i*this->_nof];
+            const double* b = &this->_of[j*this->_nof];
+            bool better = false;
+            for(std::size_t o=0; o<this->_nof; ++o)
+            {
+                if(a[o] > b[o]) return false;
+                if(a[o] < b[o]) better = true;
+            }
+            return better;
+        }
+
+        /// Returns true if rows \a i and \a j have identical objectives.
+        inline
+        bool
+        Identical(
+            std::size_t i,
+            std::size_t j
+            ) const
+        {
+            const double* a = &this->_of[i*this->_nof];
+            const double* b = &this->_of[j*this->_nof];
+            for(std::size_t o=0; o<this->_nof; ++o) if(a[o] != b[o]) return false;
+            return true;
+        }
+
+        /// Returns true if any row of \a front dominates row \a p.
+        /**
+         * The rows of a front are mutually non-dominated and in
+         * lexicographic order.  With two objectives, that means the last row
+         * has the best second objective so only it need be tested.
+         * Otherwise, the rows are tested from last to first since the most
+         * recently added rows are the most similar to \a p.
+         */
+        inline
+        bool
+        FrontDominates(
+            const std::vector<std::size_t>& front,
+            std::size_t p
+            ) const
+        {
+            if(this->_nof == 2) return this->Dominates(front.back(), p);
+
+            for(std::size_t i=front.size(); i>0; --i)
+                if(this->Dominates(front[i-1], p)) return true;
+            return false;
+        }
+
+        /// Returns \a count limited to \a cutoff if \a cutoff is not negative.
+        static inline
+        eddy::utilities::uint64_t
+        Cap(
+            eddy::utilities::uint64_t count,
+            int cutoff
+            )
+        {
+            return (cutoff < 0 ||
+                    count < static_cast<eddy::utilities::uint64_t>(cutoff)) ?
+                count : static_cast<eddy::utilities::uint64_t>(cutoff);
+        }
+
+        /**
+         * \brief Counts domination for the two objective rows in [b, e)
+         *        with a sweep over a binary indexed tree.
+         *
+         * In the forward sweep, every earlier row whose second objective is
+         * no worse dominates the current row unless it is identical to it.
+         * The reverse sweep counts the later rows that are dominated in the
+         * same way.  Identical rows are adjacent in lexicographic order so
+         * they are discounted with a run length.
+         */
+        void
+        SweepCount2(
+            std::size_t b,
+            std::size_t e,
+            CountVector* dominating,
+            CountVector* dominatedBy,
+            int cutoff
+            ) const
+        {
+            EDDY_FUNC_DEBUGSCOPE
+
+            // rank the second objective values of the group.
+            std::vector<double> vals;
+            vals.reserve(e - b);
+            for(std::size_t p=b; p<e; ++p) vals.push_back(this->_of[2*p+1]);
+            std::sort(vals.begin(), vals.end());
+            vals.erase(std::unique(vals.begin(), vals.end()), vals.end());
+            const std::size_t nVals = vals.size();
+
+            std::vector<std::size_t> ranks(e - b);
+            for(std::size_t p=b; p<e; ++p) ranks[p-b] = 1 + (
+                std::lower_bound(vals.begin(), vals.end(), this->_of[2*p+1]) -
+                vals.begin()
+                );
+
+            std::vector<eddy::utilities::uint64_t> tree(nVals + 1);
+
+            if(dominatedBy != 0x0)
+            {
+                // every row of an earlier group dominates this one.
+                const eddy::utilities::uint64_t before = b;
+                eddy::utilities::uint64_t run = 0;
+
+                for(std::size_t p=b; p<e; ++p)
+                {
+                    run = (p > b && this->Identical(p-1, p)) ? run + 1 : 0;
+
+                    eddy::utilities::uint64_t ct = 0;
+                    for(std::size_t r=ranks[p-b]; r>0; r -= (r & (~r + 1)))
+                        ct += tree[r];
+
+                    (*dominatedBy)[p] = Cap(before + ct - run, cutoff);
+
+                    for(std::size_t r=ranks[p-b]; r<=nVals; r += (r & (~r + 1)))
+                        ++tree[r];
+                }
+            }
+
+            if(dominating != 0x0)
+            {
+                // this row dominates every row of a later group.
+                const eddy::utilities::uint64_t after = this->GetSize() - e;
+                eddy::utilities::uint64_t run = 0;
+                tree.assign(nVals + 1, 0);
+
+                for(std::size_t p=e; p>b; --p)
+                {
+                    const std::size_t q = p - 1;
+                    run = (p < e && this->Identical(q, p)) ? run + 1 : 0;
+
+                    // reverse the ranks to count the later rows whose second
+                    // objective is no better.
+                    const std::size_t rr = nVals + 1 - ranks[q-b];
+
+                    eddy::utilities::uint64_t ct = 0;
+                    for(std::size_t r=rr; r>0; r -= (r & (~r + 1))) ct += tree[r];
+
+                    (*dominating)[q] = Cap(after + ct - run, cutoff);
+
+                    for(std::size_t r=rr; r<=nVals; r += (r & (~r + 1)))
+                        ++tree[r];
+                }
+            }
+        }
+
+        /**
+         * \brief Counts domination pairwise for every \a stride'th row
+         *        beginning with \a first.
+         *
+         * Only the rows of the same group are compared.  Rows of other
+         * groups are accounted for by position.
+         */
+        void
+        CountRows(
+            std::size_t first,
+            std::size_t stride,
+            CountVector* dominating,
+            CountVector* dominatedBy,
+            int cutoff
+            ) const
+        {
+            EDDY_FUNC_DEBUGSCOPE
+
+            const std::size_t n = this->GetSize();
+
+            for(std::size_t p=first; p<n; p+=stride)
+            {
+                // find the group of p.
+                const std::size_t g = (std::upper_bound(
+                    this->_groups.begin(), this->_groups.end(), p
+                    ) - this->_groups.begin()) - 1;
+                const std::size_t b = this->_groups[g];
+                const std::size_t e = this->_groups[g+1];
+
+                // only earlier rows can dominate p.
+                if(dominatedBy != 0x0)
+                {
+                    eddy::utilities::uint64_t ct = b;
+                    for(std::size_t q=b; q<p; ++q)
+                    {
+                        if(cutoff >= 0 &&
+                           ct >= static_cast<eddy::utilities::uint64_t>(cutoff))
+                            break;
+                        if(this->Dominates(q, p)) ++ct;
+                    }
+                    (*dominatedBy)[p] = Cap(ct, cutoff);
+                }
+
+                // and p can only dominate later rows.
+                if(dominating != 0x0)
+                {
+                    eddy::utilities::uint64_t ct = n - e;
+                    for(std::size_t q=p+1; q<e; ++q)
+                    {
+                        if(cutoff >= 0 &&
+                           ct >= static_cast<eddy::utilities::uint64_t>(cutoff))
+                            break;
+                        if(this->Dominates(p, q)) ++ct;
+                    }
+                    (*dominating)[p] = Cap(ct, cutoff);
+                }
+            }
+        }
+
+#ifdef JEGA_THREADSAFE
+        /// The main function of each thread of a threaded count.
+        static
+        void*
+        RunCountJob(
+            void* data
+            )
+        {
+            const CountJob* job = static_cast<const CountJob*>(data);
+            job->_set->CountRows(
+                job->_first, job->_stride, job->_dominating,
+                job->_dominatedBy, job->_cutoff
+                );
+            return 0x0;
+        }
+#endif
+
+    /*
+    ============================================================================
+    Structors
+    ============================================================================
+    */
+    public:
+
+        /// Constructs a FlatObjectiveSet holding the Designs of \a from.
+        /**
+         * \param from The Designs whose objectives are to be copied.  These
+         *             must be either all feasible or all infeasible.
+         */
+        FlatObjectiveSet(
+            const DesignOFSortSet& from
+            ) :
+                _nof(from.empty() ? 0 : from.front()->GetNOF())
+        {
+            EDDY_FUNC_DEBUGSCOPE
+
+            this->_des.assign(from.begin(), from.end());
+
+            // the feasible are compared on objectives alone so they make up
+            // a single group.  Otherwise, order by violation, keeping the
+            // lexicographic order within equal violations.
+            std::vector<double> viol(this->_des.size(), 0.0);
+            if(!this->_des.empty() && !this->_des.front()->IsFeasible())
+            {
+                std::vector<std::pair<double, std::size_t> > order;
+                order.reserve(this->_des.size());
+                for(std::size_t i=0; i<this->_des.size(); ++i)
+                    order.push_back(std::make_pair(
+                        DesignStatistician::ComputeTotalPercentageViolation(
+                            *this->_des[i]
+                            ),
+                        i
+                        ));
+                std::sort(order.begin(), order.end());
+
+                std::vector<Design*> sorted(this->_des.size());
+                for(std::size_t i=0; i<order.size(); ++i)
+                {
+                    sorted[i] = this->_des[order[i].second];
+                    viol[i] = order[i].first;
+                }
+                this->_des.swap(sorted);
+            }
+
+            const std::size_t n = this->_des.size();
+            for(std::size_t i=0; i<n; ++i)
+                if(i == 0 || viol[i] != viol[i-1]) this->_groups.push_back(i);
+            this->_groups.push_back(n);
+
+            if(n == 0) return;
+
+            const ObjectiveFunctionInfoVector& infos =
+                this->_des.front()->GetDesignTarget().GetObjectiveFunctionInfos();
+
+            this->_of.resize(n * this->_nof);
+            for(std::size_t i=0; i<n; ++i)
+                for(std::size_t o=0; o<this->_nof; ++o)
+                    this->_of[i*this->_nof+o] =
+                        infos[o]->WhichForMinimization(*this->_des[i]);
+        }
+
+}; // class MultiObjectiveStatistician::FlatObjectiveSet
+
+
+
+
+
+
+
 /*
 ================================================================================
 Mutators
@@ -548,12 +1108,9 @@ MultiObjectiveStatistician::ComputeLayers(
     // if designs is empty, there is nothing to do.
     if(designs.empty()) return DesignCountMap();
 
-    // we will do this by repeatedly separating the non-dominated
-    // designs from a copy of the passed in deque and updating
-    // the returned map.
-
-    // make a temporary copy of the passed in deque that will eventually
-    // contain only the feasible.
+    // The feasible are layered first and the infeasible are layered
+    // beginning after the last feasible layer since any feasible Design
+    // dominates every infeasible one.
     DesignOFSortSet feasible;
     DesignOFSortSet infeasible;
 
@@ -562,37 +1119,22 @@ MultiObjectiveStatistician::ComputeLayers(
 			(*it)->IsFeasible() ?
 			feasible.insert(*it) : infeasible.insert(*it);
 
-    // prepare the layer value to tag Designs with.
-    eddy::utilities::uint64_t layer = 0;
-
     // prepare our return object.
     DesignCountMap ret(designs.size());
 
-    // prepare a pointer to the collection we are currently considering
-    // which will initially be the feasible.
-    DesignOFSortSet* currSet = &feasible;
-
-    // do the following for each collection.
-    for(eddy::utilities::uint64_t ct = 0; ct<2; ++ct)
-    {
-        // while the current deque is not empty,
-        // separate the non-dominated and label them.
-        while(!currSet->empty())
-        {
-            // Separate the non-dominated from temp
-            DesignOFSortSet nonDom(SeparateNonDominated(*currSet));
-
-            // iterate nonDom and insert the layer for each Design.
-            for(DesignOFSortSet::const_iterator it(nonDom.begin());
-                it!=nonDom.end(); ++it) ret.AddValue(*it, layer);
+    // prepare the layer value to tag Designs with.
+    eddy::utilities::uint64_t layer = 0;
+    FlatObjectiveSet::CountVector layers;
 
-            // increment the layer
-            ++layer;
-        }
+    const FlatObjectiveSet flatFeas(feasible);
+    layer = flatFeas.ComputeLayers(layers, layer);
+    for(size_t i=0; i<flatFeas.GetSize(); ++i)
+        ret.AddValue(flatFeas.GetDesign(i), layers[i]);
 
-        // now change to doing the infeasible
-        currSet = &infeasible;
-    }
+    const FlatObjectiveSet flatInfeas(infeasible);
+    flatInfeas.ComputeLayers(layers, layer);
+    for(size_t i=0; i<flatInfeas.GetSize(); ++i)
+        ret.AddValue(flatInfeas.GetDesign(i), layers[i]);
 
     return ret;
 
@@ -651,14 +1193,16 @@ MultiObjectiveStatistician::ComputeDominatedByCounts(
     DesignCountMap ret(designs.size());
     ret.SuspendStatistics();
 
+    FlatObjectiveSet::CountVector counts;
+
     // if the feasible set is empty, skip it.
     if(!feasible.empty())
     {
         // now add in the count of dominating designs to each.
-        for(DesignOFSortSet::const_iterator iit(feasible.begin());
-            iit!=feasible.end(); ++iit) ret.AddToValue(
-                *iit, CountNumDominating(**iit, feasible, iit, cutoff)
-                );
+        const FlatObjectiveSet flat(feasible);
+        flat.CountDomination(0x0, &counts, cutoff);
+        for(size_t i=0; i<flat.GetSize(); ++i)
+            ret.AddToValue(flat.GetDesign(i), counts[i]);
     }
 
     // prepare to now do the infeasible.  if there are none, skip it.
@@ -667,12 +1211,10 @@ MultiObjectiveStatistician::ComputeDominatedByCounts(
         // The initial penalty is the number of feasible.  Feasible always
         // dominate infeasible.
         // Add in the count of dominating designs to each.
-        for(DesignOFSortSet::const_iterator iit(infeasible.begin());
-            iit!=infeasible.end(); ++iit) ret.AddToValue(
-                *iit,
-                feasible.size() +
-                CountNumDominating(**iit, infeasible, iit, cutoff)
-                );
+        const FlatObjectiveSet flat(infeasible);
+        flat.CountDomination(0x0, &counts, cutoff);
+        for(size_t i=0; i<flat.GetSize(); ++i)
+            ret.AddToValue(flat.GetDesign(i), feasible.size() + counts[i]);
     }
 
     ret.ResumeStatistics(true);
@@ -704,36 +1246,28 @@ MultiObjectiveStatistician::ComputeDominatingCounts(
     DesignCountMap ret(designs.size());
     ret.SuspendStatistics();
 
+    FlatObjectiveSet::CountVector counts;
+
     // if the current set is empty, skip it.
     if(!feasible.empty())
     {
         // Prepare to reward the feasible with the number of infeasible.
         const DesignOFSortSet::size_type reward = infeasible.size();
 
-        // prepare to iterate the current set.
-        const DesignOFSortSet::const_iterator e(feasible.end());
-
-        // now add in the count of dominating designs to each.
-        for(DesignOFSortSet::const_iterator iit(feasible.begin());
-            iit!=e; ++iit) ret.AddToValue(
-                *iit, reward + CountNumDominatedBy(
-                    **iit, feasible, iit, false, cutoff
-                    )
-                );
+        // now add in the count of dominated designs to each.
+        const FlatObjectiveSet flat(feasible);
+        flat.CountDomination(&counts, 0x0, cutoff);
+        for(size_t i=0; i<flat.GetSize(); ++i)
+            ret.AddToValue(flat.GetDesign(i), reward + counts[i]);
     }
 
     if(!infeasible.empty())
     {
-        // prepare to iterate the infeasible.
-        const DesignOFSortSet::const_iterator e(infeasible.end());
-
-        // now add in the count of dominating designs to each.
-        for(DesignOFSortSet::const_iterator iit(infeasible.begin());
-            iit!=e; ++iit) ret.AddToValue(
-                *iit, CountNumDominatedBy(
-                    **iit, infeasible, iit, true, cutoff
-                    )
-                );
+        // now add in the count of dominated designs to each.
+        const FlatObjectiveSet flat(infeasible);
+        flat.CountDomination(&counts, 0x0, cutoff);
+        for(size_t i=0; i<flat.GetSize(); ++i)
+            ret.AddToValue(flat.GetDesign(i), counts[i]);
     }
 
     ret.ResumeStatistics(true);
@@ -762,75 +1296,42 @@ MultiObjectiveStatistician::ComputeDominationCounts(
     // Prepare our return object containing our counts.
     DesignDoubleCountMap ret(designs.size());
 
-    // Get the objective function info's for repeated use.
-    const ObjectiveFunctionInfoVector& infos =
-        designs.front()->GetDesignTarget().GetObjectiveFunctionInfos();
+    FlatObjectiveSet::CountVector domCounts;
+    FlatObjectiveSet::CountVector domByCounts;
 
     if(!feasible.empty())
     {
-        // prepare to iterate the current set.
-        const DesignOFSortSet::const_iterator e(feasible.end());
-
         // for each design, see who dominates it and who it dominates.
-        for(DesignOFSortSet::const_iterator iit(feasible.begin());
-            iit!=e; ++iit)
-        {
-            DesignDoubleCountMap::value_type numIDom = infeasible.size();
-
-            DesignOFSortSet::const_iterator jit(iit);
-            for(++jit; jit!=e; ++jit)
-            {
-                // Remember that j cannot dominate i b/c we are in the feasible
-                // set and the designs are ordered.
-                int domResult = DominationCompare(**iit, **jit, infos);
-                EDDY_ASSERT(domResult < 1);
+        // Each feasible Design also dominates all the infeasible.
+        const FlatObjectiveSet flat(feasible);
+        flat.CountDomination(&domCounts, &domByCounts, -1);
 
-                // if iit dominates, increment its domct and jits dombyct.
-                if(domResult == -1)
-                {
-                    ++numIDom;
-                    ret.AddToSecondValue(*jit, 1);
-                }
-            }
+        for(size_t i=0; i<flat.GetSize(); ++i)
+        {
+            DesignDoubleCountMap::value_type numIDom =
+                infeasible.size() + domCounts[i];
 
-            if(numIDom > 0) ret.AddToFirstValue(*iit, numIDom);
+            if(numIDom > 0) ret.AddToFirstValue(flat.GetDesign(i), numIDom);
+            if(domByCounts[i] > 0)
+                ret.AddToSecondValue(flat.GetDesign(i), domByCounts[i]);
         }
     }
 
     if(!infeasible.empty())
     {
-        const DesignOFSortSet::size_type penalty = feasible.size();
-
-        // prepare to iterate the current set.
-        const DesignOFSortSet::const_iterator e(infeasible.end());
-
         // for each design, see who dominates it and who it dominates.
-        for(DesignOFSortSet::const_iterator iit(infeasible.begin());
-            iit!=e; ++iit)
-        {
-            DesignDoubleCountMap::value_type numIDom = 0;
-            DesignDoubleCountMap::value_type numIDomBy = feasible.size();
+        // Each infeasible Design is also dominated by all the feasible.
+        const FlatObjectiveSet flat(infeasible);
+        flat.CountDomination(&domCounts, &domByCounts, -1);
 
-            DesignOFSortSet::const_iterator jit(iit);
-            for(++jit; jit!=e; ++jit)
-            {
-                int domResult = DominationCompare(**iit, **jit, infos);
-
-                // if iit dominates, increment its domct and jits dombyct.
-                if(domResult == -1)
-                {
-                    ++numIDom;
-                    ret.AddToSecondValue(*jit, 1);
-                }
-                else if(domResult == 1)
-                {
-                    ret.AddToFirstValue(*jit, 1);
-                    ++numIDomBy;
-                }
-            }
+        for(size_t i=0; i<flat.GetSize(); ++i)
+        {
+            DesignDoubleCountMap::value_type numIDomBy =
+                feasible.size() + domByCounts[i];
 
-            if(numIDom > 0) ret.AddToFirstValue(*iit, numIDom);
-            if(numIDomBy > 0) ret.AddToSecondValue(*iit, numIDomBy);
+            if(domCounts[i] > 0)
+                ret.AddToFirstValue(flat.GetDesign(i), domCounts[i]);
+            if(numIDomBy > 0) ret.AddToSecondValue(flat.GetDesign(i), numIDomBy);
         }
     }
 
@@ -500,6 +500,63 @@ class JEGA_SL_IEDECL GeneticAlgorithmEvaluator :
             JEGA::Utilities::Design& des
             ) = 0;
 
+        /**
+         * \brief Starts the evaluation of \a des without waiting for it to
+         *        complete if the evaluator supports that.
+         *
+         * This is used by main loops that keep evaluations in flight across
+         * generations.  Upon return, \a des is either evaluated (or marked
+         * illconditioned) or its evaluation is outstanding and will be
+         * completed by a later call to CollectEvaluations.
+         *
+         * The default implementation copies responses from an evaluated clone
+         * if possible and otherwise evaluates \a des synchronously using the
+         * overload of Evaluate taking a Design.  If the maximum number of
+         * evaluations has been reached, \a des is marked evaluated and
+         * illconditioned instead.
+         *
+         * \param des The Design object whose evaluation is to be started.
+         * \return False if an error occurred and \a des has been marked
+         *         illconditioned and true otherwise.
+         */
+        virtual
+        bool
+        BeginEvaluation(
+            JEGA::Utilities::Design& des
+            );
+
+        /**
+         * \brief Completes any outstanding evaluations started by
+         *        BeginEvaluation that have finished.
+         *
+         * Each completed Design is marked evaluated and post-evaluated.  The
+         * default implementation does nothing since the default
+         * BeginEvaluation never leaves an evaluation outstanding.
+         *
+         * \param wait True if this method should block until at least one
+         *             outstanding evaluation completes (if any are
+         *             outstanding) and false if it should return immediately.
+         * \return The number of evaluations completed by this call.
+         */
+        virtual
+        std::size_t
+        CollectEvaluations(
+            bool wait
+            );
+
+        /**
+         * \brief Returns the number of evaluations started by BeginEvaluation
+         *        that have not yet been collected.
+         *
+         * The default implementation always returns 0.
+         *
+         * \return The number of outstanding evaluations.
+         */
+        virtual
+        std::size_t
+        GetNumberPendingEvaluations(
+            ) const;
+
         /// Retrieves specific parameters using Get...FromDB methods.
         /**
          * This method is used to extract needed information for this
@@ -0,0 +1,496 @@
+/*
+================================================================================
+    PROJECT:
+
+        John Eddy's Genetic Algorithms (JEGA)
+
+    CONTENTS:
+
+        Definition of class SteadyStateMainLoop.
+
+    NOTES:
+
+        See notes under section "Class Definition" of this file.
+
+    PROGRAMMERS:
+
+        John Eddy (jpeddy@sandia.gov) (JE)
+
+    ORGANIZATION:
+
+        Sandia National Laboratories
+
+    COPYRIGHT:
+
+        See the LICENSE file in the top level JEGA directory.
+
+    VERSION:
+
+        1.0.0
+
+    CHANGES:
+
+        Mon Oct 19 09:12:44 2026 - Original Version
+
+================================================================================
+*/
+
+
+
+
+/*
+================================================================================
+Document This File
+================================================================================
+*/
+/** \file
+ * \brief Contains the definition of the SteadyStateMainLoop class.
+ */
+
+
+
+
+
+/*
+================================================================================
+Prevent Multiple Inclusions
+================================================================================
+*/
+#ifndef JEGA_ALGORITHMS_STEADYSTATEMAINLOOP_HPP
+#define JEGA_ALGORITHMS_STEADYSTATEMAINLOOP_HPP
+
+
+
+
+
+
+
+/*
+================================================================================
+Includes
+================================================================================
+*/
+// JEGAConfig.hpp should be the first include in all JEGA files.
+#include <../Utilities/include/JEGAConfig.hpp>
+
+#include <GeneticAlgorithmMainLoop.hpp>
+#include <../Utilities/include/DesignGroup.hpp>
+
+
+
+
+
+
+
+/*
+================================================================================
+Pre-Namespace Forward Declares
+================================================================================
+*/
+
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Namespace Aliases
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Begin Namespace
+================================================================================
+*/
+namespace JEGA {
+    namespace Algorithms {
+
+
+
+
+
+
+
+
+/*
+================================================================================
+In-Namespace Forward Declares
+================================================================================
+*/
+class SteadyStateMainLoop;
+
+
+
+
+
+
+
+/*
+================================================================================
+Class Definition
+================================================================================
+*/
+
+/// Keeps evaluations in flight across generations.
+/**
+ * This main loop operator is a steady state variant of the
+ * DuplicateRemovingMainLoop.  Instead of evaluating all offspring of a
+ * generation and waiting for the last of them to complete before selection,
+ * offspring evaluations are started through
+ * GeneticAlgorithmEvaluator::BeginEvaluation and the designs wait in a
+ * pending group.  Each trip through the loop collects whichever evaluations
+ * have completed and subjects only those designs to fitness assessment and
+ * selection along with the current population.  New offspring are only
+ * generated while fewer than the evaluation window of evaluations are
+ * outstanding.
+ *
+ * When the evaluator does not support asynchronous evaluation, every design
+ * completes immediately and this loop behaves like the
+ * DuplicateRemovingMainLoop.
+ *
+ * The evaluation window is extracted using the parameter name
+ * "method.jega.evaluation_window".  It is a size_t parameter.  A value of 0
+ * (the default) means that the window is the size of the population.
+ */
+class SteadyStateMainLoop :
+    public GeneticAlgorithmMainLoop
+{
+    /*
+    ============================================================================
+    Member Data Declarations
+    ============================================================================
+    */
+    private:
+
+        /// The designs whose evaluations have been started but not completed.
+        JEGA::Utilities::DesignGroup _pending;
+
+        /**
+         * \brief The maximum number of outstanding evaluations before new
+         *        offspring are no longer generated.
+         *
+         * A value of 0 means to use the size of the population.
+         */
+        std::size_t _evalWindow;
+
+
+
+
+
+    /*
+    ============================================================================
+    Mutators
+    ============================================================================
+    */
+    public:
+
+        /**
+         * \brief Sets the maximum number of outstanding evaluations before new
+         *        offspring are no longer generated.
+         *
+         * \param window The new evaluation window.  0 means to use the size
+         *               of the population.
+         */
+        void
+        SetEvaluationWindow(
+            std::size_t window
+            );
+
+
+
+
+
+    /*
+    ============================================================================
+    Accessors
+    ============================================================================
+    */
+    public:
+
+        /**
+         * \brief Gets the maximum number of outstanding evaluations before new
+         *        offspring are no longer generated.
+         *
+         * \return The evaluation window.  0 means the size of the population.
+         */
+        inline
+        std::size_t
+        GetEvaluationWindow(
+            ) const;
+
+
+
+
+
+    /*
+    ============================================================================
+    Public Methods
+    ============================================================================
+    */
+    public:
+
+        /// Returns the proper name of this operator.
+        /**
+         * \return The string "steady_state".
+         */
+        static
+        const std::string&
+        Name(
+            );
+
+        /// Returns a full description of what this operator does and how.
+        /**
+         * The returned text is:
+         * \verbatim
+            This main loop operator is a steady state variant of the
+            duplicate_free main loop.  Offspring evaluations are started
+            without waiting for them to complete and each generation
+            assesses fitness and performs selection using only the offspring
+            whose evaluations have completed.  New offspring are generated
+            only while fewer than the evaluation window of evaluations are
+            outstanding.  The window defaults to the population size.
+           \endverbatim.
+         *
+         * \return A description of the operation of this operator.
+         */
+        static
+        const std::string&
+        Description(
+            );
+
+        /**
+         * \brief Returns a new instance of this operator class for use by
+         *        \a algorithm.
+         *
+         * \param algorithm The GA for which the new main loop is to be used.
+         * \return A new, default instance of a SteadyStateMainLoop.
+         */
+        static
+        GeneticAlgorithmOperator*
+        Create(
+            GeneticAlgorithm& algorithm
+            );
+
+
+
+    /*
+    ============================================================================
+    Subclass Visible Methods
+    ============================================================================
+    */
+    protected:
+
+
+
+
+
+    /*
+    ============================================================================
+    Subclass Overridable Methods
+    ============================================================================
+    */
+    public:
+
+        /// Performs one trip through the main loop.
+        /**
+         * The operations are executed in the order described in the
+         * documetation of this class.
+         *
+         * \return True if this loop wishes to be called again and false
+         *         otherwise which means that convergence has occurred.
+         */
+        virtual
+        bool
+        RunGeneration(
+            );
+
+        /// Returns the proper name of this operator.
+        /**
+         * \return See Name().
+         */
+        virtual
+        std::string
+        GetName(
+            ) const;
+
+        /// Returns a full description of what this operator does and how.
+        /**
+         * \return See Description().
+         */
+        virtual
+        std::string
+        GetDescription(
+            ) const;
+
+        /**
+         * \brief Creates and returns a pointer to an exact duplicate of this
+         *        operator.
+         *
+         * \param algorithm The GA for which the clone is being created.
+         * \return A clone of this operator.
+         */
+        virtual
+        GeneticAlgorithmOperator*
+        Clone(
+            GeneticAlgorithm& algorithm
+            ) const;
+
+        /// Retrieves specific parameters using Get...FromDB methods.
+        /**
+         * This method is used to extract needed information for this
+         * operator.  It does so using the "Get...FromDB" class
+         * of methods from the GeneticAlgorithmOperator base class.
+         *
+         * This version retrieves the evaluation window.
+         *
+         * \param db The database of parameters from which the configuration
+         *           information can be retrieved.
+         * \return true if the extraction completed successfully and false
+         *         otherwise.
+         */
+        virtual
+        bool
+        PollForParameters(
+            const JEGA::Utilities::ParameterDatabase& db
+            );
+
+        /// Completes all outstanding evaluations.
+        /**
+         * The completed designs are sent to the target where they remain
+         * candidates for the final optimal set.
+         *
+         * \return true if finalization completed successfully and false
+         *         otherwise.
+         */
+        virtual
+        bool
+        Finalize(
+            );
+
+    protected:
+
+
+    private:
+
+
+
+
+
+    /*
+    ============================================================================
+    Private Methods
+    ============================================================================
+    */
+    private:
+
+        /**
+         * \brief Starts the evaluation of each offspring design and moves
+         *        those that are outstanding into the pending group.
+         *
+         * \return The number of designs moved into the pending group.
+         */
+        std::size_t
+        StartOffspringEvaluations(
+            );
+
+        /**
+         * \brief Moves the pending designs whose evaluations have completed
+         *        into the offspring group.
+         *
+         * \return The number of designs moved into the offspring group.
+         */
+        std::size_t
+        ReclaimCompletedEvaluations(
+            );
+
+
+
+
+
+    /*
+    ============================================================================
+    Structors
+    ============================================================================
+    */
+    public:
+
+
+        /// Constructs an SteadyStateMainLoop for use by \a algorithm.
+        /**
+         * \param algorithm The GA for which this main loop is
+         *                  being constructed.
+         */
+        SteadyStateMainLoop(
+            GeneticAlgorithm& algorithm
+            );
+
+        /// Copy constructs an SteadyStateMainLoop.
+        /**
+         * \param copy The instance from which properties should be copied into
+         *             this.
+         */
+        SteadyStateMainLoop(
+            const SteadyStateMainLoop& copy
+            );
+
+        /**
+         * \brief Copy constructs an SteadyStateMainLoop for use by
+         *        \a algorithm.
+         *
+         * \param copy The instance from which properties should be copied into
+         *             this.
+         * \param algorithm The GA for which this main loop is
+         *                  being constructed.
+         */
+        SteadyStateMainLoop(
+            const SteadyStateMainLoop& copy,
+            GeneticAlgorithm& algorithm
+            );
+
+
+
+}; // class SteadyStateMainLoop
+
+
+/*
+================================================================================
+End Namespace
+================================================================================
+*/
+    } // namespace Algorithms
+} // namespace JEGA
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Include Inlined Methods File
+================================================================================
+*/
+#include "./inline/SteadyStateMainLoop.hpp.inl"
+
+
+
+/*
+================================================================================
+End of Multiple Inclusion Check
+================================================================================
+*/
+#endif // JEGA_ALGORITHMS_STEADYSTATEMAINLOOP_HPP
@@ -0,0 +1,172 @@
+/*
+================================================================================
+    PROJECT:
+
+        John Eddy's Genetic Algorithms (JEGA)
+
+    CONTENTS:
+
+        Inline methods of class SteadyStateMainLoop.
+
+    NOTES:
+
+        See notes of SteadyStateMainLoop.hpp.
+
+    PROGRAMMERS:
+
+        John Eddy (jpeddy@sandia.gov) (JE)
+
+    ORGANIZATION:
+
+        Sandia National Laboratories
+
+    COPYRIGHT:
+
+        See the LICENSE file in the top level JEGA directory.
+
+    VERSION:
+
+        1.0.0
+
+    CHANGES:
+
+        Mon Oct 19 09:12:44 2026 - Original Version
+
+================================================================================
+*/
+
+
+
+
+/*
+================================================================================
+Document This File
+================================================================================
+*/
+/** \file
+ * \brief Contains the inline methods of the SteadyStateMainLoop class.
+ */
+
+
+
+/*
+================================================================================
+Includes
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Begin Namespace
+================================================================================
+*/
+namespace JEGA {
+    namespace Algorithms {
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Mutators
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Accessors
+================================================================================
+*/
+
+inline
+std::size_t
+SteadyStateMainLoop::GetEvaluationWindow(
+    ) const
+{
+    return this->_evalWindow;
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Public Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Subclass Visible Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Private Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Inline Structors
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+End Namespace
+================================================================================
+*/
+    } // namespace Algorithms
+} // namespace JEGA
@@ -870,6 +870,45 @@ GeneticAlgorithmEvaluator::PollForParameters(
     return true;
 }
 
+bool
+GeneticAlgorithmEvaluator::BeginEvaluation(
+    Design& des
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    if(des.IsEvaluated() || ResolveClone(des)) return !des.IsIllconditioned();
+
+    // evaluations that are outstanding will count against the maximum once
+    // they are collected so they must be considered here.
+    if(this->GetNumberEvaluations() + this->GetNumberPendingEvaluations() >=
+       this->GetMaxEvaluations())
+    {
+        des.SetEvaluated(true);
+        des.SetIllconditioned(true);
+        return false;
+    }
+
+    return this->Evaluate(des);
+}
+
+std::size_t
+GeneticAlgorithmEvaluator::CollectEvaluations(
+    bool
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+    return 0;
+}
+
+std::size_t
+GeneticAlgorithmEvaluator::GetNumberPendingEvaluations(
+    ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+    return 0;
+}
+
 string
 GeneticAlgorithmEvaluator::GetType(
     ) const
@@ -0,0 +1,642 @@
+/*
+================================================================================
+    PROJECT:
+
+        John Eddy's Genetic Algorithms (JEGA)
+
+    CONTENTS:
+
+        Implementation of class SteadyStateMainLoop.
+
+    NOTES:
+
+        See notes of SteadyStateMainLoop.hpp.
+
+    PROGRAMMERS:
+
+        John Eddy (jpeddy@sandia.gov) (JE)
+
+    ORGANIZATION:
+
+        Sandia National Laboratories
+
+    COPYRIGHT:
+
+        See the LICENSE file in the top level JEGA directory.
+
+    VERSION:
+
+        1.0.0
+
+    CHANGES:
+
+        Mon Oct 19 09:12:44 2026 - Original Version
+
+================================================================================
+*/
+
+
+
+
+/*
+================================================================================
+Document This File
+================================================================================
+*/
+/** \file
+ * \brief Contains the implementation of the SteadyStateMainLoop class.
+ */
+
+
+/*
+================================================================================
+Includes
+================================================================================
+*/
+// JEGAConfig.hpp should be the first include in all JEGA files.
+#include <../Utilities/include/JEGAConfig.hpp>
+
+#include <FitnessRecord.hpp>
+#include <GeneticAlgorithm.hpp>
+#include <GeneticAlgorithmCrosser.hpp>
+#include <GeneticAlgorithmEvaluator.hpp>
+#include <GeneticAlgorithmMutator.hpp>
+#include <GeneticAlgorithmNichePressureApplicator.hpp>
+#include <../Utilities/include/Logging.hpp>
+#include <../Utilities/include/ParameterExtractor.hpp>
+#include <utilities/include/EDDY_DebugScope.hpp>
+#include <MainLoops/SteadyStateMainLoop.hpp>
+
+
+
+
+/*
+================================================================================
+Namespace Using Directives
+================================================================================
+*/
+using namespace std;
+using namespace JEGA::Logging;
+using namespace JEGA::Utilities;
+
+
+
+
+
+
+
+/*
+================================================================================
+Begin Namespace
+================================================================================
+*/
+namespace JEGA {
+    namespace Algorithms {
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Static Member Data Definitions
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Mutators
+================================================================================
+*/
+
+void
+SteadyStateMainLoop::SetEvaluationWindow(
+    std::size_t window
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    this->_evalWindow = window;
+
+    JEGALOG_II(this->GetLogger(), lverbose(), this,
+        ostream_entry(lverbose(),
+            this->GetName() + ": Evaluation window now = "
+            ) << this->_evalWindow
+        )
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Accessors
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Public Methods
+================================================================================
+*/
+
+const string&
+SteadyStateMainLoop::Name(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+    static const string ret("steady_state");
+    return ret;
+}
+
+const string&
+SteadyStateMainLoop::Description(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    static const string ret(
+        "This main loop operator is a steady state variant of the "
+        "duplicate_free main loop.  Offspring evaluations are started "
+        "without waiting for them to complete and each generation "
+        "assesses fitness and performs selection using only the offspring "
+        "whose evaluations have completed.  New offspring are generated "
+        "only while fewer than the evaluation window of evaluations are "
+        "outstanding.  The window defaults to the population size."
+        );
+    return ret;
+}
+
+GeneticAlgorithmOperator*
+SteadyStateMainLoop::Create(
+    GeneticAlgorithm& algorithm
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+    return new SteadyStateMainLoop(algorithm);
+}
+
+
+
+
+
+
+
+/*
+================================================================================
+Subclass Visible Methods
+================================================================================
+*/
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Subclass Overridable Methods
+================================================================================
+*/
+
+string
+SteadyStateMainLoop::GetName(
+    ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+    return SteadyStateMainLoop::Name();
+}
+
+string
+SteadyStateMainLoop::GetDescription(
+    ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+    return SteadyStateMainLoop::Description();
+}
+
+GeneticAlgorithmOperator*
+SteadyStateMainLoop::Clone(
+  GeneticAlgorithm& algorithm
+  ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+    return new SteadyStateMainLoop(*this, algorithm);
+}
+
+bool
+SteadyStateMainLoop::PollForParameters(
+    const JEGA::Utilities::ParameterDatabase& db
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    bool success = ParameterExtractor::GetSizeTypeFromDB(
+        db, "method.jega.evaluation_window", this->_evalWindow
+        );
+
+    JEGAIFLOG_CF_II(!success, this->GetLogger(), lverbose(), this,
+        ostream_entry(lverbose(), this->GetName() + ": The evaluation window "
+            "was not found in the parameter database.  Using the current "
+            "value of ") << this->_evalWindow
+        )
+
+    this->SetEvaluationWindow(this->_evalWindow);
+
+    return this->GeneticAlgorithmMainLoop::PollForParameters(db);
+}
+
+bool
+SteadyStateMainLoop::Finalize(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    GeneticAlgorithmEvaluator& evaler =
+        this->GetAlgorithm().GetOperatorSet().GetEvaluator();
+
+    // wait on every outstanding evaluation.  Stop if the evaluator cannot
+    // make progress so that a misbehaving evaluator cannot hang us here.
+    while(evaler.GetNumberPendingEvaluations() > 0)
+        if(evaler.CollectEvaluations(true) == 0) break;
+
+    JEGAIFLOG_CF_II(!this->_pending.IsEmpty(), this->GetLogger(), lverbose(),
+        this,
+        ostream_entry(lverbose(), this->GetName() + ": returning ")
+            << this->_pending.GetSize() << " designs with outstanding "
+               "evaluations at finalization to the target."
+        )
+
+    // completed designs go to the target where they are still candidates
+    // for the final solution set.
+    this->_pending.FlushAll();
+
+    return this->GeneticAlgorithmMainLoop::Finalize();
+}
+
+bool
+SteadyStateMainLoop::RunGeneration(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    // store a reference to the algorithm for repeated use.
+    GeneticAlgorithm& algorithm = this->GetAlgorithm();
+    const GeneticAlgorithm& constAlg = algorithm;
+
+    // store a reference to the population and the offspring
+    DesignGroup& pop = algorithm.GetPopulation();
+    DesignGroup& cldrn = algorithm.GetOffspring();
+
+    // On the first run, the population must be tested.
+    // After that it should be safe at this point.
+    if(algorithm.GetGenerationNumber() == 0)
+    {
+        JEGA_LOGGING_IF_ON(DesignDVSortSet::size_type nrem =)
+            pop.FlushNonUnique();
+
+        JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+            ostream_entry(
+                lverbose(), this->GetName() + ": encountered and flushed "
+                ) << nrem << " non-unique designs from the initial population."
+            )
+    }
+
+    // Don't bother creating new designs from the initial population.  First
+    // apply some selection pressure and then start performing variation.  This
+    // is sensible especially if the initial population is randomly generated.
+    // if that is the case, then performing the following would result in
+    // creating more essentially random designs.  If it is warm started, then
+    // the rationale is similar.  If they are good designs, then most of them
+    // will survive selection.  If not, then they shouldn't have been explored
+    // further anyway.
+    else
+    {
+        // at this point, if there were fitnesses on record, they are no longer
+        // valid.
+        algorithm.SetCurrentFitnesses(0x0);
+
+        // Offspring left over from the last selection are not reconsidered.
+        cldrn.FlushAll();
+
+        const std::size_t window = (this->_evalWindow == 0) ?
+            pop.GetSize() : this->_evalWindow;
+
+        // Only generate new offspring if there is room in the window.
+        // Otherwise, this generation is spent waiting on outstanding
+        // evaluations.
+        if(this->_pending.GetSize() < window)
+        {
+            // Do Crossover
+            algorithm.DoCrossover();
+
+            // Do Mutation
+            algorithm.DoMutation();
+
+            if(constAlg.GetMutator().CanProduceInvalidVariableValues() ||
+               constAlg.GetCrosser().CanProduceInvalidVariableValues())
+            {
+                // at this point, we should verify the variable values of
+                // the generated Designs
+                const size_t numIll = algorithm.ValidateVariableValues(cldrn);
+
+                // ValidateVariableValues may mark Designs illconditioned if
+                // it cannot fix the variable values so we should flush any of
+                // those.
+                if(numIll > 0)
+                {
+                    this->GetAlgorithm().LogIllconditionedDesigns(cldrn);
+
+                    JEGA_LOGGING_IF_ON(DesignDVSortSet::size_type nrem =)
+                        cldrn.FlushIllconditionedDesigns();
+
+                    JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lquiet(),
+                        this,
+                        ostream_entry(lquiet(), this->GetName() + ": flushed ")
+                            << nrem << " designs whose variables could not be "
+                               "corrected."
+                            )
+                }
+            }
+
+            // Flush clones out of the children list and then any children
+            // that duplicate population members, designs whose evaluations
+            // are outstanding, or discarded designs.
+            DesignDVSortSet::size_type nrem = cldrn.FlushNonUnique();
+
+            JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+                ostream_entry(lverbose(), this->GetName() + ": flushed ")
+                    << nrem << " duplicate offspring designs after application "
+                       "of the variational operators."
+                    )
+
+            nrem = pop.GetDVSortContainer().test_for_clones(
+                cldrn.GetDVSortContainer()
+                );
+
+            if(nrem > 0) nrem = cldrn.FlushCloneDesigns();
+
+            JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+                ostream_entry(lverbose(), this->GetName() + ": flushed ")
+                    << nrem << " offspring designs that duplicate existing "
+                       "population members."
+                    )
+
+            nrem = this->_pending.GetDVSortContainer().test_for_clones(
+                cldrn.GetDVSortContainer()
+                );
+
+            if(nrem > 0) nrem = cldrn.FlushCloneDesigns();
+
+            JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+                ostream_entry(lverbose(), this->GetName() + ": flushed ")
+                    << nrem << " offspring designs that duplicate designs "
+                       "whose evaluations are outstanding."
+                    )
+
+            const DesignDVSortSet& discards =
+                this->GetDesignTarget().CheckoutDiscards();
+            nrem = discards.test_for_clones(cldrn.GetDVSortContainer());
+            this->GetDesignTarget().CheckinDiscards();
+
+            if(nrem > 0) nrem = cldrn.FlushCloneDesigns();
+
+            nrem = this->GetAlgorithm().GetOperatorSet(
+                ).GetNichePressureApplicator().TestBufferForClones(
+                    cldrn.GetDVSortContainer()
+                    );
+
+            if(nrem > 0) nrem = cldrn.FlushCloneDesigns();
+
+            JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+                ostream_entry(lverbose(), this->GetName() + ": flushed ")
+                    << nrem << " offspring designs that duplicate discarded "
+                       "designs from previous generations."
+                    )
+
+            // start the evaluations of the children.  Those that do not
+            // complete immediately move into the pending group.
+            JEGA_LOGGING_IF_ON(nrem =) this->StartOffspringEvaluations();
+
+            JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+                ostream_entry(lverbose(), this->GetName() + ": started ")
+                    << nrem << " offspring evaluations that are now "
+                       "outstanding."
+                    )
+        }
+
+        // collect whatever has completed.  If nothing is available for
+        // selection, wait for at least one evaluation to finish.
+        algorithm.GetOperatorSet().GetEvaluator().CollectEvaluations(
+            cldrn.IsEmpty()
+            );
+        this->ReclaimCompletedEvaluations();
+
+        // any children that could not be evaluated (are illconditioned) must
+        // be removed.  Issue a log entry about any removed.
+        this->GetAlgorithm().LogIllconditionedDesigns(cldrn);
+
+        JEGA_LOGGING_IF_ON(DesignDVSortSet::size_type nrem =)
+            cldrn.FlushIllconditionedDesigns();
+
+        JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lquiet(), this,
+            ostream_entry(
+            lquiet(), this->GetName() + ": encountered and flushed "
+            )
+                << nrem
+                << " illconditioned designs after evaluation of children."
+                )
+    }
+
+    // now merge in any designs injected via the evaluator.  They get merged
+    // into the children and must already be evaluated.
+    algorithm.AbsorbEvaluatorInjections(false);
+
+    // now perform the pre-selection operation whereby any of the
+    // selection operators that need it get an opportunity to prepare.
+    algorithm.DoPreSelection();
+
+    // assess the fitness of the current designs.
+    const FitnessRecord* fits(algorithm.DoFitnessAssessment());
+    algorithm.SetCurrentFitnesses(fits);
+
+    // do not alter the groups after fitness assessment.  This could cause the
+    // fitness statistics to become invalidated and selection to fail.
+
+    // Do selection of next population.
+    algorithm.DoSelection(*fits);
+
+    // flush non-unique designs.
+    JEGA_LOGGING_IF_ON(DesignDVSortSet::size_type nrem =)
+        pop.FlushNonUnique();
+
+    JEGAIFLOG_CF_II(nrem > 0, this->GetLogger(), lverbose(), this,
+        ostream_entry(lverbose(), this->GetName() + ": flushed ") << nrem
+            << " duplicates found in the population after selection.  "
+               "This must be caused by use of a selector that does not "
+               "respect the duplicate free requirement or a niche pressure "
+               "applicator whose pre-selection operation doesn't."
+            )
+
+    // in debug mode, assert that the duplicate removal stuff worked
+    EDDY_ASSERT(pop.GetDVSortContainer().count_non_unique() == 0);
+
+    // Do secondary selection by niche pressure of next population.
+    algorithm.ApplyNichePressure(pop, *fits);
+
+    // increment the generation number.
+    this->IncCurrentGeneration();
+
+    // if converged, set to the complete state.
+    const bool ret = !algorithm.TestForConvergence(*fits);
+
+    this->PostLoopReport();
+
+    // return whether or not we converged.
+    return ret;
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Private Methods
+================================================================================
+*/
+
+std::size_t
+SteadyStateMainLoop::StartOffspringEvaluations(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    GeneticAlgorithm& algorithm = this->GetAlgorithm();
+    GeneticAlgorithmEvaluator& evaler =
+        algorithm.GetOperatorSet().GetEvaluator();
+    DesignGroup& cldrn = algorithm.GetOffspring();
+
+    for(DesignDVSortSet::iterator it(cldrn.BeginDV()); it!=cldrn.EndDV(); ++it)
+        evaler.BeginEvaluation(**it);
+
+    // Unevaluated Designs are never in the objective sort so erasing them
+    // does not depend on it.  Those that did complete are added to it below.
+    std::size_t nmoved = 0;
+    for(DesignDVSortSet::iterator it(cldrn.BeginDV()); it!=cldrn.EndDV();)
+    {
+        if((*it)->IsEvaluated()) { ++it; continue; }
+        this->_pending.Insert(*it);
+        it = cldrn.EraseRetDV(it);
+        ++nmoved;
+    }
+
+    cldrn.SynchronizeOFAndDVContainers();
+    return nmoved;
+}
+
+std::size_t
+SteadyStateMainLoop::ReclaimCompletedEvaluations(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    DesignGroup& cldrn = this->GetAlgorithm().GetOffspring();
+
+    std::size_t nmoved = 0;
+    for(DesignDVSortSet::iterator it(this->_pending.BeginDV());
+        it!=this->_pending.EndDV();)
+    {
+        if(!(*it)->IsEvaluated()) { ++it; continue; }
+        cldrn.Insert(*it);
+        it = this->_pending.EraseRetDV(it);
+        ++nmoved;
+    }
+
+    return nmoved;
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+Structors
+================================================================================
+*/
+
+SteadyStateMainLoop::SteadyStateMainLoop(
+    GeneticAlgorithm& algorithm
+    ) :
+        GeneticAlgorithmMainLoop(algorithm),
+        _pending(this->GetDesignTarget()),
+        _evalWindow(0)
+{
+    EDDY_FUNC_DEBUGSCOPE
+}
+
+SteadyStateMainLoop::SteadyStateMainLoop(
+    const SteadyStateMainLoop& copy
+    ) :
+        GeneticAlgorithmMainLoop(copy),
+        _pending(this->GetDesignTarget()),
+        _evalWindow(copy._evalWindow)
+{
+    EDDY_FUNC_DEBUGSCOPE
+}
+
+SteadyStateMainLoop::SteadyStateMainLoop(
+    const SteadyStateMainLoop& copy,
+    GeneticAlgorithm& algorithm
+    ) :
+        GeneticAlgorithmMainLoop(copy, algorithm),
+        _pending(this->GetDesignTarget()),
+        _evalWindow(copy._evalWindow)
+{
+    EDDY_FUNC_DEBUGSCOPE
+}
+
+
+
+
+
+
+
+
+/*
+================================================================================
+End Namespace
+================================================================================
+*/
+    } // namespace Algorithms
+} // namespace JEGA
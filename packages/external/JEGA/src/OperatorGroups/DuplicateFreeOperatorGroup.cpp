@@ -64,6 +64,7 @@ Includes
 #include <OperatorGroups/NullOperatorGroup.hpp>
 #include <utilities/include/EDDY_DebugScope.hpp>
 #include <MainLoops/DuplicateRemovingMainLoop.hpp>
+#include <MainLoops/SteadyStateMainLoop.hpp>
 #include <Mutators/LocalDesignVariableMutator.hpp>
 #include <OperatorGroups/StandardOperatorGroup.hpp>
 #include <Initializers/RandomUniqueInitializer.hpp>
@@ -266,6 +267,9 @@ DuplicateFreeOperatorGroup::AcquireOperators(
         // Register the DuplicateRemovingMainLoop
         DO_REGISTER(MainLoopRegistry, DuplicateRemovingMainLoop);
 
+        // Register the SteadyStateMainLoop
+        DO_REGISTER(MainLoopRegistry, SteadyStateMainLoop);
+
         // Register all the Mutators
         DO_REGISTER(MutatorRegistry, LocalDesignVariableMutator);
         DO_REGISTER(MutatorRegistry, RandomDesignVariableMutator);
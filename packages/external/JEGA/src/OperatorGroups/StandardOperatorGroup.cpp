@@ -87,6 +87,7 @@ Includes
 
 #include <MainLoops/StandardMainLoop.hpp>
 #include <MainLoops/DuplicateRemovingMainLoop.hpp>
+#include <MainLoops/SteadyStateMainLoop.hpp>
 
 #include <Selectors/ElitistSelector.hpp>
 #include <Selectors/BelowLimitSelector.hpp>
@@ -292,6 +293,7 @@ StandardOperatorGroup::AcquireOperators(
         // Register all the MainLoops
         DO_REGISTER(MainLoopRegistry, StandardMainLoop);
         DO_REGISTER(MainLoopRegistry, DuplicateRemovingMainLoop);
+        DO_REGISTER(MainLoopRegistry, SteadyStateMainLoop);
 
         // Register all the Mutators
         DO_REGISTER(MutatorRegistry, LocalDesignVariableMutator);
@@ -47,6 +47,18 @@ enum	{ANN_IN=0, ANN_OUT=1};	// shrinking indices
 								// what to do in case of error
 enum ANNerr {ANNwarn = 0, ANNabort = 1};
 
+//----------------------------------------------------------------------
+//	Search state
+//	The globals shared by the recursive search procedures are
+//	thread local, so that different threads may search the same
+//	(unmodified) tree concurrently.
+//----------------------------------------------------------------------
+#if defined(_MSC_VER)
+  #define ANN_THREAD_LOCAL __declspec(thread)
+#else
+  #define ANN_THREAD_LOCAL __thread
+#endif
+
 //----------------------------------------------------------------------
 //	Maximum number of points to visit
 //	We have an option for terminating the search early if the
@@ -56,7 +68,7 @@ enum ANNerr {ANNwarn = 0, ANNabort = 1};
 //----------------------------------------------------------------------
 
 extern int		ANNmaxPtsVisited;	// maximum number of pts visited
-extern int		ANNptsVisited;		// number of pts visited in search
+extern ANN_THREAD_LOCAL int ANNptsVisited; // number of pts visited in search
 
 //----------------------------------------------------------------------
 //	Global function declarations
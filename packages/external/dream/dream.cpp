@@ -345,12 +345,16 @@ void chain_init ( int chain_num, double fit[], int gen_num, int par_num,
       z[p+c*par_num+0*par_num*chain_num] = zp[p];
     }
 
-    fit[c+0*chain_num] = sample_likelihood ( par_num, zp );
-
     // BMA, 20150430: changed to match malloc
     //delete [] zp;
     free(zp);
   }
+//
+//  The initial points of all chains are stored consecutively in the first
+//  generation of Z, so their likelihoods are computed as a single batch.
+//
+  sample_likelihood_batch ( chain_num, par_num, z, fit );
+
   return;
 }
 //****************************************************************************80
@@ -1154,6 +1158,7 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
   double *cr_dis;
   int cr_index;
   double *cr_prob;
+  int *cr_index_gen;
   int *cr_ups;
   int gen_index;
   int i;
@@ -1162,11 +1167,14 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
   double pd1;
   double pd2;
   double r;
+  double *r_gen;
   double *zp;
   int zp_accept;
   double zp_accept_rate;
   int zp_count;
   double zp_fit;
+  double *zp_fit_gen;
+  double *zp_gen;
   double *zp_old;
   double zp_old_fit;
   double zp_ratio;
@@ -1183,6 +1191,17 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
   cr_ups = new int[cr_num];
 
   cr_init ( cr, cr_dis, cr_num, cr_prob, cr_ups );
+//
+//  The candidates of a generation depend only on the previous generation,
+//  so they are all generated before their likelihoods are computed as a
+//  single batch.  The acceptance draw of each chain is taken right after
+//  its candidate, so that the random number sequence, and hence the
+//  chains for a given seed, are those of the chain-by-chain loop.
+//
+  cr_index_gen = new int[chain_num];
+  zp_gen = new double[par_num*chain_num];
+  zp_fit_gen = new double[chain_num];
+  r_gen = new double[chain_num];
 
   for ( gen_index = 1; gen_index < gen_num; gen_index++ )
   {
@@ -1191,19 +1210,35 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
 //
 //  Choose CR_INDEX, the index of a CR.
 //
-      cr_index = cr_index_choose ( cr_num, cr_prob );
+      cr_index_gen[chain_index] = cr_index_choose ( cr_num, cr_prob );
 //
 //  Generate a sample candidate ZP.
 //
-      zp = sample_candidate ( chain_index, chain_num, cr, cr_index, cr_num, 
-        gen_index, gen_num, jumprate_table, jumpstep, limits, pair_num, 
-        par_num, z );
+      zp = sample_candidate ( chain_index, chain_num, cr, 
+        cr_index_gen[chain_index], cr_num, gen_index, gen_num, 
+        jumprate_table, jumpstep, limits, pair_num, par_num, z );
+
+      for ( i = 0; i < par_num; i++ )
+      {
+        zp_gen[i+chain_index*par_num] = zp[i];
+      }
 
       zp_count = zp_count + 1;
+
+      delete [] zp;
+
+      r_gen[chain_index] = r8_uniform_01_sample ( );
+    }
 //
-//  Compute the log likelihood function for ZP.
+//  Compute the log likelihood function for all candidates.
 //
-      zp_fit = sample_likelihood ( par_num, zp );
+    sample_likelihood_batch ( chain_num, par_num, zp_gen, zp_fit_gen );
+
+    for ( chain_index = 0; chain_index < chain_num; chain_index++ )
+    {
+      cr_index = cr_index_gen[chain_index];
+      zp = zp_gen + chain_index * par_num;
+      zp_fit = zp_fit_gen[chain_index];
 
       for ( i = 0; i < par_num; i++ )
       {
@@ -1226,7 +1261,7 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
 //
 //  Accept the candidate, or copy the value from the previous generation.
 //
-      r = r8_uniform_01_sample ( );
+      r = r_gen[chain_index];
 
       if ( r <= zp_ratio )
       {
@@ -1256,8 +1291,6 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
             cr_num, cr_ups, gen_index, gen_num, par_num, z );
         }
       }
-
-      delete [] zp;
     }
 //
 //  Update the multinomial distribution of CR.
@@ -1304,7 +1337,11 @@ void dream_algm ( int chain_num, int cr_num, double fit[], int gen_num,
   delete [] cr;
   delete [] cr_dis;
   delete [] cr_prob;
+  delete [] cr_index_gen;
   delete [] cr_ups;
+  delete [] r_gen;
+  delete [] zp_fit_gen;
+  delete [] zp_gen;
   delete [] zp_old;
 
   return;
@@ -12,6 +12,10 @@ void problem_value ( string *chain_filename, string *gr_filename,
 double prior_density ( int par_num, double zp[] );
 double *prior_sample ( int par_num );
 double sample_likelihood ( int par_num, double zp[] );
+/// Batched likelihood for the SAMPLE_NUM points stored consecutively
+/// in ZP[PAR_NUM*SAMPLE_NUM], written to FIT[SAMPLE_NUM]
+void sample_likelihood_batch ( int sample_num, int par_num, double zp[],
+  double fit[] );
 
 }
 
@@ -117,6 +117,44 @@ void SurfpackInterface::Save(const SurfData* data, const std::string& filename)
   data->write(filename);
 }
 
+/// Load a model from an open stream, e.g., one embedded in a larger file
+SurfpackModel* SurfpackInterface::LoadModel(std::istream& is, bool binary)
+{
+  SurfpackModel* model = NULL;
+#ifdef SURFPACK_HAVE_BOOST_SERIALIZATION
+  if (binary) {
+    boost::archive::binary_iarchive input_archive(is);
+    input_archive >> model;
+  }
+  else {
+    boost::archive::text_iarchive input_archive(is);
+    input_archive >> model;
+  }
+#else
+  throw string("surface load requires compilation with Boost serialization.");
+#endif
+  return model;
+}
+
+/// Save a model to an open stream, e.g., one embedded in a larger file
+void SurfpackInterface::Save(const SurfpackModel* model, std::ostream& os,
+			     bool binary)
+{
+#ifdef SURFPACK_HAVE_BOOST_SERIALIZATION
+  if (binary) {
+    boost::archive::binary_oarchive output_archive(os);
+    output_archive << model;
+  }
+  else {
+    boost::archive::text_oarchive output_archive(os);
+    output_archive << model;
+  }
+#else
+  throw 
+    string("surface save requires compilation with Boost serialization.");
+#endif
+}
+
 SurfpackModel* SurfpackInterface::CreateSurface(const SurfData* sd, ParamMap& args)
 {
   assert(sd);
@@ -22,6 +22,8 @@ namespace SurfpackInterface
   SurfpackModel* LoadModel(const std::string& filename);
   void Save(const SurfpackModel* model, const std::string& filename);
   void Save(const SurfData* data, const std::string& filename);
+  SurfpackModel* LoadModel(std::istream& is, bool binary);
+  void Save(const SurfpackModel* model, std::ostream& os, bool binary);
   SurfpackModel* CreateSurface(const SurfData* sd, ParamMap& args);
   void Evaluate(const SurfpackModel* model, SurfData* sd, 
     const std::string& response_name = "");
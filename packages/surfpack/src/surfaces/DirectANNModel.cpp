@@ -4,6 +4,7 @@
 #include "surfpack.h"
 #include "ModelScaler.h"
 #include "least_squares_omp.h"
+#include "surfpack_LAPACK_wrappers.h"
 
 using std::cout;
 using std::endl;
@@ -37,6 +38,34 @@ double DirectANNBasisSet::eval(unsigned index, const VecDbl& x) const
   return tanh(nodeSum(index,x));
 }
 
+/** One GEMM forms the node sums for every point, then tanh is applied
+    in a single sweep over the contiguous (column-major) result. */
+void DirectANNBasisSet::eval(const MtxDbl& aug_points, MtxDbl& basis_vals) const
+{
+  assert(aug_points.getNCols() == weights.getNCols());
+  unsigned num_pts = aug_points.getNRows();
+  unsigned num_nodes = weights.getNRows();
+  basis_vals.reshape(num_pts, num_nodes+1);
+  if (num_pts == 0)
+    return;
+
+  char transa = 'N', transb = 'T';
+  int m = static_cast<int>(num_pts);
+  int n = static_cast<int>(num_nodes);
+  int k = static_cast<int>(weights.getNCols());
+  int lda = m, ldb = n, ldc = m;
+  double alpha = 1.0, beta = 0.0;
+  DGEMM_F77(&transa, &transb, &m, &n, &k, &alpha, &aug_points(0,0), &lda,
+	    &weights(0,0), &ldb, &beta, &basis_vals(0,0), &ldc);
+
+  double* node_vals = &basis_vals(0,0);
+  unsigned num_vals = num_pts*num_nodes;
+  for (unsigned i = 0; i < num_vals; i++)
+    node_vals[i] = tanh(node_vals[i]);
+  for (unsigned p = 0; p < num_pts; p++)
+    basis_vals(p,num_nodes) = 1.0; // for hidden layer bias
+}
+
 double DirectANNBasisSet::deriv(unsigned index, const VecDbl& x, const VecUns& vars) const
 {
   assert(vars.size() == 1);
@@ -73,6 +102,43 @@ double DirectANNModel::evaluate(const VecDbl& x) const
   return tanh(sum);
 }
 
+/** Points are processed in blocks of at most block_size so the hidden
+    layer work matrix stays cache-sized; within a block the hidden layer
+    is one GEMM (DirectANNBasisSet::eval) and the output layer one GEMV. */
+VecDbl DirectANNModel::operator()(const SurfData& data) const
+{
+  assert(coeffs.size() == bs.weights.getNRows() + 1);
+  const unsigned block_size = 256;
+  unsigned num_pts = data.size();
+  unsigned num_vars = bs.weights.getNCols() - 1;
+  VecDbl result(num_pts);
+
+  MtxDbl aug_points, basis_vals;
+  for (unsigned start = 0; start < num_pts; start += block_size) {
+    unsigned block_pts = std::min(block_size, num_pts - start);
+    aug_points.reshape(block_pts, num_vars+1);
+    for (unsigned p = 0; p < block_pts; p++) {
+      const VecDbl& x = mScaler->scale(data(start+p));
+      assert(x.size() == num_vars);
+      for (unsigned v = 0; v < num_vars; v++)
+	aug_points(p,v) = x[v];
+      aug_points(p,num_vars) = 1.0; // for input layer bias
+    }
+    bs.eval(aug_points, basis_vals);
+
+    char trans = 'N';
+    int m = static_cast<int>(block_pts);
+    int n = static_cast<int>(coeffs.size());
+    int inc = 1;
+    double alpha = 1.0, beta = 0.0;
+    DGEMV_F77(&trans, &m, &n, &alpha, &basis_vals(0,0), &m, &coeffs[0], &inc,
+	      &beta, &result[start], &inc);
+    for (unsigned p = start; p < start + block_pts; p++)
+      result[p] = mScaler->descale(tanh(result[p]));
+  }
+  return result;
+}
+
 VecDbl DirectANNModel::gradient(const VecDbl& x) const
 {
   assert(!x.empty());
@@ -226,18 +292,21 @@ SurfpackModel* DirectANNModelFactory::Create(const SurfData& sd)
   MtxDbl random_weights = randomMatrix(nodes,ssd.xSize()+1);
   DirectANNBasisSet bs(random_weights);
 
-  // Solve linear system to compute weights for second layer
-  MtxDbl A(ssd.size(),nodes+1,true);
+  // Solve linear system to compute weights for second layer; the
+  // design matrix [ tanh( [ X | 1 ] [ A0 | theta0 ]^T ) | 1 ] is formed
+  // with a single matrix product over the scaled build points
+  MtxDbl aug_points(ssd.size(),ssd.xSize()+1,true);
   VecDbl b(ssd.size(),0.0);
   for (unsigned samp = 0; samp < ssd.size(); samp++) {
-    for (unsigned n = 0; n < nodes; n++) { 
-      A(samp,n) = bs.eval(n,ssd(samp));
-      //cout << "A(" << samp << "," << n << "): " << A(samp,n) << endl;
-    }
-    A(samp,nodes) = 1.0; // for hidden layer bias
+    const VecDbl& x = ssd(samp);
+    for (unsigned v = 0; v < ssd.xSize(); v++)
+      aug_points(samp,v) = x[v];
+    aug_points(samp,ssd.xSize()) = 1.0; // for input layer bias
     b[samp] = surfpack::atanh(ssd.getResponse(samp));
       //cout << "b(" << samp <<  "): " << b[samp] << endl;
   }
+  MtxDbl A(ssd.size(),nodes+1,true);
+  bs.eval(aug_points, A);
   VecDbl x;
   //cout << "Ready to solve" << endl;
   //cout << "ssd size: " << ssd.size() << " nodes: " << nodes << " rows: " << A.getNRows() << "  cols: " << A.getNCols() << endl;
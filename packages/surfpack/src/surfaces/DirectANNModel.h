@@ -38,6 +38,10 @@ public:
   /// compute the contribution due to the index-th basis function at the point x
   double nodeSum(unsigned index, const VecDbl& x) const;
 
+  /// evaluate all basis functions at each row of the augmented points
+  /// [ X | 1 ]; basis_vals is reshaped to [ tanh( [ X | 1 ] [ A0 | theta0 ]^T ) | 1 ]
+  void eval(const MtxDbl& aug_points, MtxDbl& basis_vals) const;
+
   /// write the basis set as a string
   std::string asString() const;
 
@@ -63,6 +67,10 @@ class DirectANNModel : public SurfpackModel
 public:
 
   DirectANNModel(const DirectANNBasisSet& bs_in, const VecDbl& coeffs_in);
+  using SurfpackModel::operator();
+  /// evaluate the model at every point in data, blocking the points so
+  /// each layer is a single matrix product
+  virtual VecDbl operator()(const SurfData& data) const;
   virtual VecDbl gradient(const VecDbl& x) const;
   virtual std::string asString() const;
 
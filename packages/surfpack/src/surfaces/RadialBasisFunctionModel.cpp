@@ -59,22 +59,54 @@ unsigned findClosest(const SurfData& sd, VecDbl pt)
   return argmin;
 }
 
+/// Per-dimension distance from each generator to its nearest neighbor in
+/// that coordinate.  Sorting each coordinate makes this O(n log n): the
+/// nearest neighbor in one dimension is adjacent in sorted order.
 SurfData radii(const SurfData& generators)
 {
+  unsigned npts = generators.size();
+  unsigned ndims = generators.xSize();
+  std::vector<VecDbl> radius(npts,
+    VecDbl(ndims,std::numeric_limits<double>::max()));
+  std::vector<std::pair<double,unsigned> > coord(npts);
+  for (unsigned dim = 0; dim < ndims; dim++) {
+    for (unsigned i = 0; i < npts; i++)
+      coord[i] = std::make_pair(generators(i,dim),i);
+    std::sort(coord.begin(),coord.end());
+    for (unsigned k = 1; k < npts; k++) {
+      double distance = coord[k].first - coord[k-1].first;
+      double& r_hi = radius[coord[k].second][dim];
+      double& r_lo = radius[coord[k-1].second][dim];
+      if (distance < r_hi) r_hi = distance;
+      if (distance < r_lo) r_lo = distance;
+    }
+  }
   SurfData result;
+  for (unsigned i = 0; i < npts; i++)
+    result.addPoint(SurfPoint(radius[i]));
+  return result;
+}
+
+/// Bases for compact support with isotropic inverse squared length
+/// scales: each generator's length scale is twice the Euclidean distance
+/// to its nearest neighboring generator, so supports track center density
+VecRbf makeLocalRbfs(const SurfData& generators)
+{
+  assert(generators.size());
+  RbfSpatialIndex index;
+  index.build(generators);
+  VecRbf rbfs;
   for (unsigned i = 0; i < generators.size(); i++) {
-    VecDbl radius(generators.xSize(),std::numeric_limits<double>::max());
-    for (unsigned j = 0; j < generators.size(); j++) {
-      if (i != j) {
-        for (unsigned dim = 0; dim < generators.xSize(); dim++) {
-          double distance = fabs(generators(i,dim)-generators(j,dim));
-          if (distance < radius[dim]) radius[dim] = distance;
-        }
-      }
+    double dist_sq = std::numeric_limits<double>::max();
+    if (generators.size() > 1) {
+      unsigned j = index.nearest(generators(i),i);
+      double dist = surfpack::euclideanDistance(generators(i),generators(j));
+      dist_sq = max(dist*dist,std::numeric_limits<double>::min());
     }
-    result.addPoint(SurfPoint(radius));
+    rbfs.push_back(RadialBasisFunction(generators(i),
+				       VecDbl(generators.xSize(),0.25/dist_sq)));
   }
-  return result;
+  return rbfs;
 }
 
 SurfData cvts(const AxesBounds& ab, unsigned ngenerators, unsigned ninfluencers,
@@ -83,11 +115,13 @@ SurfData cvts(const AxesBounds& ab, unsigned ngenerators, unsigned ninfluencers,
   assert(ninfluencers > ngenerators);
   SurfData* generators = ab.sampleMonteCarlo(ngenerators);
   unsigned iters = 10;
+  RbfSpatialIndex generator_index;
   for (unsigned i = 0; i < iters; i++) {
     SurfData* influencers = ab.sampleMonteCarlo(ninfluencers);
     vector<SurfData> closestSets(ngenerators);
+    generator_index.build(*generators);
     for (unsigned samp = 0; samp < influencers->size(); samp++) {
-      unsigned nearest = findClosest(*generators,(*influencers)(samp));
+      unsigned nearest = generator_index.nearest((*influencers)(samp));
       closestSets[nearest].addPoint((*influencers)[samp]);
     } // for each sample pt
     // Find centroids, update generators
@@ -161,6 +195,31 @@ MtxDbl getMatrix(const SurfData& sd, const VecRbf& candidates, VecUns used)
   return A;
 }
 
+/// Sparse assembly for compactly supported candidates: only the bases
+/// whose support contains a build point contribute to its row
+MtxDbl getMatrix(const SurfData& sd, const VecRbf& candidates, VecUns used,
+		 const RbfSpatialIndex& index, double cutoff)
+{
+  std::sort(used.begin(),used.end());
+  MtxDbl A(sd.size(),used.size(),true);
+  // map candidate index to column of A (ncols if not used)
+  unsigned ncols = used.size();
+  VecUns column(candidates.size(),ncols);
+  for (unsigned cola = 0; cola < ncols; cola++) {
+    assert(used[cola] < candidates.size());
+    column[used[cola]] = cola;
+  }
+  VecUns hits;
+  for (unsigned rowa = 0; rowa < sd.size(); rowa++) {
+    hits.clear();
+    index.contains(sd(rowa),hits);
+    for (unsigned h = 0; h < hits.size(); h++)
+      if (column[hits[h]] < ncols)
+	A(rowa,column[hits[h]]) = candidates[hits[h]](sd(rowa),cutoff);
+  }
+  return A;
+}
+
 VecUns probInclusion(unsigned vec_size, unsigned max_size, double prob)
 {
   assert(prob >= 0.0);
@@ -246,6 +305,53 @@ double RadialBasisFunction::deriv(const VecDbl& x, const VecUns& vars) const
   return -2.0*radius[i]*(x[i]-center[i])*(*this)(x);
 }
 
+double RadialBasisFunction::operator()(const VecDbl& x, double cutoff) const
+{
+  assert(x.size() == center.size());
+  if (cutoff <= 0.0) return (*this)(x);
+  double sum = 0.0;
+  double temp;
+  for (unsigned i = 0; i < center.size(); i++) {
+    temp = x[i] - center[i];
+    sum += temp*temp*radius[i];
+  }
+  if (sum >= cutoff) return 0.0;
+  double floor = exp(-cutoff);
+  return (exp(-sum) - floor)/(1.0 - floor);
+}
+
+double RadialBasisFunction::deriv(const VecDbl& x, const VecUns& vars,
+				  double cutoff) const
+{
+  assert(vars.size() == 1);
+  assert(x.size() == center.size());
+  if (cutoff <= 0.0) return deriv(x,vars);
+  double sum = 0.0;
+  double temp;
+  for (unsigned i = 0; i < center.size(); i++) {
+    temp = x[i] - center[i];
+    sum += temp*temp*radius[i];
+  }
+  if (sum >= cutoff) return 0.0;
+  unsigned i = vars[0];
+  return -2.0*radius[i]*(x[i]-center[i])*exp(-sum)/(1.0 - exp(-cutoff));
+}
+
+void RadialBasisFunction::supportBox(double cutoff, VecDbl& lower,
+				     VecDbl& upper) const
+{
+  assert(cutoff > 0.0);
+  lower.resize(center.size());
+  upper.resize(center.size());
+  for (unsigned i = 0; i < center.size(); i++) {
+    // radius is an inverse squared length scale; zero means no decay
+    double half_width = (radius[i] > 0.0) ? sqrt(cutoff/radius[i]) :
+      std::numeric_limits<double>::max();
+    lower[i] = center[i] - half_width;
+    upper[i] = center[i] + half_width;
+  }
+}
+
 std::string RadialBasisFunction::asString() const
 {
   std::ostringstream os;
@@ -258,18 +364,35 @@ std::string RadialBasisFunction::asString() const
 }
 
 
-RadialBasisFunctionModel::RadialBasisFunctionModel(const VecRbf& rbfs_in, const VecDbl& coeffs_in)
-  : SurfpackModel(1), rbfs(rbfs_in),coeffs(coeffs_in)
+RadialBasisFunctionModel::RadialBasisFunctionModel(const VecRbf& rbfs_in, const VecDbl& coeffs_in, double support_cutoff)
+  : SurfpackModel(1), rbfs(rbfs_in),coeffs(coeffs_in),
+    supportCutoff(support_cutoff)
 {
   assert(!rbfs.empty());
   this->ndims = rbfs[0].center.size();
   assert(this->size() != 0);
   assert(rbfs.size() == coeffs.size()); 
+  if (supportCutoff > 0.0) buildSupportIndex();
+}
+
+void RadialBasisFunctionModel::buildSupportIndex() const
+{
+  supportIndex.build(rbfs,supportCutoff);
 }
 
 double RadialBasisFunctionModel::evaluate(const VecDbl& x) const
 {
   double sum = 0.0;
+  if (supportCutoff > 0.0) {
+    // only the bases whose support contains x contribute
+    if (supportIndex.empty()) buildSupportIndex();
+    VecUns hits;
+    supportIndex.contains(x,hits);
+    for (unsigned h = 0; h < hits.size(); h++) {
+      sum += coeffs[hits[h]]*rbfs[hits[h]](x,supportCutoff);
+    }
+    return sum;
+  }
   for (unsigned i = 0; i < rbfs.size(); i++) {
     sum += coeffs[i]*rbfs[i](x);
   }
@@ -285,6 +408,19 @@ VecDbl RadialBasisFunctionModel::gradient(const VecDbl& x) const
   //assert(coeffs.size() == bs.bases.size());
   VecUns diff_var(1,0); // variable with which to differentiate
   VecDbl result(x.size(),0.0);
+  if (supportCutoff > 0.0) {
+    if (supportIndex.empty()) buildSupportIndex();
+    VecUns hits;
+    supportIndex.contains(x,hits);
+    for (unsigned i = 0; i < x.size(); i++) {
+      diff_var[0] = i;
+      for (unsigned h = 0; h < hits.size(); h++) {
+	result[i] += 
+	  coeffs[hits[h]]*rbfs[hits[h]].deriv(x,diff_var,supportCutoff);
+      }
+    }
+    return result;
+  }
   for (unsigned i = 0; i < x.size(); i++) {
     diff_var[0] = i;
     for (unsigned j = 0; j < rbfs.size(); j++) {
@@ -301,9 +437,16 @@ std::string RadialBasisFunctionModel::asString() const
   unsigned num_vars = ndims;
   os << "-----\n";
   os << "Surfpack Radial Basis Function model\n";
-  os << "f(x) = w*phi(x) and phi_k(x) = exp{-r_k*(x-c_k^T).^2}; where\n\n";
+  if (supportCutoff > 0.0) {
+    os << "f(x) = w*phi(x) and phi_k(x) = max(exp{-s_k} - exp{-t}, 0)/(1 - "
+       << "exp{-t}), s_k = r_k*(x-c_k^T).^2; where\n\n";
+  }
+  else
+    os << "f(x) = w*phi(x) and phi_k(x) = exp{-r_k*(x-c_k^T).^2}; where\n\n";
   os << "inputs = " << num_vars << "\n";
   os << "bases = " << num_bases << "\n";
+  if (supportCutoff > 0.0)
+    os << "t (support cutoff) = " << supportCutoff << "\n";
  
   os << std::scientific << std::setprecision(16);
   os << "\nw (1 x bases) =\n";
@@ -335,14 +478,14 @@ typedef std::pair<double,VecUns> RbfBest;
 
 RadialBasisFunctionModelFactory::RadialBasisFunctionModelFactory()
   : SurfpackModelFactory(), nCenters(0), cvtPts(0), maxSubsets(0), 
-  minPartition(1)
+  minPartition(1), supportCutoff(0.0)
 {
 
 }
 
 RadialBasisFunctionModelFactory::RadialBasisFunctionModelFactory(const ParamMap& args)
   : SurfpackModelFactory(args), nCenters(0), cvtPts(0), maxSubsets(0), 
-  minPartition(1)
+  minPartition(1), supportCutoff(0.0)
 {
 
 }
@@ -359,6 +502,8 @@ void RadialBasisFunctionModelFactory::config()
   if (strarg != "") maxSubsets = std::atoi(strarg.c_str());
   strarg = params["min_partition"];
   if (strarg != "") minPartition = std::atoi(strarg.c_str());
+  strarg = params["support_cutoff"];
+  if (strarg != "") supportCutoff = std::atof(strarg.c_str());
 }
 
 SurfpackModel* RadialBasisFunctionModelFactory::Create(const SurfData& sd)
@@ -371,18 +516,31 @@ SurfpackModel* RadialBasisFunctionModelFactory::Create(const SurfData& sd)
   RbfBest bestset(std::numeric_limits<double>::max(),VecUns());
   
   SurfData centers = cvts(AxesBounds::boundingBox(sd),nCenters,cvtPts);
-  SurfData radiuses = radii(centers);
   VecDbl b = sd.getResponses();
-  VecRbf candidates = makeRbfs(centers,radiuses);
+  // compactly supported bases are scaled to the local center spacing
+  VecRbf candidates = (supportCutoff > 0.0) ? makeLocalRbfs(centers) :
+    makeRbfs(centers,radii(centers));
   augment(candidates);
   assert(candidates.size() == 2*nCenters);
+  // with compact support, index the candidate supports once so each
+  // subset's least squares matrix is assembled from local bases only
+  RbfSpatialIndex candidate_index;
+  if (supportCutoff > 0.0) candidate_index.build(candidates,supportCutoff);
   for (unsigned i = 0; i < maxSubsets; i++) {
     VecUns used = probInclusion(candidates.size(),sd.size(),.5);
-    MtxDbl A = getMatrix(sd,candidates,used);
+    if (used.empty()) continue;
+    MtxDbl A = (supportCutoff > 0.0) ?
+      getMatrix(sd,candidates,used,candidate_index,supportCutoff) :
+      getMatrix(sd,candidates,used);
     VecDbl x;
     surfpack::linearSystemLeastSquares(A,x,b);
-    VecDbl coeffs = fullCoeff(candidates.size(),x,used);
-    RadialBasisFunctionModel rbfm(candidates,coeffs);
+    // unused candidates have zero coefficients, so the fitness of the
+    // subset model alone equals that of the full candidate expansion
+    VecRbf subset_rbfs;
+    std::sort(used.begin(),used.end());
+    for (unsigned j = 0; j < used.size(); j++)
+      subset_rbfs.push_back(candidates[used[j]]);
+    RadialBasisFunctionModel rbfm(subset_rbfs,x,supportCutoff);
     StandardFitness sf;
     double fitness = sf(rbfm,sd);
     if (fitness < bestset.first) bestset = RbfBest(fitness,used);
@@ -396,14 +554,216 @@ SurfpackModel* RadialBasisFunctionModelFactory::Create(const SurfData& sd)
   }
   // Recompute the coefficients.  If we cached the result, we wouldn't
   // have to do it again.  
-  MtxDbl A = getMatrix(sd,final_rbfs,final_used);
+  MtxDbl A;
+  if (supportCutoff > 0.0) {
+    RbfSpatialIndex final_index;
+    final_index.build(final_rbfs,supportCutoff);
+    A = getMatrix(sd,final_rbfs,final_used,final_index,supportCutoff);
+  }
+  else
+    A = getMatrix(sd,final_rbfs,final_used);
   VecDbl x;
   surfpack::linearSystemLeastSquares(A,x,b);
-  SurfpackModel* sm = new RadialBasisFunctionModel(final_rbfs, x); 
-  StandardFitness sf;
-  double fitness = sf(*sm,sd);
-  //cout << "Cached fitness: " << bestset.first << " recomputed: " << fitness << endl;
+  SurfpackModel* sm = new RadialBasisFunctionModel(final_rbfs, x,
+						   supportCutoff); 
   assert(sm);
   return sm; 
 }
 
+
+///////////////////////////////////////////////////////////
+///	RBF Spatial Index
+///////////////////////////////////////////////////////////
+
+const unsigned RbfSpatialIndex::noChild = std::numeric_limits<unsigned>::max();
+
+RbfSpatialIndex::RbfSpatialIndex(): ndims(0)
+{ /* empty ctor */ }
+
+void RbfSpatialIndex::clear()
+{
+  ndims = 0;
+  boxLower.clear(); boxUpper.clear();
+  nodeLower.clear(); nodeUpper.clear();
+  perm.clear();
+  nodeBegin.clear(); nodeEnd.clear(); nodeLeft.clear(); nodeRight.clear();
+}
+
+void RbfSpatialIndex::build(const std::vector<VecDbl>& lower,
+			    const std::vector<VecDbl>& upper)
+{
+  assert(lower.size() == upper.size());
+  clear();
+  if (lower.empty()) return;
+  ndims = lower[0].size();
+  unsigned nboxes = lower.size();
+  boxLower.resize(nboxes*ndims);
+  boxUpper.resize(nboxes*ndims);
+  perm.resize(nboxes);
+  for (unsigned i = 0; i < nboxes; i++) {
+    assert(lower[i].size() == ndims && upper[i].size() == ndims);
+    std::copy(lower[i].begin(),lower[i].end(),&boxLower[i*ndims]);
+    std::copy(upper[i].begin(),upper[i].end(),&boxUpper[i*ndims]);
+    perm[i] = i;
+  }
+  buildNode(0,nboxes);
+}
+
+void RbfSpatialIndex::build(const VecRbf& rbfs, double cutoff)
+{
+  std::vector<VecDbl> lower(rbfs.size()), upper(rbfs.size());
+  for (unsigned i = 0; i < rbfs.size(); i++)
+    rbfs[i].supportBox(cutoff,lower[i],upper[i]);
+  build(lower,upper);
+}
+
+void RbfSpatialIndex::build(const SurfData& sd)
+{
+  std::vector<VecDbl> pts(sd.size());
+  for (unsigned i = 0; i < sd.size(); i++)
+    pts[i] = sd(i);
+  build(pts,pts);
+}
+
+/// Orders box indices by the center of their extent along one dimension
+struct RbfBoxCenterLess
+{
+  RbfBoxCenterLess(const VecDbl& lower, const VecDbl& upper, unsigned ndims,
+		   unsigned dim)
+    : lo(lower), hi(upper), nd(ndims), d(dim) {}
+  bool operator()(unsigned a, unsigned b) const
+  { return lo[a*nd+d] + hi[a*nd+d] < lo[b*nd+d] + hi[b*nd+d]; }
+  const VecDbl& lo;
+  const VecDbl& hi;
+  unsigned nd, d;
+};
+
+unsigned RbfSpatialIndex::buildNode(unsigned begin, unsigned end)
+{
+  unsigned node = nodeBegin.size();
+  nodeBegin.push_back(begin);
+  nodeEnd.push_back(end);
+  nodeLeft.push_back(noChild);
+  nodeRight.push_back(noChild);
+  // bounding box of the node and spread of the box centers
+  VecDbl lo(ndims,std::numeric_limits<double>::max()), 
+    hi(ndims,-std::numeric_limits<double>::max()),
+    cmin(lo), cmax(hi);
+  for (unsigned k = begin; k < end; k++) {
+    unsigned b = perm[k]*ndims;
+    for (unsigned d = 0; d < ndims; d++) {
+      lo[d] = min(lo[d],boxLower[b+d]);
+      hi[d] = max(hi[d],boxUpper[b+d]);
+      double c = 0.5*(boxLower[b+d]+boxUpper[b+d]);
+      cmin[d] = min(cmin[d],c);
+      cmax[d] = max(cmax[d],c);
+    }
+  }
+  nodeLower.insert(nodeLower.end(),lo.begin(),lo.end());
+  nodeUpper.insert(nodeUpper.end(),hi.begin(),hi.end());
+  if (end - begin <= leafSize) return node;
+
+  unsigned split_dim = 0;
+  for (unsigned d = 1; d < ndims; d++)
+    if (cmax[d] - cmin[d] > cmax[split_dim] - cmin[split_dim]) split_dim = d;
+  // coincident centers cannot be separated further
+  if (cmax[split_dim] <= cmin[split_dim]) return node;
+  unsigned mid = begin + (end - begin)/2;
+  std::nth_element(perm.begin()+begin, perm.begin()+mid, perm.begin()+end,
+		   RbfBoxCenterLess(boxLower,boxUpper,ndims,split_dim));
+  unsigned left = buildNode(begin,mid);
+  unsigned right = buildNode(mid,end);
+  nodeLeft[node] = left;
+  nodeRight[node] = right;
+  return node;
+}
+
+void RbfSpatialIndex::contains(const VecDbl& x, VecUns& hits) const
+{
+  if (perm.empty()) return;
+  assert(x.size() == ndims);
+  std::vector<unsigned> stack(1,0);
+  while (!stack.empty()) {
+    unsigned node = stack.back(); stack.pop_back();
+    const double* lo = &nodeLower[node*ndims];
+    const double* hi = &nodeUpper[node*ndims];
+    bool inside = true;
+    for (unsigned d = 0; d < ndims && inside; d++)
+      inside = (x[d] >= lo[d] && x[d] <= hi[d]);
+    if (!inside) continue;
+    if (nodeLeft[node] == noChild) {
+      for (unsigned k = nodeBegin[node]; k < nodeEnd[node]; k++) {
+	const double* blo = &boxLower[perm[k]*ndims];
+	const double* bhi = &boxUpper[perm[k]*ndims];
+	bool in_box = true;
+	for (unsigned d = 0; d < ndims && in_box; d++)
+	  in_box = (x[d] >= blo[d] && x[d] <= bhi[d]);
+	if (in_box) hits.push_back(perm[k]);
+      }
+    }
+    else {
+      stack.push_back(nodeLeft[node]);
+      stack.push_back(nodeRight[node]);
+    }
+  }
+}
+
+double RbfSpatialIndex::boxDistance(const VecDbl& x, unsigned node) const
+{
+  const double* lo = &nodeLower[node*ndims];
+  const double* hi = &nodeUpper[node*ndims];
+  double dist = 0.0;
+  for (unsigned d = 0; d < ndims; d++) {
+    double delta = 0.0;
+    if (x[d] < lo[d]) delta = lo[d] - x[d];
+    else if (x[d] > hi[d]) delta = x[d] - hi[d];
+    dist += delta*delta;
+  }
+  return dist;
+}
+
+unsigned RbfSpatialIndex::nearest(const VecDbl& x) const
+{
+  return nearest(x,noChild);
+}
+
+unsigned RbfSpatialIndex::nearest(const VecDbl& x, unsigned exclude) const
+{
+  assert(!perm.empty());
+  assert(x.size() == ndims);
+  double best_dist = std::numeric_limits<double>::max();
+  unsigned best = noChild;
+  std::vector<unsigned> stack(1,0);
+  while (!stack.empty()) {
+    unsigned node = stack.back(); stack.pop_back();
+    if (boxDistance(x,node) >= best_dist) continue;
+    if (nodeLeft[node] == noChild) {
+      for (unsigned k = nodeBegin[node]; k < nodeEnd[node]; k++) {
+	if (perm[k] == exclude) continue;
+	const double* blo = &boxLower[perm[k]*ndims];
+	const double* bhi = &boxUpper[perm[k]*ndims];
+	double dist = 0.0;
+	for (unsigned d = 0; d < ndims; d++) {
+	  double delta = 0.0;
+	  if (x[d] < blo[d]) delta = blo[d] - x[d];
+	  else if (x[d] > bhi[d]) delta = x[d] - bhi[d];
+	  dist += delta*delta;
+	}
+	if (dist < best_dist || (dist == best_dist && perm[k] < best)) {
+	  best_dist = dist;
+	  best = perm[k];
+	}
+      }
+    }
+    else {
+      // visit the nearer child first
+      unsigned near_child = nodeLeft[node], far_child = nodeRight[node];
+      if (boxDistance(x,far_child) < boxDistance(x,near_child))
+	std::swap(near_child,far_child);
+      stack.push_back(far_child);
+      stack.push_back(near_child);
+    }
+  }
+  assert(best != noChild);
+  return best;
+}
@@ -35,6 +35,13 @@ public:
   RadialBasisFunction(const std::string& center_in, const std::string& radius_in);
   double operator()(const VecDbl& x) const;
   double deriv(const VecDbl& x, const VecUns& vars) const;
+  /// Gaussian truncated and shifted to zero where the scaled squared
+  /// distance to the center reaches cutoff (compact support)
+  double operator()(const VecDbl& x, double cutoff) const;
+  /// derivative of the compactly supported basis function
+  double deriv(const VecDbl& x, const VecUns& vars, double cutoff) const;
+  /// axis-aligned bounding box of the support for the given cutoff
+  void supportBox(double cutoff, VecDbl& lower, VecDbl& upper) const;
   std::string asString() const;
 
 //protected:
@@ -57,14 +64,68 @@ private:
 
 typedef std::vector<RadialBasisFunction> VecRbf;
 VecRbf makeRbfs(const SurfData& generators, const SurfData& radii);
+VecRbf makeLocalRbfs(const SurfData& generators);
 void augment(VecRbf& rbfs);
 
 
+/// Bounding volume hierarchy over axis-aligned boxes, used to find the
+/// basis functions whose compact support contains a point and, when the
+/// boxes degenerate to points, to find the nearest CVT generator.  Build
+/// is O(n log n); queries visit only the subtrees whose boxes are hit.
+class RbfSpatialIndex
+{
+
+public:
+
+  RbfSpatialIndex();
+
+  /// index the boxes [lower[i], upper[i]], i = 0..n-1
+  void build(const std::vector<VecDbl>& lower, 
+	     const std::vector<VecDbl>& upper);
+  /// index the support boxes of rbfs for the given cutoff
+  void build(const VecRbf& rbfs, double cutoff);
+  /// index the points of sd (degenerate boxes)
+  void build(const SurfData& sd);
+
+  /// append to hits the indices of all boxes containing x
+  void contains(const VecDbl& x, VecUns& hits) const;
+  /// index of the box nearest to x in Euclidean distance
+  unsigned nearest(const VecDbl& x) const;
+  /// index of the box nearest to x, ignoring box exclude
+  unsigned nearest(const VecDbl& x, unsigned exclude) const;
+
+  bool empty() const { return perm.empty(); }
+  void clear();
+
+private:
+
+  /// recursively partition perm[begin,end) and return the node index
+  unsigned buildNode(unsigned begin, unsigned end);
+  /// squared distance from x to the bounding box of node
+  double boxDistance(const VecDbl& x, unsigned node) const;
+
+  /// maximum number of boxes stored in a leaf
+  static const unsigned leafSize = 8;
+  /// sentinel child index for leaf nodes
+  static const unsigned noChild;
+
+  unsigned ndims;
+  /// box bounds, stored contiguously ndims values per box
+  VecDbl boxLower, boxUpper;
+  /// node bounds, stored contiguously ndims values per node
+  VecDbl nodeLower, nodeUpper;
+  /// permutation of box indices; each node owns a contiguous range
+  VecUns perm;
+  VecUns nodeBegin, nodeEnd, nodeLeft, nodeRight;
+};
+
+
 class RadialBasisFunctionModel : public SurfpackModel
 {
 public:
 
-  RadialBasisFunctionModel(const VecRbf& rbfs_in, const VecDbl& coeffs_in);
+  RadialBasisFunctionModel(const VecRbf& rbfs_in, const VecDbl& coeffs_in,
+			   double support_cutoff = 0.0);
   virtual double evaluate(const VecDbl& x) const;
   virtual VecDbl gradient(const VecDbl& x) const;
   virtual std::string asString() const;
@@ -72,10 +133,18 @@ public:
 protected:
 
   /// default constructor used when reading from archive file
-  RadialBasisFunctionModel() { /* empty ctor */ }
+  RadialBasisFunctionModel(): supportCutoff(0.0) { /* empty ctor */ }
+
+  /// (re)build the support index when using compactly supported bases
+  void buildSupportIndex() const;
 
   VecRbf rbfs;
   VecDbl coeffs;
+  /// scaled squared distance beyond which each basis function vanishes;
+  /// 0.0 means global (untruncated) Gaussian support
+  double supportCutoff;
+  /// index over basis supports; not serialized, rebuilt on first use
+  mutable RbfSpatialIndex supportIndex;
 
 friend class RadialBasisFunctionModelTest;
 
@@ -120,6 +189,8 @@ protected:
   unsigned cvtPts;
   unsigned maxSubsets;
   unsigned minPartition;
+  /// support cutoff for compactly supported bases (0.0 = global support)
+  double supportCutoff;
 };
 
 
@@ -147,8 +218,13 @@ void RadialBasisFunctionModel::serialize(Archive & archive,
   archive & boost::serialization::base_object<SurfpackModel>(*this);
   archive & rbfs;
   archive & coeffs;
+  if (version > 0)
+    archive & supportCutoff;
 }
 
+// version 1 adds the compact support cutoff
+BOOST_CLASS_VERSION(RadialBasisFunctionModel, 1)
+
 #endif
 
 
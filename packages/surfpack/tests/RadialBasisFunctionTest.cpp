@@ -15,6 +15,8 @@
 #include <iostream>
 #include <string>
 #include <iterator>
+#include <algorithm>
+#include <limits>
 
 #include "LinearRegressionModel.h"
 #include "SurfpackMatrix.h"
@@ -172,3 +174,103 @@ void RadialBasisFunctionTest::createTest()
   delete model;
 }
 
+
+void RadialBasisFunctionTest::spatialIndexTest()
+{
+  // random compactly supported bases; more than a leaf's worth
+  VecRbf rbfs;
+  VecDbl center(2);
+  VecDbl radius(2);
+  for (unsigned i = 0; i < 200; i++) {
+    center[0] = shared_rng().rand()*4.0-2.0;
+    center[1] = shared_rng().rand()*4.0-2.0;
+    radius[0] = shared_rng().rand()*0.5+0.05;
+    radius[1] = shared_rng().rand()*0.5+0.05;
+    rbfs.push_back(RadialBasisFunction(center,radius));
+  }
+  double cutoff = 2.0;
+  RbfSpatialIndex index;
+  index.build(rbfs,cutoff);
+
+  // support queries must match a brute force search of the boxes
+  VecDbl x(2), lower, upper;
+  for (unsigned k = 0; k < 100; k++) {
+    x[0] = shared_rng().rand()*5.0-2.5;
+    x[1] = shared_rng().rand()*5.0-2.5;
+    VecUns hits;
+    index.contains(x,hits);
+    std::sort(hits.begin(),hits.end());
+    VecUns brute;
+    for (unsigned i = 0; i < rbfs.size(); i++) {
+      rbfs[i].supportBox(cutoff,lower,upper);
+      if (lower[0] <= x[0] && x[0] <= upper[0] &&
+	  lower[1] <= x[1] && x[1] <= upper[1])
+	brute.push_back(i);
+    }
+    CPPUNIT_ASSERT(hits == brute);
+  }
+
+  // nearest point queries must match a brute force search
+  AxesBounds ab("-2 2 | -2 2");
+  SurfData* sd = SurfpackInterface::CreateSample(&ab,VecUns(2,9));
+  RbfSpatialIndex point_index;
+  point_index.build(*sd);
+  for (unsigned k = 0; k < 100; k++) {
+    x[0] = shared_rng().rand()*5.0-2.5;
+    x[1] = shared_rng().rand()*5.0-2.5;
+    unsigned best = 0;
+    double best_dist = std::numeric_limits<double>::max();
+    for (unsigned i = 0; i < sd->size(); i++) {
+      double dist = surfpack::euclideanDistance((*sd)(i),x);
+      if (dist < best_dist) { best_dist = dist; best = i; }
+    }
+    CPPUNIT_ASSERT(matches(
+      surfpack::euclideanDistance((*sd)(point_index.nearest(x)),x),
+      best_dist));
+    CPPUNIT_ASSERT(point_index.nearest((*sd)(best),best) != best);
+  }
+  delete sd;
+}
+
+void RadialBasisFunctionTest::compactSupportTest()
+{
+  VecRbf rbfs;
+  VecDbl center(2);
+  VecDbl radius(2,0.3);
+  VecDbl cfs;
+  for (unsigned i = 0; i < 50; i++) {
+    center[0] = shared_rng().rand()*4.0-2.0;
+    center[1] = shared_rng().rand()*4.0-2.0;
+    rbfs.push_back(RadialBasisFunction(center,radius));
+    cfs.push_back(shared_rng().rand()*2.0-1.0);
+  }
+  double cutoff = 3.0;
+  RadialBasisFunctionModel rbf_model(rbfs,cfs,cutoff);
+
+  // the indexed evaluation must agree with summing every basis
+  VecDbl x(2);
+  for (unsigned k = 0; k < 100; k++) {
+    x[0] = shared_rng().rand()*4.0-2.0;
+    x[1] = shared_rng().rand()*4.0-2.0;
+    double sum = 0.0;
+    for (unsigned i = 0; i < rbfs.size(); i++)
+      sum += cfs[i]*rbfs[i](x,cutoff);
+    CPPUNIT_ASSERT(matches(rbf_model(x),sum));
+  }
+
+  // the factory builds a usable model with compact support
+  AxesBounds ab("-2 2 | -2 2");
+  SurfData* sd = SurfpackInterface::CreateSample(&ab,VecUns(2,10));
+  SurfpackInterface::Evaluate(sd,VecStr(1,"moderatepoly"));
+  ParamMap args;
+  args["support_cutoff"] = "3.0";
+  RadialBasisFunctionModelFactory rbfmf(args);
+  // Build() applies the parameters before creating the model
+  SurfpackModel* model = rbfmf.Build(*sd);
+  VecDbl est = (*model)(*sd);
+  CPPUNIT_ASSERT(est.size() == sd->size());
+  for (unsigned i = 0; i < est.size(); i++)
+    CPPUNIT_ASSERT(est[i] == est[i]);
+  delete sd;
+  delete model;
+}
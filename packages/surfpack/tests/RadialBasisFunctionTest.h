@@ -31,6 +31,8 @@ class RadialBasisFunctionTest : public CppUnit::TestFixture
 //CPPUNIT_TEST( updateCentroidTest );
 //CPPUNIT_TEST( cvtTest );
 CPPUNIT_TEST( createTest );
+CPPUNIT_TEST( spatialIndexTest );
+CPPUNIT_TEST( compactSupportTest );
   CPPUNIT_TEST_SUITE_END();
 public:
   void setUp();
@@ -44,6 +46,8 @@ void centroidTest2();
 void updateCentroidTest();
 void cvtTest();
 void createTest();
+void spatialIndexTest();
+void compactSupportTest();
 };
 
 #endif
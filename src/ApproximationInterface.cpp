@@ -17,6 +17,18 @@
 #include "DakotaResponse.hpp"
 #include "ProblemDescDB.hpp"
 #include "PRPMultiIndex.hpp"
+#include "OutputManager.hpp"
+#include "ParallelLibrary.hpp"
+#include "ResultsManager.hpp"
+#include <boost/filesystem/operations.hpp>
+#include <boost/lexical_cast.hpp>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#ifdef HAVE_WORKING_FORK
+#include <sys/wait.h> // for waitpid
+#include <unistd.h>   // for fork, _exit
+#endif
 
 //#define DEBUG
 
@@ -24,6 +36,71 @@
 namespace Dakota {
 
 extern PRPCache data_pairs;
+extern ResultsManager iterator_results_db;
+
+
+// Approximation archives (model cache files and the files returned by
+// concurrent builds) contain a fixed header followed by the payload
+// written by Approximation::save_model().  The hash identifies the build
+// data and settings; archives are native binary and are not intended
+// to be portable across platforms.
+
+/// identifies an approximation archive file
+static const char ARCHIVE_MAGIC[8] = { 'D','A','K','A','P','P','R','X' };
+/// incremented when the archive layout changes
+static const boost::uint32_t ARCHIVE_VERSION = 1;
+/// detects archives written with a different byte order
+static const boost::uint32_t ARCHIVE_BYTE_ORDER = 0x01020304;
+/// initial value of the (FNV-1a) archive hash
+static const boost::uint64_t ARCHIVE_HASH_SEED = 14695981039346656037ULL;
+
+/// fixed-size header of an approximation archive
+struct ApproxArchiveHeader {
+  char           magic[8];  ///< ARCHIVE_MAGIC
+  boost::uint32_t version;   ///< ARCHIVE_VERSION
+  boost::uint32_t byteOrder; ///< ARCHIVE_BYTE_ORDER
+  boost::uint64_t hash;      ///< hash of the build data and settings
+  boost::uint64_t length;    ///< length of the payload in bytes
+};
+
+
+/// accumulate bytes into an FNV-1a hash
+static void hash_bytes(boost::uint64_t& hash, const void* data, size_t len)
+{
+  const unsigned char* bytes = (const unsigned char*)data;
+  for (size_t i=0; i<len; ++i)
+    { hash ^= bytes[i]; hash *= 1099511628211ULL; }
+}
+
+/// accumulate the length and values of a vector into an FNV-1a hash
+template <typename OrdinalType, typename ScalarType>
+static void hash_vector(boost::uint64_t& hash,
+  const Teuchos::SerialDenseVector<OrdinalType, ScalarType>& v)
+{
+  OrdinalType len = v.length();
+  hash_bytes(hash, &len, sizeof(OrdinalType));
+  if (len) hash_bytes(hash, v.values(), len * sizeof(ScalarType));
+}
+
+/// accumulate the size and lower triangle of a symmetric matrix into
+/// an FNV-1a hash
+static void hash_matrix(boost::uint64_t& hash, const RealSymMatrix& m)
+{
+  int i, j, n = m.numRows();
+  hash_bytes(hash, &n, sizeof(int));
+  for (j=0; j<n; ++j)
+    for (i=j; i<n; ++i)
+      hash_bytes(hash, &m(i,j), sizeof(Real));
+}
+
+
+/// stream buffer over a read-only block of memory
+class ArchiveStreamBuf: public std::streambuf
+{
+public:
+  ArchiveStreamBuf(const char* data, size_t len)
+  { char* p = const_cast<char*>(data); setg(p, p, p + len); }
+};
 
 ApproximationInterface::
 ApproximationInterface(ProblemDescDB& problem_db, const Variables& am_vars,
@@ -37,6 +114,8 @@ ApproximationInterface(ProblemDescDB& problem_db, const Variables& am_vars,
     problem_db.get_ushort("model.surrogate.challenge_points_file_format")),
   challengeActiveOnly(
     problem_db.get_bool("model.surrogate.challenge_points_file_active")),
+  buildConcurrency(problem_db.get_int("model.surrogate.build_concurrency")),
+  modelCachePrefix(problem_db.get_string("model.surrogate.model_cache_prefix")),
   actualModelVars(am_vars.copy()), actualModelCache(am_cache),
   actualModelInterfaceId(am_interface_id)
 {
@@ -47,6 +126,15 @@ ApproximationInterface(ProblemDescDB& problem_db, const Variables& am_vars,
   interfaceId = "APPROX_INTERFACE"; interfaceType = APPROX_INTERFACE;
   algebraicMappings = false; // for now; *** TO DO ***
 
+  // a process forked after MPI initialization cannot safely use or
+  // finalize MPI, so approximations are built serially in MPI runs
+  const ParallelLibrary& parallel_lib = problem_db.parallel_library();
+  if (buildConcurrency > 1 && !parallel_lib.fork_allowed()) {
+    Cerr << "\nWarning: build_concurrency ignored in MPI runs; "
+	 << "approximations are built serially." << std::endl;
+    buildConcurrency = 1;
+  }
+
   // process approxFnIndices.  IntSets are sorted and unique.  Error checking
   // is performed in SurrogateModel and does not need to be replicated here.
   size_t num_fns = fn_labels.size();
@@ -130,7 +218,7 @@ ApproximationInterface(const String& approx_type,
 		       short data_order, short output_level):
   Interface(NoDBBaseConstructor(), num_fns, output_level), //graph3DFlag(false),
   challengeFormat(TABULAR_ANNOTATED), challengeActiveOnly(false), 
-  actualModelVars(am_vars.copy()),
+  buildConcurrency(1), actualModelVars(am_vars.copy()),
   actualModelCache(am_cache), actualModelInterfaceId(am_interface_id)
 {
   interfaceId = "APPROX_INTERFACE"; interfaceType = APPROX_INTERFACE;
@@ -628,11 +716,49 @@ build_approximation(const RealVector&  c_l_bnds, const RealVector&  c_u_bnds,
   sharedData.set_bounds(c_l_bnds, c_u_bnds, di_l_bnds, di_u_bnds,
 			dr_l_bnds, dr_u_bnds);
   sharedData.build();
+
+  // restore persisted approximations for which the build data and
+  // settings are unchanged; only the remainder are built
+  std::map<int, boost::uint64_t> archive_hashes;
+  IntSet restored_indices;
+  IntArray build_indices;
+  if (!modelCachePrefix.empty()) {
+    boost::uint64_t bounds_hash = ARCHIVE_HASH_SEED;
+    hash_vector(bounds_hash, c_l_bnds);  hash_vector(bounds_hash, c_u_bnds);
+    hash_vector(bounds_hash, di_l_bnds); hash_vector(bounds_hash, di_u_bnds);
+    hash_vector(bounds_hash, dr_l_bnds); hash_vector(bounds_hash, dr_u_bnds);
+    for (ISIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it)
+      if (functionSurfaces[*it].model_archive_available()) {
+	boost::uint64_t hash = archive_hash(*it, bounds_hash);
+	archive_hashes[*it] = hash;
+	if (read_model_archive(*it, model_cache_filename(*it), hash))
+	  restored_indices.insert(*it);
+      }
+    if (outputLevel >= NORMAL_OUTPUT && !restored_indices.empty())
+      Cout << "\nRestored " << restored_indices.size() << " of "
+	   << approxFnIndices.size() << " approximations from model cache "
+	   << "files with prefix " << modelCachePrefix << ".\n";
+  }
+  for (ISIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it)
+    if (!restored_indices.count(*it))
+      build_indices.push_back(*it);
+
   // build the approximation surface instances
+  bool concurrent = concurrent_build_available(build_indices);
+  if (concurrent)
+    build_concurrent(build_indices, false);
   for (ISIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it) {
     int index = *it;
-    // construct the approximation
-    functionSurfaces[index].build();
+    if (!restored_indices.count(index)) {
+      // construct the approximation
+      if (!concurrent)
+	functionSurfaces[index].build();
+      // persist it for reuse by subsequent runs
+      std::map<int, boost::uint64_t>::iterator h_it
+	= archive_hashes.find(index);
+      if (h_it != archive_hashes.end())
+	write_model_archive(index, model_cache_filename(index), h_it->second);
+    }
 
     // manage diagnostics
     if (functionSurfaces[index].diagnostics_available()) {
@@ -679,13 +805,232 @@ rebuild_approximation(const BoolDeque& rebuild_deque)
   // rebuild data shared among approximation instances
   sharedData.rebuild();
   // rebuild the approximation surfaces
+  IntArray rebuild_indices;
   for (ISIter it=approxFnIndices.begin(); it!=approxFnIndices.end(); ++it)
     // check for rebuild request (defaults to true if no deque defined)
-    if (rebuild_deque.empty() || rebuild_deque[*it]) {
-      // approx bounds not updated as in build_approximation()
-      functionSurfaces[*it].rebuild(); // invokes increment_coefficients()
-      // diagnostics not currently active on rebuild
+    if (rebuild_deque.empty() || rebuild_deque[*it])
+      rebuild_indices.push_back(*it);
+  // approx bounds not updated as in build_approximation()
+  // diagnostics not currently active on rebuild
+  if (concurrent_build_available(rebuild_indices))
+    build_concurrent(rebuild_indices, true);
+  else
+    for (size_t i=0; i<rebuild_indices.size(); ++i)
+      functionSurfaces[rebuild_indices[i]].rebuild(); // increment_coeffs()
+}
+
+
+bool ApproximationInterface::
+concurrent_build_available(const IntArray& fn_indices)
+{
+#ifdef HAVE_WORKING_FORK
+  if (buildConcurrency <= 1 || fn_indices.size() <= 1)
+    return false;
+  // each surface built in a child process must be archived to be
+  // returned to the parent
+  for (size_t i=0; i<fn_indices.size(); ++i)
+    if (!functionSurfaces[fn_indices[i]].model_archive_available())
+      return false;
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+/** This function uses the heavy fork() approach employed for
+    simulation interfaces to build independent approximations
+    concurrently.  Each child process builds a strided subset of the
+    surfaces and writes them to binary archives in a temporary
+    location, from which the parent restores them once all children
+    have exited.  Separate address spaces isolate fitting codes that
+    are not reentrant (Fortran optimizers with static storage, global
+    random number generators).  The shared approximation data is built
+    by the parent prior to the fork, so the children only read it. */
+void ApproximationInterface::
+build_concurrent(const IntArray& fn_indices, bool rebuild_flag)
+{
+#ifdef HAVE_WORKING_FORK
+  size_t i, j, num_surf = fn_indices.size(),
+    num_procs = std::min((size_t)buildConcurrency, num_surf);
+  if (outputLevel >= NORMAL_OUTPUT)
+    Cout << "\nBuilding " << num_surf << " approximations using "
+	 << num_procs << " concurrent processes.\n";
+
+  // archive file names are unique to this build
+  String archive_root = (boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path("dakota_approx_%%%%%%%%")).string();
+  StringArray archive_names(num_surf);
+  for (j=0; j<num_surf; ++j)
+    archive_names[j] = archive_root + "." +
+      boost::lexical_cast<String>(fn_indices[j]+1) + ".dsa";
+
+  // flush buffered output so that it is not replicated by the children
+  Cout.flush(); Cerr.flush();
+  AsyncOutputBuffer::drain_all();
+
+  std::vector<pid_t> pids(num_procs);
+  for (i=0; i<num_procs; ++i) {
+    pid_t pid = fork();
+    if (pid == -1) {
+      Cerr << "\nCould not fork approximation build; error code " << errno
+	   << " (" << std::strerror(errno) << ")" << std::endl;
+      abort_handler(-1);
     }
+    if (pid == 0) { // child: build and archive every num_procs-th surface
+      // errors exit the child without cleaning up the files and streams
+      // it shares with the parent, which reports the failure
+      abort_mode = ABORT_CHILD_EXITS;
+      iterator_results_db.detach_forked_child();
+      int exit_status = 0;
+      try {
+	for (j=i; j<num_surf && !exit_status; j+=num_procs) {
+	  Approximation& fn_surf = functionSurfaces[fn_indices[j]];
+	  if (rebuild_flag) fn_surf.rebuild();
+	  else              fn_surf.build();
+	  if (!write_model_archive(fn_indices[j], archive_names[j], 0))
+	    exit_status = 1;
+	}
+      }
+      catch (const std::exception& e) {
+	Cerr << "\nError: approximation build failed in child process:\n  "
+	     << e.what() << std::endl;
+	exit_status = 1;
+      }
+      catch (...) {
+	exit_status = 1;
+      }
+      Cout.flush(); Cerr.flush();
+      // use _exit so that the parent's streams are not closed
+      _exit(exit_status);
+    }
+    pids[i] = pid;
+  }
+
+  // parent: wait for all children before restoring any surfaces
+  bool build_failed = false;
+  for (i=0; i<num_procs; ++i) {
+    int status = 0;
+    pid_t wpid = waitpid(pids[i], &status, 0);
+    if (wpid == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      build_failed = true;
+  }
+
+  for (j=0; j<num_surf; ++j) {
+    if (!build_failed &&
+	!read_model_archive(fn_indices[j], archive_names[j], 0))
+      build_failed = true;
+    boost::system::error_code ec; // ignore removal failures
+    boost::filesystem::remove(archive_names[j], ec);
+  }
+  if (build_failed) {
+    Cerr << "\nError: concurrent approximation build failed in a child "
+	 << "process." << std::endl;
+    abort_handler(-1);
+  }
+#endif
+}
+
+
+String ApproximationInterface::model_cache_filename(int fn_index) const
+{
+  return modelCachePrefix + "." + boost::lexical_cast<String>(fn_index+1)
+    + ".dsa";
+}
+
+
+/** The hash covers the approximation settings, the build data
+    (variables, and response values and derivatives), and the seed,
+    which accounts for data shared among the approximations. */
+boost::uint64_t ApproximationInterface::
+archive_hash(int fn_index, boost::uint64_t seed)
+{
+  Approximation& fn_surf = functionSurfaces[fn_index];
+  boost::uint64_t hash = seed;
+  String settings = fn_surf.model_settings();
+  hash_bytes(hash, settings.data(), settings.size());
+
+  const Pecos::SurrogateData& approx_data = fn_surf.approximation_data();
+  size_t i, num_pts = approx_data.points();
+  hash_bytes(hash, &num_pts, sizeof(size_t));
+  for (i=0; i<num_pts; ++i) {
+    hash_vector(hash, approx_data.continuous_variables(i));
+    hash_vector(hash, approx_data.discrete_int_variables(i));
+    hash_vector(hash, approx_data.discrete_real_variables(i));
+    hash_bytes(hash, &approx_data.response_function(i), sizeof(Real));
+    hash_vector(hash, approx_data.response_gradient(i));
+    hash_matrix(hash, approx_data.response_hessian(i));
+  }
+  bool anchor = approx_data.anchor();
+  hash_bytes(hash, &anchor, sizeof(bool));
+  if (anchor) {
+    hash_vector(hash, approx_data.anchor_continuous_variables());
+    hash_vector(hash, approx_data.anchor_discrete_int_variables());
+    hash_vector(hash, approx_data.anchor_discrete_real_variables());
+    hash_bytes(hash, &approx_data.anchor_function(), sizeof(Real));
+    hash_vector(hash, approx_data.anchor_gradient());
+    hash_matrix(hash, approx_data.anchor_hessian());
+  }
+  return hash;
+}
+
+
+/** The archive is written under a temporary name and then renamed, so
+    that a concurrent reader never sees a partial file.  Returns false
+    if the archive could not be written. */
+bool ApproximationInterface::
+write_model_archive(int fn_index, const String& filename, boost::uint64_t hash)
+{
+  // serialize the approximation first so that its length is known
+  std::ostringstream payload(std::ios::out | std::ios::binary);
+  functionSurfaces[fn_index].save_model(payload);
+  String bytes = payload.str();
+
+  ApproxArchiveHeader header;
+  std::memcpy(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+  header.version   = ARCHIVE_VERSION;
+  header.byteOrder = ARCHIVE_BYTE_ORDER;
+  header.hash      = hash;
+  header.length    = bytes.size();
+
+  String tmp_name = filename + ".tmp";
+  std::ofstream archive(tmp_name.c_str(), std::ios::out | std::ios::binary);
+  archive.write((const char*)&header, sizeof(header));
+  archive.write(bytes.data(), bytes.size());
+  archive.close();
+  boost::system::error_code ec;
+  if (archive.good())
+    boost::filesystem::rename(tmp_name, filename, ec);
+  if (!archive.good() || ec) {
+    Cerr << "Warning: could not write approximation archive " << filename
+	 << std::endl;
+    boost::filesystem::remove(tmp_name, ec);
+    return false;
+  }
+  return true;
+}
+
+
+/** Returns false, leaving the approximation unchanged, if the archive
+    does not exist, its header or hash do not match, or its model
+    cannot be deserialized. */
+bool ApproximationInterface::
+read_model_archive(int fn_index, const String& filename, boost::uint64_t hash)
+{
+  TabularIO::MappedFileView view(filename);
+  ApproxArchiveHeader header;
+  if (view.size() < sizeof(header))
+    return false;
+  std::memcpy(&header, view.data(), sizeof(header));
+  if (std::memcmp(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) ||
+      header.version != ARCHIVE_VERSION ||
+      header.byteOrder != ARCHIVE_BYTE_ORDER || header.hash != hash ||
+      header.length != view.size() - sizeof(header))
+    return false;
+
+  ArchiveStreamBuf payload_buf(view.data() + sizeof(header), header.length);
+  std::istream payload(&payload_buf);
+  return functionSurfaces[fn_index].load_model(payload);
 }
 
 
@@ -20,6 +20,7 @@
 #include "DakotaInterface.hpp"
 #include "DakotaVariables.hpp"
 #include "DakotaResponse.hpp"
+#include <boost/cstdint.hpp>
 
 
 namespace Dakota {
@@ -161,6 +162,25 @@ private:
   /// Load approximation test points from user challenge points file
   void read_challenge_points(bool active_only);
 
+  /// test whether the functionSurfaces indexed by fn_indices can be
+  /// built concurrently using build_concurrent()
+  bool concurrent_build_available(const IntArray& fn_indices);
+  /// build (or rebuild) the functionSurfaces indexed by fn_indices
+  /// within up to buildConcurrency child processes
+  void build_concurrent(const IntArray& fn_indices, bool rebuild_flag);
+
+  /// name of the model cache file for functionSurfaces[fn_index]
+  String model_cache_filename(int fn_index) const;
+  /// hash of the settings and build data of functionSurfaces[fn_index]
+  boost::uint64_t archive_hash(int fn_index, boost::uint64_t seed);
+  /// write functionSurfaces[fn_index] to an archive file tagged with hash
+  bool write_model_archive(int fn_index, const String& filename,
+			   boost::uint64_t hash);
+  /// restore functionSurfaces[fn_index] from an archive file if its tag
+  /// matches hash
+  bool read_model_archive(int fn_index, const String& filename,
+			  boost::uint64_t hash);
+
   //
   //- Heading: Data
   //
@@ -204,6 +224,11 @@ private:
   /// container for the challenge points data (responses only)
   RealMatrix challengeResponses;
 
+  /// maximum number of functionSurfaces to build concurrently
+  int buildConcurrency;
+  /// file name prefix for persisted functionSurfaces (empty: no persistence)
+  String modelCachePrefix;
+
   /// copy of the actualModel variables object used to simplify conversion 
   /// among differing variable views
   Variables actualModelVars;
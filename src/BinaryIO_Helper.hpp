@@ -25,6 +25,7 @@
 #include "hdf5.h"
 #include "hdf5_hl.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <cmath>
@@ -148,7 +149,8 @@ public:
                      bool writable_fstream  = false,
                      bool exit_on_error     = true) :
     fileName(file_name), binStreamId(),
-    dbIsIncore(db_is_incore), exitOnError(exit_on_error), errorStatus()
+    dbIsIncore(db_is_incore), exitOnError(exit_on_error), errorStatus(),
+    fileDetached(false)
   {
     // WJB - ToDo: split-out into .cpp file
     if ( db_is_incore ) {
@@ -216,11 +218,17 @@ public:
     // that it "owns"
     //H5VariableString::destroy(varStringHid);
 
-    if ( H5Fclose(binStreamId) < 0 )
+    if ( !fileDetached && H5Fclose(binStreamId) < 0 )
       throw BinaryStream_CloseFailure();
   }
 
 
+  /// In a forked child sharing the parent's open file, leave the file
+  /// unclosed at destruction, since closing writes file metadata
+  void detach()
+  { fileDetached = true; }
+
+
   // WJB: will a client need to query? -- hid_t binary_stream_id() const { return binStreamId; }
 
   //
@@ -599,10 +607,142 @@ public:
   }
 
 
+  /// Create an empty 2D dataset with num_cols columns that grows by
+  /// appending rows; it is stored in chunks of chunk_rows rows, each
+  /// deflated at compress_level when that is nonzero
+  template <typename T>
+  herr_t create_extensible_dataset(const std::string& dset_name,
+                                   std::size_t num_cols,
+                                   std::size_t chunk_rows,
+                                   int compress_level = 0) const
+  {
+    create_groups(dset_name);
+
+    hsize_t dims[2]       = { 0, num_cols };
+    hsize_t max_dims[2]   = { H5S_UNLIMITED, num_cols };
+    hsize_t chunk_dims[2] = { std::max(chunk_rows, std::size_t(1)), num_cols };
+
+    hid_t space  = H5Screate_simple(2, dims, max_dims);
+    hid_t cparms = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(cparms, 2, chunk_dims);
+    // shuffling the bytes of each column groups the slowly varying
+    // exponents together, which deflate compresses much better
+    if ( compress_level > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0 ) {
+      H5Pset_shuffle(cparms);
+      H5Pset_deflate(cparms, std::min(compress_level, 9));
+    }
+
+    hid_t dataset = H5Dcreate(binStreamId, dset_name.c_str(),
+                      NativeDataTypes<T>::datatype(), space, H5P_DEFAULT,
+                      cparms, H5P_DEFAULT);
+    H5Pclose(cparms);
+    H5Sclose(space);
+
+    herr_t status = (dataset < 0) ? dataset : H5Dclose(dataset);
+    check_error_store(status);
+    return status;
+  }
+
+
+  /// Append num_rows rows, stored contiguously by row in buf, to a 2D
+  /// dataset created by create_extensible_dataset()
+  template <typename T>
+  herr_t append_rows(const std::string& dset_name, const T* buf,
+                     std::size_t num_rows) const
+  {
+    hid_t dataset = H5Dopen(binStreamId, dset_name.c_str(), H5P_DEFAULT);
+    if ( dataset < 0 ) {
+      check_error_store(dataset);
+      return dataset;
+    }
+
+    hid_t file_space = H5Dget_space(dataset);
+    hsize_t dims[2] = { 0, 0 };
+    H5Sget_simple_extent_dims(file_space, dims, NULL);
+    H5Sclose(file_space);
+
+    hsize_t offset[2] = { dims[0], 0 };
+    hsize_t count[2]  = { num_rows, dims[1] };
+    dims[0] += num_rows;
+
+    herr_t status = H5Dset_extent(dataset, dims);
+    if ( status >= 0 && num_rows && dims[1] ) {
+      file_space = H5Dget_space(dataset);
+      hid_t mem_space = H5Screate_simple(2, count, NULL);
+      H5Sselect_hyperslab(file_space, H5S_SELECT_SET, offset, NULL, count,
+                          NULL);
+      status = H5Dwrite(dataset, NativeDataTypes<T>::datatype(), mem_space,
+                        file_space, H5P_DEFAULT, buf);
+      H5Sclose(mem_space);
+      H5Sclose(file_space);
+    }
+    H5Dclose(dataset);
+
+    check_error_store(status);
+    return status;
+  }
+
+
+  /// Write any data cached by the HDF5 library to the file
+  herr_t flush() const
+  { return H5Fflush(binStreamId, H5F_SCOPE_LOCAL); }
+
+
   //
   //- Heading:  Data retrieval methods (read HDF5)
   //
 
+  /// Read up to num_rows rows starting at first_row of a 2D dataset
+  /// with a single hyperslab selection; buf is returned by row, with
+  /// num_cols values per row
+  template <typename T>
+  herr_t read_rows(const std::string& dset_name, std::vector<T>& buf,
+                   std::size_t& num_cols, std::size_t first_row = 0,
+                   std::size_t num_rows = std::numeric_limits<std::size_t>::max()
+                   ) const
+  {
+    hid_t dataset = H5Dopen(binStreamId, dset_name.c_str(), H5P_DEFAULT);
+    if ( dataset < 0 ) {
+      if ( exitOnError )
+        throw BinaryStream_InvalidPath();
+      return dataset;
+    }
+
+    hid_t file_space = H5Dget_space(dataset);
+    hsize_t dims[2] = { 0, 0 };
+    if ( H5Sget_simple_extent_ndims(file_space) != 2 ) {
+      H5Sclose(file_space);
+      H5Dclose(dataset);
+      if ( exitOnError )
+        throw BinaryStream_InvalidDataSpace();
+      return -1;
+    }
+    H5Sget_simple_extent_dims(file_space, dims, NULL);
+
+    num_cols = dims[1];
+    std::size_t avail = (first_row < dims[0]) ? dims[0] - first_row : 0;
+    hsize_t offset[2] = { first_row, 0 };
+    hsize_t count[2]  = { std::min(num_rows, avail), dims[1] };
+    buf.resize(count[0]*count[1]);
+
+    herr_t status = 0;
+    if ( !buf.empty() ) {
+      hid_t mem_space = H5Screate_simple(2, count, NULL);
+      H5Sselect_hyperslab(file_space, H5S_SELECT_SET, offset, NULL, count,
+                          NULL);
+      status = H5Dread(dataset, NativeDataTypes<T>::datatype(), mem_space,
+                       file_space, H5P_DEFAULT, &buf[0]);
+      H5Sclose(mem_space);
+    }
+    H5Sclose(file_space);
+    H5Dclose(dataset);
+
+    if ( status < 0 && exitOnError )
+      throw BinaryStream_GetDataFailure();
+    return status;
+  }
+
+
   template <typename T, size_t DIM>
   herr_t read_data(const std::string& dset_name,
                    std::vector<T>& buf) const
@@ -721,12 +861,28 @@ public:
 
     size_t num_str = dims[0];
     string_array.resize(num_str);
+    if (num_str == 0)
+      return size_stat;
 
-    for (size_t i=0; i<num_str; ++i) {
-      // TODO: read each string from the HDF5 sharing core with above reader
-      ;
+    // the library allocates each variable length string on read
+    std::vector<char*> rdata(num_str);
+    hid_t dataset = H5Dopen(binStreamId, dset_name.c_str(), H5P_DEFAULT);
+    hid_t str_type = H5VariableString::datatype();
+    herr_t ret_val = H5Dread(dataset, str_type, H5S_ALL, H5S_ALL,
+			     H5P_DEFAULT, &rdata[0]);
+    if (ret_val >= 0) {
+      for (size_t i=0; i<num_str; ++i)
+	string_array[i] = (rdata[i]) ? rdata[i] : "";
+      hid_t space = H5Dget_space(dataset);
+      H5Dvlen_reclaim(str_type, space, H5P_DEFAULT, &rdata[0]);
+      H5Sclose(space);
     }
+    H5Dclose(dataset);
+
+    if ( ret_val < 0 && exitOnError )
+      throw BinaryStream_GetDataFailure();
 
+    return ret_val;
   }
 
 
@@ -1031,6 +1187,9 @@ private:
   /// In-class caching of the error status code (mostly for debugging)
   herr_t errorStatus;
 
+  /// whether the file belongs to another process and is not closed
+  bool fileDetached;
+
 
   // WJB:  consider boost::ublas::bounded_vector type instead
   //static std::vector<hsize_t, 1> staticVectorDims;
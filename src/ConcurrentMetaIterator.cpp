@@ -25,7 +25,9 @@ namespace Dakota {
 ConcurrentMetaIterator::ConcurrentMetaIterator(ProblemDescDB& problem_db):
   MetaIterator(problem_db),
   numRandomJobs(probDescDB.get_int("method.concurrent.random_jobs")),
-  randomSeed(probDescDB.get_int("method.random_seed"))
+  randomSeed(probDescDB.get_int("method.random_seed")),
+  convergedStarts(probDescDB.get_int("method.concurrent.converged_starts")),
+  matchTol(probDescDB.get_real("method.concurrent.match_tolerance"))
 {
   // ***************************************************************************
   // TO DO: support concurrent meta-iteration for both Minimizer & Analyzer:
@@ -107,7 +109,9 @@ ConcurrentMetaIterator::
 ConcurrentMetaIterator(ProblemDescDB& problem_db, Model& model):
   MetaIterator(problem_db, model),
   numRandomJobs(probDescDB.get_int("method.concurrent.random_jobs")),
-  randomSeed(probDescDB.get_int("method.random_seed"))
+  randomSeed(probDescDB.get_int("method.random_seed")),
+  convergedStarts(probDescDB.get_int("method.concurrent.converged_starts")),
+  matchTol(probDescDB.get_real("method.concurrent.match_tolerance"))
 {
   const RealVector& raw_param_sets
     = problem_db.get_rv("method.concurrent.parameter_sets");
@@ -357,6 +361,15 @@ void ConcurrentMetaIterator::pre_run()
   // all iterator masters bookkeep on the full results list, even if
   // only some entries are defined locally
   prpResults.resize(iterSched.numIteratorJobs);
+
+  // early termination compares a single objective across jobs
+  completedObjectives.clear();
+  if (convergedStarts && iteratedModel.num_primary_fns() != 1) {
+    if (iterSched.lead_rank())
+      Cerr << "\nWarning: converged_starts requires a single objective "
+	   << "function and will be ignored." << std::endl;
+    convergedStarts = 0;
+  }
 }
 
 
@@ -375,6 +388,45 @@ void ConcurrentMetaIterator::core_run()
 }
 
 
+/** Jobs are considered to have converged to the same solution when
+    their final objectives agree with the best to within a relative
+    tolerance.  Once convergedStarts completed jobs match the best, the
+    scheduler is asked not to assign the remaining jobs; results are
+    then streamed in only for jobs that were already assigned. */
+void ConcurrentMetaIterator::check_converged_starts(int job_index)
+{
+  if (!convergedStarts || iterSched.terminateJobs)
+    return;
+
+  const Response& resp = prpResults[job_index].response();
+  if (resp.is_null() || resp.num_functions() == 0)
+    return;
+  completedObjectives.push_back(resp.function_value(0));
+
+  const BoolDeque& max_sense = iteratedModel.primary_response_fn_sense();
+  bool maximize = (!max_sense.empty() && max_sense[0]);
+  size_t i, num_completed = completedObjectives.size();
+  Real best = completedObjectives[0];
+  for (i=1; i<num_completed; ++i)
+    if ( (maximize) ? completedObjectives[i] > best :
+	 completedObjectives[i] < best )
+      best = completedObjectives[i];
+
+  int num_matched = 0;
+  Real tol = matchTol * std::max(1., std::abs(best));
+  for (i=0; i<num_completed; ++i)
+    if (std::abs(completedObjectives[i] - best) <= tol)
+      ++num_matched;
+
+  if (num_matched >= convergedStarts) {
+    Cout << "\nMulti-start: " << num_matched << " of " << num_completed
+	 << " completed jobs match the best objective " << best
+	 << "; no further jobs will be assigned.\n";
+    iterSched.terminateJobs = true;
+  }
+}
+
+
 void ConcurrentMetaIterator::print_results(std::ostream& s)
 {
   using std::setw;
@@ -423,6 +475,8 @@ void ConcurrentMetaIterator::print_results(std::ostream& s)
   size_t num_results = prpResults.size();
   for (i=0; i<num_results; ++i) {
     const ParamResponsePair& prp_result = prpResults[i];
+    if (prp_result.eval_id() == 0) // job not run following early termination
+      continue;
     s << std::setprecision(10) << std::resetiosflags(std::ios::floatfield)
          << setw(9) << prp_result.eval_id() << ' ';
     for (size_t j=0; j<paramSetLen; ++j)
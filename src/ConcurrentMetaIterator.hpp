@@ -97,6 +97,11 @@ private:
   /// and define param_set_len
   void initialize_model();
 
+  /// record the final objective of a completed MULTI_START job and
+  /// request early termination of the job schedule once convergedStarts
+  /// completed jobs match the best objective
+  void check_converged_starts(int job_index);
+
   //
   //- Heading: Data members
   //
@@ -119,6 +124,13 @@ private:
   int numRandomJobs;
   /// seed for random number generator for random samples
   int randomSeed;
+  /// number of completed MULTI_START jobs matching the best objective
+  /// that terminates the assignment of further jobs (0 = run all jobs)
+  int convergedStarts;
+  /// relative tolerance used to match the final objectives of jobs
+  Real matchTol;
+  /// final objectives of the MULTI_START jobs completed so far
+  RealArray completedObjectives;
   /// 1-d array of ParamResponsePair results corresponding to numIteratorJobs
   PRPArray prpResults;
 };
@@ -209,7 +221,10 @@ pack_results_buffer(MPIPackBuffer& send_buffer, int job_index)
 
 inline void ConcurrentMetaIterator::
 unpack_results_buffer(MPIUnpackBuffer& recv_buffer, int job_index)
-{ recv_buffer >> prpResults[job_index]; }
+{
+  recv_buffer >> prpResults[job_index];
+  check_converged_starts(job_index);
+}
 
 
 inline void ConcurrentMetaIterator::update_local_results(int job_index)
@@ -219,6 +234,7 @@ inline void ConcurrentMetaIterator::update_local_results(int job_index)
 			iteratedModel.interface_id(),
 			selectedIterator.response_results(),
 			job_index+1); // deep copy
+  check_converged_starts(job_index);
 }
 
 } // namespace Dakota
@@ -596,8 +596,33 @@ void Analyzer::pre_output()
     return;
   }
 
+  unsigned short tabular_format = 
+    parallelLib.program_options().pre_run_output_format();
+  bool binary = (tabular_format & TABULAR_BINARY);
   std::ofstream tabular_file;
-  TabularIO::open_file(tabular_file, filename, "pre-run output");
+  TabularIO::open_file(tabular_file, filename, "pre-run output", binary);
+
+  if (binary) {
+    // no response data, so the binary schema has only variables columns
+    TabularIO::BinaryTabularWriter binary_writer;
+    Variables vars = iteratedModel.current_variables().copy();
+    binary_writer.write_header(tabular_file, vars, StringArray());
+    RealVector no_fn_vals;
+    for (size_t eval_index = 0; eval_index < num_evals; eval_index++) {
+      if (compactMode)
+	sample_to_variables(allSamples[eval_index], vars);
+      binary_writer.write_row(tabular_file, compactMode ? vars :
+			      allVariables[eval_index],
+			      iteratedModel.interface_id(), no_fn_vals,
+			      eval_index+1);
+    }
+    binary_writer.flush(tabular_file);
+    tabular_file.close();
+    if (outputLevel > QUIET_OUTPUT)
+      Cout << "\nPre-run phase complete: variables written to binary tabular "
+	   << "file " << filename << ".\n" << std::endl;
+    return;
+  }
 
   // try to mitigate errors resulting from lack of precision in output
   // the full 17 digits might surprise users, but will reduce
@@ -613,8 +638,6 @@ void Analyzer::pre_output()
   // When in compactMode, get the inactive variables off the Model and
   // use sample_to_variables to set the discrete variables not treated
   // by allSamples.
-  unsigned short tabular_format = 
-    parallelLib.program_options().pre_run_output_format();
   TabularIO::write_header_tabular(tabular_file,
 				  iteratedModel.current_variables(), 
 				  iteratedModel.current_response(),
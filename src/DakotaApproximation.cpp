@@ -19,6 +19,7 @@
 #include "TANA3Approximation.hpp"
 #include "PecosApproximation.hpp"
 #include "GaussProcApproximation.hpp"
+#include "SparseGaussProcApproximation.hpp"
 #include "VPSApproximation.hpp"
 #ifdef HAVE_SURFPACK
 #include "SurfpackApproximation.hpp"
@@ -129,6 +130,9 @@ get_approx(ProblemDescDB& problem_db, const SharedApproxData& shared_data,
       return new PecosApproximation(problem_db, shared_data, approx_label);
     else if (approx_type == "global_gaussian")
       return new GaussProcApproximation(problem_db, shared_data, approx_label);
+    else if (approx_type == "global_sparse_gaussian")
+      return new SparseGaussProcApproximation(problem_db, shared_data,
+					      approx_label);
 #ifdef HAVE_SURFPACK
     else if (approx_type == "global_polynomial"     ||
 	     approx_type == "global_kriging"        ||
@@ -184,6 +188,8 @@ Approximation* Approximation::get_approx(const SharedApproxData& shared_data)
     approx = new PecosApproximation(shared_data);
   else if (approx_type == "global_gaussian")
     approx = new GaussProcApproximation(shared_data);
+  else if (approx_type == "global_sparse_gaussian")
+    approx = new SparseGaussProcApproximation(shared_data);
   else if (approx_type == "global_voronoi_surrogate")
     approx = new VPSApproximation(shared_data);
 #ifdef HAVE_SURFPACK
@@ -305,6 +311,47 @@ void Approximation::export_model(const String& fn_label,
 }
 
 
+bool Approximation::model_archive_available()
+{
+  if (approxRep) // envelope fwd to letter
+    return approxRep->model_archive_available();
+  else // default for letter lacking virtual fn redefinition
+    return false;
+}
+
+
+String Approximation::model_settings()
+{
+  if (approxRep) // envelope fwd to letter
+    return approxRep->model_settings();
+  else // default for letter lacking virtual fn redefinition
+    return sharedDataRep->approxType;
+}
+
+
+void Approximation::save_model(std::ostream& s)
+{
+  if (approxRep)
+    approxRep->save_model(s);
+  else {
+    Cerr << "Error: save_model() not available for this approximation type."
+	 << std::endl;
+    abort_handler(-1);
+  }
+}
+
+
+bool Approximation::load_model(std::istream& s)
+{
+  if (!approxRep) {
+    Cerr << "Error: load_model() not available for this approximation type."
+	 << std::endl;
+    abort_handler(-1);
+  }
+  return approxRep->load_model(s);
+}
+
+
 /** This is the common base class portion of the virtual fn and is
     insufficient on its own; derived implementations should explicitly
     invoke (or reimplement) this base class contribution. */
@@ -72,6 +72,18 @@ public:
   virtual void export_model(const String& fn_label = "", 
       const String& export_prefix = "", 
       const unsigned short export_format = NO_MODEL_FORMAT );
+  /// check if the built approximation can be archived using
+  /// save_model() and restored using load_model()
+  virtual bool model_archive_available();
+  /// return the settings, beyond the build data, that determine the
+  /// built approximation; used to identify archived approximations
+  virtual String model_settings();
+  /// write the built approximation to a binary stream
+  virtual void save_model(std::ostream& s);
+  /// restore a built approximation from a stream written by
+  /// save_model(); returns false, leaving the approximation unchanged,
+  /// if the stream cannot be read
+  virtual bool load_model(std::istream& s);
   /// rebuilds the approximation incrementally
   virtual void rebuild();
   /// removes entries from end of SurrogateData::{vars,resp}Data
@@ -1033,6 +1033,9 @@ void Iterator::run()
     // name/id duplication, so increment execution number for this name/id pair
     String method_string = method_enum_to_string(methodName);
     execNum = ResultsID::instance().increment_id(method_string, method_id());
+    // archive evaluations by top-level iterator run
+    if (summaryOutputFlag)
+      parallelLib.output_manager().archive_evaluations(run_identifier());
 
     initialize_run();
     if (summaryOutputFlag)
@@ -1059,6 +1062,10 @@ void Iterator::run()
     if (summaryOutputFlag)
       Cout << "\n<<<<< Iterator " << method_string <<" completed.\n";
     finalize_run();
+    // write out asynchronously buffered output at top-level iterator
+    // boundaries, rather than per evaluation
+    if (summaryOutputFlag)
+      parallelLib.output_manager().flush_output();
   }
 }
 
@@ -1510,6 +1517,10 @@ void Iterator::initialize_graphics(int iterator_server_id)
       auto_log = true;
     }
 
+    // archive the evaluation history to the results database
+    if (resultsDB.hdf5_active())
+      auto_log = true;
+
     if (auto_log) // turn out automatic graphics logging
       iteratedModel.auto_graphics(true);
   }
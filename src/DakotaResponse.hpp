@@ -277,6 +277,8 @@ public:
 
   /// function to check responseRep (does this handle contain a body)
   bool is_null() const;
+  /// return the number of handles sharing responseRep
+  int reference_count() const;
  
   /// method to set the covariance matrix defined for ExperimentResponse
   virtual void set_scalar_covariance(RealVector& scalars);
@@ -865,6 +867,10 @@ inline bool Response::is_null() const
 { return (responseRep == NULL); }
 
 
+inline int Response::reference_count() const
+{ return (responseRep) ? responseRep->referenceCount : referenceCount; }
+
+
 inline RealMatrix Response::field_gradients_view(size_t i) const
 {
   if (responseRep)
@@ -518,6 +518,8 @@ public:
 
   /// function to check variablesRep (does this envelope contain a letter)
   bool is_null() const;
+  /// return the number of handles sharing variablesRep
+  int reference_count() const;
 
 protected:
 
@@ -1519,6 +1521,10 @@ inline bool Variables::is_null() const
 { return (variablesRep == NULL); }
 
 
+inline int Variables::reference_count() const
+{ return (variablesRep) ? variablesRep->referenceCount : referenceCount; }
+
+
 inline void Variables::build_views()
 {
   // called only from letters
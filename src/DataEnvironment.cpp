@@ -27,7 +27,7 @@ DataEnvironmentRep::DataEnvironmentRep():
   tabularDataFile("dakota_tabular.dat"), tabularFormat(TABULAR_ANNOTATED), 
   outputPrecision(0), 
   resultsOutputFlag(false), resultsOutputFile("dakota_results.txt"), 
-  referenceCount(1)
+  resultsOutputCompression(0), referenceCount(1)
 { }
 
 
@@ -40,7 +40,8 @@ void DataEnvironmentRep::write(MPIPackBuffer& s) const
     << preRunOutputFormat << postRunInputFormat
     << graphicsFlag << tabularDataFlag << tabularDataFile << tabularFormat 
     << outputPrecision
-    << resultsOutputFlag << resultsOutputFile << topMethodPointer;
+    << resultsOutputFlag << resultsOutputFile << resultsOutputCompression
+    << topMethodPointer;
 }
 
 
@@ -53,7 +54,8 @@ void DataEnvironmentRep::read(MPIUnpackBuffer& s)
     >> preRunOutputFormat >> postRunInputFormat
     >> graphicsFlag >> tabularDataFlag >> tabularDataFile >> tabularFormat 
     >> outputPrecision
-    >> resultsOutputFlag >> resultsOutputFile >> topMethodPointer;
+    >> resultsOutputFlag >> resultsOutputFile >> resultsOutputCompression
+    >> topMethodPointer;
 }
 
 
@@ -66,7 +68,8 @@ void DataEnvironmentRep::write(std::ostream& s) const
     << preRunOutputFormat << postRunInputFormat
     << graphicsFlag << tabularDataFlag << tabularDataFile << tabularFormat 
     << outputPrecision
-    << resultsOutputFlag << resultsOutputFile << topMethodPointer;
+    << resultsOutputFlag << resultsOutputFile << resultsOutputCompression
+    << topMethodPointer;
 }
 
 
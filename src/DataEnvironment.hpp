@@ -93,6 +93,8 @@ public:
   bool resultsOutputFlag;
   /// named file for results output
   String resultsOutputFile;
+  /// deflate level (0-9) for an HDF5 results file; 0 disables compression
+  int resultsOutputCompression;
 
   /// method identifier for the environment (from the \c top_method_pointer
   /// specification
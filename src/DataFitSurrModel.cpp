@@ -227,6 +227,7 @@ DataFitSurrModel(Iterator& dace_iterator, Model& actual_model,
   if (grad_flag)
     gradientType = (approx_type == "global_polynomial" ||
       approx_type == "global_gaussian" || approx_type == "global_kriging" ||
+      approx_type == "global_sparse_gaussian" ||
       strends(approx_type, "_orthogonal_polynomial") ||
       strends(approx_type, "_interpolation_polynomial") ||
       strbegins(approx_type, "local_") ||
@@ -1827,10 +1828,15 @@ import_points(unsigned short tabular_format, bool active_only)
 void DataFitSurrModel::initialize_export()
 {
   if (!exportPointsFile.empty()) {
+    bool binary = (exportFormat & TABULAR_BINARY);
     TabularIO::open_file(exportFileStream, exportPointsFile,
-			 "DataFitSurrModel export");
-    TabularIO::write_header_tabular(exportFileStream, currentVariables,
-				    currentResponse, "eval_id", exportFormat);
+			 "DataFitSurrModel export", binary);
+    if (binary)
+      exportBinaryWriter.write_header(exportFileStream, currentVariables,
+				      currentResponse);
+    else
+      TabularIO::write_header_tabular(exportFileStream, currentVariables,
+				      currentResponse, "eval_id", exportFormat);
   }
 }
 
@@ -1838,9 +1844,12 @@ void DataFitSurrModel::initialize_export()
 /** Constructor helper to export approximation-based evaluations to a file. */
 void DataFitSurrModel::finalize_export()
 {
-  if (!exportPointsFile.empty())
+  if (!exportPointsFile.empty()) {
+    if (exportFormat & TABULAR_BINARY)
+      exportBinaryWriter.flush(exportFileStream);
     TabularIO::close_file(exportFileStream, exportPointsFile,
 			  "DataFitSurrModel export");
+  }
 }
 
 
@@ -1856,9 +1865,17 @@ export_point(int eval_id, const Variables& vars, const Response& resp)
   if (recastings()) {
     Variables export_vars; Response export_resp;
     iterator_space_to_user_space(vars, resp, export_vars, export_resp);
-    TabularIO::write_data_tabular(exportFileStream, export_vars, interface_id(),
-				  export_resp, eval_id, exportFormat);
+    if (exportFormat & TABULAR_BINARY)
+      exportBinaryWriter.write_row(exportFileStream, export_vars,
+				   interface_id(), export_resp, eval_id);
+    else
+      TabularIO::write_data_tabular(exportFileStream, export_vars,
+				    interface_id(), export_resp, eval_id,
+				    exportFormat);
   }
+  else if (exportFormat & TABULAR_BINARY)
+    exportBinaryWriter.write_row(exportFileStream, vars, interface_id(), resp,
+				 eval_id);
   else
     TabularIO::write_data_tabular(exportFileStream, vars, interface_id(), resp, 
 				  eval_id, exportFormat);
@@ -24,6 +24,7 @@
 #include "DakotaIterator.hpp"
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
+#include "dakota_tabular_io.hpp"
 
 
 namespace Dakota {
@@ -357,6 +358,8 @@ private:
   unsigned short exportFormat;
   /// output file stream for \c export_approx_points_file specification
   std::ofstream exportFileStream;
+  /// writer buffering the rows of a binary \c export_approx_points_file
+  TabularIO::BinaryTabularWriter exportBinaryWriter;
 
   /// manages the building and subsequent evaluation of the approximations
   /// (required for both global and local)
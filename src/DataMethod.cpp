@@ -28,9 +28,10 @@ DataMethodRep::DataMethodRep():
   methodName(DEFAULT_METHOD), subMethod(SUBMETHOD_DEFAULT),
   // Meta-iterators
   iteratorServers(0), procsPerIterator(0), // 0 defaults to detect user spec
-  iteratorScheduling(DEFAULT_SCHEDULING), hybridLSProb(0.1),
-  //hybridProgThresh(0.5),
-  concurrentRandomJobs(0),
+  iteratorScheduling(DEFAULT_SCHEDULING), localIteratorServers(1),
+  hybridLSProb(0.1), hybridPipelined(false), //hybridProgThresh(0.5),
+  concurrentRandomJobs(0), concurrentConvergedStarts(0),
+  concurrentMatchTol(1.e-4),
   // Local surrogate-based opt/NLS
   softConvLimit(0), // dummy value -> method-specific default
   surrBasedLocalLayerBypass(false),  //trustRegionInitSize(0.4),
@@ -136,7 +137,8 @@ DataMethodRep::DataMethodRep():
   reliabilitySearchType(MV), integrationRefine(NO_INT_REFINE),
   finalMomentsType(STANDARD_MOMENTS), distributionType(CUMULATIVE),
   responseLevelTarget(PROBABILITIES), responseLevelTargetReduce(COMPONENT),
-  chainSamples(0), buildSamples(0), samplesOnEmulator(0), emulatorOrder(0),
+  chainSamples(0), mcmcChains(1), mcmcPrefetchDepth(0), buildSamples(0),
+  samplesOnEmulator(0), emulatorOrder(0),
   emulatorType(NO_EMULATOR), mcmcType("dram"), standardizedSpace(false),
   adaptPosteriorRefine(false), logitTransform(false), gpmsaNormalize(false),
   posteriorStatsKL(false),
@@ -181,13 +183,15 @@ void DataMethodRep::write(MPIPackBuffer& s) const
 
   // Meta-iterators
   s << iteratorServers << procsPerIterator << iteratorScheduling
-    << hybridMethodNames << hybridModelPointers << hybridMethodPointers
+    << localIteratorServers << hybridMethodNames << hybridModelPointers << hybridMethodPointers
   //<< hybridProgThresh
     << hybridGlobalMethodName << hybridGlobalModelPointer
     << hybridGlobalMethodPointer << hybridLocalMethodName
     << hybridLocalModelPointer << hybridLocalMethodPointer << hybridLSProb
+    << hybridPipelined
   //<< branchBndNumSamplesRoot << branchBndNumSamplesNode
-    << concurrentRandomJobs << concurrentParameterSets;
+    << concurrentRandomJobs << concurrentParameterSets
+    << concurrentConvergedStarts << concurrentMatchTol;
 
   // Surrogate-based
   s << softConvLimit << surrBasedLocalLayerBypass
@@ -281,7 +285,8 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << pilotSamples << finalMomentsType << distributionType << responseLevelTarget
     << responseLevelTargetReduce << responseLevels << probabilityLevels
     << reliabilityLevels << genReliabilityLevels << chainSamples
-    << buildSamples << samplesOnEmulator << emulatorOrder << emulatorType
+    << mcmcChains << mcmcPrefetchDepth << buildSamples << samplesOnEmulator
+    << emulatorOrder << emulatorType
     << mcmcType << standardizedSpace << adaptPosteriorRefine << logitTransform
     << gpmsaNormalize
     << posteriorStatsKL << posteriorStatsMutual << preSolveMethod
@@ -329,13 +334,15 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
 
   // Meta-iterators
   s >> iteratorServers >> procsPerIterator >> iteratorScheduling
-    >> hybridMethodNames >> hybridModelPointers >> hybridMethodPointers
+    >> localIteratorServers >> hybridMethodNames >> hybridModelPointers >> hybridMethodPointers
   //>> hybridProgThresh
     >> hybridGlobalMethodName >> hybridGlobalModelPointer
     >> hybridGlobalMethodPointer >> hybridLocalMethodName
     >> hybridLocalModelPointer >> hybridLocalMethodPointer >> hybridLSProb
+    >> hybridPipelined
   //>> branchBndNumSamplesRoot >> branchBndNumSamplesNode
-    >> concurrentRandomJobs >> concurrentParameterSets;
+    >> concurrentRandomJobs >> concurrentParameterSets
+    >> concurrentConvergedStarts >> concurrentMatchTol;
 
   // Surrogate-based
   s >> softConvLimit >> surrBasedLocalLayerBypass
@@ -429,7 +436,8 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> pilotSamples >> finalMomentsType >> distributionType >> responseLevelTarget
     >> responseLevelTargetReduce >> responseLevels >> probabilityLevels
     >> reliabilityLevels >> genReliabilityLevels >> chainSamples
-    >> buildSamples >> samplesOnEmulator >> emulatorOrder >> emulatorType
+    >> mcmcChains >> mcmcPrefetchDepth >> buildSamples >> samplesOnEmulator
+    >> emulatorOrder >> emulatorType
     >> mcmcType >> standardizedSpace >> adaptPosteriorRefine >> logitTransform
     >> gpmsaNormalize
     >> posteriorStatsKL >> posteriorStatsMutual >> preSolveMethod
@@ -477,13 +485,15 @@ void DataMethodRep::write(std::ostream& s) const
 
   // Meta-iterators
   s << iteratorServers << procsPerIterator << iteratorScheduling
-    << hybridMethodNames << hybridModelPointers << hybridMethodPointers
+    << localIteratorServers << hybridMethodNames << hybridModelPointers << hybridMethodPointers
   //<< hybridProgThresh
     << hybridGlobalMethodName << hybridGlobalModelPointer
     << hybridGlobalMethodPointer << hybridLocalMethodName
     << hybridLocalModelPointer << hybridLocalMethodPointer << hybridLSProb
+    << hybridPipelined
   //<< branchBndNumSamplesRoot << branchBndNumSamplesNode
-    << concurrentRandomJobs << concurrentParameterSets;
+    << concurrentRandomJobs << concurrentParameterSets
+    << concurrentConvergedStarts << concurrentMatchTol;
 
   // Surrogate-based
   s << softConvLimit << surrBasedLocalLayerBypass
@@ -577,7 +587,8 @@ void DataMethodRep::write(std::ostream& s) const
     << pilotSamples << finalMomentsType << distributionType << responseLevelTarget
     << responseLevelTargetReduce << responseLevels << probabilityLevels
     << reliabilityLevels << genReliabilityLevels << chainSamples
-    << buildSamples << samplesOnEmulator << emulatorOrder << emulatorType
+    << mcmcChains << mcmcPrefetchDepth << buildSamples << samplesOnEmulator
+    << emulatorOrder << emulatorType
     << mcmcType << standardizedSpace << adaptPosteriorRefine << logitTransform
     << gpmsaNormalize
     << posteriorStatsKL << posteriorStatsMutual << preSolveMethod
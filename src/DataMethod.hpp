@@ -316,6 +316,10 @@ public:
   /// type of scheduling ({DEFAULT,MASTER,PEER}_SCHEDULING) used in concurrent
   /// iterator parallelism (from the \c iterator_scheduling specification)
   short iteratorScheduling;
+  /// number of forked local processes among which concurrent iterator
+  /// jobs are dynamically scheduled in the absence of message passing
+  /// (from the \c local_iterator_servers specification)
+  int localIteratorServers;
 
   /// array of methods for the sequential and collaborative hybrid
   /// meta-iterators (from the \c method_name_list specification)
@@ -350,6 +354,9 @@ public:
   /// local search probability for embedded hybrids (from the \c
   /// local_search_probability specification)
   Real hybridLSProb;
+  /// whether a sequential hybrid overlaps its first two methods (from
+  /// the \c pipelined specification)
+  bool hybridPipelined;
 
   /// number of random jobs to perform in the pareto_set and
   /// multi_start meta-iterators (from the \c random_starts and \c
@@ -359,6 +366,13 @@ public:
   /// the pareto_set and multi_start meta-iterators (from the \c
   /// starting_points and \c weight_sets specifications)
   RealVector concurrentParameterSets;
+  /// number of completed multi_start jobs whose final objective matches
+  /// the best found that terminates the assignment of further jobs
+  /// (from the \c converged_starts specification)
+  int concurrentConvergedStarts;
+  /// relative tolerance used to match the final objectives of multi_start
+  /// jobs (from the \c match_tolerance specification)
+  Real concurrentMatchTol;
 
   /// number of consecutive iterations with change less than
   /// convergenceTolerance required to trigger convergence
@@ -925,6 +939,13 @@ public:
   RealVectorArray genReliabilityLevels;
   /// the number of MCMC chain samples
   int chainSamples;
+  /// the number of independent MCMC chains (from the \c chains
+  /// specification for QUESO)
+  int mcmcChains;
+  /// the depth of the speculative proposal tree evaluated concurrently
+  /// by prefetching Metropolis (from the \c prefetch_depth specification
+  /// for QUESO)
+  int mcmcPrefetchDepth;
   /// the number of samples to construct an emulator, e.g., for
   /// Bayesian calibration methods
   int buildSamples;
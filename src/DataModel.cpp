@@ -33,10 +33,12 @@ DataModelRep::DataModelRep():
   marsMaxBases(0), annRandomWeight(0), annNodes(0), annRange(0.0), 
   domainDecomp(false), decompCellType("voronoi"), decompSupportLayers(0),
   decompDiscontDetect(false), discontJumpThresh(0.0), discontGradThresh(0.0),
-  trendOrder("reduced_quadratic"), pointSelection(false),
+  trendOrder("reduced_quadratic"), pointSelection(false), inducingPoints(0),
   crossValidateFlag(false), numFolds(0), percentFold(0.0), pressFlag(false),
   importChallengeFormat(TABULAR_ANNOTATED), importChallengeActive(false),
+  buildConcurrency(1),
   subMethodServers(0), subMethodProcs(0), // 0 defaults to detect user spec
+  subMethodLocalServers(1), subMethodMemoize(false),
   subMethodScheduling(DEFAULT_SCHEDULING), initialSamples(0),
   maxIterations(100), convergenceTolerance(1.0e-4), softConvergenceLimit(0),
   subspaceIdBingLi(false), subspaceIdConstantine(false),
@@ -72,12 +74,15 @@ void DataModelRep::write(MPIPackBuffer& s) const
     << marsMaxBases << marsInterpolation << annRandomWeight << annNodes
     << annRange << domainDecomp << decompCellType << decompSupportLayers
     << decompDiscontDetect << discontJumpThresh << discontGradThresh
-    << trendOrder << pointSelection << diagMetrics << crossValidateFlag
-    << numFolds << percentFold << pressFlag << importChallengePtsFile
-    << importChallengeFormat << importChallengeActive
+    << trendOrder << pointSelection << inducingPoints << diagMetrics
+    << crossValidateFlag << numFolds << percentFold << pressFlag
+    << importChallengePtsFile
+    << importChallengeFormat << importChallengeActive << buildConcurrency
+    << modelCachePrefix
     << optionalInterfRespPointer << primaryVarMaps << secondaryVarMaps
     << primaryRespCoeffs << secondaryRespCoeffs << subMethodServers
-    << subMethodProcs << subMethodScheduling 
+    << subMethodProcs << subMethodLocalServers << subMethodMemoize
+    << subMethodScheduling 
     << initialSamples << refineSamples << maxIterations 
     << convergenceTolerance << softConvergenceLimit << subspaceIdBingLi 
     << subspaceIdConstantine << subspaceIdEnergy << subspaceBuildSurrogate
@@ -111,12 +116,15 @@ void DataModelRep::read(MPIUnpackBuffer& s)
     >> marsMaxBases >> marsInterpolation >> annRandomWeight >> annNodes
     >> annRange >> domainDecomp >> decompCellType >> decompSupportLayers
     >> decompDiscontDetect >> discontJumpThresh >> discontGradThresh
-    >> trendOrder >> pointSelection >> diagMetrics >> crossValidateFlag
-    >> numFolds >> percentFold >> pressFlag >> importChallengePtsFile
-    >> importChallengeFormat >> importChallengeActive
+    >> trendOrder >> pointSelection >> inducingPoints >> diagMetrics
+    >> crossValidateFlag >> numFolds >> percentFold >> pressFlag
+    >> importChallengePtsFile
+    >> importChallengeFormat >> importChallengeActive >> buildConcurrency
+    >> modelCachePrefix
     >> optionalInterfRespPointer >> primaryVarMaps >> secondaryVarMaps
     >> primaryRespCoeffs >> secondaryRespCoeffs >> subMethodServers
-    >> subMethodProcs >> subMethodScheduling     
+    >> subMethodProcs >> subMethodLocalServers >> subMethodMemoize
+    >> subMethodScheduling     
     >> initialSamples >> refineSamples >> maxIterations 
     >> convergenceTolerance >> softConvergenceLimit >> subspaceIdBingLi 
     >> subspaceIdConstantine >> subspaceIdEnergy >> subspaceBuildSurrogate
@@ -150,12 +158,15 @@ void DataModelRep::write(std::ostream& s) const
     << marsMaxBases << marsInterpolation << annRandomWeight << annNodes
     << annRange << domainDecomp << decompCellType << decompSupportLayers
     << decompDiscontDetect << discontJumpThresh << discontGradThresh
-    << trendOrder << pointSelection << diagMetrics << crossValidateFlag
-    << numFolds << percentFold << pressFlag << importChallengePtsFile
-    << importChallengeFormat << importChallengeActive
+    << trendOrder << pointSelection << inducingPoints << diagMetrics
+    << crossValidateFlag << numFolds << percentFold << pressFlag
+    << importChallengePtsFile
+    << importChallengeFormat << importChallengeActive << buildConcurrency
+    << modelCachePrefix
     << optionalInterfRespPointer << primaryVarMaps << secondaryVarMaps
     << primaryRespCoeffs << secondaryRespCoeffs << subMethodServers
-    << subMethodProcs << subMethodScheduling 
+    << subMethodProcs << subMethodLocalServers << subMethodMemoize
+    << subMethodScheduling 
     << initialSamples << refineSamples << maxIterations 
     << convergenceTolerance << subspaceIdBingLi << subspaceIdConstantine
     << subspaceIdEnergy << subspaceBuildSurrogate
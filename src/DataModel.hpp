@@ -245,6 +245,9 @@ public:
   String trendOrder;
   /// flag indicating the use of point selection in the Gaussian process
   bool pointSelection;
+  /// number of inducing points for the sparse Gaussian process (0 selects
+  /// max(50, 10*num_vars)); limited to the number of build points
+  int inducingPoints;
   /// List of diagnostic metrics the user requests to assess the 
   /// goodness of fit for a surrogate model.
   StringArray diagMetrics;
@@ -264,6 +267,13 @@ public:
   unsigned short importChallengeFormat;
   /// whether to import active variables only
   bool importChallengeActive;
+  /// number of response function approximations to build concurrently
+  /// (from the \c build_concurrency specification in \ref ModelSurrG)
+  int buildConcurrency;
+  /// file name prefix for persisted approximations that are reused when
+  /// the build data and settings match (from the \c model_cache_prefix
+  /// specification in \ref ModelSurrG)
+  String modelCachePrefix;
 
   // nested models
 
@@ -295,6 +305,14 @@ public:
   int subMethodServers;
   /// number of processors for each concurrent sub-iterator partition
   int subMethodProcs;
+  /// number of local processes among which a batch of sub-iterator jobs
+  /// is distributed when not message passing (from the \c
+  /// local_iterator_servers specification in \ref ModelNested)
+  int subMethodLocalServers;
+  /// flag for reusing sub-iterator results for repeated nested model
+  /// evaluations (from the \c memoize_results specification in
+  /// \ref ModelNested)
+  bool subMethodMemoize;
   /// scheduling approach for concurrent sub-iterator parallelism:
   /// {DEFAULT,MASTER,PEER}_SCHEDULING
   short subMethodScheduling;
@@ -482,7 +482,8 @@ void DataTransformModel::derived_evaluate_nowait(const ActiveSet& set)
     // bookkeep variables for use in primaryRespMapping/secondaryRespMapping
     //if (respMapping) {
     recastSetMap[recastModelEvalCntr]  = set;
-    recastVarsMap[recastModelEvalCntr] = currentVariables.copy();
+    recastVarsMap[recastModelEvalCntr]
+      = pooled_variables_copy(currentVariables, recastVarsPool);
     // This RecastModel doens't map variables in a way that needs these
     // if (variablesMapping)
     // 	subModelVarsMap[recastModelEvalCntr] =
@@ -689,7 +690,7 @@ cache_submodel_responses(const IntResponseMap& sm_resp_map, bool deep_copy)
 
 void DataTransformModel::collect_residuals(bool collect_all)
 {
-  recastResponseMap.clear();
+  recycle_recast_responses();
 
   BOOST_FOREACH(IntIntResponseMapMap::value_type& cr_pair, cachedResp) {
     int recast_id = cr_pair.first;  // (.second is a subModel IntResponseMap)
@@ -711,13 +712,14 @@ void DataTransformModel::collect_residuals(bool collect_all)
       IntASMIter s_it = recastSetMap.find(recast_id);
       IntVarsMIter v_it = recastVarsMap.find(recast_id);
 
-      recastResponseMap[recast_id] = currentResponse.copy();
+      recastResponseMap[recast_id] = pooled_recast_response();
       recastResponseMap[recast_id].active_set(s_it->second);
 
       transform_response_map(cr_pair.second, v_it->second,
                              recastResponseMap[recast_id]);
 
       // cleanup (could do clear() at end)
+      recastVarsPool.push_back(v_it->second);
       recastVarsMap.erase(v_it);
       recastSetMap.erase(s_it);
       // BMA TODO: consider iterator here instead of value?
@@ -842,8 +842,10 @@ apply_covariance_inv_sqrt(const RealVector& residuals, size_t experiment,
     allExperiments[experiment].apply_covariance_inv_sqrt(exp_resid, 
 							 weighted_residuals);
   else{
-    // Return a deep copy
-    weighted_residuals.sizeUninitialized( exp_resid.length() );
+    // Return a deep copy (into weighted_residuals if it is already a
+    // view of the correct length)
+    if ( weighted_residuals.length() != exp_resid.length() )
+      weighted_residuals.sizeUninitialized( exp_resid.length() );
     weighted_residuals.assign( exp_resid );
   }
 }
@@ -860,9 +862,12 @@ apply_covariance_inv_sqrt(const RealMatrix& gradients, size_t experiment,
     allExperiments[experiment].apply_covariance_inv_sqrt(exp_grads, 
 							 weighted_gradients);
   else{
-    // Return a deep copy
-    weighted_gradients.shapeUninitialized( exp_grads.numRows(),
-					   exp_grads.numCols() );
+    // Return a deep copy (into weighted_gradients if it is already a
+    // view of the correct shape)
+    if ( weighted_gradients.numRows() != exp_grads.numRows() ||
+	 weighted_gradients.numCols() != exp_grads.numCols() )
+      weighted_gradients.shapeUninitialized( exp_grads.numRows(),
+					     exp_grads.numCols() );
     weighted_gradients.assign( exp_grads );
   }
 }
@@ -1085,11 +1090,15 @@ interpolate_simulation_data(const Response &sim_resp, size_t exp_ind,
 			    const ShortArray &total_asv, size_t exp_offset,
 			    Response &interp_resp ) const
 {
+  update_interpolation_stencils(sim_resp, exp_ind);
+
   size_t offset = exp_offset + num_scalars();
-  IntVector field_lens = field_lengths(exp_ind);
+  const IntVector& field_lens = field_lengths(exp_ind);
+  const IntVectorArray& exp_indices = stencilIndices[exp_ind];
+  const RealVectorArray& exp_weights = stencilWeights[exp_ind];
   for (size_t field_num=0; field_num<num_fields(); field_num++){ 
-    RealMatrix exp_coords = field_coords_view(field_num,exp_ind);
-    interpolate_simulation_field_data( sim_resp, exp_coords, field_num, 
+    interpolate_simulation_field_data( sim_resp, exp_indices[field_num],
+				       exp_weights[field_num], field_num, 
 				       total_asv[exp_ind],
 				       offset, interp_resp );
     offset += field_lens[field_num]; 
@@ -1097,6 +1106,53 @@ interpolate_simulation_data(const Response &sim_resp, size_t exp_ind,
 }
 
 
+/** The stencils depend only on the simulation and experiment
+    coordinates, so they are computed on first use for each experiment
+    and recomputed only when the simulation coordinates of a field
+    change. */
+void ExperimentData::
+update_interpolation_stencils(const Response& sim_resp, size_t exp_ind) const
+{
+  size_t num_field_groups = num_fields();
+  if (stencilIndices.size() != numExperiments ||
+      stencilSimCoords.size() != num_field_groups) {
+    stencilSimCoords.clear();
+    stencilSimCoords.resize(num_field_groups);
+    stencilIndices.clear();
+    stencilIndices.resize(numExperiments, IntVectorArray(num_field_groups));
+    stencilWeights.clear();
+    stencilWeights.resize(numExperiments, RealVectorArray(num_field_groups));
+  }
+
+  for (size_t field_num=0; field_num<num_field_groups; ++field_num) {
+    const RealMatrix sim_coords = sim_resp.field_coords_view(field_num);
+    RealMatrix& cached_coords = stencilSimCoords[field_num];
+    int num_rows = sim_coords.numRows(), num_cols = sim_coords.numCols();
+    bool coords_changed = (cached_coords.numRows() != num_rows ||
+			   cached_coords.numCols() != num_cols);
+    for (int j=0; j<num_cols && !coords_changed; ++j)
+      for (int i=0; i<num_rows && !coords_changed; ++i)
+	coords_changed = (cached_coords(i,j) != sim_coords(i,j));
+    if (coords_changed) {
+      // deep copy, as sim_coords is a view into sim_resp
+      cached_coords.shapeUninitialized(num_rows, num_cols);
+      cached_coords.assign(sim_coords);
+      for (size_t e=0; e<numExperiments; ++e) {
+	stencilIndices[e][field_num].resize(0);
+	stencilWeights[e][field_num].resize(0);
+      }
+    }
+
+    IntVector& indices = stencilIndices[exp_ind][field_num];
+    if (indices.length() == 0) {
+      RealMatrix exp_coords = field_coords_view(field_num, exp_ind);
+      linear_interpolation_stencil(cached_coords, exp_coords, indices,
+				   stencilWeights[exp_ind][field_num]);
+    }
+  }
+}
+
+
 // BMA TODO: Make this call robust to zero and single experiment cases
 ShortArray ExperimentData::
 determine_active_request(const Response& resid_resp) const 
@@ -1189,14 +1245,12 @@ scale_residuals(const Response& residual_response,
        
     // apply cov_inv_sqrt to the residual vector
     if (total_asv[exp_ind] & 1) {
-      // BMA: not sure why View didn't work (was disconnected):
-      //RealVector exp_weighted_resid(residuals_view(weighted_resid, exp_ind));
-      RealVector exp_weighted_resid;
+      // the covariance application only resizes a disconnected result,
+      // so the weighted residuals are written directly through this view
+      RealVector exp_weighted_resid(residuals_view(weighted_resid, exp_ind));
       // takes full list of source residuals, but per-experiment output vector
       apply_covariance_inv_sqrt(residual_response.function_values(),
                                 exp_ind, exp_weighted_resid);
-      size_t calib_term_ind = expOffsets[exp_ind];
-      copy_data_partial(exp_weighted_resid, weighted_resid, calib_term_ind);
     }
 
   }
@@ -1205,15 +1259,20 @@ scale_residuals(const Response& residual_response,
 
 void ExperimentData::scale_residuals(Response& residual_response) const 
 {
+  // nothing to apply; the unweighted residuals are already in place
+  if (!variance_active())
+    return;
+
   ShortArray total_asv = determine_active_request(residual_response);
 
-  IntVector experiment_lengths;
-  per_exp_length(experiment_lengths);
+  // views of the full residual data; each experiment's block is scaled
+  // in place through these, so no per-experiment temporaries are formed
+  RealVector resid_vals = residual_response.function_values_view();
+  RealMatrix resid_grads = residual_response.function_gradients_view();
+  RealSymMatrixArray resid_hessians = 
+    residual_response.function_hessians_view();
 
-  size_t calib_term_ind = 0; // index into the total set of calibration terms
   for (size_t exp_ind = 0; exp_ind < numExperiments; ++exp_ind){
-    // total residuals in this exper
-    size_t num_fns_exp = experiment_lengths[exp_ind]; 
     
     // apply noise covariance to the residuals for this experiment 
     // and store in correct place in residual_response
@@ -1223,37 +1282,23 @@ void ExperimentData::scale_residuals(Response& residual_response) const
 	   << std::endl;
        
     // apply cov_inv_sqrt to the residual vector
-    RealVector weighted_resid;
-    if (total_asv[exp_ind] & 1)
-      apply_covariance_inv_sqrt(residual_response.function_values(),
-				exp_ind, weighted_resid);
-    else
-      weighted_resid = 
-	residuals_view(residual_response.function_values(), exp_ind);
+    if (total_asv[exp_ind] & 1) {
+      RealVector exp_resid = residuals_view(resid_vals, exp_ind);
+      allExperiments[exp_ind].apply_covariance_inv_sqrt(exp_resid, exp_resid);
+    }
 
     // apply cov_inv_sqrt to each row of gradient matrix
-    RealMatrix weighted_grad;
     if (total_asv[exp_ind] & 2) {
-      apply_covariance_inv_sqrt(residual_response.function_gradients(),
-				exp_ind, weighted_grad);
+      RealMatrix exp_grads = gradients_view(resid_grads, exp_ind);
+      allExperiments[exp_ind].apply_covariance_inv_sqrt(exp_grads, exp_grads);
     }
-    else
-      weighted_grad = 
-	gradients_view(residual_response.function_gradients(), exp_ind);
 
     // apply cov_inv_sqrt to non-contiguous Hessian matrices
-    RealSymMatrixArray weighted_hess;
-    if (total_asv[exp_ind] & 4)
-      apply_covariance_inv_sqrt(residual_response.function_hessians(), 
-				exp_ind, weighted_hess);
-    else
-      weighted_hess = hessians_view(residual_response.function_hessians(), 
-				    exp_ind);
-
-    copy_field_data(weighted_resid, weighted_grad, weighted_hess, 
-		    calib_term_ind, num_fns_exp, residual_response);
-
-    calib_term_ind += num_fns_exp;
+    if (total_asv[exp_ind] & 4) {
+      RealSymMatrixArray exp_hessians = hessians_view(resid_hessians, exp_ind);
+      allExperiments[exp_ind].apply_covariance_inv_sqrt(exp_hessians,
+							exp_hessians);
+    }
   }
 }
 
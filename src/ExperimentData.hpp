@@ -379,6 +379,11 @@ private:
 			 IntVector& scalar_map_indices);
 
 
+  /// compute (or reuse) the linear interpolation stencils mapping each
+  /// simulation field onto the coordinates of experiment exp_ind
+  void update_interpolation_stencils(const Response& sim_resp,
+				     size_t exp_ind) const;
+
   /// Return a view (to allowing updaing in place) of the residuals associated
   /// with a given experiment, from a vector contaning residuals from
   /// all experiments
@@ -465,6 +470,19 @@ private:
   IntVector experimentLengths;
   /// function index offsets for individual experiment data sets
   IntVector expOffsets;
+
+  // interpolation stencils, cached on first use (hence mutable) since
+  // they depend only on the simulation and experiment coordinates
+
+  /// simulation coordinates from which the cached stencils were
+  /// computed, one matrix per field
+  mutable RealMatrixArray stencilSimCoords;
+  /// per experiment, per field index of the left simulation point in
+  /// each experiment point's interpolation stencil
+  mutable std::vector<IntVectorArray> stencilIndices;
+  /// per experiment, per field weight on the right simulation point in
+  /// each experiment point's interpolation stencil
+  mutable std::vector<RealVectorArray> stencilWeights;
 };
 
 
@@ -69,66 +69,140 @@ void interpolate_simulation_field_data( const Response &sim_resp,
 					size_t field_num, short total_asv,
 					size_t interp_resp_offset,
 					Response &interp_resp ){
-  int outputLevel = 1;
-  int DEBUG_OUTPUT = 0;
-
-  const RealMatrix& sim_coords = sim_resp.field_coords_view(field_num);
-  const RealVector sim_vals = sim_resp.field_values_view(field_num);
-  RealMatrix sim_grads;
   // TODO(JDJ) : Decide if total_asv is fine grained enough. At the moment
   // it is per experiment. But we can use it at this level at the more
   // fine grained level of per field
-  if ( total_asv & 2 )
-    sim_grads = sim_resp.field_gradients_view(field_num);
-
-  RealSymMatrixArray sim_hessians;
-  if ( total_asv & 4 )
-    sim_hessians = sim_resp.field_hessians_view(field_num);
-
+  const RealMatrix& sim_coords = sim_resp.field_coords_view(field_num);
+  IntVector stencil_indices;
+  RealVector stencil_weights;
+  linear_interpolation_stencil( sim_coords, exp_coords, stencil_indices,
+				stencil_weights );
+  interpolate_simulation_field_data( sim_resp, stencil_indices, 
+				     stencil_weights, field_num, total_asv,
+				     interp_resp_offset, interp_resp );
+}
 
-  if (outputLevel >= DEBUG_OUTPUT){
-    RealVector sim_values;
-    sim_values = sim_resp.field_values_view(field_num);
-    Cout << "sim_values " << sim_values << '\n';
+void interpolate_simulation_field_data( const Response &sim_resp, 
+					const IntVector &stencil_indices,
+					const RealVector &stencil_weights,
+					size_t field_num, short total_asv,
+					size_t interp_resp_offset,
+					Response &interp_resp )
+{
+  int num_pred_pts = stencil_indices.length();
+  RealMatrix empty_grads;
+  RealSymMatrixArray empty_hessians;
+
+  // values and the leading rows of the gradients (the active submodel
+  // derivative variables) are written through views of the destination
+  // response; values are interpolated into scratch if not requested
+  if ( total_asv & 3 ) {
+    const RealVector sim_vals = sim_resp.field_values_view(field_num);
+    RealVector scratch_vals;
+    Real* vals_ptr;
+    if ( total_asv & 1 )
+      vals_ptr = interp_resp.function_values_view().values() + 
+	interp_resp_offset;
+    else {
+      scratch_vals.sizeUninitialized( num_pred_pts );
+      vals_ptr = scratch_vals.values();
+    }
+    RealVector interp_vals( Teuchos::View, vals_ptr, num_pred_pts );
+
+    if ( total_asv & 2 ) {
+      RealMatrix sim_grads = sim_resp.field_gradients_view(field_num);
+      RealMatrix resp_grads = interp_resp.function_gradients_view();
+      int num_sm_cv = sim_grads.numRows(), num_resp_cv = resp_grads.numRows();
+      RealMatrix interp_grads( Teuchos::View, resp_grads, num_sm_cv, 
+			       num_pred_pts, 0, interp_resp_offset );
+      apply_interpolation_stencil( stencil_indices, stencil_weights, sim_vals,
+				   sim_grads, empty_hessians, interp_vals,
+				   interp_grads, empty_hessians );
+      for ( int i = 0; i < num_pred_pts; i++ )
+	for ( int j = num_sm_cv; j < num_resp_cv; j++ )
+	  resp_grads(j,interp_resp_offset+i) = 0.;
+    }
+    else
+      apply_interpolation_stencil( stencil_indices, stencil_weights, sim_vals,
+				   empty_grads, empty_hessians, interp_vals,
+				   empty_grads, empty_hessians );
   }
 
-  if (outputLevel >= DEBUG_OUTPUT) {
-    Cout << "sim_coords " << sim_coords << '\n';
-    Cout << "exp_coords " << exp_coords << '\n';
-  }
-  
-  RealVector interp_vals;
-  RealMatrix interp_grads;
-  RealSymMatrixArray interp_hessians;
-  linear_interpolate_1d( sim_coords, sim_vals, sim_grads, sim_hessians,
-			 exp_coords, interp_vals, interp_grads, 
-			 interp_hessians ); 
-
-  size_t field_size = interp_vals.length();
-  
-  if (outputLevel >= DEBUG_OUTPUT) {
-    Cout << "field pred " << interp_vals << '\n';
-    Cout << "interp_resp_offset " << interp_resp_offset << '\n';
-    Cout << "field_size " << field_size << '\n';
+  if ( total_asv & 4 ) {
+    RealSymMatrixArray sim_hessians = sim_resp.field_hessians_view(field_num);
+    for ( int i = 0; i < num_pred_pts; i++ ){
+      int k = stencil_indices[i];
+      Real w = stencil_weights[i];
+      const RealSymMatrix &left_hess = sim_hessians[k];
+      int num_sm_cv = left_hess.numRows();
+      RealSymMatrix resp_hess = 
+	interp_resp.function_hessian_view(interp_resp_offset+i);
+      resp_hess = 0.0;
+      if ( w == 0. ){
+	for ( int c = 0; c < num_sm_cv; c++ )
+	  for ( int r = 0; r <= c; r++ )
+	    resp_hess(r,c) = left_hess(r,c);
+      }else{
+	const RealSymMatrix &right_hess = sim_hessians[k+1];
+	for ( int c = 0; c < num_sm_cv; c++ )
+	  for ( int r = 0; r <= c; r++ )
+	    resp_hess(r,c) = left_hess(r,c) + 
+	      w * ( right_hess(r,c) - left_hess(r,c) );
+      }
+    }
   }
-
-  copy_field_data(interp_vals, interp_grads, interp_hessians, 
-		  interp_resp_offset, field_size, total_asv, 
-		  interp_resp);
 }
 
-void linear_interpolate_1d( const RealMatrix &build_pts, 
-			    const RealVector &build_vals, 
-			    const RealMatrix &build_grads, 
-			    const RealSymMatrixArray &build_hessians,
-			    const RealMatrix &pred_pts, 
-			    RealVector &pred_vals,
-			    RealMatrix &pred_grads, 
-			    RealSymMatrixArray &pred_hessians )
+void linear_interpolation_stencil( const RealMatrix &build_pts, 
+				   const RealMatrix &pred_pts,
+				   IntVector &stencil_indices,
+				   RealVector &stencil_weights )
 {
-  
+  if ( build_pts.numCols()!=1 )
+    throw( std::runtime_error("build pts must be Nx1") );
+  if ( pred_pts.numCols()!=1 )
+    throw( std::runtime_error("build pts must be Mx1") );
+
   int num_pred_pts = pred_pts.numRows();
   int num_build_pts = build_pts.numRows();
+  RealVector pred_pts_1d( Teuchos::View, pred_pts.values(), num_pred_pts );
+  RealVector build_pts_1d( Teuchos::View, build_pts.values(), num_build_pts );
+
+  if ( stencil_indices.length() != num_pred_pts )
+    stencil_indices.sizeUninitialized( num_pred_pts );
+  if ( stencil_weights.length() != num_pred_pts )
+    stencil_weights.sizeUninitialized( num_pred_pts );
+
+  for ( int i = 0; i < num_pred_pts; i++ ){
+    // enforce constant interpolation when interpolation is outside the
+    // range of build_pts
+    if ( pred_pts_1d[i] <= build_pts_1d[0] ){
+      stencil_indices[i] = 0;
+      stencil_weights[i] = 0.;
+    }else if ( pred_pts_1d[i] >= build_pts_1d[num_build_pts-1] ){
+      stencil_indices[i] = num_build_pts-1;
+      stencil_weights[i] = 0.;
+    }else{
+      // assumes binary search returns index of the closest point in 
+      // build_pts to the left of pts(0,i)
+      int index = binary_search( pred_pts_1d[i], build_pts_1d );
+      stencil_indices[i] = index;
+      stencil_weights[i] = ( pred_pts_1d[i] - build_pts_1d[index] ) /
+	( build_pts_1d[index+1] - build_pts_1d[index] );
+    }
+  }
+}
+
+void apply_interpolation_stencil( const IntVector &stencil_indices,
+				  const RealVector &stencil_weights,
+				  const RealVector &build_vals, 
+				  const RealMatrix &build_grads, 
+				  const RealSymMatrixArray &build_hessians,
+				  RealVector &pred_vals,
+				  RealMatrix &pred_grads, 
+				  RealSymMatrixArray &pred_hessians )
+{
+  int num_pred_pts = stencil_indices.length();
 
   // Following code assumes that vals are always interpolated
   // and if hessians are requested that gradients are provided
@@ -139,17 +213,7 @@ void linear_interpolate_1d( const RealMatrix &build_pts,
   if ( ( interp_hessians ) && ( !interp_grads) )
     throw( std::runtime_error("Hessians were provided, but gradients were missing") );
 
-  if ( build_pts.numCols()!=1 )
-    throw( std::runtime_error("build pts must be Nx1") );
-  if ( pred_pts.numCols()!=1 )
-    throw( std::runtime_error("build pts must be Mx1") );
-  // The following is for when we active multivariate interpolation of field data
-  //if ( pred_pts.numCols()!=build_pts.numCols() )
-  //  throw( std::runtime_error("build pts and pred pts must have the same number of columns") );
-
   int num_vars = build_grads.numRows();
-  RealVector pred_pts_1d( Teuchos::View, pred_pts.values(), num_pred_pts );
-  RealVector build_pts_1d( Teuchos::View, build_pts.values(), num_build_pts );
 
   // Initialize memory for interpolated data
   if ( pred_vals.length() != num_pred_pts )
@@ -164,67 +228,74 @@ void linear_interpolate_1d( const RealMatrix &build_pts,
     pred_hessians.resize( num_pred_pts );
 
   for ( int i = 0; i < num_pred_pts; i++ ){
-    // enforce constant interpolation when interpolation is outside the
-    // range of build_pts
-    if ( pred_pts_1d[i] <= build_pts_1d[0] ){
-      pred_vals[i] = build_vals[0];
-      for (int k=0; k<build_grads.numRows();k++)
-	pred_grads(k,i) = build_grads(k,0);
-      if ( interp_hessians ){
-	if ( pred_hessians[i].numRows() != num_vars )
-	  pred_hessians[i].shapeUninitialized( num_vars );
-	for (int k=0; k<build_grads.numRows();k++)
-	  for (int j=0; j<=k; j++)
-	    pred_hessians[i](j,k) = build_hessians[0](j,k);
-      }
-    }else if ( pred_pts_1d[i] >= build_pts_1d[num_build_pts-1] ){
-      pred_vals[i] = build_vals[num_build_pts-1];
-      for (int k=0; k<build_grads.numRows();k++)
-	pred_grads(k,i) = build_grads(k,num_build_pts-1);
-      if ( interp_hessians ){
-	if ( pred_hessians[i].numRows() != num_vars )
-	  pred_hessians[i].shapeUninitialized( num_vars );
-	for (int k=0; k<build_grads.numRows();k++)
-	  for (int j=0; j<=k; j++)
-	    pred_hessians[i](j,k) = build_hessians[num_build_pts-1](j,k);
+    int k = stencil_indices[i];
+    Real w = stencil_weights[i];
+    // a zero weight marks a point at (or clamped to) a build point, for
+    // which k+1 may not exist
+    if ( w == 0. ){
+      pred_vals[i] = build_vals[k];
+      if ( interp_grads ){
+	const Real* build_grad = build_grads[k];
+	Real* pred_grad = pred_grads[i];
+	for (int j=0; j<num_vars; j++)
+	  pred_grad[j] = build_grad[j];
       }
     }else{
-      // assumes binary search returns index of the closest point in 
-      // build_pts to the left of pts(0,i)
-      int index = binary_search( pred_pts_1d[i], build_pts_1d );
-
-      // interpolate function values
-      pred_vals[i] = build_vals[index] +
-	( (build_vals[index+1]-build_vals[index] ) /
-	  (build_pts_1d[index+1]-build_pts_1d[index]) ) *
-	( pred_pts_1d[i] - build_pts_1d[index] );
-      // interpolate gradient values
+      pred_vals[i] = build_vals[k] + w * ( build_vals[k+1] - build_vals[k] );
       if ( interp_grads ){
-	for (int j=0; j<build_grads.numRows();j++){
-	  pred_grads(j,i) = build_grads(j,index) +
-	    ( (build_grads(j,index+1)-build_grads(j,index) ) /
-	      (build_pts_1d[index+1]-build_pts_1d[index]) ) *
-	    ( pred_pts_1d[i] - build_pts_1d[index] );
-	}
+	const Real* left_grad = build_grads[k];
+	const Real* right_grad = build_grads[k+1];
+	Real* pred_grad = pred_grads[i];
+	for (int j=0; j<num_vars; j++)
+	  pred_grad[j] = left_grad[j] + w * ( right_grad[j] - left_grad[j] );
       }
-      // interpolate hessian values
-      if ( interp_hessians ){
-	if ( pred_hessians[i].numRows() != num_vars )
-	  pred_hessians[i].shapeUninitialized( num_vars );
-	for (int k=0; k<build_grads.numRows();k++){
-	  for (int j=0; j<=k; j++){
-	    pred_hessians[i](j,k) = build_hessians[index](j,k) +
-	      ( (build_hessians[index+1](j,k)-build_hessians[index](j,k) ) /
-		(build_pts_1d[index+1]-build_pts_1d[index]) ) *
-	      ( pred_pts_1d[i] - build_pts_1d[index] );
-	  }
-	}
+    }
+    if ( interp_hessians ){
+      if ( pred_hessians[i].numRows() != num_vars )
+	pred_hessians[i].shapeUninitialized( num_vars );
+      const RealSymMatrix &left_hess = build_hessians[k];
+      if ( w == 0. ){
+	for (int c=0; c<num_vars; c++)
+	  for (int r=0; r<=c; r++)
+	    pred_hessians[i](r,c) = left_hess(r,c);
+      }else{
+	const RealSymMatrix &right_hess = build_hessians[k+1];
+	for (int c=0; c<num_vars; c++)
+	  for (int r=0; r<=c; r++)
+	    pred_hessians[i](r,c) = left_hess(r,c) + 
+	      w * ( right_hess(r,c) - left_hess(r,c) );
       }
     }
   }
 }
 
-CovarianceMatrix::CovarianceMatrix() : numDOF_(0), covIsDiagonal_(false) {}
+void linear_interpolate_1d( const RealMatrix &build_pts, 
+			    const RealVector &build_vals, 
+			    const RealMatrix &build_grads, 
+			    const RealSymMatrixArray &build_hessians,
+			    const RealMatrix &pred_pts, 
+			    RealVector &pred_vals,
+			    RealMatrix &pred_grads, 
+			    RealSymMatrixArray &pred_hessians )
+{
+  // The following is for when we active multivariate interpolation of field data
+  //if ( pred_pts.numCols()!=build_pts.numCols() )
+  //  throw( std::runtime_error("build pts and pred pts must have the same number of columns") );
+  IntVector stencil_indices;
+  RealVector stencil_weights;
+  linear_interpolation_stencil( build_pts, pred_pts, stencil_indices,
+				stencil_weights );
+  apply_interpolation_stencil( stencil_indices, stencil_weights, build_vals,
+			       build_grads, build_hessians, pred_vals,
+			       pred_grads, pred_hessians );
+}
+
+/// correlations of magnitude below this are outside the band of a field
+/// covariance (see CovarianceMatrix::set_covariance())
+static const Real BAND_CORRELATION_TOL = 1.e-14;
+
+CovarianceMatrix::CovarianceMatrix() : numDOF_(0), covIsDiagonal_(false),
+  covIsBanded_(false), covBandwidth_(0) {}
 
 CovarianceMatrix::CovarianceMatrix( const CovarianceMatrix &source ){
   copy( source );
@@ -235,8 +306,15 @@ CovarianceMatrix::~CovarianceMatrix(){}
 void CovarianceMatrix::copy( const CovarianceMatrix &source ){
   numDOF_=source.numDOF_;
   covIsDiagonal_ = source.covIsDiagonal_;
+  covIsBanded_ = source.covIsBanded_;
+  covBandwidth_ = source.covBandwidth_;
   if ( source.covDiagonal_.length() > 0 )
     covDiagonal_=source.covDiagonal_;
+  else if ( source.covIsBanded_ )
+  {
+    covBand_ = source.covBand_;
+    covBandCholFactor_ = source.covBandCholFactor_;
+  }
   else if ( source.covMatrix_.numRows() > 0 )
   {
     covMatrix_ = source.covMatrix_;
@@ -263,7 +341,11 @@ void CovarianceMatrix::dense_covariance(RealSymMatrix &cov) const
   if (cov.numRows() != numDOF_)
     cov.shape(numDOF_);
   cov = 0.0;
-  if ( !covIsDiagonal_ ) {
+  if ( covIsBanded_ ) {
+    for (int j=0; j<numDOF_; j++)
+      for (int i=j; i<=std::min(j+covBandwidth_, numDOF_-1); i++)
+        cov(i,j) = covBand_(i-j,j);
+  } else if ( !covIsDiagonal_ ) {
     for (int i=0; i<numDOF_; i++)
       for (int j=0; j<i; j++)
         cov(i,j) = covMatrix_(i,j);
@@ -282,6 +364,34 @@ void CovarianceMatrix::set_covariance( const RealMatrix &cov )
   }
 
   numDOF_ = cov.numRows();
+  covIsDiagonal_ = false;
+
+  // Field covariances whose correlation is compactly supported, or decays
+  // below BAND_CORRELATION_TOL within a few points (e.g., a squared
+  // exponential with a short correlation length), are banded. When the
+  // band is narrow, only it is stored and factored, so that the
+  // factorization costs O(n b^2) and each application O(n b) rather than
+  // O(n^3) and O(n^2) for a bandwidth b. Correlations below the tolerance
+  // outside the band are dropped.
+  covBandwidth_ = 0;
+  for (int j=0; j<numDOF_; j++)
+    for (int i=numDOF_-1; i>j+covBandwidth_; i--)
+      if ( std::abs(cov(i,j)) >
+	   BAND_CORRELATION_TOL * std::sqrt(std::abs(cov(i,i)*cov(j,j))) )
+	{ covBandwidth_ = i-j; break; }
+  covIsBanded_ = ( 4*(covBandwidth_+1) <= numDOF_ );
+  if ( covIsBanded_ ) {
+    covMatrix_.shape(0);
+    covCholFactor_.shape(0);
+    cholFactorInv_.shape(0,0);
+    covBand_.shape(covBandwidth_+1, numDOF_);
+    for (int j=0; j<numDOF_; j++)
+      for (int i=j; i<=std::min(j+covBandwidth_, numDOF_-1); i++)
+	covBand_(i-j,j) = cov(i,j);
+    factor_banded_covariance_matrix();
+    return;
+  }
+
   covMatrix_.shape(numDOF_);
   for (int j=0; j<numDOF_; j++)
     for (int i=j; i<numDOF_; i++){
@@ -289,7 +399,6 @@ void CovarianceMatrix::set_covariance( const RealMatrix &cov )
       covMatrix_(j,i) = cov(i,j);
     }
 
-  covIsDiagonal_ = false;
   factor_covariance_matrix();
 }
 
@@ -305,6 +414,7 @@ void CovarianceMatrix::set_covariance( const RealVector & cov )
   covDiagonal_.sizeUninitialized( cov.length() );
   covDiagonal_.assign( cov );
   covIsDiagonal_ = true;
+  covIsBanded_ = false;
   numDOF_ = cov.length();
 }
 
@@ -357,6 +467,51 @@ void CovarianceMatrix::invert_cholesky_factor()
     }
 }
 
+/** The lower band Cholesky factor L, A = L*L', is computed column by
+    column; the entries of L outside the band of A are zero. */
+void CovarianceMatrix::factor_banded_covariance_matrix()
+{
+  int bw = covBandwidth_;
+  covBandCholFactor_.shape(bw+1, numDOF_);
+  for (int j=0; j<numDOF_; j++){
+    int k0 = std::max(0, j-bw);
+    Real diag = covBand_(0,j);
+    for (int k=k0; k<j; k++)
+      diag -= covBandCholFactor_(j-k,k)*covBandCholFactor_(j-k,k);
+    if ( diag <= 0. ){
+      std::string msg = "The covariance matrix is not positive definite\n";
+      throw( std::runtime_error( msg ) );
+    }
+    Real l_jj = std::sqrt(diag);
+    covBandCholFactor_(0,j) = l_jj;
+    for (int i=j+1; i<=std::min(j+bw, numDOF_-1); i++){
+      Real sum = covBand_(i-j,j);
+      for (int k=std::max(0, i-bw); k<j; k++)
+	sum -= covBandCholFactor_(i-k,k)*covBandCholFactor_(j-k,k);
+      covBandCholFactor_(i-j,j) = sum / l_jj;
+    }
+  }
+}
+
+/** Forward substitution over the degrees of freedom, updating all rows
+    of b together so that each step accesses contiguous columns. */
+void CovarianceMatrix::banded_cholesky_solve( RealMatrix &b ) const
+{
+  int num_rows = b.numRows(), bw = covBandwidth_;
+  for (int j=0; j<numDOF_; j++){
+    Real* b_j = b[j];
+    for (int k=std::max(0, j-bw); k<j; k++){
+      Real l_jk = covBandCholFactor_(j-k,k);
+      const Real* b_k = b[k];
+      for (int i=0; i<num_rows; i++)
+	b_j[i] -= l_jk * b_k[i];
+    }
+    Real l_jj = covBandCholFactor_(0,j);
+    for (int i=0; i<num_rows; i++)
+      b_j[i] /= l_jj;
+  }
+}
+
 void CovarianceMatrix::apply_covariance_inverse_sqrt( const RealVector &vector,
 						      RealVector &result ) const
 {
@@ -371,6 +526,18 @@ void CovarianceMatrix::apply_covariance_inverse_sqrt( const RealVector &vector,
   if ( covIsDiagonal_ ) {
     for (int i=0; i<numDOF_; i++)
       result[i] = vector[i] / std::sqrt( covDiagonal_[i] ); 
+  }else if ( covIsBanded_ ) {
+    result.assign( vector );
+    RealMatrix result_row( Teuchos::View, result.values(), 1, 1, numDOF_ );
+    banded_cholesky_solve( result_row );
+  }else if ( result.values() == vector.values() ) {
+    // cholFactorInv_ is triangular, so the product may be formed in place
+    Teuchos::BLAS<int, Real> teuchos_blas;
+    teuchos_blas.TRMV( ( covCholFactor_.UPLO()=='L' ) ? 
+		       Teuchos::LOWER_TRI : Teuchos::UPPER_TRI,
+		       Teuchos::NO_TRANS, Teuchos::NON_UNIT_DIAG, numDOF_,
+		       cholFactorInv_.values(), cholFactorInv_.stride(),
+		       result.values(), 1 );
   }else{
     result.multiply( Teuchos::NO_TRANS, Teuchos::NO_TRANS, 
 		     1.0, cholFactorInv_, vector, 0.0 );
@@ -396,6 +563,23 @@ void CovarianceMatrix::apply_covariance_inverse_sqrt_to_gradients(
     for (int j=0; j<numDOF_; j++)
       for (int i=0; i<num_grads; i++)
 	result(i,j) = gradients(i,j) / std::sqrt( covDiagonal_[j] ); 
+  }else if ( covIsBanded_ ) {
+    // each row of the result is inv(L) times the corresponding row of
+    // the gradients
+    RealMatrix result_grads( Teuchos::View, result, num_grads, numDOF_ );
+    for (int j=0; j<numDOF_; j++)
+      for (int i=0; i<num_grads; i++)
+	result_grads(i,j) = gradients(i,j);
+    banded_cholesky_solve( result_grads );
+  }else if ( result.values() == gradients.values() ) {
+    // B := B A' in place; A = cholFactorInv_ is triangular
+    Teuchos::BLAS<int, Real> teuchos_blas;
+    teuchos_blas.TRMM( Teuchos::RIGHT_SIDE, ( covCholFactor_.UPLO()=='L' ) ?
+		       Teuchos::LOWER_TRI : Teuchos::UPPER_TRI,
+		       Teuchos::TRANS, Teuchos::NON_UNIT_DIAG, num_grads, 
+		       numDOF_, 1.0, cholFactorInv_.values(), 
+		       cholFactorInv_.stride(), result.values(), 
+		       result.stride() );
   }else{
     // Let A = cholFactorInv_ and B = gradients. We want to compute C' = AB'
     // so compute C = (AB')' = BA'
@@ -458,6 +642,11 @@ void CovarianceMatrix::print() const {
     std::cout << " Covariance is Diagonal " << '\n';
     covDiagonal_.print(std::cout);
   }
+  else if ( covIsBanded_ ) {
+    std::cout << " Covariance is Banded with " << covBandwidth_
+	      << " sub-diagonals (lower band by column)" << '\n';
+    covBand_.print(std::cout);
+  }
   else {  
     std::cout << " Covariance is Full " << '\n';
     covMatrix_.print(std::cout);
@@ -472,6 +661,9 @@ void CovarianceMatrix::get_main_diagonal( RealVector &diagonal ) const {
   if ( covIsDiagonal_ ) {
     for (int i=0; i<num_dof(); i++ )
       diagonal[i] = covDiagonal_[i];
+  }else if ( covIsBanded_ ) {
+    for (int i=0; i<num_dof(); i++ )
+      diagonal[i] = covBand_(0,i);
   }else{
     for (int i=0; i<num_dof(); i++ )
       diagonal[i] = covMatrix_(i,i);
@@ -485,6 +677,14 @@ void CovarianceMatrix::as_correlation(RealSymMatrix& corr_mat) const
     for (int i=0; i<num_dof(); ++i)
       corr_mat(i, i) = 1.0;
   } 
+  else if (covIsBanded_) {
+    for (int j=0; j<num_dof(); ++j) {
+      corr_mat(j, j) = 1.0;
+      for (int i=j+1; i<=std::min(j+covBandwidth_, num_dof()-1); ++i)
+        corr_mat(i,j) = covBand_(i-j,j) / std::sqrt(covBand_(0,i)) /
+          std::sqrt(covBand_(0,j));
+    }
+  }
   else {
     for (int i=0; i<num_dof(); ++i) {
       corr_mat(i, i) = 1.0;
@@ -503,6 +703,10 @@ Real CovarianceMatrix::determinant() const
     for (int i=0; i<num_dof(); i++)
       det *= covDiagonal_[i];
   }
+  else if (covIsBanded_) {
+    for (int i=0; i<num_dof(); i++)
+      det *= covBandCholFactor_(0,i)*covBandCholFactor_(0,i);
+  }
   else {
     for (int i=0; i<num_dof(); i++)
       det *= covCholFactor_(i,i)*covCholFactor_(i,i);
@@ -518,6 +722,10 @@ Real CovarianceMatrix::log_determinant() const
     for (int i=0; i<num_dof(); i++)
       log_det += std::log(covDiagonal_[i]);
   }
+  else if (covIsBanded_) {
+    for (int i=0; i<num_dof(); i++)
+      log_det += 2.*std::log(covBandCholFactor_(0,i));
+  }
   else {
     for (int i=0; i<num_dof(); i++)
       log_det += std::log(covCholFactor_(i,i))+std::log(covCholFactor_(i,i));
@@ -616,7 +824,10 @@ void ExperimentCovariance::apply_experiment_covariance_inverse_sqrt(
     throw(std::runtime_error("apply_covariance_inverse_sqrt: vector is inconsistent with covariance matrix"));
 
   int shift = 0;
-  result.sizeUninitialized( vector.length() );
+  // only resize a result of the wrong length, so that a view of the
+  // destination (or vector itself) is populated in place
+  if ( result.length() != vector.length() )
+    result.sizeUninitialized( vector.length() );
   for (int i=0; i<covMatrices_.size(); i++ ){
     int num_dof = covMatrices_[i].num_dof();
     RealVector sub_vector( Teuchos::View, vector.values()+shift, num_dof );
@@ -634,7 +845,9 @@ const RealMatrix &gradients, RealMatrix &result ) const{
 
   int shift = 0;
   int num_grads = gradients.numRows();
-  result.shape( num_grads, gradients.numCols() );
+  if ( ( result.numRows() != num_grads ) || 
+       ( result.numCols() != gradients.numCols() ) )
+    result.shapeUninitialized( num_grads, gradients.numCols() );
   for (int i=0; i<covMatrices_.size(); i++ ){
     int num_dof = covMatrices_[i].num_dof();
     RealMatrix sub_matrix( Teuchos::View,gradients,num_grads,num_dof,0,shift );
@@ -651,13 +864,15 @@ void ExperimentCovariance::apply_experiment_covariance_inverse_sqrt_to_hessians(
   if ( hessians.size() != num_dof() )
     throw(std::runtime_error("apply_covariance_inverse_sqrt_to_hessians: hessians is inconsistent with covariance matrix"));
 
-  // perform deep copy of hessians
-  result.resize( hessians.size() );
-  for (int i=0; i<hessians.size(); i++ )
-    if (hessians[i].numRows()) { // else don't bother to assign empty matrix
-      result[i].shapeUninitialized( hessians[i].numRows() );
-      result[i].assign( hessians[i] );
-    }
+  // perform deep copy of hessians, unless scaling in place
+  if ( &result != &hessians ) {
+    result.resize( hessians.size() );
+    for (int i=0; i<hessians.size(); i++ )
+      if (hessians[i].numRows()) { // else don't bother to assign empty matrix
+	result[i].shapeUninitialized( hessians[i].numRows() );
+	result[i].assign( hessians[i] );
+      }
+  }
   int shift = 0;
   for (int i=0; i<covMatrices_.size(); i++ ){
     int num_dof = covMatrices_[i].num_dof();
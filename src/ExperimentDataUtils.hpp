@@ -40,6 +40,45 @@ void interpolate_simulation_field_data( const Response &sim_resp,
 					size_t interp_resp_offset,
 					Response &interp_resp );
 
+/// Interpolate the simulation field field_num onto the experiment
+/// coordinates using a precomputed stencil (see
+/// linear_interpolation_stencil), writing values, gradients and Hessians
+/// directly into interp_resp starting at interp_resp_offset
+void interpolate_simulation_field_data( const Response &sim_resp, 
+					const IntVector &stencil_indices,
+					const RealVector &stencil_weights,
+					size_t field_num, short total_asv,
+					size_t interp_resp_offset,
+					Response &interp_resp );
+
+/**
+ * \brief Compute the sparse linear interpolation operator from the
+ * coordinates build_pts onto the coordinates pred_pts.
+ * Row i of the operator has (at most) two nonzeros: the value at pred
+ * point i is (1-w)*f[k] + w*f[k+1], where k = stencil_indices[i] and
+ * w = stencil_weights[i].  Points outside the range of build_pts are
+ * assigned the nearest end value (w = 0).  The stencil depends only on
+ * the coordinates, so it may be computed once and applied to any number
+ * of build values.  This function assumes build_pts is in ascending order */
+void linear_interpolation_stencil( const RealMatrix &build_pts, 
+				   const RealMatrix &pred_pts,
+				   IntVector &stencil_indices,
+				   RealVector &stencil_weights );
+
+/**
+ * \brief Apply an interpolation stencil computed by
+ * linear_interpolation_stencil() to function values and (if available)
+ * gradients and Hessians.  Output containers are only resized when their
+ * shape is inconsistent, so views may be passed to populate in place. */
+void apply_interpolation_stencil( const IntVector &stencil_indices,
+				  const RealVector &stencil_weights,
+				  const RealVector &build_vals, 
+				  const RealMatrix &build_grads, 
+				  const RealSymMatrixArray &build_hessians,
+				  RealVector &pred_vals,
+				  RealMatrix &pred_grads, 
+				  RealSymMatrixArray &pred_hessians );
+
 /**
  * \brief Returns the value of at 1D function f and its gradient and hessians
  * (if available) at the points of  vector pred_pts using linear interpolation. 
@@ -79,6 +118,21 @@ private:
   /// Flag specifying if the covariance matrix is diagonal
   bool covIsDiagonal_;
 
+  /// Flag specifying if the covariance matrix is banded, in which case
+  /// only its band and the band of its Cholesky factor are stored
+  bool covIsBanded_;
+
+  /// The number of sub-diagonals of a banded covariance matrix
+  int covBandwidth_;
+
+  /// The lower band of a banded covariance matrix: entry (i,j), with
+  /// j <= i <= j+covBandwidth_, is stored in row i-j of column j
+  RealMatrix covBand_;
+
+  /// The lower band of the Cholesky factor of a banded covariance
+  /// matrix, stored as for covBand_
+  RealMatrix covBandCholFactor_;
+
   /// The global solver for all computations involving the inverse of
   /// the covariance matrix
   Teuchos::SerialSpdDenseSolver<int, Real> covSlvr_;
@@ -89,6 +143,14 @@ private:
   /// Compute the inverse of the Cholesky factor of the covariance matrix
   void invert_cholesky_factor();
 
+  /// Compute the banded Cholesky factorization of a banded covariance
+  /// matrix
+  void factor_banded_covariance_matrix();
+
+  /// Solve L*x = b in place for each row of the matrix b (each column
+  /// is a degree of freedom), where L is the banded Cholesky factor
+  void banded_cholesky_solve( RealMatrix &b ) const;
+
   /// Copy the values from one existing CovarianceMatrix to another. 
   void copy( const CovarianceMatrix &source );
 
@@ -136,14 +198,16 @@ public:
 
   /// Multiply a vector r by the sqrt of the inverse covariance matrix C, i.e.
   /// compute L'*r where L is the cholesky factor of the positive definite 
-  /// covariance matrix
+  /// covariance matrix.  result may share storage with vector, in which
+  /// case r is scaled in place
   void apply_covariance_inverse_sqrt( const RealVector &vector, 
 				      RealVector &result ) const;
 
   /// Multiply a matrix of gradients g (each column is a gradient vector) 
   /// by the sqrt of the inverse covariance matrix C, i.e.
   /// compute L'*g where L is the cholesky factor of the positive definite 
-  /// covariance matrix
+  /// covariance matrix.  result may share storage with gradients, in
+  /// which case g is scaled in place
   void apply_covariance_inverse_sqrt_to_gradients( const RealMatrix &gradients, 
 						   RealMatrix &result ) const;
 
@@ -211,20 +275,24 @@ public:
   Real apply_experiment_covariance( const RealVector &vector ) const;
 
   /// Compute the product inv(L)*v where L is the Cholesky factor of the 
-  /// covariance matrix C
+  /// covariance matrix C; result may be a view of (or the same object
+  /// as) vector, in which case v is scaled in place
   void apply_experiment_covariance_inverse_sqrt( const RealVector &vector,
 						 RealVector &result ) const;
 
   /// Compute the product inv(L)*G where L is the Cholesky factor of the 
   /// covariance matrix C and G is a matrix whose columns are gradient vectors
-  /// for each degree of freedom
+  /// for each degree of freedom; result may be a view of (or the same
+  /// object as) grads, in which case G is scaled in place
   void apply_experiment_covariance_inverse_sqrt_to_gradients(
            const RealMatrix &grads,
 	   RealMatrix &result) const;
 
   /// Compute the products inv(L)*H where L is the Cholesky factor of the 
   /// covariance matrix C and H is a Hessian matrix. The product is computed
-  /// for each Hessian of every degree of freedom.
+  /// for each Hessian of every degree of freedom.  If result is the same
+  /// object as hessians, the Hessians (or the matrices they view) are
+  /// scaled in place rather than copied first.
   void apply_experiment_covariance_inverse_sqrt_to_hessians( 
 	   const RealSymMatrixArray &hesians, RealSymMatrixArray &result ) const;
   
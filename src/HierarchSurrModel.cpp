@@ -623,6 +623,9 @@ void HierarchSurrModel::derived_evaluate(const ActiveSet& set)
 void HierarchSurrModel::derived_evaluate_nowait(const ActiveSet& set)
 {
   ++surrModelEvalCntr;
+  // record the mode for use in combining the LF and HF contributions, which
+  // may be synchronized together with batches queued under other modes
+  evalModeMap[surrModelEvalCntr] = responseMode;
 
   Model& lf_model = orderedModels[lowFidelityIndices.first];
   Model& hf_model = orderedModels[highFidelityIndices.first];
@@ -768,6 +771,11 @@ const IntResponseMap& HierarchSurrModel::derived_synchronize()
   else                               // competing queues: nonblocking synch
     derived_synchronize_competing();
 
+  // retire the queued modes of the returned evaluations
+  for (IntRespMCIter r_cit=surrResponseMap.begin();
+       r_cit!=surrResponseMap.end(); ++r_cit)
+    evalModeMap.erase(r_cit->first);
+
   return surrResponseMap;
 }
 
@@ -787,6 +795,11 @@ const IntResponseMap& HierarchSurrModel::derived_synchronize_nowait()
   derived_synchronize_combine_nowait(hf_resp_map_rekey, lf_resp_map_rekey,
                                      surrResponseMap);
 
+  // retire the queued modes of the returned evaluations
+  for (IntRespMCIter r_cit=surrResponseMap.begin();
+       r_cit!=surrResponseMap.end(); ++r_cit)
+    evalModeMap.erase(r_cit->first);
+
   return surrResponseMap;
 }
 
@@ -819,10 +832,20 @@ derived_synchronize_sequential(IntResponseMap& hf_resp_map_rekey,
     component_parallel_mode(SURROGATE_MODEL);
     // Interface::rawResponseMap should _not_ be corrected directly since
     // rawResponseMap, beforeSynchCorePRPQueue, and data_pairs all share a
-    // responseRep -> modifying rawResponseMap affects data_pairs.
-    bool deep_copy = (responseMode == AUTO_CORRECTED_SURROGATE);
+    // responseRep -> modifying rawResponseMap affects data_pairs.  Only
+    // evaluations queued in AUTO_CORRECTED_SURROGATE mode are corrected,
+    // which may differ from the current responseMode in a mixed batch.
     rekey_synch(orderedModels[lowFidelityIndices.first], block, surrIdMap,
-                lf_resp_map_rekey, deep_copy);
+                lf_resp_map_rekey, false);
+    IntShMCIter m_cit;
+    for (IntRespMIter r_it=lf_resp_map_rekey.begin();
+         r_it!=lf_resp_map_rekey.end(); ++r_it) {
+      m_cit = evalModeMap.find(r_it->first);
+      short eval_mode
+        = (m_cit == evalModeMap.end()) ? responseMode : m_cit->second;
+      if (eval_mode == AUTO_CORRECTED_SURROGATE)
+        r_it->second = r_it->second.copy();
+    }
   }
   // add cached approx evals from:
   // (a) recovered LF asynch evals that could not be returned since HF
@@ -865,6 +888,12 @@ derived_synchronize_combine(const IntResponseMap& hf_resp_map,
   // in {UN,AUTO_}CORRECTED_SURROGATE) or full sets (MODEL_DISCREPANCY,
   // AGGREGATED_MODELS).
 
+  if (mixed_response_modes()) {
+    derived_synchronize_combine_mixed(hf_resp_map, lf_resp_map,
+                                      combined_resp_map);
+    return;
+  }
+
   IntRespMCIter hf_cit = hf_resp_map.begin(), lf_cit = lf_resp_map.begin();
   bool quiet_flag = (outputLevel < NORMAL_OUTPUT);
   switch (responseMode) {
@@ -940,6 +969,12 @@ derived_synchronize_combine_nowait(const IntResponseMap& hf_resp_map,
   // {hf,lf}_resp_map may be partial sets (partial surrogateFnIndices
   // in {UN,AUTO_}CORRECTED_SURROGATE) or full sets (MODEL_DISCREPANCY).
 
+  if (mixed_response_modes()) {
+    derived_synchronize_combine_mixed(hf_resp_map, lf_resp_map,
+                                      combined_resp_map);
+    return;
+  }
+
   // Early return options avoid some overhead:
   if (lf_resp_map.empty() && surrIdMap.empty()) {// none completed, none pending
     combined_resp_map = hf_resp_map;  // can't swap w/ const
@@ -1029,6 +1064,96 @@ derived_synchronize_combine_nowait(const IntResponseMap& hf_resp_map,
 }
 
 
+/** Batches queued under different response modes (e.g., the sample
+    increments for several levels of a multilevel study) are synchronized
+    together, so each evaluation is combined individually using the mode
+    in effect when it was queued, with currentResponse resized to match.
+    As in derived_synchronize_combine_nowait(), available components of
+    evaluations with other components still pending are cached for a
+    subsequent pass.  Batches are assumed to share the model forms of
+    {low,high}FidelityIndices, and corrections use the current indices. */
+void HierarchSurrModel::
+derived_synchronize_combine_mixed(const IntResponseMap& hf_resp_map,
+                                  IntResponseMap& lf_resp_map,
+                                  IntResponseMap& combined_resp_map)
+{
+  IntShMCIter m_cit;
+  IntRespMIter lf_it;
+  // correct LF completions queued in AUTO_CORRECTED_SURROGATE mode
+  IntResponseMap auto_corr_map;
+  for (lf_it=lf_resp_map.begin(); lf_it!=lf_resp_map.end(); ) {
+    m_cit = evalModeMap.find(lf_it->first);
+    if (m_cit != evalModeMap.end() &&
+        m_cit->second == AUTO_CORRECTED_SURROGATE)
+      { auto_corr_map.insert(*lf_it); lf_resp_map.erase(lf_it++); }
+    else
+      ++lf_it;
+  }
+  if (!auto_corr_map.empty()) {
+    compute_apply_delta(auto_corr_map);
+    lf_resp_map.insert(auto_corr_map.begin(), auto_corr_map.end());
+  }
+
+  // invert remaining entries (pending jobs) in truthIdMap and surrIdMap
+  IntIntMap remain_truth_ids, remain_surr_ids;
+  IntIntMCIter id_it;
+  for (id_it=truthIdMap.begin(); id_it!=truthIdMap.end(); ++id_it)
+    remain_truth_ids[id_it->second] = id_it->first;
+  for (id_it=surrIdMap.begin();  id_it!=surrIdMap.end();  ++id_it)
+    remain_surr_ids[id_it->second]  = id_it->first;
+
+  short active_mode = responseMode, eval_mode;
+  IntRespMCIter hf_cit = hf_resp_map.begin();
+  lf_it = lf_resp_map.begin();
+  Response empty_resp;
+  bool quiet_flag = (outputLevel < NORMAL_OUTPUT), hf_avail, lf_avail;
+  SizetSizet2DPair indices = get_indices();
+  while (hf_cit != hf_resp_map.end() || lf_it != lf_resp_map.end()) {
+    // these have been rekeyed already to top-level surrModelEvalCntr:
+    int hf_eval_id = (hf_cit == hf_resp_map.end()) ? INT_MAX : hf_cit->first;
+    int lf_eval_id = (lf_it  == lf_resp_map.end()) ? INT_MAX : lf_it->first;
+    int eval_id = std::min(hf_eval_id, lf_eval_id);
+    hf_avail = (hf_eval_id == eval_id); lf_avail = (lf_eval_id == eval_id);
+    m_cit = evalModeMap.find(eval_id);
+    eval_mode = (m_cit == evalModeMap.end()) ? active_mode : m_cit->second;
+
+    if ( ( !hf_avail && remain_truth_ids.count(eval_id) ) ||
+         ( !lf_avail && remain_surr_ids.count(eval_id)  ) ) {
+      // other contribution is pending -> cache available response
+      if (hf_avail) cachedTruthRespMap[eval_id]  = hf_cit->second;
+      if (lf_avail) cachedApproxRespMap[eval_id] = lf_it->second;
+    }
+    else {
+      if (eval_mode != responseMode)
+        { responseMode = eval_mode; resize_response(); }
+      switch (eval_mode) {
+      case MODEL_DISCREPANCY:
+        check_key(hf_eval_id, lf_eval_id);
+        deltaCorr[indices].compute(hf_cit->second, lf_it->second,
+                                   combined_resp_map[eval_id], quiet_flag);
+        break;
+      case AGGREGATED_MODELS:
+        check_key(hf_eval_id, lf_eval_id);
+        aggregate_response(hf_cit->second, lf_it->second,
+                           combined_resp_map[eval_id]);
+        break;
+      default: // {UNCORRECTED,AUTO_CORRECTED,BYPASS}_SURROGATE modes
+        response_mapping((hf_avail) ? hf_cit->second : empty_resp,
+                         (lf_avail) ? lf_it->second  : empty_resp,
+                         combined_resp_map[eval_id]);
+        break;
+      }
+    }
+    if (hf_avail) ++hf_cit;
+    if (lf_avail) ++lf_it;
+  }
+
+  // restore the current mode for subsequent evaluations
+  if (responseMode != active_mode)
+    { responseMode = active_mode; resize_response(); }
+}
+
+
 void HierarchSurrModel::compute_apply_delta(IntResponseMap& lf_resp_map)
 {
   // Incoming we have a completed LF evaluation that may be used to compute a
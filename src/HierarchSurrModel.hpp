@@ -209,6 +209,14 @@ private:
   void derived_synchronize_combine_nowait(const IntResponseMap& hf_resp_map,
                                           IntResponseMap& lf_resp_map,
                                           IntResponseMap& combined_resp_map);
+  /// combine the available components from HF and LF response maps
+  /// when evaluations were queued under different response modes
+  void derived_synchronize_combine_mixed(const IntResponseMap& hf_resp_map,
+                                         IntResponseMap& lf_resp_map,
+                                         IntResponseMap& combined_resp_map);
+  /// test whether any pending evaluation was queued under a response
+  /// mode other than the current responseMode
+  bool mixed_response_modes() const;
 
   /// resize currentResponse based on responseMode
   void resize_response();
@@ -275,6 +283,11 @@ private:
   /// derived_synchronize_nowait() that could not be returned since
   /// corresponding low-fidelity response portions were still pending
   IntResponseMap cachedTruthRespMap;
+  /// map from HierarchSurrModel evaluation id to the responseMode in
+  /// effect when the evaluation was queued by derived_evaluate_nowait(),
+  /// allowing batches for different modes and solution levels to share
+  /// a single synchronization
+  IntShortMap evalModeMap;
 };
 
 
@@ -292,6 +305,15 @@ inline void HierarchSurrModel::check_interface_instance()
 }
 
 
+inline bool HierarchSurrModel::mixed_response_modes() const
+{
+  for (IntShMCIter m_cit=evalModeMap.begin(); m_cit!=evalModeMap.end(); ++m_cit)
+    if (m_cit->second != responseMode)
+      return true;
+  return false;
+}
+
+
 inline Model& HierarchSurrModel::surrogate_model()
 { return orderedModels[lowFidelityIndices.first]; }
 
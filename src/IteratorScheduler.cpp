@@ -14,23 +14,41 @@
 #include "IteratorScheduler.hpp"
 #include "DakotaIterator.hpp"
 #include "ParallelLibrary.hpp"
+#include <boost/filesystem/operations.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#ifdef HAVE_WORKING_FORK
+#include <fcntl.h>      // for fcntl
+#include <sys/select.h> // for select
+#include <sys/wait.h>   // for waitpid
+#include <unistd.h>     // for fork, pipe, _exit
+#endif
 
 static const char rcsId[]="@(#) $Id: IteratorScheduler.cpp 6492 2009-12-19 00:04:28Z briadam $";
 
 
 namespace Dakota {
 
+int IteratorScheduler::localServerCntr = 0;
+
+
 /** Current constructor parameters are the input specification
     components, which are requests subject to override by
     ParallelLibrary::init_iterator_communicators(). */
 IteratorScheduler::
 IteratorScheduler(ParallelLibrary& parallel_lib, bool peer_assign_jobs,
-		  int num_servers, int procs_per_iterator, short scheduling):
+		  int num_servers, int procs_per_iterator, short scheduling,
+		  int local_servers):
   parallelLib(parallel_lib), numIteratorJobs(1),
   numIteratorServers(num_servers), procsPerIterator(procs_per_iterator),
+  numLocalServers(local_servers),
   iteratorCommRank(0), iteratorCommSize(1), iteratorServerId(0),
   messagePass(false), iteratorScheduling(scheduling),//maxIteratorConcurrency(1)
-  peerAssignJobs(peer_assign_jobs), paramsMsgLen(0), resultsMsgLen(0)
+  peerAssignJobs(peer_assign_jobs), terminateJobs(false), paramsMsgLen(0),
+  resultsMsgLen(0)
 {
   // Supported examples of a single level of concurrent iterators:
   //   ConcurrentMinimizer (multi_start, pareto_set), BranchBndMinimizer
@@ -523,4 +541,209 @@ void IteratorScheduler::stop_iterator_servers()
   }
 }
 
+
+int IteratorScheduler::local_server_concurrency() const
+{
+#ifdef HAVE_WORKING_FORK
+  // a forked child cannot participate in collective operations over the
+  // iterator communicator, so only single processor iterators are forked,
+  // and no process forks once MPI has been initialized
+  return (!messagePass && iteratorCommSize == 1 &&
+	  parallelLib.fork_allowed()) ? numLocalServers : 1;
+#else
+  return 1;
+#endif
+}
+
+
+/** The child output and restart records are segregated using a tag,
+    as for concurrent iterator partitions in
+    ParallelLibrary::push_output_tag().  Job indices repeat across
+    batches and schedulers, so the tag counts all local servers forked
+    by this process (a child's tag extends its parent's, so tags of
+    nested servers are unique as well).  Restart data have already been
+    read by the parent, so the children do not read a restart file. */
+bool IteratorScheduler::fork_local_server(int job_index)
+{
+#ifdef HAVE_WORKING_FORK
+  if (!parallelLib.fork_allowed()) {
+    Cerr << "\nError: local iterator servers cannot be forked in MPI runs."
+	 << std::endl;
+    abort_handler(-1);
+  }
+  if (localResultsRoot.empty())
+    localResultsRoot = (boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("dakota_iter_%%%%%%%%")).string();
+
+  // write buffered output so that it is not replicated by the children
+  // and no writer thread is mid-write on a file they share
+  Cout.flush(); Cerr.flush();
+  AsyncOutputBuffer::drain_all();
+
+  // the child holds the write end of this pipe until it exits, such that
+  // the parent can block on the exit of any of its servers
+  int exit_fds[2];
+  pid_t pid = (pipe(exit_fds) == -1) ? -1 : fork();
+  if (pid == -1) {
+    Cerr << "\nCould not fork local iterator server; error code " << errno
+	 << " (" << std::strerror(errno) << ")" << std::endl;
+    abort_handler(-1);
+  }
+  ++localServerCntr;
+  String ctr_tag = "." + boost::lexical_cast<String>(localServerCntr);
+  if (pid == 0) { // child
+    // errors exit the child without cleaning up the files and streams
+    // it shares with the parent, which reports the failure
+    abort_mode = ABORT_CHILD_EXITS;
+    // not held by analysis drivers; the sibling servers are not ours
+    close(exit_fds[0]);
+    fcntl(exit_fds[1], F_SETFD, FD_CLOEXEC);
+    for (IntIntMIter p_it=localServerPipes.begin();
+	 p_it!=localServerPipes.end(); ++p_it)
+      close(p_it->second);
+    localServerPipes.clear(); localServerJobs.clear(); localServerTags.clear();
+    OutputManager& output_mgr = parallelLib.output_manager();
+    output_mgr.detach_forked_child();
+    ProgramOptions prog_opts(parallelLib.program_options());
+    prog_opts.read_restart_file("");
+    output_mgr.push_output_tag(ctr_tag, prog_opts, true, true);
+    return true;
+  }
+  close(exit_fds[1]);
+  fcntl(exit_fds[0], F_SETFD, FD_CLOEXEC);
+  localServerJobs[(int)pid] = job_index;
+  localServerPipes[(int)pid] = exit_fds[0];
+  localServerTags[(int)pid]
+    = parallelLib.output_manager().build_output_tag() + ctr_tag;
+#endif
+  return false;
+}
+
+
+void IteratorScheduler::
+exit_local_server(int job_index, MPIPackBuffer& send_buffer)
+{
+#ifdef HAVE_WORKING_FORK
+  String results_file
+    = localResultsRoot + "." + boost::lexical_cast<String>(job_index+1);
+  std::ofstream results_fs(results_file.c_str(), std::ios::binary);
+  results_fs.write(send_buffer.buf(), send_buffer.size());
+  results_fs.close();
+  int exit_status = (results_fs.fail()) ? 1 : 0;
+
+  // close the tagged output and restart files of this child, since
+  // _exit does not flush them; the parent's remain open
+  Cout.flush(); Cerr.flush();
+  parallelLib.output_manager().pop_output_tag();
+  // use _exit so that the parent's streams and files are not closed
+  _exit(exit_status);
+#endif
+}
+
+
+/** Only the children in localServerJobs are tested, such that process
+    completions belonging to other Dakota components are not consumed.
+    A non-blocking wait tests each active server once; a blocking wait
+    sleeps until the pipe of some server reaches end of file on its
+    exit. */
+int IteratorScheduler::
+wait_local_server(MPIUnpackBuffer& recv_buffer, bool block)
+{
+  int job_index = -1;
+#ifdef HAVE_WORKING_FORK
+  int status = 0; pid_t wpid = 0;
+  IntIntMIter j_it;
+  while (wpid == 0) {
+    for (j_it=localServerJobs.begin(); j_it!=localServerJobs.end(); ++j_it)
+      if ( (wpid = waitpid((pid_t)j_it->first, &status, WNOHANG)) != 0 )
+	break;
+    if (wpid != 0)
+      break;
+    if (!block)
+      return -1;
+
+    // block on the exit of any active server
+    fd_set exit_fds; int max_fd = -1;
+    FD_ZERO(&exit_fds);
+    IntIntMIter p_it;
+    for (p_it=localServerPipes.begin(); p_it!=localServerPipes.end(); ++p_it) {
+      FD_SET(p_it->second, &exit_fds);
+      max_fd = std::max(max_fd, p_it->second);
+    }
+    if (select(max_fd + 1, &exit_fds, NULL, NULL, NULL) == -1) {
+      if (errno == EINTR)
+	continue;
+      Cerr << "\nError: wait on local iterator servers failed; error code "
+	   << errno << " (" << std::strerror(errno) << ")" << std::endl;
+      abort_handler(-1);
+    }
+    for (p_it=localServerPipes.begin(); p_it!=localServerPipes.end(); ++p_it)
+      if (FD_ISSET(p_it->second, &exit_fds)) {
+	j_it = localServerJobs.find(p_it->first);
+	wpid = waitpid((pid_t)p_it->first, &status, 0);
+	break;
+      }
+  }
+  IntIntMIter p_it = localServerPipes.find(j_it->first);
+  close(p_it->second);
+  localServerPipes.erase(p_it);
+  job_index = j_it->second;
+  std::map<int, String>::iterator t_it = localServerTags.find(j_it->first);
+  String file_tag = t_it->second;
+  localServerTags.erase(t_it);
+  localServerJobs.erase(j_it);
+  bool server_failed
+    = (wpid == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0);
+
+  String results_file
+    = localResultsRoot + "." + boost::lexical_cast<String>(job_index+1);
+  if (!server_failed) {
+    std::ifstream results_fs(results_file.c_str(), std::ios::binary);
+    results_fs.seekg(0, std::ios::end);
+    std::streamoff len = results_fs.tellg();
+    if (len < 0) // results file could not be opened
+      server_failed = true;
+    else {
+      results_fs.seekg(0, std::ios::beg);
+      char* data = new char [len];
+      results_fs.read(data, len);
+      if (!results_fs.good()) server_failed = true;
+      recv_buffer.setup(data, (int)len, true); // buffer owns data
+    }
+  }
+  boost::system::error_code ec; // ignore removal failures
+  boost::filesystem::remove(results_file, ec);
+
+  if (server_failed) {
+    // the files of the failed server are kept for diagnosis
+    Cerr << "\nError: iterator job " << job_index+1 << " failed in a local "
+	 << "iterator server; see its output in " << parallelLib.
+      program_options().output_file() << file_tag << std::endl;
+    abort_handler(-1);
+  }
+  remove_local_server_files(file_tag);
+#endif
+  return job_index;
+}
+
+String IteratorScheduler::local_stream_file(int job_index) const
+{
+  return localResultsRoot + ".stream."
+    + boost::lexical_cast<String>(job_index+1);
+}
+
+
+/** The results of a local server are returned to and reported by the
+    parent, so its console output and restart records are not kept.
+    Those of any servers it forked in turn were removed by the child. */
+void IteratorScheduler::remove_local_server_files(const String& file_tag) const
+{
+  const ProgramOptions& prog_opts = parallelLib.program_options();
+  boost::system::error_code ec; // ignore removal failures
+  boost::filesystem::remove(prog_opts.output_file() + file_tag, ec);
+  if (!prog_opts.error_file().empty())
+    boost::filesystem::remove(prog_opts.error_file() + file_tag, ec);
+  boost::filesystem::remove(prog_opts.write_restart_file() + file_tag, ec);
+}
+
 } // namespace Dakota
@@ -47,7 +47,7 @@ public:
   /// constructor
   IteratorScheduler(ParallelLibrary& parallel_lib, bool peer_assign_jobs,
 		    int num_servers = 0, int procs_per_iterator = 0,
-		    short scheduling = DEFAULT_SCHEDULING);
+		    short scheduling = DEFAULT_SCHEDULING, int local_servers = 1);
   /// destructor
   ~IteratorScheduler();
     
@@ -146,6 +146,11 @@ public:
   template <typename MetaType>
   void peer_static_schedule_iterators(MetaType& meta_object,
 				      Iterator& sub_iterator);
+  /// executed in the absence of message passing to dynamically schedule
+  /// iterator jobs among forked local server processes
+  template <typename MetaType>
+  void local_fork_schedule_iterators(MetaType& meta_object,
+				     Iterator& sub_iterator);
 
   /// update schedPCIter
   void update(ParConfigLIter pc_iter);
@@ -161,6 +166,27 @@ public:
   /// determines if current processor is rank 0 of the parent comm
   bool lead_rank() const;
 
+  /// number of forked local server processes available for a batch of
+  /// iterator jobs (1 if local servers are not in use)
+  int local_server_concurrency() const;
+
+  /// forks a local server process for job_index; returns true within
+  /// the child
+  bool fork_local_server(int job_index);
+  /// returns the packed results of a local server to the parent and
+  /// terminates the child process
+  void exit_local_server(int job_index, MPIPackBuffer& send_buffer);
+  /// waits for any local server process to complete, retrieves its
+  /// packed results, and returns its job index; if block is false,
+  /// returns -1 when no local server has completed
+  int wait_local_server(MPIUnpackBuffer& recv_buffer, bool block = true);
+  /// name of the file through which the local server for job_index
+  /// may stream intermediate data to the parent
+  String local_stream_file(int job_index) const;
+  /// removes the tagged output, error, and restart files of a local
+  /// server whose results have been collected
+  void remove_local_server_files(const String& file_tag) const;
+
   //
   //- Heading: Data members
   //
@@ -170,6 +196,9 @@ public:
   int   numIteratorJobs;    ///< number of iterator executions to schedule
   int   numIteratorServers; ///< number of concurrent iterator partitions
   int   procsPerIterator;   ///< partition size request
+  int   numLocalServers;    ///< number of forked local processes among which
+                            ///< iterator jobs are distributed when not
+                            ///< message passing
   //int minProcsPerIterator; //  lower bound on iterator partition size
   //int maxProcsPerIterator; //  upper bound on iterator partition size
   int   iteratorCommRank;   ///< processor rank in iteratorComm
@@ -181,6 +210,9 @@ public:
   //int maxIteratorConcurrency; // max concurrency possible in meta-algorithm
   bool peerAssignJobs;      ///< flag indicating need for peer 1 to assign jobs
                             ///< to peers 2-n
+  bool terminateJobs;       ///< flag set by the meta object as results are
+                            ///< unpacked to stop the assignment of remaining
+                            ///< jobs by the dynamic schedulers
 
   ParConfigLIter schedPCIter; ///< iterator for active parallel configuration
   size_t miPLIndex;         ///< index of active parallel level (corresponding
@@ -189,16 +221,25 @@ public:
 
 private:
 
-  //
-  //- Heading: Convenience member functions
-  //
-
   //
   //- Heading: Data members
   //
 
   int  paramsMsgLen; ///< length of MPI buffer for parameter input instance(s)
   int resultsMsgLen; ///< length of MPI buffer for results  output instance(s)
+
+  IntIntMap localServerJobs; ///< map from process id of an active local
+                             ///< server to its iterator job index
+  std::map<int, String> localServerTags; ///< map from process id of an
+                             ///< active local server to its output file tag
+  IntIntMap localServerPipes; ///< map from process id of an active local
+                             ///< server to the read end of a pipe that
+                             ///< reaches end of file when the server exits
+  String localResultsRoot;  ///< root of the local server results file names
+
+  /// number of local servers forked by this process across all
+  /// schedulers, used to tag their output and restart files uniquely
+  static int localServerCntr;
 };
 
 
@@ -306,6 +347,7 @@ schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
   ParConfigLIter curr_pc_iter = parallelLib.parallel_configuration_iterator();
   parallelLib.parallel_configuration_iterator(
     meta_object.parallel_configuration_iterator());
+  terminateJobs = false;
 
   if (iteratorScheduling == MASTER_SCHEDULING) { //(dedicatedMaster) {
     if (lead_rank()) { // strategy master
@@ -319,7 +361,10 @@ schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
     if (iteratorServerId <= numIteratorServers) {
       // jobs are not assigned by messages: stop_iterator_servers() is only
       // required for an idle server partition
-      peer_static_schedule_iterators(meta_object, sub_iterator);
+      if (numIteratorJobs > 1 && local_server_concurrency() > 1)
+	local_fork_schedule_iterators(meta_object, sub_iterator);
+      else
+	peer_static_schedule_iterators(meta_object, sub_iterator);
       if (lead_rank())
 	stop_iterator_servers(); // stop an idle server partition, if present
     }
@@ -365,7 +410,7 @@ master_dynamic_schedule_iterators(MetaType& meta_object)
     int send_cntr = num_sends, recv_cntr = 0, out_count;
     MPI_Status* status_array = new MPI_Status [num_sends];
     int*        index_array  = new int        [num_sends];
-    while (recv_cntr < numIteratorJobs) {
+    while (recv_cntr < send_cntr) {
       parallelLib.waitsome(num_sends, recv_requests, out_count, index_array, 
 			   status_array);
       recv_cntr += out_count;
@@ -375,7 +420,7 @@ master_dynamic_schedule_iterators(MetaType& meta_object)
         int job_id       = status_array[i].MPI_TAG; // 1 to numIteratorJobs
         int job_index    = job_id - 1;              // 0 to numIteratorJobs-1
 	meta_object.unpack_results_buffer(recv_buffers[job_index], job_index);
-        if (send_cntr < numIteratorJobs) {
+        if (send_cntr < numIteratorJobs && !terminateJobs) {
           send_buffers[server_index].reset();// reuse send_buffers/recv_requests
 	  meta_object.pack_parameters_buffer(send_buffers[server_index],
 					     send_cntr);
@@ -393,6 +438,9 @@ master_dynamic_schedule_iterators(MetaType& meta_object)
     }
     delete [] status_array;
     delete [] index_array;
+    if (send_cntr < numIteratorJobs)
+      Cout << "Master dynamic schedule: " << numIteratorJobs - send_cntr
+	   << " iterator jobs not assigned following early termination\n";
   }
   else { // all jobs assigned in first pass
     Cout << "Master dynamic schedule: waiting on all iterator jobs."
@@ -446,8 +494,16 @@ peer_static_schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
       parallelLib.bcast_i(numIteratorJobs, miPLIndex);
   }
 
-  // Execute the iterator jobs using round robin assignment
+  // Execute the iterator jobs using round robin assignment.  Early
+  // termination is only supported for a single serial iterator server,
+  // since otherwise the peers and ranks would need to agree on it.
+  bool serial = (!messagePass && iteratorCommSize == 1);
   for (i=iteratorServerId-1; i<numIteratorJobs; i+=numIteratorServers) {
+    if (serial && terminateJobs) {
+      Cout << "Peer static schedule: " << numIteratorJobs - i
+	   << " iterator jobs not run following early termination\n";
+      break;
+    }
 
     // Set starting point or obj fn weighting set
     Real iterator_start_time;
@@ -501,6 +557,53 @@ peer_static_schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
 }
 
 
+/** In the absence of message passing, iterator jobs are dynamically
+    assigned to forked copies of this process, with at most
+    numLocalServers children active at a time.  Each child runs a
+    single job on its own copy of sub_iterator and its model and packs
+    the results with the same callbacks used for MPI iterator servers.
+    Results are unpacked by the parent in order of completion, and no
+    further jobs are assigned once the meta object sets terminateJobs.
+    Separate address spaces avoid the need for reentrant iterators and
+    models. */
+template <typename MetaType> void IteratorScheduler::
+local_fork_schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
+{
+  int num_servers = std::min(numLocalServers, numIteratorJobs),
+    send_cntr = 0, recv_cntr = 0;
+  Cout << "Local fork schedule: dynamic assignment of " << numIteratorJobs
+       << " iterator jobs among " << num_servers << " local servers\n";
+
+  while (recv_cntr < send_cntr ||
+	 (send_cntr < numIteratorJobs && !terminateJobs)) {
+    // assign jobs to any open local servers
+    while (send_cntr < numIteratorJobs && !terminateJobs &&
+	   send_cntr - recv_cntr < num_servers) {
+      if (fork_local_server(send_cntr)) {
+	// child: run this job and return the packed results
+	MPIPackBuffer send_buffer;
+	meta_object.initialize_iterator(send_cntr);
+	run_iterator(sub_iterator);
+	meta_object.update_local_results(send_cntr);
+	meta_object.pack_results_buffer(send_buffer, send_cntr);
+	exit_local_server(send_cntr, send_buffer); // does not return
+      }
+      ++send_cntr;
+    }
+
+    // parent: stream in the results of the next job to complete
+    MPIUnpackBuffer recv_buffer;
+    int job_index = wait_local_server(recv_buffer);
+    meta_object.unpack_results_buffer(recv_buffer, job_index);
+    ++recv_cntr;
+  }
+
+  if (send_cntr < numIteratorJobs)
+    Cout << "Local fork schedule: " << numIteratorJobs - send_cntr
+	 << " iterator jobs not assigned following early termination\n";
+}
+
+
 /** This function is similar in structure to
     ApplicationInterface::serve_evaluations_synch(). */
 template <typename MetaType> void IteratorScheduler::
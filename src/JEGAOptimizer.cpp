@@ -111,6 +111,7 @@ Includes
 #include <../Utilities/include/SingleObjectiveStatistician.hpp>
 
 #include <algorithm>
+#include <map>
 #include <sstream>
 
 /*
@@ -182,6 +183,14 @@ class JEGAOptimizer::Evaluator :
          */
         Model& _model;
 
+        /// The Designs whose evaluations were started by BeginEvaluation.
+        /**
+         * They are keyed by the evaluation id assigned by the model so that
+         * the responses returned by synchronize_nowait can be matched to
+         * them.
+         */
+        std::map<int, Design*> _pendingEvals;
+
     /*
     ===========================================================================
     Public Methods
@@ -287,6 +296,29 @@ class JEGAOptimizer::Evaluator :
             Design& into
             ) const;
 
+        /// Sets the variables of the model to those of \a des.
+        /**
+         * \param des The Design whose variable values are to be installed in
+         *            the model prior to an evaluation.
+         */
+        void
+        LoadModelVariables(
+            const Design& des
+            );
+
+        /// Computes and records the linear constraint values of \a des.
+        /**
+         * The responses computed by the model do not include the linear
+         * constraint values so they are computed here using the coefficients
+         * supplied to the constraint info objects.
+         *
+         * \param des The Design whose linear constraints are to be computed.
+         */
+        void
+        EvaluateLinearConstraints(
+            Design& des
+            ) const;
+
         /// Returns the number of non-linear constraints for the problem.
         /**
          * This is computed by adding the number of non-linear equality
@@ -384,6 +416,65 @@ class JEGAOptimizer::Evaluator :
             return false;
         }
 
+        /// Starts the evaluation of \a des through the model.
+        /**
+         * If the model supports asynchronous evaluation, the evaluation is
+         * requested using evaluate_nowait and \a des remains unevaluated
+         * until a call to CollectEvaluations retrieves its responses.
+         * Otherwise, \a des is evaluated synchronously.
+         *
+         * This should not be mixed with the group Evaluate method while
+         * evaluations are outstanding since that method synchronizes all
+         * evaluations of the model.
+         *
+         * \param des The Design whose evaluation is to be started.
+         * \return False if the maximum number of evaluations was reached
+         *         and \a des was marked illconditioned and true otherwise.
+         */
+        virtual
+        bool
+        BeginEvaluation(
+            Design& des
+            );
+
+        /// Records the responses of completed asynchronous evaluations.
+        /**
+         * \param wait True if this method should block on the model when
+         *             none of the outstanding evaluations has completed, in
+         *             which case all of them are collected.
+         * \return The number of Designs whose evaluations were completed.
+         */
+        virtual
+        std::size_t
+        CollectEvaluations(
+            bool wait
+            );
+
+        /// Returns the number of evaluations started but not yet collected.
+        /**
+         * \return The number of outstanding asynchronous evaluations.
+         */
+        virtual
+        std::size_t
+        GetNumberPendingEvaluations(
+            ) const
+        {
+            EDDY_FUNC_DEBUGSCOPE
+            return this->_pendingEvals.size();
+        }
+
+        /// Collects any outstanding evaluations before the GA is done.
+        /**
+         * Designs whose responses cannot be collected are marked
+         * illconditioned so that no pointer to them is kept past this call.
+         *
+         * \return The result of the base class Finalize.
+         */
+        virtual
+        bool
+        Finalize(
+            );
+
         /// Returns the proper name of this operator.
         /**
          * \return See Name().
@@ -1226,10 +1317,14 @@ JEGAOptimizer::LoadTheParameterDatabase(
         "method.jega.final_data_filename", "finaldata#.dat"
         );
 
-    // Dakota does not currently expose the main loop operator selection
-    // through the interface.
+    // The main loop is selected by the synchronization.  Nonblocking
+    // synchronization uses the steady state main loop which keeps offspring
+    // evaluations in flight across generations.  Its evaluation window is
+    // not exposed and defaults to the population size.
     this->_theParamDB->AddStringParam(
-        "method.jega.mainloop_type", "duplicate_free"
+        "method.jega.mainloop_type",
+        this->probDescDB.get_string("method.jega.synchronization") ==
+            "nonblocking" ? "steady_state" : "duplicate_free"
         );
 
     // The log file gets special attention.  If it is the default global log
@@ -2062,6 +2157,62 @@ JEGAOptimizer::Evaluator::RecordResponses(
     }
 }
 
+void
+JEGAOptimizer::Evaluator::LoadModelVariables(
+    const Design& des
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    RealVector       contVars;
+    IntVector        discIntVars;
+    RealVector       discRealVars;
+    StringMultiArray discStringVars;
+
+    // extract the real and continuous variables from the Design
+    this->SeparateVariables(des, contVars, discIntVars, discRealVars,
+        discStringVars);
+
+    this->_model.continuous_variables(contVars);
+    this->_model.discrete_int_variables(discIntVars);
+    this->_model.discrete_real_variables(discRealVars);
+    // Strings set by calling single value setter for each
+    for (size_t i=0; i<discStringVars.num_elements(); ++i)
+      this->_model.discrete_string_variable(discStringVars[i],i);
+    // Could use discrete_string_varables to avoid overhead of repeated
+    // function calls, but it takes a StringMultiArrayConstView, which
+    // must be created from discStringVars. Maybe there's a simpler way,
+    // but...
+    // const size_t &dsv_len = discStringVars.num_elements();
+    // StringMultiArrayConstView dsv_view = discStringVars[
+    //   boost::indices[idx_range(0,dsv_len)]];
+    // this->_model.discrete_string_variables(dsv_view);
+}
+
+void
+JEGAOptimizer::Evaluator::EvaluateLinearConstraints(
+    Design& des
+    ) const
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    // Get the information about the constraints.  The linear constraints
+    // follow the non-linear ones.
+    const ConstraintInfoVector& cninfos =
+        this->GetDesignTarget().GetConstraintInfos();
+
+    // we can do it using the "EvaluateConstraint" method which
+    // will only succeed for linear constraints for which
+    // coefficients have been supplied.
+    for(ConstraintInfoVector::const_iterator cit(
+            cninfos.begin() + this->GetNumberNonLinearConstraints()
+            ); cit!=cninfos.end(); ++cit)
+    {
+        (*cit)->EvaluateConstraint(des);
+        (*cit)->RecordViolation(des);
+    }
+}
+
 bool
 JEGAOptimizer::Evaluator::Evaluate(
     DesignGroup& group
@@ -2079,12 +2230,6 @@ JEGAOptimizer::Evaluator::Evaluate(
     // first, let's see if we can avoid any evaluations.
     ResolveClones(group);
 
-    // we'll prepare containers for repeated use without re-construction
-    RealVector       contVars;
-    IntVector        discIntVars;
-    RealVector       discRealVars;
-    StringMultiArray discStringVars;
-
     // prepare to iterate over the group
     DesignDVSortSet::const_iterator it(group.BeginDV());
     const DesignDVSortSet::const_iterator e(group.EndDV());
@@ -2092,27 +2237,11 @@ JEGAOptimizer::Evaluator::Evaluate(
     // these quantities will be used below
     const DesignTarget& target = this->GetDesignTarget();
 
-    // Find out the counts on the different types of constraints
-    const size_t num_nonlin_cn = this->GetNumberNonLinearConstraints();
-    // const size_t num_lin_cn = this->GetNumberLinearConstraints();
-
-    // Get the information about the constraints.
-    const ConstraintInfoVector& cninfos = target.GetConstraintInfos();
-
     // Prepare to store the number of requests in order to avoid overshooting
     // the limit.
     const eddy::utilities::uint64_t priorReqs = this->GetNumberEvaluations();
     eddy::utilities::uint64_t numEvalReqs = 0;
 
-    // store an iterator to the first linear constraint so that
-    // we can evaluate it using the cinfo objects.
-
-    // prepare to iterate
-    ConstraintInfoVector::const_iterator flincn(
-        cninfos.begin() + num_nonlin_cn
-        );
-    ConstraintInfoVector::const_iterator cit;
-
     // prepare to return the success of this.  Success occurs only if all
     // designs wind up evaluated and non-illconditioned.
     bool ret = true;
@@ -2133,29 +2262,11 @@ JEGAOptimizer::Evaluator::Evaluate(
             continue;
         }
 
-        // extract the real and continuous variables
-        // from the current Design
-        this->SeparateVariables(**it, contVars, discIntVars, discRealVars,
-	    discStringVars);
-
         // send this guy out for evaluation using the _model.
 
         // first, set the current values of the variables in the model
-        this->_model.continuous_variables(contVars);
-        this->_model.discrete_int_variables(discIntVars);
-        this->_model.discrete_real_variables(discRealVars);
-	// Strings set by calling single value setter for each
-	for (size_t i=0; i<discStringVars.num_elements(); ++i)
-	  this->_model.discrete_string_variable(discStringVars[i],i);
-	// Could use discrete_string_varables to avoid overhead of repeated 
-	// function calls, but it takes a StringMultiArrayConstView, which
-	// must be created from discStringVars. Maybe there's a simpler way,
-	// but...
-	// const size_t &dsv_len = discStringVars.num_elements();
-	// StringMultiArrayConstView dsv_view = discStringVars[ 
-	//   boost::indices[idx_range(0,dsv_len)]];
-        // this->_model.discrete_string_variables(dsv_view);
-	
+        this->LoadModelVariables(**it);
+
         // now request the evaluation in synchronous or asyncronous mode.
         if(this->_model.asynch_flag())
         {
@@ -2193,14 +2304,7 @@ JEGAOptimizer::Evaluator::Evaluate(
 
         // The responses do not (or will not) include the linear
         // constraint values. We have to compute them ourselves.
-        // we can do it using the "EvaluateConstraint" method which
-        // will only succeed for linear constraints for which
-        // coefficients have been supplied.
-        for(cit=flincn; cit!=cninfos.end(); ++cit)
-        {
-            (*cit)->EvaluateConstraint(**it);
-            (*cit)->RecordViolation(**it);
-        }
+        this->EvaluateLinearConstraints(**it);
     }
 
     // If we did our evaluations asynchronously, we did not yet record
@@ -2244,6 +2348,137 @@ JEGAOptimizer::Evaluator::Evaluate(
     return ret;
 }
 
+bool
+JEGAOptimizer::Evaluator::BeginEvaluation(
+    Design& des
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    if(des.IsEvaluated() || ResolveClone(des)) return !des.IsIllconditioned();
+
+    // outstanding evaluations count against the maximum.  If it has been
+    // reached, tag this design as evaluated and illconditioned so that it
+    // will be flushed from the algorithm.
+    if(this->GetNumberEvaluations() + this->_pendingEvals.size() >=
+       this->GetMaxEvaluations())
+    {
+        des.SetEvaluated(true);
+        des.SetIllconditioned(true);
+        return false;
+    }
+
+    this->LoadModelVariables(des);
+
+    if(this->_model.asynch_flag())
+    {
+        // remember which design this evaluation belongs to.  The responses
+        // are recorded by CollectEvaluations.
+        this->_model.evaluate_nowait();
+        this->_pendingEvals[this->_model.evaluation_id()] = &des;
+    }
+    else
+    {
+        this->_model.evaluate();
+        this->IncrementNumberEvaluations();
+        this->RecordResponses(
+            this->_model.current_response().function_values(), des
+            );
+        des.SetEvaluated(true);
+        this->GetDesignTarget().CheckFeasibility(des);
+    }
+
+    // The linear constraints are known now regardless of whether or not the
+    // responses are.
+    this->EvaluateLinearConstraints(des);
+    return true;
+}
+
+std::size_t
+JEGAOptimizer::Evaluator::CollectEvaluations(
+    bool wait
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    const DesignTarget& target = this->GetDesignTarget();
+    std::size_t ncollected = 0;
+
+    // each synchronize_nowait call returns only the completions not
+    // previously returned.  If none is available and we must wait, block
+    // in synchronize, which returns the remaining evaluations.
+    for(bool block = false; !this->_pendingEvals.empty(); block = true)
+    {
+        const IntResponseMap& response_map = block ?
+            this->_model.synchronize() : this->_model.synchronize_nowait();
+
+        for(IntRespMCIter r_cit(response_map.begin());
+            r_cit!=response_map.end(); ++r_cit)
+        {
+            std::map<int, Design*>::iterator pit(
+                this->_pendingEvals.find(r_cit->first)
+                );
+            if(pit == this->_pendingEvals.end())
+            {
+                JEGALOG_II(this->GetLogger(), lquiet(), this,
+                    ostream_entry(lquiet(), this->GetName() + ": discarding "
+                        "the response of evaluation ") << r_cit->first
+                        << " which was not started by BeginEvaluation."
+                    )
+                continue;
+            }
+
+            Design& des = *pit->second;
+            this->RecordResponses(r_cit->second.function_values(), des);
+            des.SetEvaluated(true);
+            target.CheckFeasibility(des);
+
+            this->_pendingEvals.erase(pit);
+            ++ncollected;
+        }
+
+        if(ncollected > 0 || !wait || block) break;
+    }
+
+    this->IncrementNumberEvaluations(ncollected);
+
+    JEGALOG_II(this->GetLogger(), ldebug(), this,
+        ostream_entry(ldebug(), this->GetName() + ": collected ")
+            << ncollected << " completed evaluations.  "
+            << this->_pendingEvals.size() << " remain outstanding."
+        )
+
+    return ncollected;
+}
+
+bool
+JEGAOptimizer::Evaluator::Finalize(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    if(!this->_pendingEvals.empty()) this->CollectEvaluations(true);
+
+    // anything left over will never be recorded.  The designs may be
+    // destroyed with the algorithm so do not hold on to them.
+    for(std::map<int, Design*>::iterator pit(this->_pendingEvals.begin());
+        pit!=this->_pendingEvals.end(); ++pit)
+    {
+        pit->second->SetEvaluated(true);
+        pit->second->SetIllconditioned(true);
+    }
+
+    JEGAIFLOG_II(!this->_pendingEvals.empty(), this->GetLogger(), lquiet(),
+        this,
+        ostream_entry(lquiet(), this->GetName() + ": ")
+            << this->_pendingEvals.size() << " evaluations were never "
+               "collected; their designs are marked illconditioned."
+        )
+
+    this->_pendingEvals.clear();
+    return this->GeneticAlgorithmEvaluator::Finalize();
+}
+
 /*
 ===============================================================================
 End Namespace
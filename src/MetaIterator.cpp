@@ -26,7 +26,8 @@ MetaIterator::MetaIterator(ProblemDescDB& problem_db):
 	    false, // peers can manage local jobs (initial extracted from DB)
 	    problem_db.get_int("method.iterator_servers"),
 	    problem_db.get_int("method.processors_per_iterator"),
-	    problem_db.get_short("method.iterator_scheduling"))
+	    problem_db.get_short("method.iterator_scheduling"),
+	    problem_db.get_int("method.local_iterator_servers"))
 {
   if (!numFinalSolutions)  // default is zero
     numFinalSolutions = 1; // for now...  (TO DO: hybrids, concurrent)
@@ -39,7 +40,8 @@ MetaIterator::MetaIterator(ProblemDescDB& problem_db, Model& model):
 	    false, // peers can manage local jobs (initial extracted from DB)
 	    problem_db.get_int("method.iterator_servers"),
 	    problem_db.get_int("method.processors_per_iterator"),
-	    problem_db.get_short("method.iterator_scheduling"))
+	    problem_db.get_short("method.iterator_scheduling"),
+	    problem_db.get_int("method.local_iterator_servers"))
 {
   iteratedModel = model;
   //update_from_model(iteratedModel);
@@ -6690,6 +6690,7 @@ static Real
 	MP_(centeringParam),
 	MP_(collocationRatio),
 	MP_(collocRatioTermsOrder),
+	MP_(concurrentMatchTol),
 	MP_(constraintPenalty),
 	MP_(constrPenalty),
 	MP_(constraintTolerance),
@@ -6837,6 +6838,7 @@ static bool
 	MP_(fixedSequenceFlag),
         MP_(generatePosteriorSamples),
 	MP_(gpmsaNormalize),
+	MP_(hybridPipelined),
 	MP_(importApproxActive),
 	MP_(importBuildActive),
 	MP_(latinizeFlag),
@@ -6874,6 +6876,7 @@ static int
 	MP_(buildSamples),
 	MP_(burnInSamples),
 	MP_(chainSamples),
+	MP_(concurrentConvergedStarts),
 	MP_(concurrentRandomJobs),
 	MP_(contractAfterFail),
 	MP_(covarianceType),
@@ -6882,11 +6885,14 @@ static int
 	MP_(expandAfterSuccess),
         MP_(iteratorServers),
 	MP_(jumpStep),
+        MP_(localIteratorServers),
 	MP_(maxFunctionEvaluations),
 	MP_(maxHifiEvals),
 	MP_(maxIterations),
 	MP_(maxRefineIterations),
 	MP_(maxSolverIterations),
+	MP_(mcmcChains),
+	MP_(mcmcPrefetchDepth),
 	MP_(mutationRange),
         MP_(neighborOrder),
 	MP_(newSolnsGenerated),
@@ -7002,46 +7008,55 @@ static Method_mp_utype
         MP2s(exportApproxFormat,TABULAR_EVAL_ID),
         MP2s(exportApproxFormat,TABULAR_IFACE_ID),
         MP2s(exportApproxFormat,TABULAR_ANNOTATED),
+        MP2s(exportApproxFormat,TABULAR_BINARY),
         MP2s(exportCorrModelFormat,TABULAR_NONE),
         MP2s(exportCorrModelFormat,TABULAR_HEADER),
         MP2s(exportCorrModelFormat,TABULAR_EVAL_ID),
         MP2s(exportCorrModelFormat,TABULAR_IFACE_ID),
         MP2s(exportCorrModelFormat,TABULAR_ANNOTATED),
+        MP2s(exportCorrModelFormat,TABULAR_BINARY),
         MP2s(exportCorrVarFormat,TABULAR_NONE),
         MP2s(exportCorrVarFormat,TABULAR_HEADER),
         MP2s(exportCorrVarFormat,TABULAR_EVAL_ID),
         MP2s(exportCorrVarFormat,TABULAR_IFACE_ID),
         MP2s(exportCorrVarFormat,TABULAR_ANNOTATED),
+        MP2s(exportCorrVarFormat,TABULAR_BINARY),
         MP2s(exportDiscrepFormat,TABULAR_NONE),
         MP2s(exportDiscrepFormat,TABULAR_HEADER),
         MP2s(exportDiscrepFormat,TABULAR_EVAL_ID),
         MP2s(exportDiscrepFormat,TABULAR_IFACE_ID),
         MP2s(exportDiscrepFormat,TABULAR_ANNOTATED),
+        MP2s(exportDiscrepFormat,TABULAR_BINARY),
         MP2s(exportSamplesFormat,TABULAR_NONE),
         MP2s(exportSamplesFormat,TABULAR_HEADER),
         MP2s(exportSamplesFormat,TABULAR_EVAL_ID),
         MP2s(exportSamplesFormat,TABULAR_IFACE_ID),
         MP2s(exportSamplesFormat,TABULAR_ANNOTATED),
+        MP2s(exportSamplesFormat,TABULAR_BINARY),
         MP2s(importApproxFormat,TABULAR_NONE),
         MP2s(importApproxFormat,TABULAR_HEADER),
         MP2s(importApproxFormat,TABULAR_EVAL_ID),
         MP2s(importApproxFormat,TABULAR_IFACE_ID),
         MP2s(importApproxFormat,TABULAR_ANNOTATED),
+        MP2s(importApproxFormat,TABULAR_BINARY),
         MP2s(importBuildFormat,TABULAR_NONE),
         MP2s(importBuildFormat,TABULAR_HEADER),
         MP2s(importBuildFormat,TABULAR_EVAL_ID),
         MP2s(importBuildFormat,TABULAR_IFACE_ID),
         MP2s(importBuildFormat,TABULAR_ANNOTATED),
+        MP2s(importBuildFormat,TABULAR_BINARY),
         MP2s(importCandFormat,TABULAR_NONE),
         MP2s(importCandFormat,TABULAR_HEADER),
         MP2s(importCandFormat,TABULAR_EVAL_ID),
         MP2s(importCandFormat,TABULAR_IFACE_ID),
         MP2s(importCandFormat,TABULAR_ANNOTATED),
+        MP2s(importCandFormat,TABULAR_BINARY),
         MP2s(importPredConfigFormat,TABULAR_NONE),
         MP2s(importPredConfigFormat,TABULAR_HEADER),
         MP2s(importPredConfigFormat,TABULAR_EVAL_ID),
         MP2s(importPredConfigFormat,TABULAR_IFACE_ID),
         MP2s(importPredConfigFormat,TABULAR_ANNOTATED),
+        MP2s(importPredConfigFormat,TABULAR_BINARY),
 	MP2s(integrationRefine,AIS),
 	MP2s(integrationRefine,IS),
 	MP2s(integrationRefine,MMAIS),
@@ -7121,6 +7136,7 @@ static Method_mp_utype
         MP2s(pstudyFileFormat,TABULAR_EVAL_ID),
         MP2s(pstudyFileFormat,TABULAR_IFACE_ID),
         MP2s(pstudyFileFormat,TABULAR_ANNOTATED),
+        MP2s(pstudyFileFormat,TABULAR_BINARY),
 	MP2s(reliabilitySearchType,AMV_PLUS_U),
 	MP2s(reliabilitySearchType,AMV_PLUS_X),
 	MP2s(reliabilitySearchType,AMV_U),
@@ -7193,6 +7209,7 @@ static Model_mp_lit
 	MP2(surrogateType,global_neural_network),
 	MP2(surrogateType,global_polynomial),
 	MP2(surrogateType,global_radial_basis),
+	MP2(surrogateType,global_sparse_gaussian),
 	MP2(surrogateType,global_voronoi_surrogate),
 	MP2(surrogateType,local_taylor),
         MP2(surrogateType,multipoint_tana),
@@ -7229,6 +7246,7 @@ static Model_mp_utype
         MP2s(exportApproxFormat,TABULAR_EVAL_ID),
         MP2s(exportApproxFormat,TABULAR_IFACE_ID),
         MP2s(exportApproxFormat,TABULAR_ANNOTATED),
+        MP2s(exportApproxFormat,TABULAR_BINARY),
       //MP2s(importApproxFormat,TABULAR_NONE),
       //MP2s(importApproxFormat,TABULAR_HEADER),
       //MP2s(importApproxFormat,TABULAR_EVAL_ID),
@@ -7239,11 +7257,13 @@ static Model_mp_utype
         MP2s(importBuildFormat,TABULAR_EVAL_ID),
         MP2s(importBuildFormat,TABULAR_IFACE_ID),
         MP2s(importBuildFormat,TABULAR_ANNOTATED),
+        MP2s(importBuildFormat,TABULAR_BINARY),
         MP2s(importChallengeFormat,TABULAR_NONE),
         MP2s(importChallengeFormat,TABULAR_HEADER),
         MP2s(importChallengeFormat,TABULAR_EVAL_ID),
         MP2s(importChallengeFormat,TABULAR_IFACE_ID),
         MP2s(importChallengeFormat,TABULAR_ANNOTATED),
+        MP2s(importChallengeFormat,TABULAR_BINARY),
         MP2s(modelExportFormat,TEXT_ARCHIVE),
         MP2s(modelExportFormat,BINARY_ARCHIVE),
         MP2s(modelExportFormat,ALGEBRAIC_FILE),
@@ -7292,6 +7312,7 @@ static String
 	MP_(importChallengePtsFile),
 	MP_(interfacePointer),
 	MP_(krigingOptMethod),
+	MP_(modelCachePrefix),
 	MP_(modelExportPrefix),
 	MP_(optionalInterfRespPointer),
 	MP_(propagationModelPointer),
@@ -7321,6 +7342,7 @@ static bool
         MP_(domainDecomp),
         MP_(pointSelection),
         MP_(pressFlag),
+        MP_(subMethodMemoize),
   MP_(subspaceIdBingLi),
   MP_(subspaceIdConstantine),
   MP_(subspaceIdEnergy),
@@ -7346,7 +7368,9 @@ static short
 	MP_(rbfMinPartition);
 
 static int
+        MP_(buildConcurrency),
         MP_(decompSupportLayers),
+        MP_(inducingPoints),
         MP_(initialSamples),
         MP_(maxFunctionEvals),
         MP_(maxIterations),
@@ -7355,6 +7379,7 @@ static int
         MP_(pointsTotal),
         MP_(refineCVFolds),
         MP_(softConvergenceLimit),
+        MP_(subMethodLocalServers),
         MP_(subMethodProcs),
         MP_(subMethodServers),
         MP_(subspaceDimension),
@@ -7474,16 +7499,19 @@ static Env_mp_utype
         MP2s(postRunInputFormat,TABULAR_EVAL_ID),
         MP2s(postRunInputFormat,TABULAR_IFACE_ID),
         MP2s(postRunInputFormat,TABULAR_ANNOTATED),
+        MP2s(postRunInputFormat,TABULAR_BINARY),
         MP2s(preRunOutputFormat,TABULAR_NONE),
         MP2s(preRunOutputFormat,TABULAR_HEADER),
         MP2s(preRunOutputFormat,TABULAR_EVAL_ID),
         MP2s(preRunOutputFormat,TABULAR_IFACE_ID),
         MP2s(preRunOutputFormat,TABULAR_ANNOTATED),
+        MP2s(preRunOutputFormat,TABULAR_BINARY),
         MP2s(tabularFormat,TABULAR_NONE),
         MP2s(tabularFormat,TABULAR_HEADER),
         MP2s(tabularFormat,TABULAR_EVAL_ID),
         MP2s(tabularFormat,TABULAR_IFACE_ID),
-        MP2s(tabularFormat,TABULAR_ANNOTATED);
+        MP2s(tabularFormat,TABULAR_ANNOTATED),
+        MP2s(tabularFormat,TABULAR_BINARY);
 
 static String
         MP_(errorFile),
@@ -7511,6 +7539,7 @@ static bool
 
 static int
         MP_(outputPrecision),
+        MP_(resultsOutputCompression),
         MP_(stopRestart);
 
 //#undef MP2
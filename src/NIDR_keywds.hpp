@@ -7,13 +7,14 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_stm(augment_utype,postRunInputFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_stm(augment_utype,postRunInputFormat_TABULAR_IFACE_ID)}
 		},
-	kw_2[3] = {
+	kw_2[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_stm(utype,postRunInputFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_stm(utype,postRunInputFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_1,0.,0.,0,N_stm(utype,postRunInputFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_stm(utype,postRunInputFormat_TABULAR_NONE)}
 		},
 	kw_3[2] = {
-		{"input",11,3,1,0,kw_2,0.,0.,0,N_stm(str,postRunInput)},
+		{"input",11,4,1,0,kw_2,0.,0.,0,N_stm(str,postRunInput)},
 		{"output",11,0,2,0,0,0.,0.,0,N_stm(str,postRunOutput)}
 		},
 	kw_4[3] = {
@@ -21,19 +22,21 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_stm(augment_utype,preRunOutputFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_stm(augment_utype,preRunOutputFormat_TABULAR_IFACE_ID)}
 		},
-	kw_5[3] = {
+	kw_5[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_stm(utype,preRunOutputFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_stm(utype,preRunOutputFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_4,0.,0.,0,N_stm(utype,preRunOutputFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_stm(utype,preRunOutputFormat_TABULAR_NONE)}
 		},
 	kw_6[2] = {
 		{"input",11,0,1,0,0,0.,0.,0,N_stm(str,preRunInput)},
-		{"output",11,3,2,0,kw_5,0.,0.,0,N_stm(str,preRunOutput)}
+		{"output",11,4,2,0,kw_5,0.,0.,0,N_stm(str,preRunOutput)}
 		},
 	kw_7[1] = {
 		{"stop_restart",0x29,0,1,0,0,0.,0.,0,N_stm(int,stopRestart)}
 		},
-	kw_8[1] = {
+	kw_8[2] = {
+		{"results_output_compression",0x29,0,2,0,0,0.,0.,0,N_stm(int,resultsOutputCompression)},
 		{"results_output_file",11,0,1,0,0,0.,0.,0,N_stm(str,resultsOutputFile)}
 		},
 	kw_9[2] = {
@@ -45,8 +48,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_stm(augment_utype,tabularFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_stm(augment_utype,tabularFormat_TABULAR_IFACE_ID)}
 		},
-	kw_11[5] = {
+	kw_11[6] = {
 		{"annotated",8,0,2,0,0,0.,0.,0,N_stm(utype,tabularFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,2,0,0,0.,0.,0,N_stm(utype,tabularFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,2,0,kw_10,0.,0.,0,N_stm(utype,tabularFormat_TABULAR_NONE)},
 		{"freeform",8,0,2,0,0,0.,0.,0,N_stm(utype,tabularFormat_TABULAR_NONE)},
 		{"tabular_data_file",11,0,1,0,0,0.,0.,0,N_stm(str,tabularDataFile)},
@@ -62,10 +66,10 @@ static KeyWord
 		{"post_run",8,2,12,0,kw_3,0.,0.,0,N_stm(true,postRunFlag)},
 		{"pre_run",8,2,10,0,kw_6,0.,0.,0,N_stm(true,preRunFlag)},
 		{"read_restart",11,1,4,0,kw_7,0.,0.,0,N_stm(str,readRestart)},
-		{"results_output",8,1,7,0,kw_8,0.,0.,0,N_stm(true,resultsOutputFlag)},
+		{"results_output",8,2,7,0,kw_8,0.,0.,0,N_stm(true,resultsOutputFlag)},
 		{"run",8,2,11,0,kw_9,0.,0.,0,N_stm(true,runFlag)},
-		{"tabular_data",8,5,1,0,kw_11,0.,0.,0,N_stm(true,tabularDataFlag)},
-		{"tabular_graphics_data",0,5,1,0,kw_11,0.,0.,-1,N_stm(true,tabularDataFlag)},
+		{"tabular_data",8,6,1,0,kw_11,0.,0.,0,N_stm(true,tabularDataFlag)},
+		{"tabular_graphics_data",0,6,1,0,kw_11,0.,0.,-1,N_stm(true,tabularDataFlag)},
 		{"top_method_pointer",11,0,13,0,0,0.,0.,0,N_stm(str,topMethodPointer)},
 		{"write_restart",11,0,5,0,0,0.,0.,0,N_stm(str,writeRestart)}
 		},
@@ -214,8 +218,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_37[3] = {
+	kw_37[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_36,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
@@ -229,9 +234,10 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_40[4] = {
+	kw_40[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_39,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -252,11 +258,11 @@ static KeyWord
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
 		{"batch_selection",8,4,5,0,kw_35},
-		{"export_approx_points_file",11,3,8,0,kw_37,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,8,0,kw_37,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"export_approx_points_file",11,4,8,0,kw_37,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,8,0,kw_37,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
 		{"fitness_metric",8,3,4,0,kw_38},
-		{"import_build_points_file",11,4,7,0,kw_40,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,7,0,kw_40,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,7,0,kw_40,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,7,0,kw_40,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"initial_samples",9,0,1,0,0,0.,0.,0,N_mdm(int,numSamples)},
 		{"max_iterations",0x29,0,11,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"misc_options",15,0,10,0,0,0.,0.,0,N_mdm(strL,miscOptions)},
@@ -309,17 +315,18 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_51[4] = {
+	kw_51[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_50,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_52[6] = {
 		{"build_samples",9,0,2,0,0,0.,0.,0,N_mdm(int,buildSamples)},
 		{"dakota",8,0,1,1,0,0.,0.,0,N_mdm(type,emulatorType_GP_EMULATOR)},
-		{"import_build_points_file",11,4,4,0,kw_51,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_51,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_51,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_51,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,3,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)},
 		{"surfpack",8,0,1,1,0,0.,0.,0,N_mdm(type,emulatorType_KRIGING_EMULATOR)}
 		},
@@ -328,9 +335,10 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_54[4] = {
+	kw_54[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_53,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -338,8 +346,8 @@ static KeyWord
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
 		{"collocation_ratio",10,0,1,1,0,0.,0.,0,N_mdm(Realp,collocationRatio)},
 		{"cross_validation",8,0,2,0,0,0.,0.,0,N_mdm(true,crossValidation)},
-		{"import_build_points_file",11,4,4,0,kw_54,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_54,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_54,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_54,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,3,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)}
 		},
 	kw_56[3] = {
@@ -347,16 +355,17 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_57[4] = {
+	kw_57[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_56,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_58[4] = {
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
-		{"import_build_points_file",11,4,3,0,kw_57,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,3,0,kw_57,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,3,0,kw_57,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,3,0,kw_57,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,2,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)}
 		},
 	kw_59[3] = {
@@ -379,8 +388,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_IFACE_ID)}
 		},
-	kw_63[3] = {
+	kw_63[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_62,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)}
 		},
@@ -389,7 +399,7 @@ static KeyWord
 		{"chains",0x29,0,3,0,0,3.,0.,0,N_mdm(int,numChains)},
 		{"crossover_chain_pairs",0x29,0,5,0,0,0.,0.,0,N_mdm(int,crossoverChainPairs)},
 		{"emulator",8,5,8,0,kw_61},
-		{"export_chain_points_file",11,3,10,0,kw_63,0.,0.,0,N_mdm(str,exportMCMCPtsFile)},
+		{"export_chain_points_file",11,4,10,0,kw_63,0.,0.,0,N_mdm(str,exportMCMCPtsFile)},
 		{"gr_threshold",0x1a,0,6,0,0,0.,0.,0,N_mdm(Real,grThreshold)},
 		{"jump_step",0x29,0,7,0,0,0.,0.,0,N_mdm(int,jumpStep)},
 		{"num_cr",0x29,0,4,0,0,1.,0.,0,N_mdm(int,numCR)},
@@ -402,13 +412,14 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importCandFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importCandFormat_TABULAR_IFACE_ID)}
 		},
-	kw_66[3] = {
+	kw_66[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importCandFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importCandFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_65,0.,0.,0,N_mdm(utype,importCandFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importCandFormat_TABULAR_NONE)}
 		},
 	kw_67[5] = {
-		{"import_candidate_points_file",11,3,4,0,kw_66,0.,0.,0,N_mdm(str,importCandPtsFile)},
+		{"import_candidate_points_file",11,4,4,0,kw_66,0.,0.,0,N_mdm(str,importCandPtsFile)},
 		{"initial_samples",9,0,1,1,0,0.,0.,0,N_mdm(int,numSamples)},
 		{"max_hifi_evaluations",0x29,0,3,0,0,0.,0.,0,N_mdm(int,maxHifiEvals)},
 		{"num_candidates",0x19,0,2,2,0,0.,0.,0,N_mdm(sizet,numCandidates)},
@@ -419,8 +430,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_IFACE_ID)}
 		},
-	kw_69[3] = {
+	kw_69[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_68,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)}
 		},
@@ -429,8 +441,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_71[3] = {
+	kw_71[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_70,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -461,10 +474,10 @@ static KeyWord
 		{"chain_samples",9,0,1,1,0,0.,0.,0,N_mdm(int,chainSamples)},
 		{"delayed_rejection",8,0,9,0,0,0.,0.,0,N_mdm(lit,mcmcType_delayed_rejection)},
 		{"dram",8,0,9,0,0,0.,0.,0,N_mdm(lit,mcmcType_dram)},
-		{"export_chain_points_file",11,3,8,0,kw_69,0.,0.,0,N_mdm(str,exportMCMCPtsFile)},
+		{"export_chain_points_file",11,4,8,0,kw_69,0.,0.,0,N_mdm(str,exportMCMCPtsFile)},
 		{"gpmsa_normalize",8,0,7,0,0,0.,0.,0,N_mdm(true,gpmsaNormalize)},
-		{"import_build_points_file",11,3,4,0,kw_71,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,3,4,0,kw_71,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,4,4,0,kw_71,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,4,4,0,kw_71,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"logit_transform",8,0,6,0,0,0.,0.,0,N_mdm(true,logitTransform)},
 		{"metropolis_hastings",8,0,9,0,0,0.,0.,0,N_mdm(lit,mcmcType_metropolis_hastings)},
 		{"options_file",11,0,12,0,0,0.,0.,0,N_mdm(str,quesoOptionsFilename)},
@@ -490,8 +503,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportCorrModelFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportCorrModelFormat_TABULAR_IFACE_ID)}
 		},
-	kw_81[3] = {
+	kw_81[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportCorrModelFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportCorrModelFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_80,0.,0.,0,N_mdm(utype,exportCorrModelFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportCorrModelFormat_TABULAR_NONE)}
 		},
@@ -500,8 +514,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportCorrVarFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportCorrVarFormat_TABULAR_IFACE_ID)}
 		},
-	kw_83[3] = {
+	kw_83[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportCorrVarFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportCorrVarFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_82,0.,0.,0,N_mdm(utype,exportCorrVarFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportCorrVarFormat_TABULAR_NONE)}
 		},
@@ -510,8 +525,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportDiscrepFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportDiscrepFormat_TABULAR_IFACE_ID)}
 		},
-	kw_85[3] = {
+	kw_85[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportDiscrepFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportDiscrepFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_84,0.,0.,0,N_mdm(utype,exportDiscrepFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportDiscrepFormat_TABULAR_NONE)}
 		},
@@ -520,17 +536,18 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importPredConfigFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importPredConfigFormat_TABULAR_IFACE_ID)}
 		},
-	kw_87[3] = {
+	kw_87[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importPredConfigFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importPredConfigFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_86,0.,0.,0,N_mdm(utype,importPredConfigFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importPredConfigFormat_TABULAR_NONE)}
 		},
 	kw_88[7] = {
 		{"discrepancy_type",8,4,1,0,kw_79},
-		{"export_corrected_model_file",11,3,6,0,kw_81,0.,0.,0,N_mdm(str,exportCorrModelFile)},
-		{"export_corrected_variance_file",11,3,7,0,kw_83,0.,0.,0,N_mdm(str,exportCorrVarFile)},
-		{"export_discrepancy_file",11,3,5,0,kw_85,0.,0.,0,N_mdm(str,exportDiscrepFile)},
-		{"import_prediction_configs",11,3,4,0,kw_87,0.,0.,0,N_mdm(str,importPredConfigs)},
+		{"export_corrected_model_file",11,4,6,0,kw_81,0.,0.,0,N_mdm(str,exportCorrModelFile)},
+		{"export_corrected_variance_file",11,4,7,0,kw_83,0.,0.,0,N_mdm(str,exportCorrVarFile)},
+		{"export_discrepancy_file",11,4,5,0,kw_85,0.,0.,0,N_mdm(str,exportDiscrepFile)},
+		{"import_prediction_configs",11,4,4,0,kw_87,0.,0.,0,N_mdm(str,importPredConfigs)},
 		{"num_prediction_configs",0x29,0,2,0,0,0.,0.,0,N_mdm(sizet,numPredConfigs)},
 		{"prediction_configs",14,0,3,0,0,0.,0.,0,N_mdm(RealDL,predictionConfigList)}
 		},
@@ -546,17 +563,18 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_92[4] = {
+	kw_92[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_91,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_93[6] = {
 		{"build_samples",9,0,2,0,0,0.,0.,0,N_mdm(int,buildSamples)},
 		{"dakota",8,0,1,1,0,0.,0.,0,N_mdm(type,emulatorType_GP_EMULATOR)},
-		{"import_build_points_file",11,4,4,0,kw_92,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_92,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_92,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_92,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,3,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)},
 		{"surfpack",8,0,1,1,0,0.,0.,0,N_mdm(type,emulatorType_KRIGING_EMULATOR)}
 		},
@@ -565,9 +583,10 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_95[4] = {
+	kw_95[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_94,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -575,8 +594,8 @@ static KeyWord
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
 		{"collocation_ratio",10,0,1,1,0,0.,0.,0,N_mdm(Realp,collocationRatio)},
 		{"cross_validation",8,0,2,0,0,0.,0.,0,N_mdm(true,crossValidation)},
-		{"import_build_points_file",11,4,4,0,kw_95,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_95,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_95,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_95,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,3,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)}
 		},
 	kw_97[3] = {
@@ -584,16 +603,17 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_98[4] = {
+	kw_98[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_97,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_99[4] = {
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
-		{"import_build_points_file",11,4,3,0,kw_98,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,3,0,kw_98,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,3,0,kw_98,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,3,0,kw_98,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,2,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)}
 		},
 	kw_100[3] = {
@@ -616,8 +636,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_IFACE_ID)}
 		},
-	kw_104[3] = {
+	kw_104[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_103,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)}
 		},
@@ -647,20 +668,22 @@ static KeyWord
 		{"mt19937",8,0,1,1,0,0.,0.,0,N_mdm(lit,rngName_mt19937)},
 		{"rnum2",8,0,1,1,0,0.,0.,0,N_mdm(lit,rngName_rnum2)}
 		},
-	kw_111[15] = {
+	kw_111[17] = {
 		{"adaptive_metropolis",8,0,7,0,0,0.,0.,0,N_mdm(lit,mcmcType_adaptive_metropolis)},
 		{"chain_samples",9,0,1,1,0,0.,0.,0,N_mdm(int,chainSamples)},
+		{"chains",0x19,0,11,0,0,0.,0.,0,N_mdm(pint,mcmcChains)},
 		{"delayed_rejection",8,0,7,0,0,0.,0.,0,N_mdm(lit,mcmcType_delayed_rejection)},
 		{"dram",8,0,7,0,0,0.,0.,0,N_mdm(lit,mcmcType_dram)},
 		{"emulator",8,5,3,0,kw_102},
-		{"export_chain_points_file",11,3,6,0,kw_104,0.,0.,0,N_mdm(str,exportMCMCPtsFile)},
+		{"export_chain_points_file",11,4,6,0,kw_104,0.,0.,0,N_mdm(str,exportMCMCPtsFile)},
 		{"logit_transform",8,0,5,0,0,0.,0.,0,N_mdm(true,logitTransform)},
 		{"metropolis_hastings",8,0,7,0,0,0.,0.,0,N_mdm(lit,mcmcType_metropolis_hastings)},
 		{"multilevel",8,0,7,0,0,0.,0.,0,N_mdm(lit,mcmcType_multilevel)},
 		{"pre_solve",8,3,9,0,kw_105},
+		{"prefetch_depth",0x19,0,12,0,0,0.,0.,0,N_mdm(pint,mcmcPrefetchDepth)},
 		{"proposal_covariance",8,4,10,0,kw_109,0.,0.,0,N_mdm(lit,proposalCovType_user)},
 		{"rng",8,2,8,0,kw_110},
-		{"samples",1,0,1,1,0,0.,0.,-11,N_mdm(int,chainSamples)},
+		{"samples",1,0,1,1,0,0.,0.,-13,N_mdm(int,chainSamples)},
 		{"seed",0x19,0,2,0,0,0.,0.,0,N_mdm(pint,randomSeed)},
 		{"standardized_space",8,0,4,0,0,0.,0.,0,N_mdm(true,standardizedSpace)}
 		},
@@ -681,17 +704,18 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_116[4] = {
+	kw_116[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_115,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_117[6] = {
 		{"build_samples",9,0,2,0,0,0.,0.,0,N_mdm(int,buildSamples)},
 		{"dakota",8,0,1,1,0,0.,0.,0,N_mdm(type,emulatorType_GP_EMULATOR)},
-		{"import_build_points_file",11,4,4,0,kw_116,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_116,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_116,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_116,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,3,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)},
 		{"surfpack",8,0,1,1,0,0.,0.,0,N_mdm(type,emulatorType_KRIGING_EMULATOR)}
 		},
@@ -700,9 +724,10 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_119[4] = {
+	kw_119[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_118,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -710,8 +735,8 @@ static KeyWord
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
 		{"collocation_ratio",10,0,1,1,0,0.,0.,0,N_mdm(Realp,collocationRatio)},
 		{"cross_validation",8,0,2,0,0,0.,0.,0,N_mdm(true,crossValidation)},
-		{"import_build_points_file",11,4,4,0,kw_119,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_119,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_119,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_119,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,3,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)}
 		},
 	kw_121[3] = {
@@ -719,16 +744,17 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_122[4] = {
+	kw_122[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_121,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_123[4] = {
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
-		{"import_build_points_file",11,4,3,0,kw_122,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,3,0,kw_122,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,3,0,kw_122,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,3,0,kw_122,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"posterior_adaptive",8,0,2,0,0,0.,0.,0,N_mdm(true,adaptPosteriorRefine)}
 		},
 	kw_124[3] = {
@@ -771,7 +797,7 @@ static KeyWord
 		{"model_discrepancy",8,7,6,0,kw_88,0.,0.,0,N_mdm(true,calModelDiscrepancy)},
 		{"posterior_stats",8,2,5,0,kw_89},
 		{"probability_levels",14,1,8,0,kw_90,0.,0.,0,N_mdm(resplevs01,probabilityLevels)},
-		{"queso",8,15,1,1,kw_111,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_QUESO)},
+		{"queso",8,17,1,1,kw_111,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_QUESO)},
 		{"sub_sampling_period",9,0,7,0,0,0.,0.,0,N_mdm(int,subSamplingPeriod)},
 		{"wasabi",8,8,1,1,kw_128,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_WASABI)}
 		},
@@ -1018,8 +1044,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_159[3] = {
+	kw_159[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_158,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
@@ -1032,19 +1059,20 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_162[4] = {
+	kw_162[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_161,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_163[11] = {
 		{0,0,1,0,0,kw_29},
-		{"export_approx_points_file",11,3,7,0,kw_159,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,7,0,kw_159,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"export_approx_points_file",11,4,7,0,kw_159,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,7,0,kw_159,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
 		{"gaussian_process",8,2,4,0,kw_160},
-		{"import_build_points_file",11,4,6,0,kw_162,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,6,0,kw_162,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,6,0,kw_162,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,6,0,kw_162,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"initial_samples",9,0,1,0,0,0.,0.,0,N_mdm(int,numSamples)},
 		{"kriging",0,2,4,0,kw_160,0.,0.,-4},
 		{"max_iterations",0x29,0,3,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
@@ -1093,8 +1121,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_170[3] = {
+	kw_170[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_169,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
@@ -1103,9 +1132,10 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_172[4] = {
+	kw_172[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_171,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -1126,10 +1156,10 @@ static KeyWord
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
 		{"build_samples",9,0,1,0,0,0.,0.,0,N_mdm(int,buildSamples)},
-		{"export_approx_points_file",11,3,5,0,kw_170,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,5,0,kw_170,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
-		{"import_build_points_file",11,4,4,0,kw_172,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_172,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"export_approx_points_file",11,4,5,0,kw_170,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,5,0,kw_170,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_172,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_172,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"max_iterations",0x29,0,7,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"response_levels",14,2,6,0,kw_175,0.,0.,0,N_mdm(resplevs,responseLevels)},
 		{"samples",1,0,1,0,0,0.,0.,-7,N_mdm(int,buildSamples)},
@@ -1160,8 +1190,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_182[3] = {
+	kw_182[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_181,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
@@ -1174,18 +1205,19 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_185[4] = {
+	kw_185[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_184,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_186[7] = {
-		{"export_approx_points_file",11,3,4,0,kw_182,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,4,0,kw_182,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"export_approx_points_file",11,4,4,0,kw_182,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,4,0,kw_182,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
 		{"gaussian_process",8,2,1,0,kw_183},
-		{"import_build_points_file",11,4,3,0,kw_185,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,3,0,kw_185,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,3,0,kw_185,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,3,0,kw_185,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"kriging",0,2,1,0,kw_183,0.,0.,-3},
 		{"use_derivatives",8,0,2,0,0,0.,0.,0,N_mdm(true,methodUseDerivsFlag)}
 		},
@@ -1209,8 +1241,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_190[3] = {
+	kw_190[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_189,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
@@ -1223,18 +1256,19 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_193[4] = {
+	kw_193[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_192,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
 	kw_194[7] = {
-		{"export_approx_points_file",11,3,4,0,kw_190,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,4,0,kw_190,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"export_approx_points_file",11,4,4,0,kw_190,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,4,0,kw_190,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
 		{"gaussian_process",8,2,1,0,kw_191},
-		{"import_build_points_file",11,4,3,0,kw_193,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,3,0,kw_193,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"import_build_points_file",11,5,3,0,kw_193,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,3,0,kw_193,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"kriging",0,2,1,0,kw_191,0.,0.,-3},
 		{"use_derivatives",8,0,2,0,0,0.,0.,0,N_mdm(true,methodUseDerivsFlag)}
 		},
@@ -1271,8 +1305,9 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_201[3] = {
+	kw_201[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_200,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
@@ -1281,9 +1316,10 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_203[4] = {
+	kw_203[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_202,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
@@ -1309,10 +1345,10 @@ static KeyWord
 		{0,0,3,0,0,kw_199},
 		{"convergence_tolerance",10,0,11,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"dakota",8,0,3,0,0,0.,0.,0,N_mdm(type,emulatorType_GP_EMULATOR)},
-		{"export_approx_points_file",11,3,5,0,kw_201,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,5,0,kw_201,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
-		{"import_build_points_file",11,4,4,0,kw_203,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,4,0,kw_203,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
+		{"export_approx_points_file",11,4,5,0,kw_201,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,5,0,kw_201,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"import_build_points_file",11,5,4,0,kw_203,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,4,0,kw_203,0.,0.,-1,N_mdm(str,importBuildPtsFile)},
 		{"initial_samples",9,0,1,0,0,0.,0.,0,N_mdm(int,numSamples)},
 		{"max_iterations",0x29,0,10,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"response_levels",14,2,9,0,kw_206,0.,0.,0,N_mdm(resplevs,responseLevels)},
@@ -1329,9 +1365,10 @@ static KeyWord
 		{"master",8,0,1,1,0,0.,0.,0,N_mdm(type,iteratorScheduling_MASTER_SCHEDULING)},
 		{"peer",8,0,1,1,0,0.,0.,0,N_mdm(type,iteratorScheduling_PEER_SCHEDULING)}
 		},
-	kw_210[3] = {
+	kw_210[4] = {
 		{"iterator_scheduling",8,2,2,0,kw_209},
 		{"iterator_servers",0x19,0,1,0,0,0.,0.,0,N_mdm(pint,iteratorServers)},
+		{"local_iterator_servers",0x19,0,4,0,0,0.,0.,0,N_mdm(pint,localIteratorServers)},
 		{"processors_per_iterator",0x19,0,3,0,0,0.,0.,0,N_mdm(pint,procsPerIterator)}
 		},
 	kw_211[1] = {
@@ -1357,17 +1394,18 @@ static KeyWord
 	kw_216[1] = {
 		{"model_pointer_list",11,0,1,0,0,0.,0.,0,N_mdm(strL,hybridModelPointers)}
 		},
-	kw_217[2] = {
+	kw_217[3] = {
 		{"method_name_list",15,1,1,1,kw_216,0.,0.,0,N_mdm(strL,hybridMethodNames)},
-		{"method_pointer_list",15,0,1,1,0,0.,0.,0,N_mdm(strL,hybridMethodPointers)}
+		{"method_pointer_list",15,0,1,1,0,0.,0.,0,N_mdm(strL,hybridMethodPointers)},
+		{"pipelined",8,0,2,0,0,0.,0.,0,N_mdm(true,hybridPipelined)}
 		},
 	kw_218[6] = {
-		{0,0,3,0,0,kw_210},
+		{0,0,4,0,0,kw_210},
 		{"collaborative",8,2,1,1,kw_212,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_COLLABORATIVE)},
 		{"coupled",0,5,1,1,kw_215,0.,0.,1,N_mdm(utype,subMethod_SUBMETHOD_EMBEDDED)},
 		{"embedded",8,5,1,1,kw_215,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_EMBEDDED)},
-		{"sequential",8,2,1,1,kw_217,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_SEQUENTIAL)},
-		{"uncoupled",0,2,1,1,kw_217,0.,0.,-1,N_mdm(utype,subMethod_SUBMETHOD_SEQUENTIAL)}
+		{"sequential",8,3,1,1,kw_217,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_SEQUENTIAL)},
+		{"uncoupled",0,3,1,1,kw_217,0.,0.,-1,N_mdm(utype,subMethod_SUBMETHOD_SEQUENTIAL)}
 		},
 	kw_219[2] = {
 		{"parallel",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_PARALLEL)},
@@ -1401,15 +1439,16 @@ static KeyWord
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,pstudyFileFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,pstudyFileFormat_TABULAR_IFACE_ID)}
 		},
-	kw_224[4] = {
+	kw_224[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,pstudyFileActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,pstudyFileFormat_TABULAR_ANNOTATED)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,pstudyFileFormat_TABULAR_BINARY)},
 		{"custom_annotated",8,3,1,0,kw_223,0.,0.,0,N_mdm(utype,pstudyFileFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,pstudyFileFormat_TABULAR_NONE)}
 		},
 	kw_225[3] = {
 		{0,0,1,0,0,kw_29},
-		{"import_points_file",11,4,1,1,kw_224,0.,0.,0,N_mdm(str,pstudyFilename)},
+		{"import_points_file",11,5,1,1,kw_224,0.,0.,0,N_mdm(str,pstudyFilename)},
 		{"list_of_points",14,0,1,1,0,0.,0.,0,N_mdm(RealDL,listOfPoints)}
 		},
 	kw_226[2] = {
@@ -1554,7 +1593,11 @@ static KeyWord
 		{"offset_uniform",8,1,1,1,kw_248,0.,0.,0,N_mdm(litc,TYPE_DATA_mutationType_offset_uniform)},
 		{"replace_uniform",8,0,1,1,0,0.,0.,0,N_mdm(lit,mutationType_replace_uniform)}
 		},
-	kw_250[8] = {
+	kw_250[2] = {
+		{"blocking",8,0,1,1,0,0.,0.,0,N_mdm(lit,evalSynchronize_blocking)},
+		{"nonblocking",8,0,1,1,0,0.,0.,0,N_mdm(lit,evalSynchronize_nonblocking)}
+		},
+	kw_251[9] = {
 		{"convergence_tolerance",10,0,8,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"crossover_type",8,5,5,0,kw_246},
 		{"initialization_type",8,3,4,0,kw_247},
@@ -1562,99 +1605,105 @@ static KeyWord
 		{"mutation_type",8,6,6,0,kw_249},
 		{"population_size",0x29,0,1,0,0,0.,0.,0,N_mdm(nnint,populationSize)},
 		{"print_each_pop",8,0,3,0,0,0.,0.,0,N_mdm(true,printPopFlag)},
-		{"seed",0x19,0,7,0,0,0.,0.,0,N_mdm(pint,randomSeed)}
+		{"seed",0x19,0,7,0,0,0.,0.,0,N_mdm(pint,randomSeed)},
+		{"synchronization",8,2,9,0,kw_250}
 		},
-	kw_251[3] = {
+	kw_252[3] = {
 		{"metric_tracker",8,0,1,1,0,0.,0.,0,N_mdm(lit,convergenceType_metric_tracker)},
 		{"num_generations",0x29,0,3,0,0,0.,0.,0,N_mdm(sizet,numGenerations)},
 		{"percent_change",10,0,2,0,0,0.,0.,0,N_mdm(Realz,convergenceTolerance)}
 		},
-	kw_252[2] = {
+	kw_253[2] = {
 		{"domination_count",8,0,1,1,0,0.,0.,0,N_mdm(lit,fitnessType_domination_count)},
 		{"layer_rank",8,0,1,1,0,0.,0.,0,N_mdm(lit,fitnessType_layer_rank)}
 		},
-	kw_253[1] = {
+	kw_254[1] = {
 		{"num_designs",0x29,0,1,0,0,2.,0.,0,N_mdm(pintz,numDesigns)}
 		},
-	kw_254[3] = {
+	kw_255[3] = {
 		{"distance",14,0,1,1,0,0.,0.,0,N_mdm(RealLlit,TYPE_DATA_nichingType_distance)},
-		{"max_designs",14,1,1,1,kw_253,0.,0.,0,N_mdm(RealLlit,TYPE_DATA_nichingType_max_designs)},
+		{"max_designs",14,1,1,1,kw_254,0.,0.,0,N_mdm(RealLlit,TYPE_DATA_nichingType_max_designs)},
 		{"radial",14,0,1,1,0,0.,0.,0,N_mdm(RealLlit,TYPE_DATA_nichingType_radial)}
 		},
-	kw_255[1] = {
+	kw_256[1] = {
 		{"orthogonal_distance",14,0,1,1,0,0.,0.,0,N_mdm(RealLlit,TYPE_DATA_postProcessorType_distance_postprocessor)}
 		},
-	kw_256[2] = {
+	kw_257[2] = {
 		{"shrinkage_fraction",10,0,1,0,0,0.,0.,0,N_mdm(Real01,shrinkagePercent)},
 		{"shrinkage_percentage",2,0,1,0,0,0.,0.,-1,N_mdm(Real01,shrinkagePercent)}
 		},
-	kw_257[4] = {
-		{"below_limit",10,2,1,1,kw_256,0.,0.,0,N_mdm(litp,TYPE_DATA_replacementType_below_limit)},
+	kw_258[4] = {
+		{"below_limit",10,2,1,1,kw_257,0.,0.,0,N_mdm(litp,TYPE_DATA_replacementType_below_limit)},
 		{"elitist",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_elitist)},
 		{"roulette_wheel",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_roulette_wheel)},
 		{"unique_roulette_wheel",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_unique_roulette_wheel)}
 		},
-	kw_258[10] = {
+	kw_259[10] = {
 		{0,0,1,0,0,kw_29},
-		{0,0,8,0,0,kw_250},
-		{"convergence_type",8,3,4,0,kw_251},
-		{"fitness_type",8,2,1,0,kw_252},
+		{0,0,9,0,0,kw_251},
+		{"convergence_type",8,3,4,0,kw_252},
+		{"fitness_type",8,2,1,0,kw_253},
 		{"max_function_evaluations",0x29,0,7,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
 		{"max_iterations",0x29,0,6,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
-		{"niching_type",8,3,3,0,kw_254},
-		{"postprocessor_type",8,1,5,0,kw_255},
-		{"replacement_type",8,4,2,0,kw_257},
+		{"niching_type",8,3,3,0,kw_255},
+		{"postprocessor_type",8,1,5,0,kw_256},
+		{"replacement_type",8,4,2,0,kw_258},
 		{"scaling",8,0,8,0,0,0.,0.,0,N_mdm(true,methodScaling)}
 		},
-	kw_259[1] = {
+	kw_260[1] = {
+		{"match_tolerance",0x1a,0,1,0,0,0.,0.,0,N_mdm(Real,concurrentMatchTol)}
+		},
+	kw_261[1] = {
 		{"model_pointer",11,0,1,0,0,0.,0.,0,N_mdm(str,subModelPointer)}
 		},
-	kw_260[1] = {
+	kw_262[1] = {
 		{"seed",9,0,1,0,0,0.,0.,0,N_mdm(int,randomSeed)}
 		},
-	kw_261[5] = {
-		{0,0,3,0,0,kw_210},
-		{"method_name",11,1,1,1,kw_259,0.,0.,0,N_mdm(str,subMethodName)},
+	kw_263[6] = {
+		{0,0,4,0,0,kw_210},
+		{"converged_starts",0x19,1,4,0,kw_260,0.,0.,0,N_mdm(pint,concurrentConvergedStarts)},
+		{"method_name",11,1,1,1,kw_261,0.,0.,0,N_mdm(str,subMethodName)},
 		{"method_pointer",11,0,1,1,0,0.,0.,0,N_mdm(str,subMethodPointer)},
-		{"random_starts",9,1,2,0,kw_260,0.,0.,0,N_mdm(int,concurrentRandomJobs)},
+		{"random_starts",9,1,2,0,kw_262,0.,0.,0,N_mdm(int,concurrentRandomJobs)},
 		{"starting_points",14,0,3,0,0,0.,0.,0,N_mdm(RealDL,concurrentParameterSets)}
 		},
-	kw_262[2] = {
+	kw_264[2] = {
 		{0,0,1,0,0,kw_29},
 		{"partitions",13,0,1,1,0,0.,0.,0,N_mdm(usharray,varPartitions)}
 		},
-	kw_263[3] = {
+	kw_265[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportSamplesFormat_TABULAR_IFACE_ID)}
 		},
-	kw_264[3] = {
+	kw_266[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_263,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_265,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportSamplesFormat_TABULAR_NONE)}
 		},
-	kw_265[3] = {
+	kw_267[3] = {
 		{"central",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_CENTRAL_MOMENTS)},
 		{"none",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_NO_MOMENTS)},
 		{"standard",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_STANDARD_MOMENTS)}
 		},
-	kw_266[2] = {
+	kw_268[2] = {
 		{"lhs",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_LHS)},
 		{"random",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_RANDOM)}
 		},
-	kw_267[10] = {
+	kw_269[10] = {
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
 		{"convergence_tolerance",10,0,7,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
-		{"export_sample_sequence",8,3,5,0,kw_264,0.,0.,0,N_mdm(true,exportSampleSeqFlag)},
-		{"final_moments",8,3,8,0,kw_265},
+		{"export_sample_sequence",8,4,5,0,kw_266,0.,0.,0,N_mdm(true,exportSampleSeqFlag)},
+		{"final_moments",8,3,8,0,kw_267},
 		{"fixed_seed",8,0,2,0,0,0.,0.,0,N_mdm(true,fixedSeedFlag)},
 		{"max_iterations",0x29,0,6,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"pilot_samples",13,0,3,0,0,0.,0.,0,N_mdm(szarray,pilotSamples)},
-		{"sample_type",8,2,4,0,kw_266},
+		{"sample_type",8,2,4,0,kw_268},
 		{"seed",0x19,0,1,0,0,0.,0.,0,N_mdm(pint,randomSeed)}
 		},
-	kw_268[9] = {
+	kw_270[9] = {
 		{0,0,1,0,0,kw_29},
 		{"convergence_tolerance",10,0,4,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"max_function_evaluations",0x29,0,6,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
@@ -1665,7 +1714,7 @@ static KeyWord
 		{"solution_target",10,0,1,0,0,0.,0.,0,N_mdm(Real,solnTarget)},
 		{"volume_boxsize_limit",10,0,3,0,0,0.,0.,0,N_mdm(Real,volBoxSize)}
 		},
-	kw_269[15] = {
+	kw_271[15] = {
 		{0,0,1,0,0,kw_29},
 		{"absolute_conv_tol",10,0,2,0,0,0.,0.,0,N_mdm(Real,absConvTol)},
 		{"convergence_tolerance",10,0,10,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
@@ -1682,414 +1731,419 @@ static KeyWord
 		{"speculative",8,0,12,0,0,0.,0.,0,N_mdm(true,speculativeFlag)},
 		{"x_conv_tol",10,0,3,0,0,0.,0.,0,N_mdm(Real,xConvTol)}
 		},
-	kw_270[5] = {
+	kw_272[5] = {
 		{0,0,1,0,0,kw_29},
 		{"convergence_tolerance",10,0,2,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"max_function_evaluations",0x29,0,3,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
 		{"max_iterations",0x29,0,1,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"scaling",8,0,4,0,0,0.,0.,0,N_mdm(true,methodScaling)}
 		},
-	kw_271[2] = {
+	kw_273[2] = {
 		{"global",8,0,1,1,0,0.,0.,0,N_mdm(lit,lipschitzType_global)},
 		{"local",8,0,1,1,0,0.,0.,0,N_mdm(lit,lipschitzType_local)}
 		},
-	kw_272[2] = {
+	kw_274[2] = {
 		{"parallel",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_PARALLEL)},
 		{"series",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_SERIES)}
 		},
-	kw_273[3] = {
+	kw_275[3] = {
 		{"gen_reliabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_GEN_RELIABILITIES)},
 		{"probabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_PROBABILITIES)},
-		{"system",8,2,2,0,kw_272}
+		{"system",8,2,2,0,kw_274}
 		},
-	kw_274[2] = {
-		{"compute",8,3,2,0,kw_273},
+	kw_276[2] = {
+		{"compute",8,3,2,0,kw_275},
 		{"num_response_levels",13,0,1,0,0,0.,0.,0,N_mdm(num_resplevs,responseLevels)}
 		},
-	kw_275[8] = {
+	kw_277[8] = {
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
 		{"build_samples",9,0,1,1,0,0.,0.,0,N_mdm(int,buildSamples)},
-		{"lipschitz",8,2,3,0,kw_271},
-		{"response_levels",14,2,5,0,kw_274,0.,0.,0,N_mdm(resplevs,responseLevels)},
+		{"lipschitz",8,2,3,0,kw_273},
+		{"response_levels",14,2,5,0,kw_276,0.,0.,0,N_mdm(resplevs,responseLevels)},
 		{"samples",1,0,1,1,0,0.,0.,-3,N_mdm(int,buildSamples)},
 		{"samples_on_emulator",9,0,4,0,0,0.,0.,0,N_mdm(int,samplesOnEmulator)},
 		{"seed",0x19,0,2,0,0,0.,0.,0,N_mdm(pint,randomSeed)}
 		},
-	kw_276[1] = {
+	kw_278[1] = {
 		{"num_reliability_levels",13,0,1,0,0,0.,0.,0,N_mdm(num_resplevs,reliabilityLevels)}
 		},
-	kw_277[2] = {
+	kw_279[2] = {
 		{"parallel",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_PARALLEL)},
 		{"series",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_SERIES)}
 		},
-	kw_278[4] = {
+	kw_280[4] = {
 		{"gen_reliabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_GEN_RELIABILITIES)},
 		{"probabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_PROBABILITIES)},
 		{"reliabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_RELIABILITIES)},
-		{"system",8,2,2,0,kw_277}
+		{"system",8,2,2,0,kw_279}
 		},
-	kw_279[2] = {
-		{"compute",8,4,2,0,kw_278},
+	kw_281[2] = {
+		{"compute",8,4,2,0,kw_280},
 		{"num_response_levels",13,0,1,0,0,0.,0.,0,N_mdm(num_resplevs,responseLevels)}
 		},
-	kw_280[2] = {
-		{"reliability_levels",14,1,1,0,kw_276,0.,0.,0,N_mdm(resplevs,reliabilityLevels)},
-		{"response_levels",14,2,2,0,kw_279,0.,0.,0,N_mdm(resplevs,responseLevels)}
+	kw_282[2] = {
+		{"reliability_levels",14,1,1,0,kw_278,0.,0.,0,N_mdm(resplevs,reliabilityLevels)},
+		{"response_levels",14,2,2,0,kw_281,0.,0.,0,N_mdm(resplevs,responseLevels)}
 		},
-	kw_281[3] = {
+	kw_283[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_282[4] = {
+	kw_284[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_281,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_283,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importBuildFormat_TABULAR_NONE)}
 		},
-	kw_283[2] = {
-		{"import_build_points_file",11,4,1,0,kw_282,0.,0.,0,N_mdm(str,importBuildPtsFile)},
-		{"import_points_file",3,4,1,0,kw_282,0.,0.,-1,N_mdm(str,importBuildPtsFile)}
+	kw_285[2] = {
+		{"import_build_points_file",11,5,1,0,kw_284,0.,0.,0,N_mdm(str,importBuildPtsFile)},
+		{"import_points_file",3,5,1,0,kw_284,0.,0.,-1,N_mdm(str,importBuildPtsFile)}
 		},
-	kw_284[2] = {
+	kw_286[2] = {
 		{"advancements",9,0,1,0,0,0.,0.,0,N_mdm(ushint,adaptedBasisAdvancements)},
 		{"soft_convergence_limit",9,0,2,0,0,0.,0.,0,N_mdm(ushint,softConvLimit)}
 		},
-	kw_285[3] = {
-		{"adapted",8,2,1,1,kw_284,0.,0.,0,N_mdm(type,expansionBasisType_ADAPTED_BASIS_EXPANDING_FRONT)},
+	kw_287[3] = {
+		{"adapted",8,2,1,1,kw_286,0.,0.,0,N_mdm(type,expansionBasisType_ADAPTED_BASIS_EXPANDING_FRONT)},
 		{"tensor_product",8,0,1,1,0,0.,0.,0,N_mdm(type,expansionBasisType_TENSOR_PRODUCT_BASIS)},
 		{"total_order",8,0,1,1,0,0.,0.,0,N_mdm(type,expansionBasisType_TOTAL_ORDER_BASIS)}
 		},
-	kw_286[1] = {
+	kw_288[1] = {
 		{"noise_tolerance",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,regressionNoiseTol)}
 		},
-	kw_287[1] = {
+	kw_289[1] = {
 		{"noise_only",8,0,1,0,0,0.,0.,0,N_mdm(true,crossValidNoiseOnly)}
 		},
-	kw_288[1] = {
+	kw_290[1] = {
 		{"noise_tolerance",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,regressionNoiseTol)}
 		},
-	kw_289[2] = {
+	kw_291[2] = {
 		{"l2_penalty",10,0,2,0,0,0.,0.,0,N_mdm(Real,regressionL2Penalty)},
 		{"noise_tolerance",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,regressionNoiseTol)}
 		},
-	kw_290[2] = {
+	kw_292[2] = {
 		{"equality_constrained",8,0,1,0,0,0.,0.,0,N_mdm(type,lsRegressionType_EQ_CON_LS)},
 		{"svd",8,0,1,0,0,0.,0.,0,N_mdm(type,lsRegressionType_SVD_LS)}
 		},
-	kw_291[1] = {
+	kw_293[1] = {
 		{"noise_tolerance",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,regressionNoiseTol)}
 		},
-	kw_292[19] = {
+	kw_294[19] = {
 		{"basis_pursuit",8,0,2,0,0,0.,0.,0,N_mdm(type,regressionType_BASIS_PURSUIT)},
-		{"basis_pursuit_denoising",8,1,2,0,kw_286,0.,0.,0,N_mdm(type,regressionType_BASIS_PURSUIT_DENOISING)},
+		{"basis_pursuit_denoising",8,1,2,0,kw_288,0.,0.,0,N_mdm(type,regressionType_BASIS_PURSUIT_DENOISING)},
 		{"bp",0,0,2,0,0,0.,0.,-2,N_mdm(type,regressionType_BASIS_PURSUIT)},
-		{"bpdn",0,1,2,0,kw_286,0.,0.,-2,N_mdm(type,regressionType_BASIS_PURSUIT_DENOISING)},
-		{"cross_validation",8,1,3,0,kw_287,0.,0.,0,N_mdm(true,crossValidation)},
-		{"lars",0,1,2,0,kw_288,0.,0.,3,N_mdm(type,regressionType_LEAST_ANGLE_REGRESSION)},
-		{"lasso",0,2,2,0,kw_289,0.,0.,1,N_mdm(type,regressionType_LASSO_REGRESSION)},
-		{"least_absolute_shrinkage",8,2,2,0,kw_289,0.,0.,0,N_mdm(type,regressionType_LASSO_REGRESSION)},
-		{"least_angle_regression",8,1,2,0,kw_288,0.,0.,0,N_mdm(type,regressionType_LEAST_ANGLE_REGRESSION)},
-		{"least_squares",8,2,2,0,kw_290,0.,0.,0,N_mdm(type,regressionType_DEFAULT_LEAST_SQ_REGRESSION)},
+		{"bpdn",0,1,2,0,kw_288,0.,0.,-2,N_mdm(type,regressionType_BASIS_PURSUIT_DENOISING)},
+		{"cross_validation",8,1,3,0,kw_289,0.,0.,0,N_mdm(true,crossValidation)},
+		{"lars",0,1,2,0,kw_290,0.,0.,3,N_mdm(type,regressionType_LEAST_ANGLE_REGRESSION)},
+		{"lasso",0,2,2,0,kw_291,0.,0.,1,N_mdm(type,regressionType_LASSO_REGRESSION)},
+		{"least_absolute_shrinkage",8,2,2,0,kw_291,0.,0.,0,N_mdm(type,regressionType_LASSO_REGRESSION)},
+		{"least_angle_regression",8,1,2,0,kw_290,0.,0.,0,N_mdm(type,regressionType_LEAST_ANGLE_REGRESSION)},
+		{"least_squares",8,2,2,0,kw_292,0.,0.,0,N_mdm(type,regressionType_DEFAULT_LEAST_SQ_REGRESSION)},
 		{"max_iterations",0x29,0,7,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"max_solver_iterations",0x29,0,8,0,0,0.,0.,0,N_mdm(nnint,maxSolverIterations)},
-		{"omp",0,1,2,0,kw_291,0.,0.,1,N_mdm(type,regressionType_ORTHOG_MATCH_PURSUIT)},
-		{"orthogonal_matching_pursuit",8,1,2,0,kw_291,0.,0.,0,N_mdm(type,regressionType_ORTHOG_MATCH_PURSUIT)},
+		{"omp",0,1,2,0,kw_293,0.,0.,1,N_mdm(type,regressionType_ORTHOG_MATCH_PURSUIT)},
+		{"orthogonal_matching_pursuit",8,1,2,0,kw_293,0.,0.,0,N_mdm(type,regressionType_ORTHOG_MATCH_PURSUIT)},
 		{"ratio_order",10,0,1,0,0,0.,0.,0,N_mdm(Realp,collocRatioTermsOrder)},
 		{"reuse_points",8,0,6,0,0,0.,0.,0,N_mdm(lit,pointReuse_all)},
 		{"reuse_samples",0,0,6,0,0,0.,0.,-1,N_mdm(lit,pointReuse_all)},
 		{"tensor_grid",8,0,5,0,0,0.,0.,0,N_mdm(true,tensorGridFlag)},
 		{"use_derivatives",8,0,4,0,0,0.,0.,0,N_mdm(true,methodUseDerivsFlag)}
 		},
-	kw_293[3] = {
+	kw_295[3] = {
 		{"incremental_lhs",8,0,2,0,0,0.,0.,0,N_mdm(lit,expansionSampleType_incremental_lhs)},
 		{"reuse_points",8,0,1,0,0,0.,0.,0,N_mdm(lit,pointReuse_all)},
 		{"reuse_samples",0,0,1,0,0,0.,0.,-1,N_mdm(lit,pointReuse_all)}
 		},
-	kw_294[6] = {
-		{0,0,2,0,0,kw_283},
-		{"basis_type",8,3,2,0,kw_285},
-		{"collocation_points_sequence",13,19,3,1,kw_292,0.,0.,0,N_mdm(szarray,collocationPoints)},
-		{"collocation_ratio",10,19,3,1,kw_292,0.,0.,0,N_mdm(Realp,collocationRatio)},
+	kw_296[6] = {
+		{0,0,2,0,0,kw_285},
+		{"basis_type",8,3,2,0,kw_287},
+		{"collocation_points_sequence",13,19,3,1,kw_294,0.,0.,0,N_mdm(szarray,collocationPoints)},
+		{"collocation_ratio",10,19,3,1,kw_294,0.,0.,0,N_mdm(Realp,collocationRatio)},
 		{"dimension_preference",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,anisoDimPref)},
-		{"expansion_samples_sequence",13,3,3,1,kw_293,0.,0.,0,N_mdm(szarray,expansionSamples)}
+		{"expansion_samples_sequence",13,3,3,1,kw_295,0.,0.,0,N_mdm(szarray,expansionSamples)}
 		},
-	kw_295[3] = {
+	kw_297[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_296[3] = {
+	kw_298[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_295,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_297,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
-	kw_297[3] = {
+	kw_299[3] = {
 		{"central",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_CENTRAL_MOMENTS)},
 		{"none",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_NO_MOMENTS)},
 		{"standard",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_STANDARD_MOMENTS)}
 		},
-	kw_298[3] = {
+	kw_300[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mdm(augment_utype,importApproxFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_299[4] = {
+	kw_301[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importApproxActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_298,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_300,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_NONE)}
 		},
-	kw_300[5] = {
-		{0,0,2,0,0,kw_283},
+	kw_302[5] = {
+		{0,0,2,0,0,kw_285},
 		{"collocation_points_sequence",13,0,1,1,0,0.,0.,0,N_mdm(szarray,collocationPoints)},
 		{"reuse_points",8,0,3,0,0,0.,0.,0,N_mdm(lit,pointReuse_all)},
 		{"reuse_samples",0,0,3,0,0,0.,0.,-1,N_mdm(lit,pointReuse_all)},
 		{"tensor_grid",13,0,2,0,0,0.,0.,0,N_mdm(usharray,tensorGridOrder)}
 		},
-	kw_301[3] = {
+	kw_303[3] = {
 		{"decay",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_DECAY)},
 		{"generalized",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_GENERALIZED)},
 		{"sobol",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_SOBOL)}
 		},
-	kw_302[2] = {
-		{"dimension_adaptive",8,3,1,1,kw_301},
+	kw_304[2] = {
+		{"dimension_adaptive",8,3,1,1,kw_303},
 		{"uniform",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_UNIFORM_CONTROL)}
 		},
-	kw_303[4] = {
+	kw_305[4] = {
 		{"adapt_import",8,0,1,1,0,0.,0.,0,N_mdm(utype,integrationRefine_AIS)},
 		{"import",8,0,1,1,0,0.,0.,0,N_mdm(utype,integrationRefine_IS)},
 		{"mm_adapt_import",8,0,1,1,0,0.,0.,0,N_mdm(utype,integrationRefine_MMAIS)},
 		{"refinement_samples",13,0,2,0,0,0.,0.,0,N_mdm(ivec,refineSamples)}
 		},
-	kw_304[3] = {
+	kw_306[3] = {
 		{"dimension_preference",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,anisoDimPref)},
 		{"nested",8,0,2,0,0,0.,0.,0,N_mdm(type,nestingOverride_NESTED)},
 		{"non_nested",8,0,2,0,0,0.,0.,0,N_mdm(type,nestingOverride_NON_NESTED)}
 		},
-	kw_305[2] = {
+	kw_307[2] = {
 		{"lhs",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_LHS)},
 		{"random",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_RANDOM)}
 		},
-	kw_306[3] = {
-		{0,0,3,0,0,kw_304},
+	kw_308[3] = {
+		{0,0,3,0,0,kw_306},
 		{"restricted",8,0,1,0,0,0.,0.,0,N_mdm(type,growthOverride_RESTRICTED)},
 		{"unrestricted",8,0,1,0,0,0.,0.,0,N_mdm(type,growthOverride_UNRESTRICTED)}
 		},
-	kw_307[2] = {
+	kw_309[2] = {
 		{"drop_tolerance",10,0,2,0,0,0.,0.,0,N_mdm(Real,vbdDropTolerance)},
 		{"interaction_order",0x19,0,1,0,0,0.,0.,0,N_mdm(ushint,vbdOrder)}
 		},
-	kw_308[32] = {
+	kw_310[32] = {
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
-		{0,0,2,0,0,kw_280},
+		{0,0,2,0,0,kw_282},
 		{"askey",8,0,8,0,0,0.,0.,0,N_mdm(type,expansionType_ASKEY_U)},
 		{"convergence_tolerance",10,0,5,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"cubature_integrand",9,0,9,1,0,0.,0.,0,N_mdm(ushint,cubIntOrder)},
 		{"diagonal_covariance",8,0,11,0,0,0.,0.,0,N_mdm(type,covarianceControl_DIAGONAL_COVARIANCE)},
-		{"expansion_order_sequence",13,5,9,1,kw_294,0.,0.,0,N_mdm(usharray,expansionOrder)},
-		{"export_approx_points_file",11,3,16,0,kw_296,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"expansion_order_sequence",13,5,9,1,kw_296,0.,0.,0,N_mdm(usharray,expansionOrder)},
+		{"export_approx_points_file",11,4,16,0,kw_298,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
 		{"export_expansion_file",11,0,17,0,0,0.,0.,0,N_mdm(str,exportExpansionFile)},
-		{"export_points_file",3,3,16,0,kw_296,0.,0.,-2,N_mdm(str,exportApproxPtsFile)},
-		{"final_moments",8,3,6,0,kw_297},
+		{"export_points_file",3,4,16,0,kw_298,0.,0.,-2,N_mdm(str,exportApproxPtsFile)},
+		{"final_moments",8,3,6,0,kw_299},
 		{"fixed_seed",8,0,3,0,0,0.,0.,0,N_mdm(true,fixedSeedFlag)},
 		{"full_covariance",8,0,11,0,0,0.,0.,0,N_mdm(type,covarianceControl_FULL_COVARIANCE)},
-		{"import_approx_points_file",11,4,15,0,kw_299,0.,0.,0,N_mdm(str,importApproxPtsFile)},
+		{"import_approx_points_file",11,5,15,0,kw_301,0.,0.,0,N_mdm(str,importApproxPtsFile)},
 		{"import_expansion_file",11,0,9,1,0,0.,0.,0,N_mdm(str,importExpansionFile)},
-		{"least_interpolation",0,4,9,1,kw_300,0.,0.,4,N_mdm(type,regressionType_ORTHOG_LEAST_INTERPOLATION)},
+		{"least_interpolation",0,4,9,1,kw_302,0.,0.,4,N_mdm(type,regressionType_ORTHOG_LEAST_INTERPOLATION)},
 		{"max_refinement_iterations",0x29,0,4,0,0,0.,0.,0,N_mdm(nnint,maxRefineIterations)},
 		{"normalized",8,0,12,0,0,0.,0.,0,N_mdm(true,normalizedCoeffs)},
-		{"oli",0,4,9,1,kw_300,0.,0.,1,N_mdm(type,regressionType_ORTHOG_LEAST_INTERPOLATION)},
-		{"orthogonal_least_interpolation",8,4,9,1,kw_300,0.,0.,0,N_mdm(type,regressionType_ORTHOG_LEAST_INTERPOLATION)},
-		{"p_refinement",8,2,7,0,kw_302,0.,0.,0,N_mdm(type,refinementType_P_REFINEMENT)},
-		{"probability_refinement",8,4,14,0,kw_303},
-		{"quadrature_order_sequence",13,3,9,1,kw_304,0.,0.,0,N_mdm(usharray,quadratureOrder)},
-		{"sample_refinement",0,4,14,0,kw_303,0.,0.,-2},
-		{"sample_type",8,2,13,0,kw_305},
+		{"oli",0,4,9,1,kw_302,0.,0.,1,N_mdm(type,regressionType_ORTHOG_LEAST_INTERPOLATION)},
+		{"orthogonal_least_interpolation",8,4,9,1,kw_302,0.,0.,0,N_mdm(type,regressionType_ORTHOG_LEAST_INTERPOLATION)},
+		{"p_refinement",8,2,7,0,kw_304,0.,0.,0,N_mdm(type,refinementType_P_REFINEMENT)},
+		{"probability_refinement",8,4,14,0,kw_305},
+		{"quadrature_order_sequence",13,3,9,1,kw_306,0.,0.,0,N_mdm(usharray,quadratureOrder)},
+		{"sample_refinement",0,4,14,0,kw_305,0.,0.,-2},
+		{"sample_type",8,2,13,0,kw_307},
 		{"samples",1,0,1,0,0,0.,0.,1,N_mdm(int,samplesOnEmulator)},
 		{"samples_on_emulator",9,0,1,0,0,0.,0.,0,N_mdm(int,samplesOnEmulator)},
 		{"seed",0x19,0,2,0,0,0.,0.,0,N_mdm(pint,randomSeed)},
-		{"sparse_grid_level_sequence",13,2,9,1,kw_306,0.,0.,0,N_mdm(usharray,sparseGridLevel)},
-		{"variance_based_decomp",8,2,10,0,kw_307,0.,0.,0,N_mdm(true,vbdFlag)},
+		{"sparse_grid_level_sequence",13,2,9,1,kw_308,0.,0.,0,N_mdm(usharray,sparseGridLevel)},
+		{"variance_based_decomp",8,2,10,0,kw_309,0.,0.,0,N_mdm(true,vbdFlag)},
 		{"wiener",8,0,8,0,0,0.,0.,0,N_mdm(type,expansionType_STD_NORMAL_U)}
 		},
-	kw_309[2] = {
+	kw_311[2] = {
 		{"global",8,0,1,1,0,0.,0.,0,N_mdm(lit,lipschitzType_global)},
 		{"local",8,0,1,1,0,0.,0.,0,N_mdm(lit,lipschitzType_local)}
 		},
-	kw_310[2] = {
+	kw_312[2] = {
 		{"parallel",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_PARALLEL)},
 		{"series",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTargetReduce_SYSTEM_SERIES)}
 		},
-	kw_311[3] = {
+	kw_313[3] = {
 		{"gen_reliabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_GEN_RELIABILITIES)},
 		{"probabilities",8,0,1,1,0,0.,0.,0,N_mdm(type,responseLevelTarget_PROBABILITIES)},
-		{"system",8,2,2,0,kw_310}
+		{"system",8,2,2,0,kw_312}
 		},
-	kw_312[2] = {
-		{"compute",8,3,2,0,kw_311},
+	kw_314[2] = {
+		{"compute",8,3,2,0,kw_313},
 		{"num_response_levels",13,0,1,0,0,0.,0.,0,N_mdm(num_resplevs,responseLevels)}
 		},
-	kw_313[8] = {
+	kw_315[8] = {
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
 		{"build_samples",9,0,1,1,0,0.,0.,0,N_mdm(int,buildSamples)},
-		{"lipschitz",8,2,3,0,kw_309},
-		{"response_levels",14,2,5,0,kw_312,0.,0.,0,N_mdm(resplevs,responseLevels)},
+		{"lipschitz",8,2,3,0,kw_311},
+		{"response_levels",14,2,5,0,kw_314,0.,0.,0,N_mdm(resplevs,responseLevels)},
 		{"samples",1,0,1,1,0,0.,0.,-3,N_mdm(int,buildSamples)},
 		{"samples_on_emulator",9,0,4,0,0,0.,0.,0,N_mdm(int,samplesOnEmulator)},
 		{"seed",0x19,0,2,0,0,0.,0.,0,N_mdm(pint,randomSeed)}
 		},
-	kw_314[2] = {
+	kw_316[2] = {
 		{"candidate_designs",0x19,0,1,0,0,0.,0.,0,N_mdm(sizet,numCandidateDesigns)},
 		{"leja_oversample_ratio",10,0,1,0,0,0.,0.,0,N_mdm(Real,collocationRatio)}
 		},
-	kw_315[3] = {
+	kw_317[3] = {
 		{"central",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_CENTRAL_MOMENTS)},
 		{"none",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_NO_MOMENTS)},
 		{"standard",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_STANDARD_MOMENTS)}
 		},
-	kw_316[1] = {
+	kw_318[1] = {
 		{"percent_variance_explained",10,0,1,0,0,0.,0.,0,N_mdm(Real,percentVarianceExplained)}
 		},
-	kw_317[4] = {
+	kw_319[4] = {
 		{"incremental_lhs",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_LHS)},
 		{"incremental_random",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_RANDOM)},
 		{"lhs",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_LHS)},
 		{"random",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_RANDOM)}
 		},
-	kw_318[1] = {
+	kw_320[1] = {
 		{"drop_tolerance",10,0,1,0,0,0.,0.,0,N_mdm(Real,vbdDropTolerance)}
 		},
-	kw_319[5] = {
+	kw_321[5] = {
 		{"confidence_level",10,0,2,0,0,0.,0.,0,N_mdm(Real,wilksConfidenceLevel)},
 		{"one_sided_lower",8,0,3,0,0,0.,0.,0,N_mdm(type,wilksSidedInterval_ONE_SIDED_LOWER)},
 		{"one_sided_upper",8,0,4,0,0,0.,0.,0,N_mdm(type,wilksSidedInterval_ONE_SIDED_UPPER)},
 		{"order",9,0,1,0,0,0.,0.,0,N_mdm(ushint,wilksOrder)},
 		{"two_sided",8,0,5,0,0,0.,0.,0,N_mdm(type,wilksSidedInterval_TWO_SIDED)}
 		},
-	kw_320[15] = {
+	kw_322[15] = {
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
-		{0,0,2,0,0,kw_280},
+		{0,0,2,0,0,kw_282},
 		{"backfill",8,0,8,0,0,0.,0.,0,N_mdm(true,backfillFlag)},
-		{"d_optimal",8,2,6,0,kw_314,0.,0.,0,N_mdm(true,dOptimal)},
-		{"final_moments",8,3,11,0,kw_315},
+		{"d_optimal",8,2,6,0,kw_316,0.,0.,0,N_mdm(true,dOptimal)},
+		{"final_moments",8,3,11,0,kw_317},
 		{"fixed_seed",8,0,3,0,0,0.,0.,0,N_mdm(true,fixedSeedFlag)},
 		{"initial_samples",1,0,1,0,0,0.,0.,4,N_mdm(int,numSamples)},
-		{"principal_components",8,1,9,0,kw_316,0.,0.,0,N_mdm(true,pcaFlag)},
+		{"principal_components",8,1,9,0,kw_318,0.,0.,0,N_mdm(true,pcaFlag)},
 		{"refinement_samples",13,0,5,0,0,0.,0.,0,N_mdm(ivec,refineSamples)},
-		{"sample_type",8,4,4,0,kw_317},
+		{"sample_type",8,4,4,0,kw_319},
 		{"samples",9,0,1,0,0,0.,0.,0,N_mdm(int,numSamples)},
 		{"seed",0x19,0,2,0,0,0.,0.,0,N_mdm(pint,randomSeed)},
-		{"variance_based_decomp",8,1,7,0,kw_318,0.,0.,0,N_mdm(true,vbdFlag)},
-		{"wilks",8,5,10,0,kw_319,0.,0.,0,N_mdm(true,wilksFlag)}
+		{"variance_based_decomp",8,1,7,0,kw_320,0.,0.,0,N_mdm(true,vbdFlag)},
+		{"wilks",8,5,10,0,kw_321,0.,0.,0,N_mdm(true,wilksFlag)}
 		},
-	kw_321[3] = {
+	kw_323[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_322[3] = {
+	kw_324[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_321,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_323,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,exportApproxFormat_TABULAR_NONE)}
 		},
-	kw_323[3] = {
+	kw_325[3] = {
 		{"central",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_CENTRAL_MOMENTS)},
 		{"none",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_NO_MOMENTS)},
 		{"standard",8,0,1,1,0,0.,0.,0,N_mdm(type,finalMomentsType_STANDARD_MOMENTS)}
 		},
-	kw_324[2] = {
+	kw_326[2] = {
 		{"generalized",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_GENERALIZED)},
 		{"sobol",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_SOBOL)}
 		},
-	kw_325[3] = {
-		{"dimension_adaptive",8,2,1,1,kw_324},
+	kw_327[3] = {
+		{"dimension_adaptive",8,2,1,1,kw_326},
 		{"local_adaptive",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_LOCAL_ADAPTIVE_CONTROL)},
 		{"uniform",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_UNIFORM_CONTROL)}
 		},
-	kw_326[3] = {
+	kw_328[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mdm(augment_utype,importApproxFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mdm(augment_utype,importApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mdm(augment_utype,importApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_327[4] = {
+	kw_329[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mdm(true,importApproxActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_326,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_328,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mdm(utype,importApproxFormat_TABULAR_NONE)}
 		},
-	kw_328[2] = {
+	kw_330[2] = {
 		{"generalized",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_GENERALIZED)},
 		{"sobol",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_DIMENSION_ADAPTIVE_CONTROL_SOBOL)}
 		},
-	kw_329[2] = {
-		{"dimension_adaptive",8,2,1,1,kw_328},
+	kw_331[2] = {
+		{"dimension_adaptive",8,2,1,1,kw_330},
 		{"uniform",8,0,1,1,0,0.,0.,0,N_mdm(type,refinementControl_UNIFORM_CONTROL)}
 		},
-	kw_330[4] = {
+	kw_332[4] = {
 		{"adapt_import",8,0,1,1,0,0.,0.,0,N_mdm(utype,integrationRefine_AIS)},
 		{"import",8,0,1,1,0,0.,0.,0,N_mdm(utype,integrationRefine_IS)},
 		{"mm_adapt_import",8,0,1,1,0,0.,0.,0,N_mdm(utype,integrationRefine_MMAIS)},
 		{"refinement_samples",13,0,2,0,0,0.,0.,0,N_mdm(ivec,refineSamples)}
 		},
-	kw_331[2] = {
+	kw_333[2] = {
 		{"lhs",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_LHS)},
 		{"random",8,0,1,1,0,0.,0.,0,N_mdm(utype,sampleType_SUBMETHOD_RANDOM)}
 		},
-	kw_332[4] = {
+	kw_334[4] = {
 		{"hierarchical",8,0,2,0,0,0.,0.,0,N_mdm(type,expansionBasisType_HIERARCHICAL_INTERPOLANT)},
 		{"nodal",8,0,2,0,0,0.,0.,0,N_mdm(type,expansionBasisType_NODAL_INTERPOLANT)},
 		{"restricted",8,0,1,0,0,0.,0.,0,N_mdm(type,growthOverride_RESTRICTED)},
 		{"unrestricted",8,0,1,0,0,0.,0.,0,N_mdm(type,growthOverride_UNRESTRICTED)}
 		},
-	kw_333[2] = {
+	kw_335[2] = {
 		{"drop_tolerance",10,0,2,0,0,0.,0.,0,N_mdm(Real,vbdDropTolerance)},
 		{"interaction_order",0x19,0,1,0,0,0.,0.,0,N_mdm(ushint,vbdOrder)}
 		},
-	kw_334[30] = {
+	kw_336[30] = {
 		{0,0,1,0,0,kw_29},
 		{0,0,4,0,0,kw_34},
-		{0,0,2,0,0,kw_280},
+		{0,0,2,0,0,kw_282},
 		{"askey",8,0,8,0,0,0.,0.,0,N_mdm(type,expansionType_ASKEY_U)},
 		{"convergence_tolerance",10,0,5,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"diagonal_covariance",8,0,14,0,0,0.,0.,0,N_mdm(type,covarianceControl_DIAGONAL_COVARIANCE)},
 		{"dimension_preference",14,0,10,0,0,0.,0.,0,N_mdm(RealDL,anisoDimPref)},
-		{"export_approx_points_file",11,3,18,0,kw_322,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,18,0,kw_322,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
-		{"final_moments",8,3,6,0,kw_323},
+		{"export_approx_points_file",11,4,18,0,kw_324,0.,0.,0,N_mdm(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,18,0,kw_324,0.,0.,-1,N_mdm(str,exportApproxPtsFile)},
+		{"final_moments",8,3,6,0,kw_325},
 		{"fixed_seed",8,0,3,0,0,0.,0.,0,N_mdm(true,fixedSeedFlag)},
 		{"full_covariance",8,0,14,0,0,0.,0.,0,N_mdm(type,covarianceControl_FULL_COVARIANCE)},
-		{"h_refinement",8,3,7,0,kw_325,0.,0.,0,N_mdm(type,refinementType_H_REFINEMENT)},
-		{"import_approx_points_file",11,4,17,0,kw_327,0.,0.,0,N_mdm(str,importApproxPtsFile)},
+		{"h_refinement",8,3,7,0,kw_327,0.,0.,0,N_mdm(type,refinementType_H_REFINEMENT)},
+		{"import_approx_points_file",11,5,17,0,kw_329,0.,0.,0,N_mdm(str,importApproxPtsFile)},
 		{"max_refinement_iterations",0x29,0,4,0,0,0.,0.,0,N_mdm(nnint,maxRefineIterations)},
 		{"nested",8,0,12,0,0,0.,0.,0,N_mdm(type,nestingOverride_NESTED)},
 		{"non_nested",8,0,12,0,0,0.,0.,0,N_mdm(type,nestingOverride_NON_NESTED)},
-		{"p_refinement",8,2,7,0,kw_329,0.,0.,0,N_mdm(type,refinementType_P_REFINEMENT)},
+		{"p_refinement",8,2,7,0,kw_331,0.,0.,0,N_mdm(type,refinementType_P_REFINEMENT)},
 		{"piecewise",8,0,8,0,0,0.,0.,0,NIDRProblemDescDB::method_piecewise},
-		{"probability_refinement",8,4,16,0,kw_330},
+		{"probability_refinement",8,4,16,0,kw_332},
 		{"quadrature_order_sequence",13,0,9,1,0,0.,0.,0,N_mdm(usharray,quadratureOrder)},
-		{"sample_refinement",0,4,16,0,kw_330,0.,0.,-2},
-		{"sample_type",8,2,15,0,kw_331},
+		{"sample_refinement",0,4,16,0,kw_332,0.,0.,-2},
+		{"sample_type",8,2,15,0,kw_333},
 		{"samples",1,0,1,0,0,0.,0.,1,N_mdm(int,samplesOnEmulator)},
 		{"samples_on_emulator",9,0,1,0,0,0.,0.,0,N_mdm(int,samplesOnEmulator)},
 		{"seed",0x19,0,2,0,0,0.,0.,0,N_mdm(pint,randomSeed)},
-		{"sparse_grid_level_sequence",13,4,9,1,kw_332,0.,0.,0,N_mdm(usharray,sparseGridLevel)},
+		{"sparse_grid_level_sequence",13,4,9,1,kw_334,0.,0.,0,N_mdm(usharray,sparseGridLevel)},
 		{"use_derivatives",8,0,11,0,0,0.,0.,0,N_mdm(true,methodUseDerivsFlag)},
-		{"variance_based_decomp",8,2,13,0,kw_333,0.,0.,0,N_mdm(true,vbdFlag)},
+		{"variance_based_decomp",8,2,13,0,kw_335,0.,0.,0,N_mdm(true,vbdFlag)},
 		{"wiener",8,0,8,0,0,0.,0.,0,N_mdm(type,expansionType_STD_NORMAL_U)}
 		},
-	kw_335[5] = {
+	kw_337[5] = {
 		{0,0,1,0,0,kw_29},
 		{"convergence_tolerance",10,0,2,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"max_iterations",0x29,0,3,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"misc_options",15,0,1,0,0,0.,0.,0,N_mdm(strL,miscOptions)},
 		{"scaling",8,0,4,0,0,0.,0.,0,N_mdm(true,methodScaling)}
 		},
-	kw_336[6] = {
+	kw_338[6] = {
 		{"contract_threshold",10,0,3,0,0,0.,0.,0,N_mdm(Real,trustRegionContractTrigger)},
 		{"contraction_factor",10,0,5,0,0,0.,0.,0,N_mdm(Real,trustRegionContract)},
 		{"expand_threshold",10,0,4,0,0,0.,0.,0,N_mdm(Real,trustRegionExpandTrigger)},
@@ -2097,14 +2151,14 @@ static KeyWord
 		{"initial_size",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,trustRegionInitSize)},
 		{"minimum_size",10,0,2,0,0,0.,0.,0,N_mdm(Real,trustRegionMinSize)}
 		},
-	kw_337[5] = {
+	kw_339[5] = {
 		{0,0,1,0,0,kw_29},
 		{"max_function_evaluations",0x29,0,3,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
 		{"max_iterations",0x29,0,2,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"scaling",8,0,4,0,0,0.,0.,0,N_mdm(true,methodScaling)},
-		{"trust_region",8,6,1,0,kw_336,0.,0.,0,0,0,NIDRProblemDescDB::method_tr_final}
+		{"trust_region",8,6,1,0,kw_338,0.,0.,0,0,0,NIDRProblemDescDB::method_tr_final}
 		},
-	kw_338[9] = {
+	kw_340[9] = {
 		{"constraint_tolerance",10,0,6,0,0,0.,0.,0,N_mdm(Real,constraintTolerance)},
 		{"convergence_tolerance",10,0,4,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"function_precision",10,0,2,0,0,0.,0.,0,N_mdm(Real,functionPrecision)},
@@ -2115,12 +2169,12 @@ static KeyWord
 		{"speculative",8,0,7,0,0,0.,0.,0,N_mdm(true,speculativeFlag)},
 		{"verify_level",9,0,1,0,0,0.,0.,0,N_mdm(int,verifyLevel)}
 		},
-	kw_339[3] = {
+	kw_341[3] = {
 		{0,0,1,0,0,kw_29},
-		{0,0,9,0,0,kw_338},
+		{0,0,9,0,0,kw_340},
 		{""}
 		},
-	kw_340[7] = {
+	kw_342[7] = {
 		{"convergence_tolerance",10,0,4,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"gradient_tolerance",10,0,2,0,0,0.,0.,0,N_mdm(Real,gradientTolerance)},
 		{"max_function_evaluations",0x29,0,6,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
@@ -2129,12 +2183,12 @@ static KeyWord
 		{"scaling",8,0,7,0,0,0.,0.,0,N_mdm(true,methodScaling)},
 		{"speculative",8,0,5,0,0,0.,0.,0,N_mdm(true,speculativeFlag)}
 		},
-	kw_341[3] = {
+	kw_343[3] = {
 		{0,0,1,0,0,kw_29},
-		{0,0,7,0,0,kw_340},
+		{0,0,7,0,0,kw_342},
 		{""}
 		},
-	kw_342[6] = {
+	kw_344[6] = {
 		{0,0,1,0,0,kw_29},
 		{"convergence_tolerance",10,0,3,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"max_function_evaluations",0x29,0,4,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
@@ -2142,56 +2196,56 @@ static KeyWord
 		{"scaling",8,0,5,0,0,0.,0.,0,N_mdm(true,methodScaling)},
 		{"search_scheme_size",9,0,1,0,0,0.,0.,0,N_mdm(int,searchSchemeSize)}
 		},
-	kw_343[3] = {
+	kw_345[3] = {
 		{"argaez_tapia",8,0,1,1,0,0.,0.,0,N_mdm(type,meritFn_ArgaezTapia)},
 		{"el_bakry",8,0,1,1,0,0.,0.,0,N_mdm(type,meritFn_NormFmu)},
 		{"van_shanno",8,0,1,1,0,0.,0.,0,N_mdm(type,meritFn_VanShanno)}
 		},
-	kw_344[4] = {
+	kw_346[4] = {
 		{"gradient_based_line_search",8,0,1,1,0,0.,0.,0,N_mdm(lit,searchMethod_gradient_based_line_search)},
 		{"tr_pds",8,0,1,1,0,0.,0.,0,N_mdm(lit,searchMethod_tr_pds)},
 		{"trust_region",8,0,1,1,0,0.,0.,0,N_mdm(lit,searchMethod_trust_region)},
 		{"value_based_line_search",8,0,1,1,0,0.,0.,0,N_mdm(lit,searchMethod_value_based_line_search)}
 		},
-	kw_345[6] = {
+	kw_347[6] = {
 		{0,0,1,0,0,kw_29},
-		{0,0,7,0,0,kw_340},
+		{0,0,7,0,0,kw_342},
 		{"centering_parameter",10,0,4,0,0,0.,0.,0,N_mdm(Real,centeringParam)},
-		{"merit_function",8,3,2,0,kw_343},
-		{"search_method",8,4,1,0,kw_344},
+		{"merit_function",8,3,2,0,kw_345},
+		{"search_method",8,4,1,0,kw_346},
 		{"steplength_to_boundary",10,0,3,0,0,0.,0.,0,N_mdm(Real,stepLenToBoundary)}
 		},
-	kw_346[5] = {
+	kw_348[5] = {
 		{"debug",8,0,1,1,0,0.,0.,0,N_mdm(type,methodOutput_DEBUG_OUTPUT)},
 		{"normal",8,0,1,1,0,0.,0.,0,N_mdm(type,methodOutput_NORMAL_OUTPUT)},
 		{"quiet",8,0,1,1,0,0.,0.,0,N_mdm(type,methodOutput_QUIET_OUTPUT)},
 		{"silent",8,0,1,1,0,0.,0.,0,N_mdm(type,methodOutput_SILENT_OUTPUT)},
 		{"verbose",8,0,1,1,0,0.,0.,0,N_mdm(type,methodOutput_VERBOSE_OUTPUT)}
 		},
-	kw_347[2] = {
+	kw_349[2] = {
 		{"model_pointer",11,0,1,0,0,0.,0.,0,N_mdm(str,subModelPointer)},
 		{"opt_model_pointer",3,0,1,0,0,0.,0.,-1,N_mdm(str,subModelPointer)}
 		},
-	kw_348[1] = {
+	kw_350[1] = {
 		{"seed",9,0,1,0,0,0.,0.,0,N_mdm(int,randomSeed)}
 		},
-	kw_349[8] = {
-		{0,0,3,0,0,kw_210},
-		{"method_name",11,2,1,1,kw_347,0.,0.,0,N_mdm(str,subMethodName)},
+	kw_351[8] = {
+		{0,0,4,0,0,kw_210},
+		{"method_name",11,2,1,1,kw_349,0.,0.,0,N_mdm(str,subMethodName)},
 		{"method_pointer",11,0,1,1,0,0.,0.,0,N_mdm(str,subMethodPointer)},
 		{"multi_objective_weight_sets",6,0,3,0,0,0.,0.,4,N_mdm(RealDL,concurrentParameterSets)},
-		{"opt_method_name",3,2,1,1,kw_347,0.,0.,-3,N_mdm(str,subMethodName)},
+		{"opt_method_name",3,2,1,1,kw_349,0.,0.,-3,N_mdm(str,subMethodName)},
 		{"opt_method_pointer",3,0,1,1,0,0.,0.,-3,N_mdm(str,subMethodPointer)},
-		{"random_weight_sets",9,1,2,0,kw_348,0.,0.,0,N_mdm(int,concurrentRandomJobs)},
+		{"random_weight_sets",9,1,2,0,kw_350,0.,0.,0,N_mdm(int,concurrentRandomJobs)},
 		{"weight_sets",14,0,3,0,0,0.,0.,0,N_mdm(RealDL,concurrentParameterSets)}
 		},
-	kw_350[4] = {
+	kw_352[4] = {
 		{0,0,1,0,0,kw_29},
 		{"partitions",13,0,1,0,0,0.,0.,0,N_mdm(usharray,varPartitions)},
 		{"samples",9,0,2,0,0,0.,0.,0,N_mdm(int,numSamples)},
 		{"seed",0x19,0,3,0,0,0.,0.,0,N_mdm(pint,randomSeed)}
 		},
-	kw_351[7] = {
+	kw_353[7] = {
 		{0,0,1,0,0,kw_29},
 		{"converge_order",8,0,1,1,0,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_CONVERGE_ORDER)},
 		{"converge_qoi",8,0,1,1,0,0.,0.,0,N_mdm(utype,subMethod_SUBMETHOD_CONVERGE_QOI)},
@@ -2200,7 +2254,7 @@ static KeyWord
 		{"max_iterations",0x29,0,4,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"refinement_rate",10,0,2,0,0,0.,0.,0,N_mdm(Real,refinementRate)}
 		},
-	kw_352[6] = {
+	kw_354[6] = {
 		{"contract_threshold",10,0,3,0,0,0.,0.,0,N_mdm(Real,trustRegionContractTrigger)},
 		{"contraction_factor",10,0,5,0,0,0.,0.,0,N_mdm(Real,trustRegionContract)},
 		{"expand_threshold",10,0,4,0,0,0.,0.,0,N_mdm(Real,trustRegionExpandTrigger)},
@@ -2208,53 +2262,53 @@ static KeyWord
 		{"initial_size",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,trustRegionInitSize)},
 		{"minimum_size",10,0,2,0,0,0.,0.,0,N_mdm(Real,trustRegionMinSize)}
 		},
-	kw_353[6] = {
+	kw_355[6] = {
 		{0,0,1,0,0,kw_29},
 		{"max_function_evaluations",0x29,0,4,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
 		{"max_iterations",0x29,0,3,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
 		{"scaling",8,0,5,0,0,0.,0.,0,N_mdm(true,methodScaling)},
 		{"seed",0x19,0,1,0,0,0.,0.,0,N_mdm(pint,randomSeed)},
-		{"trust_region",8,6,2,0,kw_352,0.,0.,0,0,0,NIDRProblemDescDB::method_tr_final}
+		{"trust_region",8,6,2,0,kw_354,0.,0.,0,0,0,NIDRProblemDescDB::method_tr_final}
 		},
-	kw_354[2] = {
+	kw_356[2] = {
 		{"num_generations",0x29,0,2,0,0,0.,0.,0,N_mdm(sizet,numGenerations)},
 		{"percent_change",10,0,1,0,0,0.,0.,0,N_mdm(Realz,convergenceTolerance)}
 		},
-	kw_355[2] = {
+	kw_357[2] = {
 		{"num_generations",0x29,0,2,0,0,0.,0.,0,N_mdm(sizet,numGenerations)},
 		{"percent_change",10,0,1,0,0,0.,0.,0,N_mdm(Realz,convergenceTolerance)}
 		},
-	kw_356[2] = {
-		{"average_fitness_tracker",8,2,1,1,kw_354,0.,0.,0,N_mdm(lit,convergenceType_average_fitness_tracker)},
-		{"best_fitness_tracker",8,2,1,1,kw_355,0.,0.,0,N_mdm(lit,convergenceType_best_fitness_tracker)}
+	kw_358[2] = {
+		{"average_fitness_tracker",8,2,1,1,kw_356,0.,0.,0,N_mdm(lit,convergenceType_average_fitness_tracker)},
+		{"best_fitness_tracker",8,2,1,1,kw_357,0.,0.,0,N_mdm(lit,convergenceType_best_fitness_tracker)}
 		},
-	kw_357[2] = {
+	kw_359[2] = {
 		{"constraint_penalty",10,0,2,0,0,0.,0.,0,N_mdm(Realp,constraintTolerance)},
 		{"merit_function",8,0,1,1,0,0.,0.,0,N_mdm(lit,fitnessType_merit_function)}
 		},
-	kw_358[4] = {
+	kw_360[4] = {
 		{"elitist",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_elitist)},
 		{"favor_feasible",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_favor_feasible)},
 		{"roulette_wheel",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_roulette_wheel)},
 		{"unique_roulette_wheel",8,0,1,1,0,0.,0.,0,N_mdm(lit,replacementType_unique_roulette_wheel)}
 		},
-	kw_359[8] = {
+	kw_361[8] = {
 		{0,0,1,0,0,kw_29},
-		{0,0,8,0,0,kw_250},
-		{"convergence_type",8,2,3,0,kw_356},
-		{"fitness_type",8,2,1,0,kw_357},
+		{0,0,9,0,0,kw_251},
+		{"convergence_type",8,2,3,0,kw_358},
+		{"fitness_type",8,2,1,0,kw_359},
 		{"max_function_evaluations",0x29,0,5,0,0,0.,0.,0,N_mdm(nnint,maxFunctionEvaluations)},
 		{"max_iterations",0x29,0,4,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
-		{"replacement_type",8,4,2,0,kw_358},
+		{"replacement_type",8,4,2,0,kw_360},
 		{"scaling",8,0,6,0,0,0.,0.,0,N_mdm(true,methodScaling)}
 		},
-	kw_360[4] = {
+	kw_362[4] = {
 		{0,0,1,0,0,kw_29},
-		{0,0,9,0,0,kw_338},
+		{0,0,9,0,0,kw_340},
 		{"nlssol",8,0,1,1,0,0.,0.,0,N_mdm(utype,methodName_NLSSOL_SQP)},
 		{"npsol",8,0,1,1,0,0.,0.,0,N_mdm(utype,methodName_NPSOL_SQP)}
 		},
-	kw_361[8] = {
+	kw_363[8] = {
 		{"approx_method_name",3,0,1,1,0,0.,0.,4,N_mdm(str,subMethodName)},
 		{"approx_method_pointer",3,0,1,1,0,0.,0.,4,N_mdm(str,subMethodPointer)},
 		{"approx_model_pointer",3,0,2,2,0,0.,0.,4,N_mdm(str,modelPointer)},
@@ -2264,11 +2318,11 @@ static KeyWord
 		{"model_pointer",11,0,2,2,0,0.,0.,0,N_mdm(str,modelPointer)},
 		{"replace_points",8,0,3,0,0,0.,0.,0,N_mdm(true,surrBasedGlobalReplacePts)}
 		},
-	kw_362[2] = {
+	kw_364[2] = {
 		{"filter",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalAcceptLogic_FILTER)},
 		{"tr_ratio",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalAcceptLogic_TR_RATIO)}
 		},
-	kw_363[7] = {
+	kw_365[7] = {
 		{"augmented_lagrangian_objective",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalSubProbObj_AUGMENTED_LAGRANGIAN_OBJECTIVE)},
 		{"lagrangian_objective",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalSubProbObj_LAGRANGIAN_OBJECTIVE)},
 		{"linearized_constraints",8,0,2,2,0,0.,0.,0,N_mdm(type,surrBasedLocalSubProbCon_LINEARIZED_CONSTRAINTS)},
@@ -2277,16 +2331,16 @@ static KeyWord
 		{"original_primary",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalSubProbObj_ORIGINAL_PRIMARY)},
 		{"single_objective",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalSubProbObj_SINGLE_OBJECTIVE)}
 		},
-	kw_364[1] = {
+	kw_366[1] = {
 		{"homotopy",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalConstrRelax_HOMOTOPY)}
 		},
-	kw_365[4] = {
+	kw_367[4] = {
 		{"adaptive_penalty_merit",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalMeritFn_ADAPTIVE_PENALTY_MERIT)},
 		{"augmented_lagrangian_merit",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalMeritFn_AUGMENTED_LAGRANGIAN_MERIT)},
 		{"lagrangian_merit",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalMeritFn_LAGRANGIAN_MERIT)},
 		{"penalty_merit",8,0,1,1,0,0.,0.,0,N_mdm(type,surrBasedLocalMeritFn_PENALTY_MERIT)}
 		},
-	kw_366[6] = {
+	kw_368[6] = {
 		{"contract_threshold",10,0,3,0,0,0.,0.,0,N_mdm(Real,trustRegionContractTrigger)},
 		{"contraction_factor",10,0,5,0,0,0.,0.,0,N_mdm(Real,trustRegionContract)},
 		{"expand_threshold",10,0,4,0,0,0.,0.,0,N_mdm(Real,trustRegionExpandTrigger)},
@@ -2294,31 +2348,31 @@ static KeyWord
 		{"initial_size",14,0,1,0,0,0.,0.,0,N_mdm(RealDL,trustRegionInitSize)},
 		{"minimum_size",10,0,2,0,0,0.,0.,0,N_mdm(Real,trustRegionMinSize)}
 		},
-	kw_367[16] = {
-		{"acceptance_logic",8,2,7,0,kw_362},
+	kw_369[16] = {
+		{"acceptance_logic",8,2,7,0,kw_364},
 		{"approx_method_name",3,0,1,1,0,0.,0.,9,N_mdm(str,subMethodName)},
 		{"approx_method_pointer",3,0,1,1,0,0.,0.,9,N_mdm(str,subMethodPointer)},
 		{"approx_model_pointer",3,0,2,2,0,0.,0.,9,N_mdm(str,modelPointer)},
-		{"approx_subproblem",8,7,5,0,kw_363},
-		{"constraint_relax",8,1,8,0,kw_364},
+		{"approx_subproblem",8,7,5,0,kw_365},
+		{"constraint_relax",8,1,8,0,kw_366},
 		{"constraint_tolerance",10,0,12,0,0,0.,0.,0,N_mdm(Real,constraintTolerance)},
 		{"convergence_tolerance",10,0,11,0,0,0.,0.,0,N_mdm(Real,convergenceTolerance)},
 		{"max_iterations",0x29,0,10,0,0,0.,0.,0,N_mdm(nnint,maxIterations)},
-		{"merit_function",8,4,6,0,kw_365},
+		{"merit_function",8,4,6,0,kw_367},
 		{"method_name",11,0,1,1,0,0.,0.,0,N_mdm(str,subMethodName)},
 		{"method_pointer",11,0,1,1,0,0.,0.,0,N_mdm(str,subMethodPointer)},
 		{"model_pointer",11,0,2,2,0,0.,0.,0,N_mdm(str,modelPointer)},
 		{"soft_convergence_limit",9,0,3,0,0,0.,0.,0,N_mdm(ushint,softConvLimit)},
-		{"trust_region",8,6,9,0,kw_366,0.,0.,0,0,0,NIDRProblemDescDB::method_tr_final},
+		{"trust_region",8,6,9,0,kw_368,0.,0.,0,0,0,NIDRProblemDescDB::method_tr_final},
 		{"truth_surrogate_bypass",8,0,4,0,0,0.,0.,0,N_mdm(true,surrBasedLocalLayerBypass)}
 		},
-	kw_368[4] = {
+	kw_370[4] = {
 		{0,0,1,0,0,kw_29},
 		{"final_point",14,0,1,1,0,0.,0.,0,N_mdm(RealDL,finalPoint)},
 		{"num_steps",9,0,2,2,0,0.,0.,0,N_mdm(int,numSteps)},
 		{"step_vector",14,0,1,1,0,0.,0.,0,N_mdm(RealDL,stepVector)}
 		},
-	kw_369[89] = {
+	kw_371[89] = {
 		{"adaptive_sampling",8,14,4,1,kw_44,0.,0.,0,N_mdm(utype,methodName_ADAPTIVE_SAMPLING)},
 		{"asynch_pattern_search",8,12,4,1,kw_47,0.,0.,0,N_mdm(utype,methodName_ASYNCH_PATTERN_SEARCH)},
 		{"bayes_calibration",8,13,4,1,kw_129,0.,0.,0,N_mdm(utype,methodName_BAYES_CALIBRATION)},
@@ -2361,15 +2415,15 @@ static KeyWord
 		{"local_interval_est",8,3,4,1,kw_233,0.,0.,0,N_mdm(utype,methodName_LOCAL_INTERVAL_EST)},
 		{"local_reliability",8,6,4,1,kw_242,0.,0.,0,N_mdm(utype,methodName_LOCAL_RELIABILITY)},
 		{"mesh_adaptive_search",8,13,4,1,kw_244,0.,0.,0,N_mdm(utype,methodName_MESH_ADAPTIVE_SEARCH)},
-		{"moga",8,8,4,1,kw_258,0.,0.,0,N_mdm(utype,methodName_MOGA)},
-		{"multi_start",8,4,4,1,kw_261,0.,0.,0,N_mdm(utype,methodName_MULTI_START)},
-		{"multidim_parameter_study",8,1,4,1,kw_262,0.,0.,0,N_mdm(utype,methodName_MULTIDIM_PARAMETER_STUDY)},
-		{"multilevel_mc",0,8,4,1,kw_267,0.,0.,1,N_mdm(utype,methodName_MULTILEVEL_SAMPLING)},
-		{"multilevel_sampling",8,8,4,1,kw_267,0.,0.,0,N_mdm(utype,methodName_MULTILEVEL_SAMPLING)},
-		{"ncsu_direct",8,8,4,1,kw_268,0.,0.,0,N_mdm(utype,methodName_NCSU_DIRECT)},
-		{"nl2sol",8,14,4,1,kw_269,0.,0.,0,N_mdm(utype,methodName_NL2SOL)},
-		{"nlpql_sqp",8,4,4,1,kw_270,0.,0.,0,N_mdm(utype,methodName_NLPQL_SQP)},
-		{"nlssol_sqp",8,0,4,1,kw_339,0.,0.,0,N_mdm(utype,methodName_NLSSOL_SQP)},
+		{"moga",8,8,4,1,kw_259,0.,0.,0,N_mdm(utype,methodName_MOGA)},
+		{"multi_start",8,5,4,1,kw_263,0.,0.,0,N_mdm(utype,methodName_MULTI_START)},
+		{"multidim_parameter_study",8,1,4,1,kw_264,0.,0.,0,N_mdm(utype,methodName_MULTIDIM_PARAMETER_STUDY)},
+		{"multilevel_mc",0,8,4,1,kw_269,0.,0.,1,N_mdm(utype,methodName_MULTILEVEL_SAMPLING)},
+		{"multilevel_sampling",8,8,4,1,kw_269,0.,0.,0,N_mdm(utype,methodName_MULTILEVEL_SAMPLING)},
+		{"ncsu_direct",8,8,4,1,kw_270,0.,0.,0,N_mdm(utype,methodName_NCSU_DIRECT)},
+		{"nl2sol",8,14,4,1,kw_271,0.,0.,0,N_mdm(utype,methodName_NL2SOL)},
+		{"nlpql_sqp",8,4,4,1,kw_272,0.,0.,0,N_mdm(utype,methodName_NLPQL_SQP)},
+		{"nlssol_sqp",8,0,4,1,kw_341,0.,0.,0,N_mdm(utype,methodName_NLSSOL_SQP)},
 		{"nond_adaptive_sampling",0,14,4,1,kw_44,0.,0.,-51,N_mdm(utype,methodName_ADAPTIVE_SAMPLING)},
 		{"nond_bayes_calibration",0,13,4,1,kw_129,0.,0.,-50,N_mdm(utype,methodName_BAYES_CALIBRATION)},
 		{"nond_global_evidence",0,7,4,1,kw_187,0.,0.,-23,N_mdm(utype,methodName_GLOBAL_EVIDENCE)},
@@ -2379,49 +2433,49 @@ static KeyWord
 		{"nond_local_evidence",0,6,4,1,kw_232,0.,0.,-19,N_mdm(utype,methodName_LOCAL_EVIDENCE)},
 		{"nond_local_interval_est",0,3,4,1,kw_233,0.,0.,-19,N_mdm(utype,methodName_LOCAL_INTERVAL_EST)},
 		{"nond_local_reliability",0,6,4,1,kw_242,0.,0.,-19,N_mdm(utype,methodName_LOCAL_RELIABILITY)},
-		{"nond_pof_darts",0,6,4,1,kw_275,0.,0.,16,N_mdm(utype,methodName_POF_DARTS)},
-		{"nond_polynomial_chaos",0,29,4,1,kw_308,0.,0.,16,N_mdm(utype,methodName_POLYNOMIAL_CHAOS)},
-		{"nond_rkd_darts",0,6,4,1,kw_313,0.,0.,18,N_mdm(utype,methodName_RKD_DARTS)},
-		{"nond_sampling",0,12,4,1,kw_320,0.,0.,18,N_mdm(utype,methodName_RANDOM_SAMPLING)},
-		{"nond_stoch_collocation",0,27,4,1,kw_334,0.,0.,21,N_mdm(utype,methodName_STOCH_COLLOCATION)},
-		{"nonlinear_cg",8,4,4,1,kw_335,0.,0.,0,N_mdm(utype,methodName_NONLINEAR_CG)},
-		{"nowpac",8,4,4,1,kw_337,0.,0.,0,N_mdm(utype,methodName_MIT_NOWPAC)},
-		{"npsol_sqp",8,0,4,1,kw_339,0.,0.,0,N_mdm(utype,methodName_NPSOL_SQP)},
-		{"optpp_cg",8,0,4,1,kw_341,0.,0.,0,N_mdm(utype,methodName_OPTPP_CG)},
-		{"optpp_fd_newton",8,4,4,1,kw_345,0.,0.,0,N_mdm(utype,methodName_OPTPP_FD_NEWTON)},
-		{"optpp_g_newton",8,4,4,1,kw_345,0.,0.,0,N_mdm(utype,methodName_OPTPP_G_NEWTON)},
-		{"optpp_newton",8,4,4,1,kw_345,0.,0.,0,N_mdm(utype,methodName_OPTPP_NEWTON)},
-		{"optpp_pds",8,5,4,1,kw_342,0.,0.,0,N_mdm(utype,methodName_OPTPP_PDS)},
-		{"optpp_q_newton",8,4,4,1,kw_345,0.,0.,0,N_mdm(utype,methodName_OPTPP_Q_NEWTON)},
-		{"output",8,5,2,0,kw_346},
-		{"pareto_set",8,7,4,1,kw_349,0.,0.,0,N_mdm(utype,methodName_PARETO_SET)},
-		{"pof_darts",8,6,4,1,kw_275,0.,0.,0,N_mdm(utype,methodName_POF_DARTS)},
-		{"polynomial_chaos",8,29,4,1,kw_308,0.,0.,0,N_mdm(utype,methodName_POLYNOMIAL_CHAOS)},
-		{"psuade_moat",8,3,4,1,kw_350,0.,0.,0,N_mdm(utype,methodName_PSUADE_MOAT)},
-		{"richardson_extrap",8,6,4,1,kw_351,0.,0.,0,N_mdm(utype,methodName_RICHARDSON_EXTRAP)},
-		{"rkd_darts",8,6,4,1,kw_313,0.,0.,0,N_mdm(utype,methodName_RKD_DARTS)},
-		{"sampling",8,12,4,1,kw_320,0.,0.,0,N_mdm(utype,methodName_RANDOM_SAMPLING)},
-		{"snowpac",8,5,4,1,kw_353,0.,0.,0,N_mdm(utype,methodName_MIT_SNOWPAC)},
-		{"soga",8,6,4,1,kw_359,0.,0.,0,N_mdm(utype,methodName_SOGA)},
-		{"stanford",8,2,4,1,kw_360},
-		{"stoch_collocation",8,27,4,1,kw_334,0.,0.,0,N_mdm(utype,methodName_STOCH_COLLOCATION)},
-		{"surrogate_based_global",8,8,4,1,kw_361,0.,0.,0,N_mdm(utype,methodName_SURROGATE_BASED_GLOBAL)},
-		{"surrogate_based_local",8,16,4,1,kw_367,0.,0.,0,N_mdm(utype,methodName_SURROGATE_BASED_LOCAL)},
-		{"vector_parameter_study",8,3,4,1,kw_368,0.,0.,0,N_mdm(utype,methodName_VECTOR_PARAMETER_STUDY)}
-		},
-	kw_370[1] = {
+		{"nond_pof_darts",0,6,4,1,kw_277,0.,0.,16,N_mdm(utype,methodName_POF_DARTS)},
+		{"nond_polynomial_chaos",0,29,4,1,kw_310,0.,0.,16,N_mdm(utype,methodName_POLYNOMIAL_CHAOS)},
+		{"nond_rkd_darts",0,6,4,1,kw_315,0.,0.,18,N_mdm(utype,methodName_RKD_DARTS)},
+		{"nond_sampling",0,12,4,1,kw_322,0.,0.,18,N_mdm(utype,methodName_RANDOM_SAMPLING)},
+		{"nond_stoch_collocation",0,27,4,1,kw_336,0.,0.,21,N_mdm(utype,methodName_STOCH_COLLOCATION)},
+		{"nonlinear_cg",8,4,4,1,kw_337,0.,0.,0,N_mdm(utype,methodName_NONLINEAR_CG)},
+		{"nowpac",8,4,4,1,kw_339,0.,0.,0,N_mdm(utype,methodName_MIT_NOWPAC)},
+		{"npsol_sqp",8,0,4,1,kw_341,0.,0.,0,N_mdm(utype,methodName_NPSOL_SQP)},
+		{"optpp_cg",8,0,4,1,kw_343,0.,0.,0,N_mdm(utype,methodName_OPTPP_CG)},
+		{"optpp_fd_newton",8,4,4,1,kw_347,0.,0.,0,N_mdm(utype,methodName_OPTPP_FD_NEWTON)},
+		{"optpp_g_newton",8,4,4,1,kw_347,0.,0.,0,N_mdm(utype,methodName_OPTPP_G_NEWTON)},
+		{"optpp_newton",8,4,4,1,kw_347,0.,0.,0,N_mdm(utype,methodName_OPTPP_NEWTON)},
+		{"optpp_pds",8,5,4,1,kw_344,0.,0.,0,N_mdm(utype,methodName_OPTPP_PDS)},
+		{"optpp_q_newton",8,4,4,1,kw_347,0.,0.,0,N_mdm(utype,methodName_OPTPP_Q_NEWTON)},
+		{"output",8,5,2,0,kw_348},
+		{"pareto_set",8,7,4,1,kw_351,0.,0.,0,N_mdm(utype,methodName_PARETO_SET)},
+		{"pof_darts",8,6,4,1,kw_277,0.,0.,0,N_mdm(utype,methodName_POF_DARTS)},
+		{"polynomial_chaos",8,29,4,1,kw_310,0.,0.,0,N_mdm(utype,methodName_POLYNOMIAL_CHAOS)},
+		{"psuade_moat",8,3,4,1,kw_352,0.,0.,0,N_mdm(utype,methodName_PSUADE_MOAT)},
+		{"richardson_extrap",8,6,4,1,kw_353,0.,0.,0,N_mdm(utype,methodName_RICHARDSON_EXTRAP)},
+		{"rkd_darts",8,6,4,1,kw_315,0.,0.,0,N_mdm(utype,methodName_RKD_DARTS)},
+		{"sampling",8,12,4,1,kw_322,0.,0.,0,N_mdm(utype,methodName_RANDOM_SAMPLING)},
+		{"snowpac",8,5,4,1,kw_355,0.,0.,0,N_mdm(utype,methodName_MIT_SNOWPAC)},
+		{"soga",8,6,4,1,kw_361,0.,0.,0,N_mdm(utype,methodName_SOGA)},
+		{"stanford",8,2,4,1,kw_362},
+		{"stoch_collocation",8,27,4,1,kw_336,0.,0.,0,N_mdm(utype,methodName_STOCH_COLLOCATION)},
+		{"surrogate_based_global",8,8,4,1,kw_363,0.,0.,0,N_mdm(utype,methodName_SURROGATE_BASED_GLOBAL)},
+		{"surrogate_based_local",8,16,4,1,kw_369,0.,0.,0,N_mdm(utype,methodName_SURROGATE_BASED_LOCAL)},
+		{"vector_parameter_study",8,3,4,1,kw_370,0.,0.,0,N_mdm(utype,methodName_VECTOR_PARAMETER_STUDY)}
+		},
+	kw_372[1] = {
 		{"refinement_samples",13,0,1,0,0,0.,0.,0,N_mom(ivec,refineSamples)}
 		},
-	kw_371[3] = {
+	kw_373[3] = {
 		{"local_gradient",8,0,1,1,0,0.,0.,0,N_mom(utype,subspaceNormalization_SUBSPACE_NORM_LOCAL_GRAD)},
 		{"mean_gradient",8,0,1,1,0,0.,0.,0,N_mom(utype,subspaceNormalization_SUBSPACE_NORM_MEAN_GRAD)},
 		{"mean_value",8,0,1,1,0,0.,0.,0,N_mom(utype,subspaceNormalization_SUBSPACE_NORM_MEAN_VALUE)}
 		},
-	kw_372[2] = {
+	kw_374[2] = {
 		{"lhs",8,0,1,1,0,0.,0.,0,N_mom(utype,subspaceSampleType_SUBMETHOD_LHS)},
 		{"random",8,0,1,1,0,0.,0.,0,N_mom(utype,subspaceSampleType_SUBMETHOD_RANDOM)}
 		},
-	kw_373[7] = {
+	kw_375[7] = {
 		{"decrease",8,0,1,0,0,0.,0.,0,N_mom(utype,subspaceIdCVMethod_DECREASE_TOLERANCE)},
 		{"decrease_tolerance",10,0,3,0,0,0.,0.,0,N_mom(Real,decreaseTolerance)},
 		{"exhaustive",8,0,5,0,0,0.,0.,0,N_mom(false,subspaceCVIncremental)},
@@ -2430,92 +2484,95 @@ static KeyWord
 		{"relative",8,0,1,0,0,0.,0.,0,N_mom(utype,subspaceIdCVMethod_RELATIVE_TOLERANCE)},
 		{"relative_tolerance",10,0,2,0,0,0.,0.,0,N_mom(Real,relTolerance)}
 		},
-	kw_374[1] = {
+	kw_376[1] = {
 		{"truncation_tolerance",10,0,1,0,0,0.,0.,0,N_mom(Real,truncationTolerance)}
 		},
-	kw_375[4] = {
+	kw_377[4] = {
 		{"bing_li",8,0,1,0,0,0.,0.,0,N_mom(true,subspaceIdBingLi)},
 		{"constantine",8,0,2,0,0,0.,0.,0,N_mom(true,subspaceIdConstantine)},
-		{"cross_validation",8,7,4,0,kw_373,0.,0.,0,N_mom(true,subspaceIdCV)},
-		{"energy",8,1,3,0,kw_374,0.,0.,0,N_mom(true,subspaceIdEnergy)}
+		{"cross_validation",8,7,4,0,kw_375,0.,0.,0,N_mom(true,subspaceIdCV)},
+		{"energy",8,1,3,0,kw_376,0.,0.,0,N_mom(true,subspaceIdEnergy)}
 		},
-	kw_376[8] = {
+	kw_378[8] = {
 		{"actual_model_pointer",11,0,1,1,0,0.,0.,0,N_mom(str,actualModelPointer)},
 		{"bootstrap_samples",9,0,6,0,0,0.,0.,0,N_mom(int,numReplicates)},
-		{"build_surrogate",8,1,7,0,kw_370,0.,0.,0,N_mom(true,subspaceBuildSurrogate)},
+		{"build_surrogate",8,1,7,0,kw_372,0.,0.,0,N_mom(true,subspaceBuildSurrogate)},
 		{"dimension",9,0,5,0,0,0.,0.,0,N_mom(int,subspaceDimension)},
 		{"initial_samples",9,0,2,0,0,0.,0.,0,N_mom(int,initialSamples)},
-		{"normalization",8,3,8,0,kw_371},
-		{"sample_type",8,2,3,0,kw_372},
-		{"truncation_method",8,4,4,0,kw_375}
+		{"normalization",8,3,8,0,kw_373},
+		{"sample_type",8,2,3,0,kw_374},
+		{"truncation_method",8,4,4,0,kw_377}
 		},
-	kw_377[1] = {
+	kw_379[1] = {
 		{"collocation_ratio",10,0,1,1,0,0.,0.,0,N_mom(Real,adaptedBasisCollocRatio)}
 		},
-	kw_378[3] = {
+	kw_380[3] = {
 		{"actual_model_pointer",11,0,1,1,0,0.,0.,0,N_mom(str,actualModelPointer)},
-		{"expansion_order",9,1,2,2,kw_377,0.,0.,0,N_mom(int,adaptedBasisExpOrder)},
+		{"expansion_order",9,1,2,2,kw_379,0.,0.,0,N_mom(int,adaptedBasisExpOrder)},
 		{"sparse_grid_level",9,0,2,2,0,0.,0.,0,N_mom(int,adaptedBasisSparseGridLev)}
 		},
-	kw_379[1] = {
+	kw_381[1] = {
 		{"optional_interface_responses_pointer",11,0,1,0,0,0.,0.,0,N_mom(str,optionalInterfRespPointer)}
 		},
-	kw_380[2] = {
+	kw_382[2] = {
 		{"master",8,0,1,1,0,0.,0.,0,N_mom(type,subMethodScheduling_MASTER_SCHEDULING)},
 		{"peer",8,0,1,1,0,0.,0.,0,N_mom(type,subMethodScheduling_PEER_SCHEDULING)}
 		},
-	kw_381[7] = {
-		{"iterator_scheduling",8,2,2,0,kw_380},
+	kw_383[9] = {
+		{"iterator_scheduling",8,2,2,0,kw_382},
 		{"iterator_servers",0x19,0,1,0,0,0.,0.,0,N_mom(pint,subMethodServers)},
-		{"primary_response_mapping",14,0,6,0,0,0.,0.,0,N_mom(RealDL,primaryRespCoeffs)},
-		{"primary_variable_mapping",15,0,4,0,0,0.,0.,0,N_mom(strL,primaryVarMaps)},
+		{"local_iterator_servers",0x19,0,4,0,0,0.,0.,0,N_mom(pint,subMethodLocalServers)},
+		{"memoize_results",8,0,5,0,0,0.,0.,0,N_mom(true,subMethodMemoize)},
+		{"primary_response_mapping",14,0,8,0,0,0.,0.,0,N_mom(RealDL,primaryRespCoeffs)},
+		{"primary_variable_mapping",15,0,6,0,0,0.,0.,0,N_mom(strL,primaryVarMaps)},
 		{"processors_per_iterator",0x19,0,3,0,0,0.,0.,0,N_mom(pint,subMethodProcs)},
-		{"secondary_response_mapping",14,0,7,0,0,0.,0.,0,N_mom(RealDL,secondaryRespCoeffs)},
-		{"secondary_variable_mapping",15,0,5,0,0,0.,0.,0,N_mom(strL,secondaryVarMaps)}
+		{"secondary_response_mapping",14,0,9,0,0,0.,0.,0,N_mom(RealDL,secondaryRespCoeffs)},
+		{"secondary_variable_mapping",15,0,7,0,0,0.,0.,0,N_mom(strL,secondaryVarMaps)}
 		},
-	kw_382[2] = {
-		{"optional_interface_pointer",11,1,1,0,kw_379,0.,0.,0,N_mom(str,interfacePointer)},
-		{"sub_method_pointer",11,7,2,1,kw_381,0.,0.,0,N_mom(str,subMethodPointer)}
+	kw_384[2] = {
+		{"optional_interface_pointer",11,1,1,0,kw_381,0.,0.,0,N_mom(str,interfacePointer)},
+		{"sub_method_pointer",11,9,2,1,kw_383,0.,0.,0,N_mom(str,subMethodPointer)}
 		},
-	kw_383[2] = {
+	kw_385[2] = {
 		{"exponential",8,0,1,1,0,0.,0.,0,N_mom(utype,analyticCovIdForm_EXP_L1)},
 		{"squared_exponential",8,0,1,1,0,0.,0.,0,N_mom(utype,analyticCovIdForm_EXP_L2)}
 		},
-	kw_384[3] = {
-		{"analytic_covariance",8,2,1,1,kw_383},
+	kw_386[3] = {
+		{"analytic_covariance",8,2,1,1,kw_385},
 		{"dace_method_pointer",11,0,1,1,0,0.,0.,0,N_mom(str,subMethodPointer)},
 		{"rf_data_file",11,0,1,1,0,0.,0.,0,N_mom(str,rfDataFileName)}
 		},
-	kw_385[2] = {
+	kw_387[2] = {
 		{"karhunen_loeve",8,0,1,1,0,0.,0.,0,N_mom(utype,randomFieldIdForm_RF_KARHUNEN_LOEVE)},
 		{"principal_components",8,0,1,1,0,0.,0.,0,N_mom(utype,randomFieldIdForm_RF_PCA_GP)}
 		},
-	kw_386[5] = {
-		{"build_source",8,3,1,0,kw_384},
+	kw_388[5] = {
+		{"build_source",8,3,1,0,kw_386},
 		{"expansion_bases",9,0,3,0,0,0.,0.,0,N_mom(int,subspaceDimension)},
-		{"expansion_form",8,2,2,0,kw_385},
+		{"expansion_form",8,2,2,0,kw_387},
 		{"propagation_model_pointer",11,0,5,1,0,0.,0.,0,N_mom(str,propagationModelPointer)},
 		{"truncation_tolerance",10,0,4,0,0,0.,0.,0,N_mom(Real,truncationTolerance)}
 		},
-	kw_387[1] = {
+	kw_389[1] = {
 		{"solution_level_cost",14,0,1,1,0,0.,0.,0,N_mom(RealDL,solutionLevelCost)}
 		},
-	kw_388[2] = {
+	kw_390[2] = {
 		{"interface_pointer",11,0,1,0,0,0.,0.,0,N_mom(str,interfacePointer)},
-		{"solution_level_control",11,1,2,0,kw_387,0.,0.,0,N_mom(str,solutionLevelControl)}
+		{"solution_level_control",11,1,2,0,kw_389,0.,0.,0,N_mom(str,solutionLevelControl)}
 		},
-	kw_389[3] = {
+	kw_391[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,importChallengeFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,importChallengeFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,importChallengeFormat_TABULAR_IFACE_ID)}
 		},
-	kw_390[4] = {
+	kw_392[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mom(true,importChallengeActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mom(utype,importChallengeFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_389,0.,0.,0,N_mom(utype,importChallengeFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mom(utype,importChallengeFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_391,0.,0.,0,N_mom(utype,importChallengeFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mom(utype,importChallengeFormat_TABULAR_NONE)}
 		},
-	kw_391[6] = {
+	kw_393[6] = {
 		{"additive",8,0,2,2,0,0.,0.,0,N_mom(type,approxCorrectionType_ADDITIVE_CORRECTION)},
 		{"combined",8,0,2,2,0,0.,0.,0,N_mom(type,approxCorrectionType_COMBINED_CORRECTION)},
 		{"first_order",8,0,1,1,0,0.,0.,0,N_mom(order,approxCorrectionOrder_1)},
@@ -2523,211 +2580,225 @@ static KeyWord
 		{"second_order",8,0,1,1,0,0.,0.,0,N_mom(order,approxCorrectionOrder_2)},
 		{"zeroth_order",8,0,1,1,0,0.,0.,0,N_mom(order,approxCorrectionOrder_0)}
 		},
-	kw_392[1] = {
+	kw_394[1] = {
 		{"folds",0x19,0,1,0,0,0.,0.,0,N_mom(int,refineCVFolds)}
 		},
-	kw_393[5] = {
+	kw_395[5] = {
 		{"convergence_tolerance",10,0,3,0,0,0.,0.,0,N_mom(Real,convergenceTolerance)},
-		{"cross_validation_metric",11,1,5,0,kw_392,0.,0.,0,N_mom(str,refineCVMetric)},
+		{"cross_validation_metric",11,1,5,0,kw_394,0.,0.,0,N_mom(str,refineCVMetric)},
 		{"max_function_evaluations",0x19,0,2,0,0,0.,0.,0,N_mom(int,maxFunctionEvals)},
 		{"max_iterations",0x19,0,1,0,0,0.,0.,0,N_mom(int,maxIterations)},
 		{"soft_convergence_limit",0x29,0,4,0,0,0.,0.,0,N_mom(int,softConvergenceLimit)}
 		},
-	kw_394[1] = {
-		{"auto_refinement",8,5,1,0,kw_393,0.,0.,0,N_mom(true,autoRefine)}
+	kw_396[1] = {
+		{"auto_refinement",8,5,1,0,kw_395,0.,0.,0,N_mom(true,autoRefine)}
 		},
-	kw_395[2] = {
+	kw_397[2] = {
 		{"folds",9,0,1,0,0,0.,0.,0,N_mom(int,numFolds)},
 		{"percent",10,0,1,0,0,0.,0.,0,N_mom(Real,percentFold)}
 		},
-	kw_396[2] = {
-		{"cross_validation",8,2,1,0,kw_395,0.,0.,0,N_mom(true,crossValidateFlag)},
+	kw_398[2] = {
+		{"cross_validation",8,2,1,0,kw_397,0.,0.,0,N_mom(true,crossValidateFlag)},
 		{"press",8,0,2,0,0,0.,0.,0,N_mom(true,pressFlag)}
 		},
-	kw_397[2] = {
+	kw_399[2] = {
 		{"gradient_threshold",10,0,1,1,0,0.,0.,0,N_mom(Real,discontGradThresh)},
 		{"jump_threshold",10,0,1,1,0,0.,0.,0,N_mom(Real,discontJumpThresh)}
 		},
-	kw_398[3] = {
+	kw_400[3] = {
 		{"cell_type",11,0,1,0,0,0.,0.,0,N_mom(str,decompCellType)},
-		{"discontinuity_detection",8,2,3,0,kw_397,0.,0.,0,N_mom(true,decompDiscontDetect)},
+		{"discontinuity_detection",8,2,3,0,kw_399,0.,0.,0,N_mom(true,decompDiscontDetect)},
 		{"support_layers",9,0,2,0,0,0.,0.,0,N_mom(int,decompSupportLayers)}
 		},
-	kw_399[3] = {
+	kw_401[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,exportApproxFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,exportApproxFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,exportApproxFormat_TABULAR_IFACE_ID)}
 		},
-	kw_400[3] = {
+	kw_402[4] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mom(utype,exportApproxFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_399,0.,0.,0,N_mom(utype,exportApproxFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mom(utype,exportApproxFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_401,0.,0.,0,N_mom(utype,exportApproxFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mom(utype,exportApproxFormat_TABULAR_NONE)}
 		},
-	kw_401[3] = {
+	kw_403[3] = {
 		{"constant",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_constant)},
 		{"linear",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_linear)},
 		{"reduced_quadratic",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_reduced_quadratic)}
 		},
-	kw_402[2] = {
+	kw_404[2] = {
 		{"point_selection",8,0,1,0,0,0.,0.,0,N_mom(true,pointSelection)},
-		{"trend",8,3,2,0,kw_401}
+		{"trend",8,3,2,0,kw_403}
 		},
-	kw_403[4] = {
+	kw_405[4] = {
 		{"algebraic_console",8,0,4,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_CONSOLE)},
 		{"algebraic_file",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_FILE)},
 		{"binary_archive",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_BINARY_ARCHIVE)},
 		{"text_archive",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_TEXT_ARCHIVE)}
 		},
-	kw_404[2] = {
+	kw_406[2] = {
 		{"filename_prefix",11,0,1,0,0,0.,0.,0,N_mom(str,modelExportPrefix)},
-		{"formats",8,4,2,1,kw_403}
+		{"formats",8,4,2,1,kw_405}
 		},
-	kw_405[4] = {
+	kw_407[4] = {
 		{"constant",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_constant)},
 		{"linear",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_linear)},
 		{"quadratic",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_quadratic)},
 		{"reduced_quadratic",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_reduced_quadratic)}
 		},
-	kw_406[7] = {
+	kw_408[7] = {
 		{"correlation_lengths",14,0,5,0,0,0.,0.,0,N_mom(RealDL,krigingCorrelations)},
-		{"export_model",8,2,6,0,kw_404,0.,0.,0,N_mom(true,exportSurrogate)},
+		{"export_model",8,2,6,0,kw_406,0.,0.,0,N_mom(true,exportSurrogate)},
 		{"find_nugget",9,0,4,0,0,0.,0.,0,N_mom(shint,krigingFindNugget)},
 		{"max_trials",0x19,0,3,0,0,0.,0.,0,N_mom(shint,krigingMaxTrials)},
 		{"nugget",0x1a,0,4,0,0,0.,0.,0,N_mom(Real,krigingNugget)},
 		{"optimization_method",11,0,2,0,0,0.,0.,0,N_mom(str,krigingOptMethod)},
-		{"trend",8,4,1,0,kw_405}
+		{"trend",8,4,1,0,kw_407}
 		},
-	kw_407[2] = {
-		{"dakota",8,2,1,1,kw_402,0.,0.,0,N_mom(lit,surrogateType_global_gaussian)},
-		{"surfpack",8,7,1,1,kw_406,0.,0.,0,N_mom(lit,surrogateType_global_kriging)}
+	kw_409[2] = {
+		{"dakota",8,2,1,1,kw_404,0.,0.,0,N_mom(lit,surrogateType_global_gaussian)},
+		{"surfpack",8,7,1,1,kw_408,0.,0.,0,N_mom(lit,surrogateType_global_kriging)}
 		},
-	kw_408[3] = {
+	kw_410[3] = {
 		{"eval_id",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,importBuildFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,importBuildFormat_TABULAR_HEADER)},
 		{"interface_id",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,importBuildFormat_TABULAR_IFACE_ID)}
 		},
-	kw_409[4] = {
+	kw_411[5] = {
 		{"active_only",8,0,2,0,0,0.,0.,0,N_mom(true,importBuildActive)},
 		{"annotated",8,0,1,0,0,0.,0.,0,N_mom(utype,importBuildFormat_TABULAR_ANNOTATED)},
-		{"custom_annotated",8,3,1,0,kw_408,0.,0.,0,N_mom(utype,importBuildFormat_TABULAR_NONE)},
+		{"binary",8,0,1,0,0,0.,0.,0,N_mom(utype,importBuildFormat_TABULAR_BINARY)},
+		{"custom_annotated",8,3,1,0,kw_410,0.,0.,0,N_mom(utype,importBuildFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_mom(utype,importBuildFormat_TABULAR_NONE)}
 		},
-	kw_410[2] = {
+	kw_412[2] = {
 		{"binary_archive",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_BINARY_ARCHIVE)},
 		{"text_archive",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_TEXT_ARCHIVE)}
 		},
-	kw_411[2] = {
+	kw_413[2] = {
 		{"filename_prefix",11,0,1,0,0,0.,0.,0,N_mom(str,modelExportPrefix)},
-		{"formats",8,2,2,1,kw_410}
+		{"formats",8,2,2,1,kw_412}
 		},
-	kw_412[2] = {
+	kw_414[2] = {
 		{"cubic",8,0,1,1,0,0.,0.,0,N_mom(lit,marsInterpolation_cubic)},
 		{"linear",8,0,1,1,0,0.,0.,0,N_mom(lit,marsInterpolation_linear)}
 		},
-	kw_413[3] = {
-		{"export_model",8,2,3,0,kw_411,0.,0.,0,N_mom(true,exportSurrogate)},
-		{"interpolation",8,2,2,0,kw_412},
+	kw_415[3] = {
+		{"export_model",8,2,3,0,kw_413,0.,0.,0,N_mom(true,exportSurrogate)},
+		{"interpolation",8,2,2,0,kw_414},
 		{"max_bases",9,0,1,0,0,0.,0.,0,N_mom(shint,marsMaxBases)}
 		},
-	kw_414[2] = {
+	kw_416[2] = {
 		{"binary_archive",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_BINARY_ARCHIVE)},
 		{"text_archive",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_TEXT_ARCHIVE)}
 		},
-	kw_415[2] = {
+	kw_417[2] = {
 		{"filename_prefix",11,0,1,0,0,0.,0.,0,N_mom(str,modelExportPrefix)},
-		{"formats",8,2,2,1,kw_414}
+		{"formats",8,2,2,1,kw_416}
 		},
-	kw_416[4] = {
+	kw_418[4] = {
 		{"basis_order",0x29,0,1,0,0,0.,0.,0,N_mom(shint,polynomialOrder)},
-		{"export_model",8,2,3,0,kw_415,0.,0.,0,N_mom(true,exportSurrogate)},
+		{"export_model",8,2,3,0,kw_417,0.,0.,0,N_mom(true,exportSurrogate)},
 		{"poly_order",0x21,0,1,0,0,0.,0.,-2,N_mom(shint,polynomialOrder)},
 		{"weight_function",9,0,2,0,0,0.,0.,0,N_mom(shint,mlsWeightFunction)}
 		},
-	kw_417[4] = {
+	kw_419[4] = {
 		{"algebraic_console",8,0,4,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_CONSOLE)},
 		{"algebraic_file",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_FILE)},
 		{"binary_archive",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_BINARY_ARCHIVE)},
 		{"text_archive",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_TEXT_ARCHIVE)}
 		},
-	kw_418[2] = {
+	kw_420[2] = {
 		{"filename_prefix",11,0,1,0,0,0.,0.,0,N_mom(str,modelExportPrefix)},
-		{"formats",8,4,2,1,kw_417}
+		{"formats",8,4,2,1,kw_419}
 		},
-	kw_419[5] = {
-		{"export_model",8,2,4,0,kw_418,0.,0.,0,N_mom(true,exportSurrogate)},
+	kw_421[5] = {
+		{"export_model",8,2,4,0,kw_420,0.,0.,0,N_mom(true,exportSurrogate)},
 		{"max_nodes",9,0,1,0,0,0.,0.,0,N_mom(shint,annNodes)},
 		{"nodes",1,0,1,0,0,0.,0.,-1,N_mom(shint,annNodes)},
 		{"random_weight",9,0,3,0,0,0.,0.,0,N_mom(shint,annRandomWeight)},
 		{"range",10,0,2,0,0,0.,0.,0,N_mom(Real,annRange)}
 		},
-	kw_420[4] = {
+	kw_422[4] = {
 		{"algebraic_console",8,0,4,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_CONSOLE)},
 		{"algebraic_file",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_FILE)},
 		{"binary_archive",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_BINARY_ARCHIVE)},
 		{"text_archive",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_TEXT_ARCHIVE)}
 		},
-	kw_421[2] = {
+	kw_423[2] = {
 		{"filename_prefix",11,0,1,0,0,0.,0.,0,N_mom(str,modelExportPrefix)},
-		{"formats",8,4,2,1,kw_420}
+		{"formats",8,4,2,1,kw_422}
 		},
-	kw_422[5] = {
+	kw_424[5] = {
 		{"basis_order",0x29,0,1,1,0,0.,0.,0,N_mom(shint,polynomialOrder)},
 		{"cubic",8,0,1,1,0,0.,0.,0,N_mom(order,polynomialOrder_3)},
-		{"export_model",8,2,2,0,kw_421,0.,0.,0,N_mom(true,exportSurrogate)},
+		{"export_model",8,2,2,0,kw_423,0.,0.,0,N_mom(true,exportSurrogate)},
 		{"linear",8,0,1,1,0,0.,0.,0,N_mom(order,polynomialOrder_1)},
 		{"quadratic",8,0,1,1,0,0.,0.,0,N_mom(order,polynomialOrder_2)}
 		},
-	kw_423[4] = {
+	kw_425[4] = {
 		{"algebraic_console",8,0,4,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_CONSOLE)},
 		{"algebraic_file",8,0,3,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_ALGEBRAIC_FILE)},
 		{"binary_archive",8,0,2,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_BINARY_ARCHIVE)},
 		{"text_archive",8,0,1,0,0,0.,0.,0,N_mom(augment_utype,modelExportFormat_TEXT_ARCHIVE)}
 		},
-	kw_424[2] = {
+	kw_426[2] = {
 		{"filename_prefix",11,0,1,0,0,0.,0.,0,N_mom(str,modelExportPrefix)},
-		{"formats",8,4,2,1,kw_423}
+		{"formats",8,4,2,1,kw_425}
 		},
-	kw_425[5] = {
+	kw_427[5] = {
 		{"bases",9,0,1,0,0,0.,0.,0,N_mom(shint,rbfBases)},
-		{"export_model",8,2,5,0,kw_424,0.,0.,0,N_mom(true,exportSurrogate)},
+		{"export_model",8,2,5,0,kw_426,0.,0.,0,N_mom(true,exportSurrogate)},
 		{"max_pts",9,0,2,0,0,0.,0.,0,N_mom(shint,rbfMaxPts)},
 		{"max_subsets",9,0,4,0,0,0.,0.,0,N_mom(shint,rbfMaxSubsets)},
 		{"min_partition",9,0,3,0,0,0.,0.,0,N_mom(shint,rbfMinPartition)}
 		},
-	kw_426[3] = {
+	kw_428[3] = {
 		{"all",8,0,1,1,0,0.,0.,0,N_mom(lit,approxPointReuse_all)},
 		{"none",8,0,1,1,0,0.,0.,0,N_mom(lit,approxPointReuse_none)},
 		{"region",8,0,1,1,0,0.,0.,0,N_mom(lit,approxPointReuse_region)}
 		},
-	kw_427[26] = {
+	kw_429[3] = {
+		{"constant",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_constant)},
+		{"linear",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_linear)},
+		{"reduced_quadratic",8,0,1,1,0,0.,0.,0,N_mom(lit,trendOrder_reduced_quadratic)}
+		},
+	kw_430[2] = {
+		{"inducing_points",0x19,0,1,0,0,0.,0.,0,N_mom(int,inducingPoints)},
+		{"trend",8,3,2,0,kw_429}
+		},
+	kw_431[29] = {
 		{"actual_model_pointer",11,0,4,0,0,0.,0.,0,N_mom(str,actualModelPointer)},
-		{"challenge_points_file",3,4,11,0,kw_390,0.,0.,9,N_mom(str,importChallengePtsFile)},
-		{"correction",8,6,9,0,kw_391},
-		{"dace_method_pointer",11,1,4,0,kw_394,0.,0.,0,N_mom(str,subMethodPointer)},
-		{"diagnostics",7,2,10,0,kw_396,0.,0.,10,N_mom(strL,diagMetrics)},
-		{"domain_decomposition",8,3,2,0,kw_398,0.,0.,0,N_mom(true,domainDecomp)},
-		{"export_approx_points_file",11,3,7,0,kw_400,0.,0.,0,N_mom(str,exportApproxPtsFile)},
-		{"export_points_file",3,3,7,0,kw_400,0.,0.,-1,N_mom(str,exportApproxPtsFile)},
-		{"gaussian_process",8,2,1,1,kw_407},
-		{"import_build_points_file",11,4,6,0,kw_409,0.,0.,0,N_mom(str,importBuildPtsFile)},
-		{"import_challenge_points_file",11,4,11,0,kw_390,0.,0.,0,N_mom(str,importChallengePtsFile)},
-		{"import_points_file",3,4,6,0,kw_409,0.,0.,-2,N_mom(str,importBuildPtsFile)},
-		{"kriging",0,2,1,1,kw_407,0.,0.,-4},
-		{"mars",8,3,1,1,kw_413,0.,0.,0,N_mom(lit,surrogateType_global_mars)},
-		{"metrics",15,2,10,0,kw_396,0.,0.,0,N_mom(strL,diagMetrics)},
+		{"build_concurrency",0x19,0,12,0,0,0.,0.,0,N_mom(int,buildConcurrency)},
+		{"challenge_points_file",3,5,11,0,kw_392,0.,0.,9,N_mom(str,importChallengePtsFile)},
+		{"correction",8,6,9,0,kw_393},
+		{"dace_method_pointer",11,1,4,0,kw_396,0.,0.,0,N_mom(str,subMethodPointer)},
+		{"diagnostics",7,2,10,0,kw_398,0.,0.,10,N_mom(strL,diagMetrics)},
+		{"domain_decomposition",8,3,2,0,kw_400,0.,0.,0,N_mom(true,domainDecomp)},
+		{"export_approx_points_file",11,4,7,0,kw_402,0.,0.,0,N_mom(str,exportApproxPtsFile)},
+		{"export_points_file",3,4,7,0,kw_402,0.,0.,-1,N_mom(str,exportApproxPtsFile)},
+		{"gaussian_process",8,2,1,1,kw_409},
+		{"import_build_points_file",11,5,6,0,kw_411,0.,0.,0,N_mom(str,importBuildPtsFile)},
+		{"import_challenge_points_file",11,5,11,0,kw_392,0.,0.,0,N_mom(str,importChallengePtsFile)},
+		{"import_points_file",3,5,6,0,kw_411,0.,0.,-2,N_mom(str,importBuildPtsFile)},
+		{"kriging",0,2,1,1,kw_409,0.,0.,-4},
+		{"mars",8,3,1,1,kw_415,0.,0.,0,N_mom(lit,surrogateType_global_mars)},
+		{"metrics",15,2,10,0,kw_398,0.,0.,0,N_mom(strL,diagMetrics)},
 		{"minimum_points",8,0,3,0,0,0.,0.,0,N_mom(type,pointsManagement_MINIMUM_POINTS)},
-		{"moving_least_squares",8,4,1,1,kw_416,0.,0.,0,N_mom(lit,surrogateType_global_moving_least_squares)},
-		{"neural_network",8,5,1,1,kw_419,0.,0.,0,N_mom(lit,surrogateType_global_neural_network)},
-		{"polynomial",8,5,1,1,kw_422,0.,0.,0,N_mom(lit,surrogateType_global_polynomial)},
-		{"radial_basis",8,5,1,1,kw_425,0.,0.,0,N_mom(lit,surrogateType_global_radial_basis)},
+		{"model_cache_prefix",11,0,13,0,0,0.,0.,0,N_mom(str,modelCachePrefix)},
+		{"moving_least_squares",8,4,1,1,kw_418,0.,0.,0,N_mom(lit,surrogateType_global_moving_least_squares)},
+		{"neural_network",8,5,1,1,kw_421,0.,0.,0,N_mom(lit,surrogateType_global_neural_network)},
+		{"polynomial",8,5,1,1,kw_424,0.,0.,0,N_mom(lit,surrogateType_global_polynomial)},
+		{"radial_basis",8,5,1,1,kw_427,0.,0.,0,N_mom(lit,surrogateType_global_radial_basis)},
 		{"recommended_points",8,0,3,0,0,0.,0.,0,N_mom(type,pointsManagement_RECOMMENDED_POINTS)},
-		{"reuse_points",8,3,5,0,kw_426},
-		{"reuse_samples",0,3,5,0,kw_426,0.,0.,-1},
-		{"samples_file",3,4,6,0,kw_409,0.,0.,-14,N_mom(str,importBuildPtsFile)},
+		{"reuse_points",8,3,5,0,kw_428},
+		{"reuse_samples",0,3,5,0,kw_428,0.,0.,-1},
+		{"samples_file",3,5,6,0,kw_411,0.,0.,-15,N_mom(str,importBuildPtsFile)},
+		{"sparse_gaussian_process",8,2,1,1,kw_430,0.,0.,0,N_mom(lit,surrogateType_global_sparse_gaussian)},
 		{"total_points",9,0,3,0,0,0.,0.,0,N_mom(int,pointsTotal)},
 		{"use_derivatives",8,0,8,0,0,0.,0.,0,N_mom(true,modelUseDerivsFlag)}
 		},
-	kw_428[6] = {
+	kw_432[6] = {
 		{"additive",8,0,2,2,0,0.,0.,0,N_mom(type,approxCorrectionType_ADDITIVE_CORRECTION)},
 		{"combined",8,0,2,2,0,0.,0.,0,N_mom(type,approxCorrectionType_COMBINED_CORRECTION)},
 		{"first_order",8,0,1,1,0,0.,0.,0,N_mom(order,approxCorrectionOrder_1)},
@@ -2735,74 +2806,74 @@ static KeyWord
 		{"second_order",8,0,1,1,0,0.,0.,0,N_mom(order,approxCorrectionOrder_2)},
 		{"zeroth_order",8,0,1,1,0,0.,0.,0,N_mom(order,approxCorrectionOrder_0)}
 		},
-	kw_429[3] = {
-		{"correction",8,6,2,0,kw_428},
+	kw_433[3] = {
+		{"correction",8,6,2,0,kw_432},
 		{"model_fidelity_sequence",7,0,1,1,0,0.,0.,1,N_mom(strL,orderedModelPointers)},
 		{"ordered_model_fidelities",15,0,1,1,0,0.,0.,0,N_mom(strL,orderedModelPointers)}
 		},
-	kw_430[2] = {
+	kw_434[2] = {
 		{"actual_model_pointer",11,0,2,2,0,0.,0.,0,N_mom(str,actualModelPointer)},
 		{"taylor_series",8,0,1,1}
 		},
-	kw_431[2] = {
+	kw_435[2] = {
 		{"actual_model_pointer",11,0,2,2,0,0.,0.,0,N_mom(str,actualModelPointer)},
 		{"tana",8,0,1,1}
 		},
-	kw_432[5] = {
-		{"global",8,26,2,1,kw_427},
-		{"hierarchical",8,3,2,1,kw_429,0.,0.,0,N_mom(lit,surrogateType_hierarchical)},
+	kw_436[5] = {
+		{"global",8,29,2,1,kw_431},
+		{"hierarchical",8,3,2,1,kw_433,0.,0.,0,N_mom(lit,surrogateType_hierarchical)},
 		{"id_surrogates",13,0,1,0,0,0.,0.,0,N_mom(intsetm1,surrogateFnIndices)},
-		{"local",8,2,2,1,kw_430,0.,0.,0,N_mom(lit,surrogateType_local_taylor)},
-		{"multipoint",8,2,2,1,kw_431,0.,0.,0,N_mom(lit,surrogateType_multipoint_tana)}
+		{"local",8,2,2,1,kw_434,0.,0.,0,N_mom(lit,surrogateType_local_taylor)},
+		{"multipoint",8,2,2,1,kw_435,0.,0.,0,N_mom(lit,surrogateType_multipoint_tana)}
 		},
-	kw_433[12] = {
-		{"active_subspace",8,8,2,1,kw_376,0.,0.,0,N_mom(lit,modelType_active_subspace)},
-		{"adapted_basis",8,3,2,1,kw_378,0.,0.,0,N_mom(lit,modelType_adapted_basis)},
+	kw_437[12] = {
+		{"active_subspace",8,8,2,1,kw_378,0.,0.,0,N_mom(lit,modelType_active_subspace)},
+		{"adapted_basis",8,3,2,1,kw_380,0.,0.,0,N_mom(lit,modelType_adapted_basis)},
 		{"hierarchical_tagging",8,0,5,0,0,0.,0.,0,N_mom(true,hierarchicalTags)},
 		{"id_model",11,0,1,0,0,0.,0.,0,N_mom(str,idModel)},
-		{"nested",8,2,2,1,kw_382,0.,0.,0,N_mom(lit,modelType_nested)},
-		{"random_field",8,5,2,1,kw_386,0.,0.,0,N_mom(lit,modelType_random_field)},
+		{"nested",8,2,2,1,kw_384,0.,0.,0,N_mom(lit,modelType_nested)},
+		{"random_field",8,5,2,1,kw_388,0.,0.,0,N_mom(lit,modelType_random_field)},
 		{"responses_pointer",11,0,4,0,0,0.,0.,0,N_mom(str,responsesPointer)},
-		{"simulation",0,2,2,1,kw_388,0.,0.,1,N_mom(lit,modelType_simulation)},
-		{"single",8,2,2,1,kw_388,0.,0.,0,N_mom(lit,modelType_simulation)},
-		{"subspace",0,8,2,1,kw_376,0.,0.,-9,N_mom(lit,modelType_active_subspace)},
-		{"surrogate",8,5,2,1,kw_432,0.,0.,0,N_mom(lit,modelType_surrogate)},
+		{"simulation",0,2,2,1,kw_390,0.,0.,1,N_mom(lit,modelType_simulation)},
+		{"single",8,2,2,1,kw_390,0.,0.,0,N_mom(lit,modelType_simulation)},
+		{"subspace",0,8,2,1,kw_378,0.,0.,-9,N_mom(lit,modelType_active_subspace)},
+		{"surrogate",8,5,2,1,kw_436,0.,0.,0,N_mom(lit,modelType_surrogate)},
 		{"variables_pointer",11,0,3,0,0,0.,0.,0,N_mom(str,variablesPointer)}
 		},
-	kw_434[2] = {
+	kw_438[2] = {
 		{"exp_id",8,0,2,0,0,0.,0.,0,N_rem(augment_utype,scalarDataFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_rem(augment_utype,scalarDataFormat_TABULAR_HEADER)}
 		},
-	kw_435[3] = {
+	kw_439[3] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_EXPER_ANNOT)},
-		{"custom_annotated",8,2,1,0,kw_434,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_NONE)},
+		{"custom_annotated",8,2,1,0,kw_438,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_NONE)}
 		},
-	kw_436[5] = {
+	kw_440[5] = {
 		{"interpolate",8,0,5,0,0,0.,0.,0,N_rem(true,interpolateFlag)},
 		{"num_config_variables",0x29,0,2,0,0,0.,0.,0,N_rem(sizet,numExpConfigVars)},
 		{"num_experiments",0x29,0,1,0,0,0.,0.,0,N_rem(sizet,numExperiments)},
-		{"scalar_data_file",11,3,4,0,kw_435,0.,0.,0,N_rem(str,scalarDataFileName)},
+		{"scalar_data_file",11,3,4,0,kw_439,0.,0.,0,N_rem(str,scalarDataFileName)},
 		{"variance_type",0x80f,0,3,0,0,0.,0.,0,N_rem(strL,varianceType)}
 		},
-	kw_437[2] = {
+	kw_441[2] = {
 		{"exp_id",8,0,2,0,0,0.,0.,0,N_rem(augment_utype,scalarDataFormat_TABULAR_EVAL_ID)},
 		{"header",8,0,1,0,0,0.,0.,0,N_rem(augment_utype,scalarDataFormat_TABULAR_HEADER)}
 		},
-	kw_438[6] = {
+	kw_442[6] = {
 		{"annotated",8,0,1,0,0,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_EXPER_ANNOT)},
-		{"custom_annotated",8,2,1,0,kw_437,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_NONE)},
+		{"custom_annotated",8,2,1,0,kw_441,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_NONE)},
 		{"freeform",8,0,1,0,0,0.,0.,0,N_rem(utype,scalarDataFormat_TABULAR_NONE)},
 		{"num_config_variables",0x29,0,3,0,0,0.,0.,0,N_rem(sizet,numExpConfigVars)},
 		{"num_experiments",0x29,0,2,0,0,0.,0.,0,N_rem(sizet,numExperiments)},
 		{"variance_type",0x80f,0,4,0,0,0.,0.,0,N_rem(strL,varianceType)}
 		},
-	kw_439[3] = {
+	kw_443[3] = {
 		{"lengths",13,0,1,1,0,0.,0.,0,N_rem(ivec,fieldLengths)},
 		{"num_coordinates_per_field",13,0,2,0,0,0.,0.,0,N_rem(ivec,numCoordsPerField)},
 		{"read_field_coordinates",8,0,3,0,0,0.,0.,0,N_rem(true,readFieldCoords)}
 		},
-	kw_440[6] = {
+	kw_444[6] = {
 		{"nonlinear_equality_scale_types",0x807,0,2,0,0,0.,0.,3,N_rem(strL,nonlinearEqScaleTypes)},
 		{"nonlinear_equality_scales",0x806,0,3,0,0,0.,0.,3,N_rem(RealDL,nonlinearEqScales)},
 		{"nonlinear_equality_targets",6,0,1,0,0,0.,0.,3,N_rem(RealDL,nonlinearEqTargets)},
@@ -2810,7 +2881,7 @@ static KeyWord
 		{"scales",0x80e,0,3,0,0,0.,0.,0,N_rem(RealDL,nonlinearEqScales)},
 		{"targets",14,0,1,0,0,0.,0.,0,N_rem(RealDL,nonlinearEqTargets)}
 		},
-	kw_441[8] = {
+	kw_445[8] = {
 		{"lower_bounds",14,0,1,0,0,0.,0.,0,N_rem(RealDL,nonlinearIneqLowerBnds)},
 		{"nonlinear_inequality_lower_bounds",6,0,1,0,0,0.,0.,-1,N_rem(RealDL,nonlinearIneqLowerBnds)},
 		{"nonlinear_inequality_scale_types",0x807,0,3,0,0,0.,0.,3,N_rem(strL,nonlinearIneqScaleTypes)},
@@ -2820,35 +2891,35 @@ static KeyWord
 		{"scales",0x80e,0,4,0,0,0.,0.,0,N_rem(RealDL,nonlinearIneqScales)},
 		{"upper_bounds",14,0,2,0,0,0.,0.,0,N_rem(RealDL,nonlinearIneqUpperBnds)}
 		},
-	kw_442[18] = {
-		{"calibration_data",8,5,6,0,kw_436,0.,0.,0,N_rem(true,calibrationDataFlag)},
-		{"calibration_data_file",11,6,6,0,kw_438,0.,0.,0,N_rem(str,scalarDataFileName)},
+	kw_446[18] = {
+		{"calibration_data",8,5,6,0,kw_440,0.,0.,0,N_rem(true,calibrationDataFlag)},
+		{"calibration_data_file",11,6,6,0,kw_442,0.,0.,0,N_rem(str,scalarDataFileName)},
 		{"calibration_term_scale_types",0x807,0,3,0,0,0.,0.,12,N_rem(strL,primaryRespFnScaleTypes)},
 		{"calibration_term_scales",0x806,0,4,0,0,0.,0.,12,N_rem(RealDL,primaryRespFnScales)},
 		{"calibration_weights",6,0,5,0,0,0.,0.,13,N_rem(RealDL,primaryRespFnWeights)},
-		{"field_calibration_terms",0x29,3,2,0,kw_439,0.,0.,0,N_rem(sizet,numFieldLeastSqTerms)},
-		{"least_squares_data_file",3,6,6,0,kw_438,0.,0.,-5,N_rem(str,scalarDataFileName)},
+		{"field_calibration_terms",0x29,3,2,0,kw_443,0.,0.,0,N_rem(sizet,numFieldLeastSqTerms)},
+		{"least_squares_data_file",3,6,6,0,kw_442,0.,0.,-5,N_rem(str,scalarDataFileName)},
 		{"least_squares_term_scale_types",0x807,0,3,0,0,0.,0.,7,N_rem(strL,primaryRespFnScaleTypes)},
 		{"least_squares_term_scales",0x806,0,4,0,0,0.,0.,7,N_rem(RealDL,primaryRespFnScales)},
 		{"least_squares_weights",6,0,5,0,0,0.,0.,8,N_rem(RealDL,primaryRespFnWeights)},
-		{"nonlinear_equality_constraints",0x29,6,8,0,kw_440,0.,0.,0,N_rem(sizet,numNonlinearEqConstraints)},
-		{"nonlinear_inequality_constraints",0x29,8,7,0,kw_441,0.,0.,0,N_rem(sizet,numNonlinearIneqConstraints)},
-		{"num_nonlinear_equality_constraints",0x21,6,8,0,kw_440,0.,0.,-2,N_rem(sizet,numNonlinearEqConstraints)},
-		{"num_nonlinear_inequality_constraints",0x21,8,7,0,kw_441,0.,0.,-2,N_rem(sizet,numNonlinearIneqConstraints)},
+		{"nonlinear_equality_constraints",0x29,6,8,0,kw_444,0.,0.,0,N_rem(sizet,numNonlinearEqConstraints)},
+		{"nonlinear_inequality_constraints",0x29,8,7,0,kw_445,0.,0.,0,N_rem(sizet,numNonlinearIneqConstraints)},
+		{"num_nonlinear_equality_constraints",0x21,6,8,0,kw_444,0.,0.,-2,N_rem(sizet,numNonlinearEqConstraints)},
+		{"num_nonlinear_inequality_constraints",0x21,8,7,0,kw_445,0.,0.,-2,N_rem(sizet,numNonlinearIneqConstraints)},
 		{"primary_scale_types",0x80f,0,3,0,0,0.,0.,0,N_rem(strL,primaryRespFnScaleTypes)},
 		{"primary_scales",0x80e,0,4,0,0,0.,0.,0,N_rem(RealDL,primaryRespFnScales)},
 		{"scalar_calibration_terms",0x29,0,1,0,0,0.,0.,0,N_rem(sizet,numScalarLeastSqTerms)},
 		{"weights",14,0,5,0,0,0.,0.,0,N_rem(RealDL,primaryRespFnWeights)}
 		},
-	kw_443[4] = {
+	kw_447[4] = {
 		{"absolute",8,0,2,0,0,0.,0.,0,N_rem(lit,fdGradStepType_absolute)},
 		{"bounds",8,0,2,0,0,0.,0.,0,N_rem(lit,fdGradStepType_bounds)},
 		{"ignore_bounds",8,0,1,0,0,0.,0.,0,N_rem(true,ignoreBounds)},
 		{"relative",8,0,2,0,0,0.,0.,0,N_rem(lit,fdGradStepType_relative)}
 		},
-	kw_444[8] = {
+	kw_448[8] = {
 		{"central",8,0,4,0,0,0.,0.,0,N_rem(lit,intervalType_central)},
-		{"dakota",8,4,2,0,kw_443,0.,0.,0,N_rem(lit,methodSource_dakota)},
+		{"dakota",8,4,2,0,kw_447,0.,0.,0,N_rem(lit,methodSource_dakota)},
 		{"fd_gradient_step_size",6,0,5,0,0,0.,0.,1,N_rem(RealL,fdGradStepSize)},
 		{"fd_step_size",14,0,5,0,0,0.,0.,0,N_rem(RealL,fdGradStepSize)},
 		{"forward",8,0,4,0,0,0.,0.,0,N_rem(lit,intervalType_forward)},
@@ -2856,38 +2927,38 @@ static KeyWord
 		{"method_source",8,0,1},
 		{"vendor",8,0,2,0,0,0.,0.,0,N_rem(lit,methodSource_vendor)}
 		},
-	kw_445[3] = {
-		{0,0,8,0,0,kw_444},
+	kw_449[3] = {
+		{0,0,8,0,0,kw_448},
 		{"id_analytic_gradients",13,0,2,2,0,0.,0.,0,N_rem(intset,idAnalyticGrads)},
 		{"id_numerical_gradients",13,0,1,1,0,0.,0.,0,N_rem(intset,idNumericalGrads)}
 		},
-	kw_446[2] = {
+	kw_450[2] = {
 		{"fd_hessian_step_size",6,0,1,0,0,0.,0.,1,N_rem(RealL,fdHessStepSize)},
 		{"fd_step_size",14,0,1,0,0,0.,0.,0,N_rem(RealL,fdHessStepSize)}
 		},
-	kw_447[1] = {
+	kw_451[1] = {
 		{"damped",8,0,1,0,0,0.,0.,0,N_rem(lit,quasiHessianType_damped_bfgs)}
 		},
-	kw_448[2] = {
-		{"bfgs",8,1,1,1,kw_447,0.,0.,0,N_rem(lit,quasiHessianType_bfgs)},
+	kw_452[2] = {
+		{"bfgs",8,1,1,1,kw_451,0.,0.,0,N_rem(lit,quasiHessianType_bfgs)},
 		{"sr1",8,0,1,1,0,0.,0.,0,N_rem(lit,quasiHessianType_sr1)}
 		},
-	kw_449[8] = {
+	kw_453[8] = {
 		{"absolute",8,0,2,0,0,0.,0.,0,N_rem(lit,fdHessStepType_absolute)},
 		{"bounds",8,0,2,0,0,0.,0.,0,N_rem(lit,fdHessStepType_bounds)},
 		{"central",8,0,3,0,0,0.,0.,0,N_rem(true,centralHess)},
 		{"forward",8,0,3,0,0,0.,0.,0,N_rem(false,centralHess)},
 		{"id_analytic_hessians",13,0,5,0,0,0.,0.,0,N_rem(intset,idAnalyticHessians)},
-		{"id_numerical_hessians",13,2,1,0,kw_446,0.,0.,0,N_rem(intset,idNumericalHessians)},
-		{"id_quasi_hessians",13,2,4,0,kw_448,0.,0.,0,N_rem(intset,idQuasiHessians)},
+		{"id_numerical_hessians",13,2,1,0,kw_450,0.,0.,0,N_rem(intset,idNumericalHessians)},
+		{"id_quasi_hessians",13,2,4,0,kw_452,0.,0.,0,N_rem(intset,idQuasiHessians)},
 		{"relative",8,0,2,0,0,0.,0.,0,N_rem(lit,fdHessStepType_relative)}
 		},
-	kw_450[3] = {
+	kw_454[3] = {
 		{"lengths",13,0,1,1,0,0.,0.,0,N_rem(ivec,fieldLengths)},
 		{"num_coordinates_per_field",13,0,2,0,0,0.,0.,0,N_rem(ivec,numCoordsPerField)},
 		{"read_field_coordinates",8,0,3,0,0,0.,0.,0,N_rem(true,readFieldCoords)}
 		},
-	kw_451[6] = {
+	kw_455[6] = {
 		{"nonlinear_equality_scale_types",0x807,0,2,0,0,0.,0.,3,N_rem(strL,nonlinearEqScaleTypes)},
 		{"nonlinear_equality_scales",0x806,0,3,0,0,0.,0.,3,N_rem(RealDL,nonlinearEqScales)},
 		{"nonlinear_equality_targets",6,0,1,0,0,0.,0.,3,N_rem(RealDL,nonlinearEqTargets)},
@@ -2895,7 +2966,7 @@ static KeyWord
 		{"scales",0x80e,0,3,0,0,0.,0.,0,N_rem(RealDL,nonlinearEqScales)},
 		{"targets",14,0,1,0,0,0.,0.,0,N_rem(RealDL,nonlinearEqTargets)}
 		},
-	kw_452[8] = {
+	kw_456[8] = {
 		{"lower_bounds",14,0,1,0,0,0.,0.,0,N_rem(RealDL,nonlinearIneqLowerBnds)},
 		{"nonlinear_inequality_lower_bounds",6,0,1,0,0,0.,0.,-1,N_rem(RealDL,nonlinearIneqLowerBnds)},
 		{"nonlinear_inequality_scale_types",0x807,0,3,0,0,0.,0.,3,N_rem(strL,nonlinearIneqScaleTypes)},
@@ -2905,14 +2976,14 @@ static KeyWord
 		{"scales",0x80e,0,4,0,0,0.,0.,0,N_rem(RealDL,nonlinearIneqScales)},
 		{"upper_bounds",14,0,2,0,0,0.,0.,0,N_rem(RealDL,nonlinearIneqUpperBnds)}
 		},
-	kw_453[15] = {
-		{"field_objectives",0x29,3,8,0,kw_450,0.,0.,0,N_rem(sizet,numFieldObjectiveFunctions)},
+	kw_457[15] = {
+		{"field_objectives",0x29,3,8,0,kw_454,0.,0.,0,N_rem(sizet,numFieldObjectiveFunctions)},
 		{"multi_objective_weights",6,0,4,0,0,0.,0.,13,N_rem(RealDL,primaryRespFnWeights)},
-		{"nonlinear_equality_constraints",0x29,6,6,0,kw_451,0.,0.,0,N_rem(sizet,numNonlinearEqConstraints)},
-		{"nonlinear_inequality_constraints",0x29,8,5,0,kw_452,0.,0.,0,N_rem(sizet,numNonlinearIneqConstraints)},
-		{"num_field_objectives",0x21,3,8,0,kw_450,0.,0.,-4,N_rem(sizet,numFieldObjectiveFunctions)},
-		{"num_nonlinear_equality_constraints",0x21,6,6,0,kw_451,0.,0.,-3,N_rem(sizet,numNonlinearEqConstraints)},
-		{"num_nonlinear_inequality_constraints",0x21,8,5,0,kw_452,0.,0.,-3,N_rem(sizet,numNonlinearIneqConstraints)},
+		{"nonlinear_equality_constraints",0x29,6,6,0,kw_455,0.,0.,0,N_rem(sizet,numNonlinearEqConstraints)},
+		{"nonlinear_inequality_constraints",0x29,8,5,0,kw_456,0.,0.,0,N_rem(sizet,numNonlinearIneqConstraints)},
+		{"num_field_objectives",0x21,3,8,0,kw_454,0.,0.,-4,N_rem(sizet,numFieldObjectiveFunctions)},
+		{"num_nonlinear_equality_constraints",0x21,6,6,0,kw_455,0.,0.,-3,N_rem(sizet,numNonlinearEqConstraints)},
+		{"num_nonlinear_inequality_constraints",0x21,8,5,0,kw_456,0.,0.,-3,N_rem(sizet,numNonlinearIneqConstraints)},
 		{"num_scalar_objectives",0x21,0,7,0,0,0.,0.,5,N_rem(sizet,numScalarObjectiveFunctions)},
 		{"objective_function_scale_types",0x807,0,2,0,0,0.,0.,2,N_rem(strL,primaryRespFnScaleTypes)},
 		{"objective_function_scales",0x806,0,3,0,0,0.,0.,2,N_rem(RealDL,primaryRespFnScales)},
@@ -2922,18 +2993,18 @@ static KeyWord
 		{"sense",0x80f,0,1,0,0,0.,0.,0,N_rem(strL,primaryRespFnSense)},
 		{"weights",14,0,4,0,0,0.,0.,0,N_rem(RealDL,primaryRespFnWeights)}
 		},
-	kw_454[3] = {
+	kw_458[3] = {
 		{"lengths",13,0,1,1,0,0.,0.,0,N_rem(ivec,fieldLengths)},
 		{"num_coordinates_per_field",13,0,2,0,0,0.,0.,0,N_rem(ivec,numCoordsPerField)},
 		{"read_field_coordinates",8,0,3,0,0,0.,0.,0,N_rem(true,readFieldCoords)}
 		},
-	kw_455[4] = {
-		{"field_responses",0x29,3,2,0,kw_454,0.,0.,0,N_rem(sizet,numFieldResponseFunctions)},
-		{"num_field_responses",0x21,3,2,0,kw_454,0.,0.,-1,N_rem(sizet,numFieldResponseFunctions)},
+	kw_459[4] = {
+		{"field_responses",0x29,3,2,0,kw_458,0.,0.,0,N_rem(sizet,numFieldResponseFunctions)},
+		{"num_field_responses",0x21,3,2,0,kw_458,0.,0.,-1,N_rem(sizet,numFieldResponseFunctions)},
 		{"num_scalar_responses",0x21,0,1,0,0,0.,0.,1,N_rem(sizet,numScalarResponseFunctions)},
 		{"scalar_responses",0x29,0,1,0,0,0.,0.,0,N_rem(sizet,numScalarResponseFunctions)}
 		},
-	kw_456[7] = {
+	kw_460[7] = {
 		{"absolute",8,0,2,0,0,0.,0.,0,N_rem(lit,fdHessStepType_absolute)},
 		{"bounds",8,0,2,0,0,0.,0.,0,N_rem(lit,fdHessStepType_bounds)},
 		{"central",8,0,3,0,0,0.,0.,0,N_rem(true,centralHess)},
@@ -2942,35 +3013,35 @@ static KeyWord
 		{"forward",8,0,3,0,0,0.,0.,0,N_rem(false,centralHess)},
 		{"relative",8,0,2,0,0,0.,0.,0,N_rem(lit,fdHessStepType_relative)}
 		},
-	kw_457[1] = {
+	kw_461[1] = {
 		{"damped",8,0,1,0,0,0.,0.,0,N_rem(lit,quasiHessianType_damped_bfgs)}
 		},
-	kw_458[2] = {
-		{"bfgs",8,1,1,1,kw_457,0.,0.,0,N_rem(lit,quasiHessianType_bfgs)},
+	kw_462[2] = {
+		{"bfgs",8,1,1,1,kw_461,0.,0.,0,N_rem(lit,quasiHessianType_bfgs)},
 		{"sr1",8,0,1,1,0,0.,0.,0,N_rem(lit,quasiHessianType_sr1)}
 		},
-	kw_459[19] = {
+	kw_463[19] = {
 		{"analytic_gradients",8,0,4,2,0,0.,0.,0,N_rem(lit,gradientType_analytic)},
 		{"analytic_hessians",8,0,5,3,0,0.,0.,0,N_rem(lit,hessianType_analytic)},
-		{"calibration_terms",0x29,18,3,1,kw_442,0.,0.,0,N_rem(sizet,numLeastSqTerms)},
+		{"calibration_terms",0x29,18,3,1,kw_446,0.,0.,0,N_rem(sizet,numLeastSqTerms)},
 		{"descriptors",15,0,2,0,0,0.,0.,0,N_rem(strL,responseLabels)},
 		{"id_responses",11,0,1,0,0,0.,0.,0,N_rem(str,idResponses)},
-		{"least_squares_terms",0x21,18,3,1,kw_442,0.,0.,-3,N_rem(sizet,numLeastSqTerms)},
-		{"mixed_gradients",8,2,4,2,kw_445,0.,0.,0,N_rem(lit,gradientType_mixed)},
-		{"mixed_hessians",8,8,5,3,kw_449,0.,0.,0,N_rem(lit,hessianType_mixed)},
+		{"least_squares_terms",0x21,18,3,1,kw_446,0.,0.,-3,N_rem(sizet,numLeastSqTerms)},
+		{"mixed_gradients",8,2,4,2,kw_449,0.,0.,0,N_rem(lit,gradientType_mixed)},
+		{"mixed_hessians",8,8,5,3,kw_453,0.,0.,0,N_rem(lit,hessianType_mixed)},
 		{"no_gradients",8,0,4,2,0,0.,0.,0,N_rem(lit,gradientType_none)},
 		{"no_hessians",8,0,5,3,0,0.,0.,0,N_rem(lit,hessianType_none)},
-		{"num_least_squares_terms",0x21,18,3,1,kw_442,0.,0.,-8,N_rem(sizet,numLeastSqTerms)},
-		{"num_objective_functions",0x21,15,3,1,kw_453,0.,0.,4,N_rem(sizet,numObjectiveFunctions)},
-		{"num_response_functions",0x21,4,3,1,kw_455,0.,0.,6,N_rem(sizet,numResponseFunctions)},
-		{"numerical_gradients",8,8,4,2,kw_444,0.,0.,0,N_rem(lit,gradientType_numerical)},
-		{"numerical_hessians",8,7,5,3,kw_456,0.,0.,0,N_rem(lit,hessianType_numerical)},
-		{"objective_functions",0x29,15,3,1,kw_453,0.,0.,0,N_rem(sizet,numObjectiveFunctions)},
-		{"quasi_hessians",8,2,5,3,kw_458,0.,0.,0,N_rem(lit,hessianType_quasi)},
+		{"num_least_squares_terms",0x21,18,3,1,kw_446,0.,0.,-8,N_rem(sizet,numLeastSqTerms)},
+		{"num_objective_functions",0x21,15,3,1,kw_457,0.,0.,4,N_rem(sizet,numObjectiveFunctions)},
+		{"num_response_functions",0x21,4,3,1,kw_459,0.,0.,6,N_rem(sizet,numResponseFunctions)},
+		{"numerical_gradients",8,8,4,2,kw_448,0.,0.,0,N_rem(lit,gradientType_numerical)},
+		{"numerical_hessians",8,7,5,3,kw_460,0.,0.,0,N_rem(lit,hessianType_numerical)},
+		{"objective_functions",0x29,15,3,1,kw_457,0.,0.,0,N_rem(sizet,numObjectiveFunctions)},
+		{"quasi_hessians",8,2,5,3,kw_462,0.,0.,0,N_rem(lit,hessianType_quasi)},
 		{"response_descriptors",7,0,2,0,0,0.,0.,-14,N_rem(strL,responseLabels)},
-		{"response_functions",0x29,4,3,1,kw_455,0.,0.,0,N_rem(sizet,numResponseFunctions)}
+		{"response_functions",0x29,4,3,1,kw_459,0.,0.,0,N_rem(sizet,numResponseFunctions)}
 		},
-	kw_460[6] = {
+	kw_464[6] = {
 		{"aleatory",8,0,1,1,0,0.,0.,0,N_vam(type,varsView_ALEATORY_UNCERTAIN_VIEW)},
 		{"all",8,0,1,1,0,0.,0.,0,N_vam(type,varsView_ALL_VIEW)},
 		{"design",8,0,1,1,0,0.,0.,0,N_vam(type,varsView_DESIGN_VIEW)},
@@ -2978,7 +3049,7 @@ static KeyWord
 		{"state",8,0,1,1,0,0.,0.,0,N_vam(type,varsView_STATE_VIEW)},
 		{"uncertain",8,0,1,1,0,0.,0.,0,N_vam(type,varsView_UNCERTAIN_VIEW)}
 		},
-	kw_461[11] = {
+	kw_465[11] = {
 		{"alphas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,betaUncAlphas)},
 		{"betas",14,0,2,2,0,0.,0.,0,N_vam(RealLb,betaUncBetas)},
 		{"buv_alphas",6,0,1,1,0,0.,0.,-2,N_vam(RealLb,betaUncAlphas)},
@@ -2991,14 +3062,14 @@ static KeyWord
 		{"lower_bounds",14,0,3,3,0,0.,0.,0,N_vam(rvec,betaUncLowerBnds)},
 		{"upper_bounds",14,0,4,4,0,0.,0.,0,N_vam(rvec,betaUncUpperBnds)}
 		},
-	kw_462[5] = {
+	kw_466[5] = {
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(dauilbl,DAUIVar_binomial)},
 		{"initial_point",13,0,3,0,0,0.,0.,0,N_vam(IntLb,binomialUncVars)},
 		{"num_trials",13,0,2,2,0,0.,0.,0,N_vam(IntLb,binomialUncNumTrials)},
 		{"prob_per_trial",6,0,1,1,0,0.,0.,1,N_vam(rvec,binomialUncProbPerTrial)},
 		{"probability_per_trial",14,0,1,1,0,0.,0.,0,N_vam(rvec,binomialUncProbPerTrial)}
 		},
-	kw_463[12] = {
+	kw_467[12] = {
 		{"cdv_descriptors",7,0,6,0,0,0.,0.,6,N_vam(strL,continuousDesignLabels)},
 		{"cdv_initial_point",6,0,1,0,0,0.,0.,6,N_vam(rvec,continuousDesignVars)},
 		{"cdv_lower_bounds",6,0,2,0,0,0.,0.,6,N_vam(rvec,continuousDesignLowerBnds)},
@@ -3012,7 +3083,7 @@ static KeyWord
 		{"scales",0x80e,0,5,0,0,0.,0.,0,N_vam(rvec,continuousDesignScales)},
 		{"upper_bounds",14,0,3,0,0,0.,0.,0,N_vam(rvec,continuousDesignUpperBnds)}
 		},
-	kw_464[10] = {
+	kw_468[10] = {
 		{"descriptors",15,0,6,0,0,0.,0.,0,N_vae(ceulbl,CEUVar_interval)},
 		{"initial_point",14,0,5,0,0,0.,0.,0,N_vam(rvec,continuousIntervalUncVars)},
 		{"interval_probabilities",14,0,2,0,0,0.,0.,0,N_vam(newrvec,Var_Info_CIp)},
@@ -3024,7 +3095,7 @@ static KeyWord
 		{"num_intervals",13,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nCI)},
 		{"upper_bounds",14,0,4,2,0,0.,0.,0,N_vam(newrvec,Var_Info_CIub)}
 		},
-	kw_465[8] = {
+	kw_469[8] = {
 		{"csv_descriptors",7,0,4,0,0,0.,0.,4,N_vam(strL,continuousStateLabels)},
 		{"csv_initial_state",6,0,1,0,0,0.,0.,4,N_vam(rvec,continuousStateVars)},
 		{"csv_lower_bounds",6,0,2,0,0,0.,0.,4,N_vam(rvec,continuousStateLowerBnds)},
@@ -3034,7 +3105,7 @@ static KeyWord
 		{"lower_bounds",14,0,2,0,0,0.,0.,0,N_vam(rvec,continuousStateLowerBnds)},
 		{"upper_bounds",14,0,3,0,0,0.,0.,0,N_vam(rvec,continuousStateUpperBnds)}
 		},
-	kw_466[8] = {
+	kw_470[8] = {
 		{"ddv_descriptors",7,0,4,0,0,0.,0.,4,N_vam(strL,discreteDesignRangeLabels)},
 		{"ddv_initial_point",5,0,1,0,0,0.,0.,4,N_vam(ivec,discreteDesignRangeVars)},
 		{"ddv_lower_bounds",5,0,2,0,0,0.,0.,4,N_vam(ivec,discreteDesignRangeLowerBnds)},
@@ -3044,11 +3115,11 @@ static KeyWord
 		{"lower_bounds",13,0,2,0,0,0.,0.,0,N_vam(ivec,discreteDesignRangeLowerBnds)},
 		{"upper_bounds",13,0,3,0,0,0.,0.,0,N_vam(ivec,discreteDesignRangeUpperBnds)}
 		},
-	kw_467[1] = {
+	kw_471[1] = {
 		{"adjacency_matrix",13,0,1,0,0,0.,0.,0,N_vam(newivec,Var_Info_ddsia)}
 		},
-	kw_468[7] = {
-		{"categorical",15,1,3,0,kw_467,0.,0.,0,N_vam(categorical,discreteDesignSetIntCat)},
+	kw_472[7] = {
+		{"categorical",15,1,3,0,kw_471,0.,0.,0,N_vam(categorical,discreteDesignSetIntCat)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vam(strL,discreteDesignSetIntLabels)},
 		{"elements",13,0,2,1,0,0.,0.,0,N_vam(newivec,Var_Info_ddsi)},
 		{"elements_per_variable",0x80d,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nddsi)},
@@ -3056,11 +3127,11 @@ static KeyWord
 		{"num_set_values",0x805,0,1,0,0,0.,0.,-2,N_vam(newiarray,Var_Info_nddsi)},
 		{"set_values",5,0,2,1,0,0.,0.,-4,N_vam(newivec,Var_Info_ddsi)}
 		},
-	kw_469[1] = {
+	kw_473[1] = {
 		{"adjacency_matrix",13,0,1,0,0,0.,0.,0,N_vam(newivec,Var_Info_ddsra)}
 		},
-	kw_470[7] = {
-		{"categorical",15,1,3,0,kw_469,0.,0.,0,N_vam(categorical,discreteDesignSetRealCat)},
+	kw_474[7] = {
+		{"categorical",15,1,3,0,kw_473,0.,0.,0,N_vam(categorical,discreteDesignSetRealCat)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vam(strL,discreteDesignSetRealLabels)},
 		{"elements",14,0,2,1,0,0.,0.,0,N_vam(newrvec,Var_Info_ddsr)},
 		{"elements_per_variable",0x80d,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nddsr)},
@@ -3068,7 +3139,7 @@ static KeyWord
 		{"num_set_values",0x805,0,1,0,0,0.,0.,-2,N_vam(newiarray,Var_Info_nddsr)},
 		{"set_values",6,0,2,1,0,0.,0.,-4,N_vam(newrvec,Var_Info_ddsr)}
 		},
-	kw_471[7] = {
+	kw_475[7] = {
 		{"adjacency_matrix",13,0,3,0,0,0.,0.,0,N_vam(newivec,Var_Info_ddssa)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vam(strL,discreteDesignSetStrLabels)},
 		{"elements",15,0,2,1,0,0.,0.,0,N_vam(newsarray,Var_Info_ddss)},
@@ -3077,12 +3148,12 @@ static KeyWord
 		{"num_set_values",0x805,0,1,0,0,0.,0.,-2,N_vam(newiarray,Var_Info_nddss)},
 		{"set_values",7,0,2,1,0,0.,0.,-4,N_vam(newsarray,Var_Info_ddss)}
 		},
-	kw_472[3] = {
-		{"integer",0x19,7,1,0,kw_468,0.,0.,0,N_vam(pintz,numDiscreteDesSetIntVars)},
-		{"real",0x19,7,3,0,kw_470,0.,0.,0,N_vam(pintz,numDiscreteDesSetRealVars)},
-		{"string",0x19,7,2,0,kw_471,0.,0.,0,N_vam(pintz,numDiscreteDesSetStrVars)}
+	kw_476[3] = {
+		{"integer",0x19,7,1,0,kw_472,0.,0.,0,N_vam(pintz,numDiscreteDesSetIntVars)},
+		{"real",0x19,7,3,0,kw_474,0.,0.,0,N_vam(pintz,numDiscreteDesSetRealVars)},
+		{"string",0x19,7,2,0,kw_475,0.,0.,0,N_vam(pintz,numDiscreteDesSetStrVars)}
 		},
-	kw_473[9] = {
+	kw_477[9] = {
 		{"descriptors",15,0,6,0,0,0.,0.,0,N_vae(deuilbl,DEUIVar_interval)},
 		{"initial_point",13,0,5,0,0,0.,0.,0,N_vam(ivec,discreteIntervalUncVars)},
 		{"interval_probabilities",14,0,2,0,0,0.,0.,0,N_vam(newrvec,Var_Info_DIp)},
@@ -3093,7 +3164,7 @@ static KeyWord
 		{"range_probs",6,0,2,0,0,0.,0.,-5,N_vam(newrvec,Var_Info_DIp)},
 		{"upper_bounds",13,0,4,2,0,0.,0.,0,N_vam(newivec,Var_Info_DIub)}
 		},
-	kw_474[8] = {
+	kw_478[8] = {
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vam(strL,discreteStateRangeLabels)},
 		{"dsv_descriptors",7,0,4,0,0,0.,0.,-1,N_vam(strL,discreteStateRangeLabels)},
 		{"dsv_initial_state",5,0,1,0,0,0.,0.,3,N_vam(ivec,discreteStateRangeVars)},
@@ -3103,7 +3174,7 @@ static KeyWord
 		{"lower_bounds",13,0,2,0,0,0.,0.,0,N_vam(ivec,discreteStateRangeLowerBnds)},
 		{"upper_bounds",13,0,3,0,0,0.,0.,0,N_vam(ivec,discreteStateRangeUpperBnds)}
 		},
-	kw_475[7] = {
+	kw_479[7] = {
 		{"categorical",15,0,3,0,0,0.,0.,0,N_vam(categorical,discreteStateSetIntCat)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vam(strL,discreteStateSetIntLabels)},
 		{"elements",13,0,2,1,0,0.,0.,0,N_vam(newivec,Var_Info_dssi)},
@@ -3112,7 +3183,7 @@ static KeyWord
 		{"num_set_values",0x805,0,1,0,0,0.,0.,-2,N_vam(newiarray,Var_Info_ndssi)},
 		{"set_values",5,0,2,1,0,0.,0.,-4,N_vam(newivec,Var_Info_dssi)}
 		},
-	kw_476[7] = {
+	kw_480[7] = {
 		{"categorical",15,0,3,0,0,0.,0.,0,N_vam(categorical,discreteStateSetRealCat)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vam(strL,discreteStateSetRealLabels)},
 		{"elements",14,0,2,1,0,0.,0.,0,N_vam(newrvec,Var_Info_dssr)},
@@ -3121,7 +3192,7 @@ static KeyWord
 		{"num_set_values",0x805,0,1,0,0,0.,0.,-2,N_vam(newiarray,Var_Info_ndssr)},
 		{"set_values",6,0,2,1,0,0.,0.,-4,N_vam(newrvec,Var_Info_dssr)}
 		},
-	kw_477[6] = {
+	kw_481[6] = {
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vam(strL,discreteStateSetStrLabels)},
 		{"elements",15,0,2,1,0,0.,0.,0,N_vam(newsarray,Var_Info_dsss)},
 		{"elements_per_variable",0x80d,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_ndsss)},
@@ -3129,12 +3200,12 @@ static KeyWord
 		{"num_set_values",0x805,0,1,0,0,0.,0.,-2,N_vam(newiarray,Var_Info_ndsss)},
 		{"set_values",7,0,2,1,0,0.,0.,-4,N_vam(newsarray,Var_Info_dsss)}
 		},
-	kw_478[3] = {
-		{"integer",0x19,7,1,0,kw_475,0.,0.,0,N_vam(pintz,numDiscreteStateSetIntVars)},
-		{"real",0x19,7,3,0,kw_476,0.,0.,0,N_vam(pintz,numDiscreteStateSetRealVars)},
-		{"string",0x19,6,2,0,kw_477,0.,0.,0,N_vam(pintz,numDiscreteStateSetStrVars)}
+	kw_482[3] = {
+		{"integer",0x19,7,1,0,kw_479,0.,0.,0,N_vam(pintz,numDiscreteStateSetIntVars)},
+		{"real",0x19,7,3,0,kw_480,0.,0.,0,N_vam(pintz,numDiscreteStateSetRealVars)},
+		{"string",0x19,6,2,0,kw_481,0.,0.,0,N_vam(pintz,numDiscreteStateSetStrVars)}
 		},
-	kw_479[9] = {
+	kw_483[9] = {
 		{"categorical",15,0,4,0,0,0.,0.,0,N_vam(categorical,discreteUncSetIntCat)},
 		{"descriptors",15,0,6,0,0,0.,0.,0,N_vae(deuilbl,DEUIVar_set_int)},
 		{"elements",13,0,2,1,0,0.,0.,0,N_vam(newivec,Var_Info_dusi)},
@@ -3145,7 +3216,7 @@ static KeyWord
 		{"set_probs",6,0,3,0,0,0.,0.,-1,N_vam(newrvec,Var_Info_DSIp)},
 		{"set_values",5,0,2,1,0,0.,0.,-6,N_vam(newivec,Var_Info_dusi)}
 		},
-	kw_480[9] = {
+	kw_484[9] = {
 		{"categorical",15,0,4,0,0,0.,0.,0,N_vam(categorical,discreteUncSetRealCat)},
 		{"descriptors",15,0,6,0,0,0.,0.,0,N_vae(deurlbl,DEURVar_set_real)},
 		{"elements",14,0,2,1,0,0.,0.,0,N_vam(newrvec,Var_Info_dusr)},
@@ -3156,7 +3227,7 @@ static KeyWord
 		{"set_probs",6,0,3,0,0,0.,0.,-1,N_vam(newrvec,Var_Info_DSRp)},
 		{"set_values",6,0,2,1,0,0.,0.,-6,N_vam(newrvec,Var_Info_dusr)}
 		},
-	kw_481[8] = {
+	kw_485[8] = {
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(deuslbl,DEUSVar_set_str)},
 		{"elements",15,0,2,1,0,0.,0.,0,N_vam(newsarray,Var_Info_duss)},
 		{"elements_per_variable",13,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nduss)},
@@ -3166,19 +3237,19 @@ static KeyWord
 		{"set_probs",6,0,3,0,0,0.,0.,-1,N_vam(newrvec,Var_Info_DSSp)},
 		{"set_values",7,0,2,1,0,0.,0.,-6,N_vam(newsarray,Var_Info_duss)}
 		},
-	kw_482[3] = {
-		{"integer",0x19,9,1,0,kw_479,0.,0.,0,N_vam(pintz,numDiscreteUncSetIntVars)},
-		{"real",0x19,9,3,0,kw_480,0.,0.,0,N_vam(pintz,numDiscreteUncSetRealVars)},
-		{"string",0x19,8,2,0,kw_481,0.,0.,0,N_vam(pintz,numDiscreteUncSetStrVars)}
+	kw_486[3] = {
+		{"integer",0x19,9,1,0,kw_483,0.,0.,0,N_vam(pintz,numDiscreteUncSetIntVars)},
+		{"real",0x19,9,3,0,kw_484,0.,0.,0,N_vam(pintz,numDiscreteUncSetRealVars)},
+		{"string",0x19,8,2,0,kw_485,0.,0.,0,N_vam(pintz,numDiscreteUncSetStrVars)}
 		},
-	kw_483[5] = {
+	kw_487[5] = {
 		{"betas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,exponentialUncBetas)},
 		{"descriptors",15,0,3,0,0,0.,0.,0,N_vae(caulbl,CAUVar_exponential)},
 		{"euv_betas",6,0,1,1,0,0.,0.,-2,N_vam(RealLb,exponentialUncBetas)},
 		{"euv_descriptors",7,0,3,0,0,0.,0.,-2,N_vae(caulbl,CAUVar_exponential)},
 		{"initial_point",14,0,2,0,0,0.,0.,0,N_vam(RealLb,exponentialUncVars)}
 		},
-	kw_484[7] = {
+	kw_488[7] = {
 		{"alphas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,frechetUncAlphas)},
 		{"betas",14,0,2,2,0,0.,0.,0,N_vam(rvec,frechetUncBetas)},
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(caulbl,CAUVar_frechet)},
@@ -3187,7 +3258,7 @@ static KeyWord
 		{"fuv_descriptors",7,0,4,0,0,0.,0.,-3,N_vae(caulbl,CAUVar_frechet)},
 		{"initial_point",14,0,3,0,0,0.,0.,0,N_vam(rvec,frechetUncVars)}
 		},
-	kw_485[7] = {
+	kw_489[7] = {
 		{"alphas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,gammaUncAlphas)},
 		{"betas",14,0,2,2,0,0.,0.,0,N_vam(RealLb,gammaUncBetas)},
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(caulbl,CAUVar_gamma)},
@@ -3196,13 +3267,13 @@ static KeyWord
 		{"gauv_descriptors",7,0,4,0,0,0.,0.,-3,N_vae(caulbl,CAUVar_gamma)},
 		{"initial_point",14,0,3,0,0,0.,0.,0,N_vam(RealLb,gammaUncVars)}
 		},
-	kw_486[4] = {
+	kw_490[4] = {
 		{"descriptors",15,0,3,0,0,0.,0.,0,N_vae(dauilbl,DAUIVar_geometric)},
 		{"initial_point",13,0,2,0,0,0.,0.,0,N_vam(IntLb,geometricUncVars)},
 		{"prob_per_trial",6,0,1,1,0,0.,0.,1,N_vam(rvec,geometricUncProbPerTrial)},
 		{"probability_per_trial",14,0,1,1,0,0.,0.,0,N_vam(rvec,geometricUncProbPerTrial)}
 		},
-	kw_487[7] = {
+	kw_491[7] = {
 		{"alphas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,gumbelUncAlphas)},
 		{"betas",14,0,2,2,0,0.,0.,0,N_vam(rvec,gumbelUncBetas)},
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(caulbl,CAUVar_gumbel)},
@@ -3211,7 +3282,7 @@ static KeyWord
 		{"guuv_descriptors",7,0,4,0,0,0.,0.,-3,N_vae(caulbl,CAUVar_gumbel)},
 		{"initial_point",14,0,3,0,0,0.,0.,0,N_vam(rvec,gumbelUncVars)}
 		},
-	kw_488[11] = {
+	kw_492[11] = {
 		{"abscissas",14,0,2,1,0,0.,0.,0,N_vam(newrvec,Var_Info_hba)},
 		{"counts",14,0,3,2,0,0.,0.,0,N_vam(newrvec,Var_Info_hbc)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(caulbl,CAUVar_histogram_bin)},
@@ -3224,7 +3295,7 @@ static KeyWord
 		{"ordinates",14,0,3,2,0,0.,0.,0,N_vam(newrvec,Var_Info_hbo)},
 		{"pairs_per_variable",13,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nhbp)}
 		},
-	kw_489[6] = {
+	kw_493[6] = {
 		{"abscissas",13,0,2,1,0,0.,0.,0,N_vam(newivec,Var_Info_hpia)},
 		{"counts",14,0,3,2,0,0.,0.,0,N_vam(newrvec,Var_Info_hpic)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(dauilbl,DAUIVar_histogram_point_int)},
@@ -3232,7 +3303,7 @@ static KeyWord
 		{"num_pairs",5,0,1,0,0,0.,0.,1,N_vam(newiarray,Var_Info_nhpip)},
 		{"pairs_per_variable",13,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nhpip)}
 		},
-	kw_490[6] = {
+	kw_494[6] = {
 		{"abscissas",14,0,2,1,0,0.,0.,0,N_vam(newrvec,Var_Info_hpra)},
 		{"counts",14,0,3,2,0,0.,0.,0,N_vam(newrvec,Var_Info_hprc)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(daurlbl,DAURVar_histogram_point_real)},
@@ -3240,7 +3311,7 @@ static KeyWord
 		{"num_pairs",5,0,1,0,0,0.,0.,1,N_vam(newiarray,Var_Info_nhprp)},
 		{"pairs_per_variable",13,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nhprp)}
 		},
-	kw_491[6] = {
+	kw_495[6] = {
 		{"abscissas",15,0,2,1,0,0.,0.,0,N_vam(newsarray,Var_Info_hpsa)},
 		{"counts",14,0,3,2,0,0.,0.,0,N_vam(newrvec,Var_Info_hpsc)},
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(dauslbl,DAUSVar_histogram_point_str)},
@@ -3248,42 +3319,42 @@ static KeyWord
 		{"num_pairs",5,0,1,0,0,0.,0.,1,N_vam(newiarray,Var_Info_nhpsp)},
 		{"pairs_per_variable",13,0,1,0,0,0.,0.,0,N_vam(newiarray,Var_Info_nhpsp)}
 		},
-	kw_492[3] = {
-		{"integer",0x19,6,1,0,kw_489,0.,0.,0,N_vam(pintz,numHistogramPtIntUncVars)},
-		{"real",0x19,6,3,0,kw_490,0.,0.,0,N_vam(pintz,numHistogramPtRealUncVars)},
-		{"string",0x19,6,2,0,kw_491,0.,0.,0,N_vam(pintz,numHistogramPtStrUncVars)}
+	kw_496[3] = {
+		{"integer",0x19,6,1,0,kw_493,0.,0.,0,N_vam(pintz,numHistogramPtIntUncVars)},
+		{"real",0x19,6,3,0,kw_494,0.,0.,0,N_vam(pintz,numHistogramPtRealUncVars)},
+		{"string",0x19,6,2,0,kw_495,0.,0.,0,N_vam(pintz,numHistogramPtStrUncVars)}
 		},
-	kw_493[5] = {
+	kw_497[5] = {
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(dauilbl,DAUIVar_hypergeometric)},
 		{"initial_point",13,0,4,0,0,0.,0.,0,N_vam(IntLb,hyperGeomUncVars)},
 		{"num_drawn",13,0,3,3,0,0.,0.,0,N_vam(IntLb,hyperGeomUncNumDrawn)},
 		{"selected_population",13,0,2,2,0,0.,0.,0,N_vam(IntLb,hyperGeomUncSelectedPop)},
 		{"total_population",13,0,1,1,0,0.,0.,0,N_vam(IntLb,hyperGeomUncTotalPop)}
 		},
-	kw_494[2] = {
+	kw_498[2] = {
 		{"lnuv_zetas",6,0,1,1,0,0.,0.,1,N_vam(RealLb,lognormalUncZetas)},
 		{"zetas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,lognormalUncZetas)}
 		},
-	kw_495[4] = {
+	kw_499[4] = {
 		{"error_factors",14,0,1,1,0,0.,0.,0,N_vam(RealLb,lognormalUncErrFacts)},
 		{"lnuv_error_factors",6,0,1,1,0,0.,0.,-1,N_vam(RealLb,lognormalUncErrFacts)},
 		{"lnuv_std_deviations",6,0,1,1,0,0.,0.,1,N_vam(RealLb,lognormalUncStdDevs)},
 		{"std_deviations",14,0,1,1,0,0.,0.,0,N_vam(RealLb,lognormalUncStdDevs)}
 		},
-	kw_496[11] = {
+	kw_500[11] = {
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(caulbl,CAUVar_lognormal)},
 		{"initial_point",14,0,4,0,0,0.,0.,0,N_vam(RealLb,lognormalUncVars)},
-		{"lambdas",14,2,1,1,kw_494,0.,0.,0,N_vam(rvec,lognormalUncLambdas)},
+		{"lambdas",14,2,1,1,kw_498,0.,0.,0,N_vam(rvec,lognormalUncLambdas)},
 		{"lnuv_descriptors",7,0,5,0,0,0.,0.,-3,N_vae(caulbl,CAUVar_lognormal)},
-		{"lnuv_lambdas",6,2,1,1,kw_494,0.,0.,-2,N_vam(rvec,lognormalUncLambdas)},
+		{"lnuv_lambdas",6,2,1,1,kw_498,0.,0.,-2,N_vam(rvec,lognormalUncLambdas)},
 		{"lnuv_lower_bounds",6,0,2,0,0,0.,0.,3,N_vam(RealLb,lognormalUncLowerBnds)},
-		{"lnuv_means",6,4,1,1,kw_495,0.,0.,3,N_vam(RealLb,lognormalUncMeans)},
+		{"lnuv_means",6,4,1,1,kw_499,0.,0.,3,N_vam(RealLb,lognormalUncMeans)},
 		{"lnuv_upper_bounds",6,0,3,0,0,0.,0.,3,N_vam(RealUb,lognormalUncUpperBnds)},
 		{"lower_bounds",14,0,2,0,0,0.,0.,0,N_vam(RealLb,lognormalUncLowerBnds)},
-		{"means",14,4,1,1,kw_495,0.,0.,0,N_vam(RealLb,lognormalUncMeans)},
+		{"means",14,4,1,1,kw_499,0.,0.,0,N_vam(RealLb,lognormalUncMeans)},
 		{"upper_bounds",14,0,3,0,0,0.,0.,0,N_vam(RealUb,lognormalUncUpperBnds)}
 		},
-	kw_497[7] = {
+	kw_501[7] = {
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(caulbl,CAUVar_loguniform)},
 		{"initial_point",14,0,3,0,0,0.,0.,0,N_vam(RealLb,loguniformUncVars)},
 		{"lower_bounds",14,0,1,1,0,0.,0.,0,N_vam(RealLb,loguniformUncLowerBnds)},
@@ -3292,14 +3363,14 @@ static KeyWord
 		{"luuv_upper_bounds",6,0,2,2,0,0.,0.,1,N_vam(RealUb,loguniformUncUpperBnds)},
 		{"upper_bounds",14,0,2,2,0,0.,0.,0,N_vam(RealUb,loguniformUncUpperBnds)}
 		},
-	kw_498[5] = {
+	kw_502[5] = {
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(dauilbl,DAUIVar_negative_binomial)},
 		{"initial_point",13,0,3,0,0,0.,0.,0,N_vam(IntLb,negBinomialUncVars)},
 		{"num_trials",13,0,2,2,0,0.,0.,0,N_vam(IntLb,negBinomialUncNumTrials)},
 		{"prob_per_trial",6,0,1,1,0,0.,0.,1,N_vam(rvec,negBinomialUncProbPerTrial)},
 		{"probability_per_trial",14,0,1,1,0,0.,0.,0,N_vam(rvec,negBinomialUncProbPerTrial)}
 		},
-	kw_499[11] = {
+	kw_503[11] = {
 		{"descriptors",15,0,6,0,0,0.,0.,0,N_vae(caulbl,CAUVar_normal)},
 		{"initial_point",14,0,5,0,0,0.,0.,0,N_vam(rvec,normalUncVars)},
 		{"lower_bounds",14,0,3,0,0,0.,0.,0,N_vam(rvec,normalUncLowerBnds)},
@@ -3312,12 +3383,12 @@ static KeyWord
 		{"std_deviations",14,0,2,2,0,0.,0.,0,N_vam(RealLb,normalUncStdDevs)},
 		{"upper_bounds",14,0,4,0,0,0.,0.,0,N_vam(rvec,normalUncUpperBnds)}
 		},
-	kw_500[3] = {
+	kw_504[3] = {
 		{"descriptors",15,0,3,0,0,0.,0.,0,N_vae(dauilbl,DAUIVar_poisson)},
 		{"initial_point",13,0,2,0,0,0.,0.,0,N_vam(IntLb,poissonUncVars)},
 		{"lambdas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,poissonUncLambdas)}
 		},
-	kw_501[9] = {
+	kw_505[9] = {
 		{"descriptors",15,0,5,0,0,0.,0.,0,N_vae(caulbl,CAUVar_triangular)},
 		{"initial_point",14,0,4,0,0,0.,0.,0,N_vam(rvec,triangularUncVars)},
 		{"lower_bounds",14,0,2,2,0,0.,0.,0,N_vam(RealLb,triangularUncLowerBnds)},
@@ -3328,7 +3399,7 @@ static KeyWord
 		{"tuv_upper_bounds",6,0,3,3,0,0.,0.,1,N_vam(RealUb,triangularUncUpperBnds)},
 		{"upper_bounds",14,0,3,3,0,0.,0.,0,N_vam(RealUb,triangularUncUpperBnds)}
 		},
-	kw_502[7] = {
+	kw_506[7] = {
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(caulbl,CAUVar_uniform)},
 		{"initial_point",14,0,3,0,0,0.,0.,0,N_vam(rvec,uniformUncVars)},
 		{"lower_bounds",14,0,1,1,0,0.,0.,0,N_vam(RealLb,uniformUncLowerBnds)},
@@ -3337,7 +3408,7 @@ static KeyWord
 		{"uuv_lower_bounds",6,0,1,1,0,0.,0.,-3,N_vam(RealLb,uniformUncLowerBnds)},
 		{"uuv_upper_bounds",6,0,2,2,0,0.,0.,-3,N_vam(RealUb,uniformUncUpperBnds)}
 		},
-	kw_503[7] = {
+	kw_507[7] = {
 		{"alphas",14,0,1,1,0,0.,0.,0,N_vam(RealLb,weibullUncAlphas)},
 		{"betas",14,0,2,2,0,0.,0.,0,N_vam(RealLb,weibullUncBetas)},
 		{"descriptors",15,0,4,0,0,0.,0.,0,N_vae(caulbl,CAUVar_weibull)},
@@ -3346,30 +3417,30 @@ static KeyWord
 		{"wuv_betas",6,0,2,2,0,0.,0.,-4,N_vam(RealLb,weibullUncBetas)},
 		{"wuv_descriptors",7,0,4,0,0,0.,0.,-4,N_vae(caulbl,CAUVar_weibull)}
 		},
-	kw_504[43] = {
-		{"active",8,6,2,0,kw_460},
-		{"beta_uncertain",0x19,11,13,0,kw_461,0.,0.,0,N_vam(pintz,numBetaUncVars)},
-		{"binomial_uncertain",0x19,5,20,0,kw_462,0.,0.,0,N_vam(pintz,numBinomialUncVars)},
-		{"continuous_design",0x19,12,4,0,kw_463,0.,0.,0,N_vam(pintz,numContinuousDesVars)},
-		{"continuous_interval_uncertain",0x19,10,26,0,kw_464,0.,0.,0,N_vam(pintz,numContinuousIntervalUncVars)},
-		{"continuous_state",0x19,8,29,0,kw_465,0.,0.,0,N_vam(pintz,numContinuousStateVars)},
-		{"discrete_design_range",0x19,8,5,0,kw_466,0.,0.,0,N_vam(pintz,numDiscreteDesRangeVars)},
-		{"discrete_design_set",8,3,6,0,kw_472},
-		{"discrete_interval_uncertain",0x19,9,27,0,kw_473,0.,0.,0,N_vam(pintz,numDiscreteIntervalUncVars)},
-		{"discrete_state_range",0x19,8,30,0,kw_474,0.,0.,0,N_vam(pintz,numDiscreteStateRangeVars)},
-		{"discrete_state_set",8,3,31,0,kw_478},
-		{"discrete_uncertain_range",0x11,9,27,0,kw_473,0.,0.,-3,N_vam(pintz,numDiscreteIntervalUncVars)},
-		{"discrete_uncertain_set",8,3,28,0,kw_482},
-		{"exponential_uncertain",0x19,5,12,0,kw_483,0.,0.,0,N_vam(pintz,numExponentialUncVars)},
-		{"frechet_uncertain",0x19,7,16,0,kw_484,0.,0.,0,N_vam(pintz,numFrechetUncVars)},
-		{"gamma_uncertain",0x19,7,14,0,kw_485,0.,0.,0,N_vam(pintz,numGammaUncVars)},
-		{"geometric_uncertain",0x19,4,22,0,kw_486,0.,0.,0,N_vam(pintz,numGeometricUncVars)},
-		{"gumbel_uncertain",0x19,7,15,0,kw_487,0.,0.,0,N_vam(pintz,numGumbelUncVars)},
-		{"histogram_bin_uncertain",0x19,11,18,0,kw_488,0.,0.,0,N_vam(pintz,numHistogramBinUncVars)},
-		{"histogram_point_uncertain",8,3,24,0,kw_492},
-		{"hypergeometric_uncertain",0x19,5,23,0,kw_493,0.,0.,0,N_vam(pintz,numHyperGeomUncVars)},
+	kw_508[43] = {
+		{"active",8,6,2,0,kw_464},
+		{"beta_uncertain",0x19,11,13,0,kw_465,0.,0.,0,N_vam(pintz,numBetaUncVars)},
+		{"binomial_uncertain",0x19,5,20,0,kw_466,0.,0.,0,N_vam(pintz,numBinomialUncVars)},
+		{"continuous_design",0x19,12,4,0,kw_467,0.,0.,0,N_vam(pintz,numContinuousDesVars)},
+		{"continuous_interval_uncertain",0x19,10,26,0,kw_468,0.,0.,0,N_vam(pintz,numContinuousIntervalUncVars)},
+		{"continuous_state",0x19,8,29,0,kw_469,0.,0.,0,N_vam(pintz,numContinuousStateVars)},
+		{"discrete_design_range",0x19,8,5,0,kw_470,0.,0.,0,N_vam(pintz,numDiscreteDesRangeVars)},
+		{"discrete_design_set",8,3,6,0,kw_476},
+		{"discrete_interval_uncertain",0x19,9,27,0,kw_477,0.,0.,0,N_vam(pintz,numDiscreteIntervalUncVars)},
+		{"discrete_state_range",0x19,8,30,0,kw_478,0.,0.,0,N_vam(pintz,numDiscreteStateRangeVars)},
+		{"discrete_state_set",8,3,31,0,kw_482},
+		{"discrete_uncertain_range",0x11,9,27,0,kw_477,0.,0.,-3,N_vam(pintz,numDiscreteIntervalUncVars)},
+		{"discrete_uncertain_set",8,3,28,0,kw_486},
+		{"exponential_uncertain",0x19,5,12,0,kw_487,0.,0.,0,N_vam(pintz,numExponentialUncVars)},
+		{"frechet_uncertain",0x19,7,16,0,kw_488,0.,0.,0,N_vam(pintz,numFrechetUncVars)},
+		{"gamma_uncertain",0x19,7,14,0,kw_489,0.,0.,0,N_vam(pintz,numGammaUncVars)},
+		{"geometric_uncertain",0x19,4,22,0,kw_490,0.,0.,0,N_vam(pintz,numGeometricUncVars)},
+		{"gumbel_uncertain",0x19,7,15,0,kw_491,0.,0.,0,N_vam(pintz,numGumbelUncVars)},
+		{"histogram_bin_uncertain",0x19,11,18,0,kw_492,0.,0.,0,N_vam(pintz,numHistogramBinUncVars)},
+		{"histogram_point_uncertain",8,3,24,0,kw_496},
+		{"hypergeometric_uncertain",0x19,5,23,0,kw_497,0.,0.,0,N_vam(pintz,numHyperGeomUncVars)},
 		{"id_variables",11,0,1,0,0,0.,0.,0,N_vam(str,idVariables)},
-		{"interval_uncertain",0x11,10,26,0,kw_464,0.,0.,-18,N_vam(pintz,numContinuousIntervalUncVars)},
+		{"interval_uncertain",0x11,10,26,0,kw_468,0.,0.,-18,N_vam(pintz,numContinuousIntervalUncVars)},
 		{"linear_equality_constraint_matrix",14,0,37,0,0,0.,0.,0,N_vam(rvec,linearEqConstraintCoeffs)},
 		{"linear_equality_scale_types",15,0,39,0,0,0.,0.,0,N_vam(strL,linearEqScaleTypes)},
 		{"linear_equality_scales",14,0,40,0,0,0.,0.,0,N_vam(rvec,linearEqScales)},
@@ -3379,25 +3450,25 @@ static KeyWord
 		{"linear_inequality_scale_types",15,0,35,0,0,0.,0.,0,N_vam(strL,linearIneqScaleTypes)},
 		{"linear_inequality_scales",14,0,36,0,0,0.,0.,0,N_vam(rvec,linearIneqScales)},
 		{"linear_inequality_upper_bounds",14,0,34,0,0,0.,0.,0,N_vam(rvec,linearIneqUpperBnds)},
-		{"lognormal_uncertain",0x19,11,8,0,kw_496,0.,0.,0,N_vam(pintz,numLognormalUncVars)},
-		{"loguniform_uncertain",0x19,7,10,0,kw_497,0.,0.,0,N_vam(pintz,numLoguniformUncVars)},
+		{"lognormal_uncertain",0x19,11,8,0,kw_500,0.,0.,0,N_vam(pintz,numLognormalUncVars)},
+		{"loguniform_uncertain",0x19,7,10,0,kw_501,0.,0.,0,N_vam(pintz,numLoguniformUncVars)},
 		{"mixed",8,0,3,0,0,0.,0.,0,N_vam(type,varsDomain_MIXED_DOMAIN)},
-		{"negative_binomial_uncertain",0x19,5,21,0,kw_498,0.,0.,0,N_vam(pintz,numNegBinomialUncVars)},
-		{"normal_uncertain",0x19,11,7,0,kw_499,0.,0.,0,N_vam(pintz,numNormalUncVars)},
-		{"poisson_uncertain",0x19,3,19,0,kw_500,0.,0.,0,N_vam(pintz,numPoissonUncVars)},
+		{"negative_binomial_uncertain",0x19,5,21,0,kw_502,0.,0.,0,N_vam(pintz,numNegBinomialUncVars)},
+		{"normal_uncertain",0x19,11,7,0,kw_503,0.,0.,0,N_vam(pintz,numNormalUncVars)},
+		{"poisson_uncertain",0x19,3,19,0,kw_504,0.,0.,0,N_vam(pintz,numPoissonUncVars)},
 		{"relaxed",8,0,3,0,0,0.,0.,0,N_vam(type,varsDomain_RELAXED_DOMAIN)},
-		{"triangular_uncertain",0x19,9,11,0,kw_501,0.,0.,0,N_vam(pintz,numTriangularUncVars)},
+		{"triangular_uncertain",0x19,9,11,0,kw_505,0.,0.,0,N_vam(pintz,numTriangularUncVars)},
 		{"uncertain_correlation_matrix",14,0,25,0,0,0.,0.,0,N_vam(newrvec,Var_Info_ucm)},
-		{"uniform_uncertain",0x19,7,9,0,kw_502,0.,0.,0,N_vam(pintz,numUniformUncVars)},
-		{"weibull_uncertain",0x19,7,17,0,kw_503,0.,0.,0,N_vam(pintz,numWeibullUncVars)}
+		{"uniform_uncertain",0x19,7,9,0,kw_506,0.,0.,0,N_vam(pintz,numUniformUncVars)},
+		{"weibull_uncertain",0x19,7,17,0,kw_507,0.,0.,0,N_vam(pintz,numWeibullUncVars)}
 		},
-	kw_505[6] = {
+	kw_509[6] = {
 		{"environment",0x108,15,1,1,kw_12,0.,0.,0,NIDRProblemDescDB::env_start},
 		{"interface",0x308,11,5,5,kw_28,0.,0.,0,N_ifm3(start,0,stop)},
-		{"method",0x308,89,2,2,kw_369,0.,0.,0,N_mdm3(start,0,stop)},
-		{"model",8,12,3,3,kw_433,0.,0.,0,N_mom3(start,0,stop)},
-		{"responses",0x308,19,6,6,kw_459,0.,0.,0,N_rem3(start,0,stop)},
-		{"variables",0x308,43,4,4,kw_504,0.,0.,0,N_vam3(start,0,stop)}
+		{"method",0x308,89,2,2,kw_371,0.,0.,0,N_mdm3(start,0,stop)},
+		{"model",8,12,3,3,kw_437,0.,0.,0,N_mom3(start,0,stop)},
+		{"responses",0x308,19,6,6,kw_463,0.,0.,0,N_rem3(start,0,stop)},
+		{"variables",0x308,43,4,4,kw_508,0.,0.,0,N_vam3(start,0,stop)}
 		};
 
 } // namespace Dakota
@@ -3405,7 +3476,7 @@ static KeyWord
 #ifdef __cplusplus
 extern "C" {
 #endif
-KeyWord Dakota_Keyword_Top = {"KeywordTop",0,6,0,0,Dakota::kw_505};
+KeyWord Dakota_Keyword_Top = {"KeywordTop",0,6,0,0,Dakota::kw_509};
 #ifdef __cplusplus
 }
 #endif
@@ -35,8 +35,10 @@ NestedModel::NestedModel(ProblemDescDB& problem_db):
 		   true, // peer 1 must assign jobs to peers 2-n
 		   problem_db.get_int("model.nested.iterator_servers"),
 		   problem_db.get_int("model.nested.processors_per_iterator"),
-		   problem_db.get_short("model.nested.iterator_scheduling")),
+		   problem_db.get_short("model.nested.iterator_scheduling"),
+		   problem_db.get_int("model.nested.local_iterator_servers")),
   subIteratorJobCntr(0),
+  memoizeResults(problem_db.get_bool("model.nested.memoize_results")),
   optInterfacePointer(problem_db.get_string("model.interface_pointer")),
   subMethodPointer(problem_db.get_string("model.nested.sub_method_pointer"))
 {
@@ -623,10 +625,13 @@ derived_set_communicators(ParLevLIter pl_iter, int max_eval_concurrency,
     }
 
     // update asynchEvalFlag & evaluationCapacity based on subIteratorSched
-    if (subIteratorSched.messagePass)
+    int local_servers = subIteratorSched.local_server_concurrency();
+    if (subIteratorSched.messagePass || local_servers > 1)
       asynchEvalFlag = true;
     if (subIteratorSched.numIteratorServers > evaluationCapacity)
       evaluationCapacity = subIteratorSched.numIteratorServers;
+    if (local_servers > evaluationCapacity)
+      evaluationCapacity = local_servers;
   }
 }
 
@@ -1343,6 +1348,19 @@ void NestedModel::derived_evaluate(const ActiveSet& set)
     interface_response_overlay(optInterfaceResponse, currentResponse);
   }
 
+  // reuse sub-iterator results from a previous evaluation at these variables
+  Response memo_resp;
+  if (sub_iterator_map && memoizeResults &&
+      lookup_sub_iterator_results(currentVariables, sub_iterator_set,
+				  memo_resp)) {
+    Cout << "\n-------------------------------------------------\nNestedModel "
+	 << "Evaluation " << std::setw(4) << nestedModelEvalCntr << ": reusing "
+	 << "sub_iterator results\n---------------------------------------------"
+	 << "----\n";
+    iterator_response_overlay(memo_resp, currentResponse);
+    sub_iterator_map = false;
+  }
+
   if (sub_iterator_map) {
     //++subIteratorJobCntr; // does not encompass blocking evals
 
@@ -1400,6 +1418,8 @@ void NestedModel::derived_evaluate(const ActiveSet& set)
 
     const Response& sub_iter_resp = subIterator.response_results();
     Cout << "\nActive response data from sub_iterator:\n"<< sub_iter_resp<<'\n';
+    if (memoizeResults)
+      cache_sub_iterator_results(currentVariables, sub_iter_resp);
     // map subIterator results into their contribution to currentResponse
     iterator_response_overlay(sub_iter_resp, currentResponse);
   }
@@ -1443,6 +1463,20 @@ void NestedModel::derived_evaluate_nowait(const ActiveSet& set)
     optInterfaceIdMap[optionalInterface.evaluation_id()] = nestedModelEvalCntr;
   }
 
+  // reuse sub-iterator results from a previous evaluation at these variables;
+  // these are mapped in derived_synchronize() along with the queued jobs
+  Response memo_resp;
+  if (sub_iterator_map && memoizeResults &&
+      lookup_sub_iterator_results(currentVariables, sub_iterator_set,
+				  memo_resp)) {
+    Cout << "\n-------------------------------------------------\n"
+	 << "NestedModel Evaluation " << std::setw(4) << nestedModelEvalCntr 
+	 << ": reusing sub_iterator results"
+	 << "\n-------------------------------------------------\n";
+    memoizedResponseMap[nestedModelEvalCntr] = memo_resp;
+    sub_iterator_map = false;
+  }
+
   if (sub_iterator_map) {
     ++subIteratorJobCntr;
 
@@ -1516,9 +1550,12 @@ const IntResponseMap& NestedModel::derived_synchronize()
     subIteratorSched.schedule_iterators(*this, subIterator);
     // overlay response sets (no rekey or cache necessary)
     for (PRPQueueIter q_it=subIteratorPRPQueue.begin();
-	 q_it!=subIteratorPRPQueue.end(); ++q_it)
+	 q_it!=subIteratorPRPQueue.end(); ++q_it) {
       iterator_response_overlay(q_it->response(),
 				nested_response(q_it->eval_id()));
+      if (memoizeResults)
+	cache_sub_iterator_results(q_it->variables(), q_it->response());
+    }
     // clear sub-iterator jobs
     subIteratorPRPQueue.clear();
     // Reset bookkeeping used in IteratorScheduler callbacks (e.g.,
@@ -1528,6 +1565,12 @@ const IntResponseMap& NestedModel::derived_synchronize()
     subIteratorIdMap.clear(); subIteratorJobCntr = 0;
   }
 
+  // overlay sub-iterator results reused within derived_evaluate_nowait()
+  for (r_cit=memoizedResponseMap.begin(); r_cit!=memoizedResponseMap.end();
+       ++r_cit)
+    iterator_response_overlay(r_cit->second, nested_response(r_cit->first));
+  memoizedResponseMap.clear();
+
   //nestedVarsMap.clear();
   for (r_cit=nestedResponseMap.begin(); r_cit!=nestedResponseMap.end(); ++r_cit)
     Cout << "\n---------------------------\nNestedModel Evaluation "
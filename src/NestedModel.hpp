@@ -277,6 +277,14 @@ private:
   /// update subModel with current variable values/bounds/labels
   void update_sub_model(const Variables& vars, const Constraints& cons);
 
+  /// retrieve sub-iterator results for vars and set from subIteratorCache;
+  /// returns false if no results are available
+  bool lookup_sub_iterator_results(const Variables& vars,
+				   const ActiveSet& set, Response& sub_resp);
+  /// add sub-iterator results for vars to subIteratorCache
+  void cache_sub_iterator_results(const Variables& vars,
+				  const Response& sub_resp);
+
   //
   //- Heading: Data members
   //
@@ -321,6 +329,16 @@ private:
   /// (different when subIterator evaluations do not occur on every nested
   /// model evaluation due to variable ASV content)
   IntIntMap subIteratorIdMap;
+  /// flag for reusing sub-iterator results when the nested model is
+  /// evaluated again at the same variables
+  bool memoizeResults;
+  /// sub-iterator results from completed jobs, keyed by the nested model
+  /// variables and the sub-iterator method id
+  PRPCache subIteratorCache;
+  /// sub-iterator results retrieved from subIteratorCache within
+  /// derived_evaluate_nowait(), keyed by nested model counter, that are
+  /// mapped within derived_synchronize()
+  IntResponseMap memoizedResponseMap;
   /// number of sub-iterator response functions prior to mapping
   size_t numSubIterFns;
   /// number of top-level inequality constraints mapped from the
@@ -585,6 +603,32 @@ inline Response& NestedModel::nested_response(int nested_cntr)
 }
 
 
+inline bool NestedModel::
+lookup_sub_iterator_results(const Variables& vars, const ActiveSet& set,
+			    Response& sub_resp)
+{
+  // set_compare() within lookup_by_val() allows reuse of results for a
+  // subset of a previously requested set
+  PRPCacheHIter cache_it
+    = lookup_by_val(subIteratorCache, subIterator.method_id(), vars, set);
+  if (cache_it == subIteratorCache.get<hashed>().end())
+    return false;
+  sub_resp = subIterator.response_results().copy();
+  sub_resp.active_set(set);
+  sub_resp.update(cache_it->response());
+  return true;
+}
+
+
+inline void NestedModel::
+cache_sub_iterator_results(const Variables& vars, const Response& sub_resp)
+{
+  // deep copy isolates the cached data from subsequent sub-iterator runs
+  ParamResponsePair sub_pair(vars, subIterator.method_id(), sub_resp, true);
+  subIteratorCache.insert(sub_pair);
+}
+
+
 /** In the OUU case,
 \verbatim
 optionalInterface fns = {f}, {g} (deterministic primary functions, constraints)
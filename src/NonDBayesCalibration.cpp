@@ -39,11 +39,18 @@
 #include "dakota_data_util.hpp"
 //#include "dakota_tabular_io.hpp"
 #include "DiscrepancyCorrection.hpp"
+#ifdef DAKOTA_HAVE_PTHREADS
+#include <pthread.h>
+#include <unistd.h> // for sysconf
+#endif
 
 static const char rcsId[]="@(#) $Id$";
 
 namespace Dakota {
 
+/// largest depth of the prefetching proposal tree (2^d - 1 concurrent evals)
+const int MAX_PREFETCH_DEPTH = 10;
+
 // initialization of statics
 NonDBayesCalibration* NonDBayesCalibration::nonDBayesInstance(NULL);
 
@@ -56,7 +63,8 @@ NonDBayesCalibration(ProblemDescDB& problem_db, Model& model):
   emulatorType(probDescDB.get_short("method.nond.emulator")),
   mcmcModelHasSurrogate(false),
   mapOptAlgOverride(probDescDB.get_ushort("method.nond.pre_solve_method")),
-  chainSamples(0), chainCycles(1),
+  chainSamples(0), chainCycles(1), chainBlocks(1),
+  prefetchDepth(probDescDB.get_int("method.nond.mcmc_prefetch_depth")),
   randomSeed(probDescDB.get_int("method.random_seed")),
   mcmcDerivOrder(1),
   adaptExpDesign(probDescDB.get_bool("method.nond.adapt_exp_design")),
@@ -228,7 +236,13 @@ NonDBayesCalibration(ProblemDescDB& problem_db, Model& model):
   // TODO: will need to be resized when data changes
   construct_map_optimizer();
 
-  int mcmc_concurrency = 1; // prior to concurrent chains
+  // prefetching evaluates the 2^d - 1 proposals of a depth d tree at once
+  if (prefetchDepth > MAX_PREFETCH_DEPTH) {
+    Cerr << "\nWarning: prefetch_depth reduced to the maximum of "
+	 << MAX_PREFETCH_DEPTH << '.' << std::endl;
+    prefetchDepth = MAX_PREFETCH_DEPTH;
+  }
+  int mcmc_concurrency = (prefetchDepth) ? (1 << prefetchDepth) - 1 : 1;
   maxEvalConcurrency *= mcmc_concurrency;
 }
 
@@ -825,6 +839,13 @@ void NonDBayesCalibration::calibrate_to_hifi()
         }
       }
 
+      // the posterior parameter samples are shared by all candidates, so
+      // their kd-tree is built once and reused by each MI estimate
+      std::vector<ANNpoint> mi_chain_pts;
+      ann_point_array(mi_chain, 0, mi_chain_pts);
+      ANNkd_tree* mi_chain_tree
+	= new ANNkd_tree(&mi_chain_pts[0], num_filtered, numContinuousVars);
+
       // BMA: You can now use acceptanceChain/acceptedFnVals, though
       // need to be careful about what subset for this chain run (may
       // need indices to track)
@@ -860,7 +881,8 @@ void NonDBayesCalibration::calibrate_to_hifi()
           Teuchos::setCol(col_vec, j, Xmatrix);
         }
         // calculate the mutual information b/w post theta and lofi responses
-        Real MI = knn_mutual_info(Xmatrix, numContinuousVars, numFunctions);
+        Real MI = knn_mutual_info(Xmatrix, numContinuousVars, numFunctions,
+				  mi_chain_tree);
 	if (outputLevel >= DEBUG_OUTPUT) {
 	  Cout << "\n----------------------------------------------\n";
           Cout << "Experimental Design Iteration "<<num_hifi+1<<" Progress";
@@ -881,6 +903,8 @@ void NonDBayesCalibration::calibrate_to_hifi()
           }
         }
       } // end for over the number of candidates
+      delete mi_chain_tree;
+      annClose();
   
       // RUN HIFI MODEL WITH NEW POINT
       // TODO: add multiple points up to concurrency
@@ -1074,6 +1098,47 @@ void NonDBayesCalibration::build_model_discrepancy()
   export_discrepancy(configpred_mat);
 }
 
+/// write the header of an export of variables and additional values,
+/// binary or text per tabular_format
+static void write_export_header(std::ostream& s,
+				TabularIO::BinaryTabularWriter& binary_writer,
+				const Variables& vars,
+				const StringArray& val_labels,
+				const String& counter_label,
+				unsigned short tabular_format)
+{
+  if (tabular_format & TABULAR_BINARY)
+    binary_writer.write_header(s, vars, val_labels, counter_label);
+  else {
+    TabularIO::write_header_tabular(s, vars, val_labels, counter_label,
+				    tabular_format);
+    s << std::setprecision(write_precision)
+      << std::resetiosflags(std::ios::floatfield);
+  }
+}
+
+
+/// write a row of an export of variables and additional values,
+/// binary or text per tabular_format
+static void write_export_row(std::ostream& s,
+			     TabularIO::BinaryTabularWriter& binary_writer,
+			     const Variables& vars, const String& iface_id,
+			     const RealVector& vals, size_t counter,
+			     unsigned short tabular_format)
+{
+  if (tabular_format & TABULAR_BINARY)
+    binary_writer.write_row(s, vars, iface_id, vals, counter);
+  else {
+    TabularIO::write_leading_columns(s, counter, iface_id, tabular_format);
+    vars.write_tabular(s);
+    size_t j, wpp4 = write_precision+4, num_vals = vals.length();
+    for (j=0; j<num_vals; ++j)
+      s << std::setw(wpp4) << vals[j] << ' ';
+    s << '\n';
+  }
+}
+
+
 void NonDBayesCalibration::export_discrepancy(RealMatrix& 
     			   pred_config_mat)
 {
@@ -1083,7 +1148,7 @@ void NonDBayesCalibration::export_discrepancy(RealMatrix&
   Variables output_vars = mcmcModel.current_variables().copy(); 
   const StringArray& resp_labels = 
     		     mcmcModel.current_response().function_labels();
-  size_t wpp4 = write_precision+4;
+  TabularIO::BinaryTabularWriter binary_writer;
 
   // Discrepancy responses file output
   unsigned short discrep_format = exportDiscrepFormat;
@@ -1092,26 +1157,22 @@ void NonDBayesCalibration::export_discrepancy(RealMatrix&
     exportDiscrepFile;
   std::ofstream discrep_stream;
   TabularIO::open_file(discrep_stream, discrep_filename, 
-      		       "NonDBayesCalibration discrepancy response export");
+      		       "NonDBayesCalibration discrepancy response export",
+		       discrep_format & TABULAR_BINARY);
 
-  TabularIO::write_header_tabular(discrep_stream, output_vars, resp_labels, 
-      				  "config_id", discrep_format);
-  discrep_stream << std::setprecision(write_precision)
-    		 << std::resetiosflags(std::ios::floatfield);
+  write_export_header(discrep_stream, binary_writer, output_vars, resp_labels,
+		      "config_id", discrep_format);
   for (int i = 0; i < num_pred; ++i) {
-    TabularIO::write_leading_columns(discrep_stream, i+1, 
-				     mcmcModel.interface_id(), 
-				     discrep_format);
     const RealVector& config_vec = Teuchos::getCol(Teuchos::View, 
 						   pred_config_mat, i);
     Model::inactive_variables(config_vec, mcmcModel);
     output_vars = mcmcModel.current_variables().copy();
-    output_vars.write_tabular(discrep_stream);
-    const RealVector& resp_vec = discrepancyResponses[i].function_values();
-    for (size_t j = 0; j < numFunctions; ++j) 
-      discrep_stream << std::setw(wpp4) << resp_vec[j] << ' ';
-    discrep_stream << '\n';
+    write_export_row(discrep_stream, binary_writer, output_vars,
+		     mcmcModel.interface_id(),
+		     discrepancyResponses[i].function_values(), i+1,
+		     discrep_format);
   }
+  binary_writer.flush(discrep_stream);
   TabularIO::close_file(discrep_stream, discrep_filename, 
       	 		"NonDBayesCalibration discrepancy response export");
 
@@ -1122,26 +1183,22 @@ void NonDBayesCalibration::export_discrepancy(RealMatrix&
     exportCorrModelFile;
   std::ofstream corrmodel_stream;
   TabularIO::open_file(corrmodel_stream, corrmodel_filename, 
-      		       "NonDBayesCalibration corrected model response export");
+      		       "NonDBayesCalibration corrected model response export",
+		       corrmodel_format & TABULAR_BINARY);
 
-  TabularIO::write_header_tabular(corrmodel_stream, output_vars, resp_labels, 
-      				  "config_id", corrmodel_format);
-  corrmodel_stream << std::setprecision(write_precision)
-    		 << std::resetiosflags(std::ios::floatfield);
+  write_export_header(corrmodel_stream, binary_writer, output_vars,
+		      resp_labels, "config_id", corrmodel_format);
   for (int i = 0; i < num_pred; ++i) {
-    TabularIO::write_leading_columns(corrmodel_stream, i+1, 
-				     mcmcModel.interface_id(), 
-				     corrmodel_format);
     const RealVector& config_vec = Teuchos::getCol(Teuchos::View, 
 						   pred_config_mat, i);
     Model::inactive_variables(config_vec, mcmcModel);
     output_vars = mcmcModel.current_variables().copy();
-    output_vars.write_tabular(corrmodel_stream);
-    const RealVector& resp_vec = correctedResponses[i].function_values();
-    for (size_t j = 0; j < numFunctions; ++j) 
-      corrmodel_stream << std::setw(wpp4) << resp_vec[j] << ' ';
-    corrmodel_stream << '\n';
+    write_export_row(corrmodel_stream, binary_writer, output_vars,
+		     mcmcModel.interface_id(),
+		     correctedResponses[i].function_values(), i+1,
+		     corrmodel_format);
   }
+  binary_writer.flush(corrmodel_stream);
   TabularIO::close_file(corrmodel_stream, corrmodel_filename, 
       	 		"NonDBayesCalibration corrected model response export");
 
@@ -1152,7 +1209,8 @@ void NonDBayesCalibration::export_discrepancy(RealMatrix&
   //discrep_filename = "dakota_corrected_variances.dat";
   std::ofstream discrepvar_stream;
   TabularIO::open_file(discrepvar_stream, var_filename, 
-      		       "NonDBayesCalibration corrected model variance export");
+      		       "NonDBayesCalibration corrected model variance export",
+		       discrepvar_format & TABULAR_BINARY);
 
   RealMatrix corrected_var_transpose(correctedVariances, Teuchos::TRANS);
   StringArray var_labels(numFunctions);
@@ -1161,25 +1219,20 @@ void NonDBayesCalibration::export_discrepancy(RealMatrix&
     s << resp_labels[i] << "_var";
     var_labels[i] = s.str();
   }
-  TabularIO::write_header_tabular(discrepvar_stream, output_vars, var_labels, 
-      				  "pred_config", discrepvar_format);
-  discrepvar_stream << std::setprecision(write_precision)
-    		 << std::resetiosflags(std::ios::floatfield);
+  write_export_header(discrepvar_stream, binary_writer, output_vars,
+		      var_labels, "pred_config", discrepvar_format);
   for (int i = 0; i < num_pred; ++i) {
-    TabularIO::write_leading_columns(discrepvar_stream, i+1, 
-				     mcmcModel.interface_id(), 
-				     discrepvar_format);
     const RealVector& config_vec = Teuchos::getCol(Teuchos::View, 
 						   pred_config_mat, i);
     Model::inactive_variables(config_vec, mcmcModel);
     output_vars = mcmcModel.current_variables().copy();
-    output_vars.write_tabular(discrepvar_stream);
     const RealVector& var_vec = Teuchos::getCol(Teuchos::View, 
 						corrected_var_transpose, i);
-    for (size_t j = 0; j < numFunctions; ++j) 
-      discrepvar_stream << std::setw(wpp4) << var_vec[j] << ' ';
-    discrepvar_stream << '\n';
+    write_export_row(discrepvar_stream, binary_writer, output_vars,
+		     mcmcModel.interface_id(), var_vec, i+1,
+		     discrepvar_format);
   }
+  binary_writer.flush(discrepvar_stream);
   TabularIO::close_file(discrepvar_stream, var_filename, 
       	 		"NonDBayesCalibration corrected model variance export");
 }
@@ -1232,6 +1285,185 @@ log_likelihood(const RealVector& residuals, const RealVector& all_params)
 }
 
 
+/** Random walk Metropolis in which the likelihoods for the next
+    prefetchDepth steps are evaluated concurrently (prefetching MCMC).
+    Starting from the current state, the proposals along all
+    accept/reject paths of the next d steps form a binary tree of
+    2^d - 1 nodes: node n proposes from its state, its accept child 2n
+    starts from the proposal of n, and its reject child 2n+1 shares the
+    state of n.  All proposals are drawn and scheduled on residualModel
+    together; walking the tree with the pre-drawn uniforms then
+    advances the chain by d steps with exactly the Metropolis
+    transition probabilities.  Proposals outside [lower, upper] or of
+    zero prior density are rejected without evaluation.  Without
+    asynchronous evaluation support, only the proposals on the path
+    actually taken are evaluated.
+
+    The chain is sized by the caller (num_params x num_samples) and
+    starts from init_pt; log_likes returns the log-likelihood of each
+    chain sample. */
+void NonDBayesCalibration::
+prefetch_metropolis(const RealVector& init_pt, const RealSymMatrix& prop_cov,
+		    const RealVector& lower, const RealVector& upper,
+		    boost::mt19937& rng, RealMatrix& chain,
+		    RealVector& log_likes)
+{
+  int i, j, n, num_params = init_pt.length(), num_samples = chain.numCols();
+  bool asynch = residualModel.asynch_flag();
+  Real neg_inf = -std::numeric_limits<Real>::infinity();
+
+  // lower triangular Cholesky factor of the proposal covariance
+  RealSymMatrix cov_factor(prop_cov);
+  Teuchos::SerialSpdDenseSolver<int, Real> cov_solver;
+  cov_solver.setMatrix( Teuchos::rcp(&cov_factor, false) );
+  if (cov_solver.factor()) {
+    Cerr << "Error: proposal covariance for prefetching Metropolis is not "
+	 << "positive definite." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+  RealMatrix prop_chol(num_params, num_params); // init to 0
+  for (i=0; i<num_params; ++i)
+    for (j=0; j<=i; ++j)
+      prop_chol(i, j) = cov_factor(i, j); // assign lower triangle
+
+  boost::normal_distribution<Real> std_normal;
+  boost::variate_generator<boost::mt19937&, boost::normal_distribution<Real> >
+    normal_gen(rng, std_normal);
+  boost::uniform_real<Real> std_uniform;
+  boost::variate_generator<boost::mt19937&, boost::uniform_real<Real> >
+    uniform_gen(rng, std_uniform);
+
+  // current state of the chain
+  RealVector curr_pt(init_pt);
+  residualModel.continuous_variables(curr_pt);
+  residualModel.evaluate();
+  Real curr_log_like
+    = log_likelihood(residualModel.current_response().function_values(),
+		     curr_pt),
+    curr_log_prior = log_prior_density(curr_pt);
+  Teuchos::setCol(curr_pt, 0, chain);
+  log_likes[0] = curr_log_like;
+
+  // tree storage, indexed by node number (entry 0 is unused): the
+  // state of node n is the proposal of node node_state[n], with 0
+  // denoting the current state of the chain
+  int max_nodes = 1 << prefetchDepth;
+  RealMatrix proposals(num_params, max_nodes, false);
+  RealVector prop_log_like(max_nodes), prop_log_prior(max_nodes),
+    log_unif(max_nodes), z(num_params, false);
+  IntArray node_state(max_nodes);
+  BoolDeque in_support(max_nodes), evaluated(max_nodes);
+  IntIntMap eval_nodes;
+  size_t num_accept = 0, num_evals = 0;
+
+  int s = 1;
+  while (s < num_samples) {
+    // depth of this tree is truncated at the end of the chain
+    int depth = std::min(prefetchDepth, num_samples - s),
+      num_nodes = (1 << depth) - 1;
+
+    // draw the proposals of all nodes and schedule the admissible ones
+    for (n=1; n<=num_nodes; ++n) {
+      node_state[n] = (n == 1) ? 0 : ((n % 2) ? node_state[n/2] : n/2);
+      const Real* state_n = (node_state[n]) ?
+	proposals[node_state[n]] : curr_pt.values();
+      for (j=0; j<num_params; ++j)
+	z[j] = normal_gen();
+      RealVector prop_n(Teuchos::View, proposals[n], num_params);
+      for (i=0; i<num_params; ++i) {
+	Real delta = 0.;
+	for (j=0; j<=i; ++j)
+	  delta += prop_chol(i, j) * z[j];
+	prop_n[i] = state_n[i] + delta;
+      }
+      log_unif[n] = std::log(uniform_gen());
+
+      in_support[n] = true;
+      for (i=0; i<num_params; ++i)
+	if (prop_n[i] < lower[i] || prop_n[i] > upper[i])
+	  { in_support[n] = false; break; }
+      prop_log_prior[n] = (in_support[n]) ? log_prior_density(prop_n) : neg_inf;
+      if (prop_log_prior[n] == neg_inf)
+	in_support[n] = false;
+      evaluated[n] = false;
+      if (asynch && in_support[n]) {
+	residualModel.continuous_variables(prop_n);
+	residualModel.evaluate_nowait();
+	eval_nodes[residualModel.evaluation_id()] = n;
+      }
+    }
+
+    // collect the likelihoods of the entire tree
+    if (asynch && !eval_nodes.empty()) {
+      const IntResponseMap& resp_map = residualModel.synchronize();
+      IntRespMCIter r_cit;
+      for (IntIntMIter e_it=eval_nodes.begin(); e_it!=eval_nodes.end();
+	   ++e_it) {
+	r_cit = resp_map.find(e_it->first);
+	if (r_cit == resp_map.end()) {
+	  Cerr << "Error: response for evaluation " << e_it->first
+	       << " missing from prefetching Metropolis batch." << std::endl;
+	  abort_handler(METHOD_ERROR);
+	}
+	n = e_it->second;
+	RealVector prop_n(Teuchos::View, proposals[n], num_params);
+	prop_log_like[n]
+	  = log_likelihood(r_cit->second.function_values(), prop_n);
+	evaluated[n] = true; ++num_evals;
+      }
+      eval_nodes.clear();
+    }
+
+    // walk the tree along the accept/reject decisions
+    int state = 0; // node whose proposal is the current state; 0 = curr_pt
+    Real state_log_post = curr_log_like + curr_log_prior;
+    for (n=1; n<(1 << depth); ++s) {
+      bool accept = false;
+      if (in_support[n]) {
+	if (!evaluated[n]) {
+	  RealVector prop_n(Teuchos::View, proposals[n], num_params);
+	  residualModel.continuous_variables(prop_n);
+	  residualModel.evaluate();
+	  prop_log_like[n] = log_likelihood(
+	    residualModel.current_response().function_values(), prop_n);
+	  evaluated[n] = true; ++num_evals;
+	}
+	Real prop_log_post = prop_log_like[n] + prop_log_prior[n];
+	accept = (log_unif[n] < prop_log_post - state_log_post);
+	if (accept)
+	  { state = n; state_log_post = prop_log_post; ++num_accept; }
+      }
+      if (state) {
+	RealVector state_pt(Teuchos::View, proposals[state], num_params);
+	Teuchos::setCol(state_pt, s, chain);
+	log_likes[s] = prop_log_like[state];
+      }
+      else {
+	Teuchos::setCol(curr_pt, s, chain);
+	log_likes[s] = curr_log_like;
+      }
+      if (outputLevel >= DEBUG_OUTPUT)
+	Cout << "Prefetching Metropolis step " << s << ": proposal node " << n
+	     << (accept ? " accepted" : " rejected") << '\n';
+      n = (accept) ? 2*n : 2*n + 1;
+    }
+
+    // advance the current state to the end of the walked path
+    if (state) {
+      copy_data(proposals[state], num_params, curr_pt);
+      curr_log_like  = prop_log_like[state];
+      curr_log_prior = prop_log_prior[state];
+    }
+  }
+
+  if (outputLevel >= NORMAL_OUTPUT)
+    Cout << "Prefetching Metropolis chain completed: " << num_accept
+	 << " of " << num_samples - 1 << " proposals accepted using "
+	 << num_evals << " likelihood evaluations with depth "
+	 << prefetchDepth << ".\n";
+}
+
+
 void NonDBayesCalibration::prior_cholesky_factorization()
 {
   // factorization to be performed offline (init time) and used online
@@ -1479,8 +1711,8 @@ void NonDBayesCalibration::compute_statistics()
   // mcmcfnvals is either acceptedFnVals or filteredFnVals
   int num_skip = (subSamplingPeriod > 0) ? subSamplingPeriod : 1;
   int burnin = (burnInSamples > 0) ? burnInSamples : 0;
-  int num_samples = acceptanceChain.numCols();
-  int num_filtered = int((num_samples-burnin)/num_skip);
+  int num_samples = acceptanceChain.numCols() / chainBlocks;
+  int num_filtered = chainBlocks * int((num_samples-burnin)/num_skip);
 
   RealMatrix filtered_chain;
   if (burnInSamples > 0 || num_skip > 1) {
@@ -1526,14 +1758,17 @@ void NonDBayesCalibration::filter_chain(RealMatrix& acceptance_chain,
 {
   int burnin = (burnInSamples > 0) ? burnInSamples : 0;
   int num_skip = (subSamplingPeriod > 0) ? subSamplingPeriod : 1;
-  int num_samples = acceptance_chain.numCols();
+  int num_samples = acceptance_chain.numCols() / chainBlocks;
   int j = 0;
-  for (int i = burnin; i < num_samples; ++i) {
-    if (i % num_skip == 0) {
-      RealVector param_vec = Teuchos::getCol(Teuchos::View, 
-	  				acceptance_chain, i);
-      Teuchos::setCol(param_vec, j, filtered_chain);
-      ++j;
+  for (int b = 0; b < chainBlocks; ++b) {
+    int offset = b * num_samples;
+    for (int i = burnin; i < num_samples; ++i) {
+      if (i % num_skip == 0) {
+	RealVector param_vec = Teuchos::getCol(Teuchos::View, 
+					       acceptance_chain, offset + i);
+	Teuchos::setCol(param_vec, j, filtered_chain);
+	++j;
+      }
     }
   }
 }
@@ -1543,16 +1778,19 @@ void NonDBayesCalibration::filter_fnvals(RealMatrix& accepted_fn_vals,
 {
   int burnin = (burnInSamples > 0) ? burnInSamples : 0;
   int num_skip = (subSamplingPeriod > 0) ? subSamplingPeriod : 1;
-  int num_samples = accepted_fn_vals.numCols();
+  int num_samples = accepted_fn_vals.numCols() / chainBlocks;
   int j = 0;
-  for (int i = burnin; i < num_samples; ++i) {
-    if (i % num_skip == 0) {
-      RealVector col_vec = Teuchos::getCol(Teuchos::View, 
-	 	  			  accepted_fn_vals, i);
-      Teuchos::setCol(col_vec, j, filtered_fn_vals);
-      j++;
-     }
-   }
+  for (int b = 0; b < chainBlocks; ++b) {
+    int offset = b * num_samples;
+    for (int i = burnin; i < num_samples; ++i) {
+      if (i % num_skip == 0) {
+	RealVector col_vec = Teuchos::getCol(Teuchos::View, 
+					     accepted_fn_vals, offset + i);
+	Teuchos::setCol(col_vec, j, filtered_fn_vals);
+	j++;
+      }
+    }
+  }
 }
 
 void NonDBayesCalibration::compute_intervals()
@@ -1708,7 +1946,8 @@ export_chain(RealMatrix& filtered_chain, RealMatrix& filtered_fn_vals)
     exportMCMCFilename.empty() ? "dakota_mcmc_tabular.dat" : exportMCMCFilename;
   std::ofstream export_mcmc_stream;
   TabularIO::open_file(export_mcmc_stream, mcmc_filename,
-		       "NonDBayesCalibration chain export");
+		       "NonDBayesCalibration chain export",
+		       exportMCMCFormat & TABULAR_BINARY);
 
   // Use a Variables object for proper tabular formatting.
   // The residual model includes hyper-parameters, if present
@@ -1729,41 +1968,20 @@ export_chain(RealMatrix& filtered_chain, RealMatrix& filtered_fn_vals)
   }
   */
 
-  TabularIO::
-    write_header_tabular(export_mcmc_stream, output_vars, 
-			 resp_labels, "mcmc_id", exportMCMCFormat);
-
-  size_t wpp4 = write_precision+4;
-  export_mcmc_stream << std::setprecision(write_precision) 
-		     << std::resetiosflags(std::ios::floatfield);
+  TabularIO::BinaryTabularWriter binary_writer;
+  write_export_header(export_mcmc_stream, binary_writer, output_vars,
+		      resp_labels, "mcmc_id", exportMCMCFormat);
 
   int num_filtered = filtered_chain.numCols();
   for (int i=0; i<num_filtered; ++i) {
-    TabularIO::write_leading_columns(export_mcmc_stream, i+1,
-				     mcmcModel.interface_id(),
-				     exportMCMCFormat);
     RealVector accept_pt = Teuchos::getCol(Teuchos::View, filtered_chain, i);
     output_vars.continuous_variables(accept_pt);
-    output_vars.write_tabular(export_mcmc_stream);
     // Write function values to filtered_tabular
-    RealVector col_vec = Teuchos::getCol(Teuchos::View, filtered_fn_vals, i);
-    for (size_t j=0; j<numFunctions; ++j){
-      export_mcmc_stream << std::setw(wpp4) << col_vec[j] << ' ';
-    }      
-    // Write predicted values to filtered_tabular
-    // When outputting experimental responses 
-    /*
-    for (size_t j =0; j<num_exp; ++j){
-      for (size_t k = 0; k<numFunctions; ++k){
-	int col_index = j*num_filtered+i;
-        const RealVector& col_vec = Teuchos::getCol(Teuchos::View, 
-      				    predVals, col_index);
-  	export_mcmc_stream << std::setw(wpp4) << col_vec[k] << ' ';
-      }
-    }
-    */
-    export_mcmc_stream << '\n';
+    RealVector col_vec(Teuchos::View, filtered_fn_vals[i], numFunctions);
+    write_export_row(export_mcmc_stream, binary_writer, output_vars,
+		     mcmcModel.interface_id(), col_vec, i+1, exportMCMCFormat);
   }
+  binary_writer.flush(export_mcmc_stream);
 
   TabularIO::close_file(export_mcmc_stream, mcmc_filename,
 			"NonDQUESOBayesCalibration chain export");
@@ -2018,32 +2236,23 @@ Real NonDBayesCalibration::knn_kl_div(RealMatrix& distX_samples,
   			 //1st neighbor is self, so need k+1 for XtoX
   double eps = 0.0; //default ann error
    
-  // Copy distX samples into ANN data types
-  ANNpointArray dataX;
-  dataX = annAllocPts(NX, dim);
-  RealVector col(dim);
-  for (int i = 0; i < NX; i++){
-    col = Teuchos::getCol(Teuchos::View, distX_samples, i);
-    for (int j = 0; j < dim; j++){
-      dataX[i][j] = col[j];
-    }
-  } 
-  // Copy distY samples into ANN data types
-  ANNpointArray dataY;
-  dataY = annAllocPts(NY, dim);
-  for (int i = 0; i < NY; i++){
-    col = Teuchos::getCol(Teuchos::View, distY_samples, i);
-    for (int j = 0; j < dim; j++){
-      dataY[i][j] = col[j];
-    }
-  } 
-  
-  // calculate vector of kNN distances from dist1 to dist2
-  RealVector XtoYdistances(NX);
-  ann_dist(dataX, dataY, XtoYdistances, NX, NY, dim, k_vec_XY, eps);
-  // calculate vector of kNN distances from dist1 to itself
-  RealVector XtoXdistances(NX);
-  ann_dist(dataX, dataX, XtoXdistances, NX, NX, dim, k_vec_XX, eps);
+  // ANN points reference the sample columns in place
+  std::vector<ANNpoint> dataX, dataY;
+  ann_point_array(distX_samples, 0, dataX);
+  ann_point_array(distY_samples, 0, dataY);
+
+  // calculate vector of kNN distances from dist1 to dist2 and from
+  // dist1 to itself, querying each tree with the full batch of X points
+  RealVector XtoYdistances(NX), XtoXdistances(NX);
+  ANNkd_tree* kdTreeY = new ANNkd_tree(&dataY[0], NY, dim);
+  ann_batch_query(kdTreeY, &dataX[0], NX, NY, false, eps, k_vec_XY,
+		  XtoYdistances);
+  delete kdTreeY;
+  ANNkd_tree* kdTreeX = new ANNkd_tree(&dataX[0], NX, dim);
+  ann_batch_query(kdTreeX, &dataX[0], NX, NX, false, eps, k_vec_XX,
+		  XtoXdistances);
+  delete kdTreeX;
+  annClose();
   
   double log_sum = 0;
   double digamma_sum = 0;
@@ -2061,9 +2270,6 @@ Real NonDBayesCalibration::knn_kl_div(RealMatrix& distX_samples,
   Dkl_est = (double(dim)*log_sum + digamma_sum)/double(NX)
           + log( double(NY)/(double(NX)-1) );
 
-  annDeallocPts( dataX );
-  annDeallocPts( dataY );
-
   approxnn::normSelector::instance().reset();
 
   return Dkl_est;
@@ -2134,8 +2340,13 @@ void NonDBayesCalibration::mutual_info_buildX()
 
 }
 
+/** If kd_tree_X is passed, it must index the same X samples (the
+    leading dimX coordinates of the columns of Xmatrix, in order) and
+    is reused in place of a new tree, e.g., across design candidates
+    sharing the same parameter samples.  The caller then retains
+    ownership of it and is responsible for annClose(). */
 Real NonDBayesCalibration::knn_mutual_info(RealMatrix& Xmatrix, int dimX,
-    int dimY)
+    int dimY, ANNkd_tree* kd_tree_X)
 {
   approxnn::normSelector::instance().method(approxnn::LINF_NORM);
 
@@ -2146,44 +2357,12 @@ Real NonDBayesCalibration::knn_mutual_info(RealMatrix& Xmatrix, int dimX,
   int num_samples = Xmatrix.numCols();
   int dim = dimX + dimY;
 
-  // Cast Xmatrix into ANN data structure
-  ANNpointArray dataXY;
-  dataXY = annAllocPts(num_samples, dim);
-  RealVector col(dim);
-  for (int i = 0; i < num_samples; i++){
-    col = Teuchos::getCol(Teuchos::View, Xmatrix, i);
-    for (int j = 0; j < dim; j++){
-      dataXY[i][j] = col[j];
-    }
-  }
-
-  /*
-  // Normalize data
-  ANNpoint meanXY, stdXY;
-  meanXY = annAllocPt(dim); //means
-  for (int i = 0; i < num_samples; i++){
-    for(int j = 0; j < dim; j++){
-      meanXY[j] += dataXY[i][j];
-    }
-  }
-  for (int j = 0; j < dim; j++){
-    meanXY[j] = meanXY[j]/double(num_samples);
-  }
-  stdXY = annAllocPt(dim); //standard deviations
-  for (int i = 0; i < num_samples; i++){
-    for (int j = 0; j < dim; j++){
-      stdXY[j] += pow (dataXY[i][j] - meanXY[j], 2.0);
-    }
-  }
-  for (int j = 0; j < dim; j++){
-    stdXY[j] = sqrt( stdXY[j]/(double(num_samples)-1.0) );
-  }
-  for (int i = 0; i < num_samples; i++){
-    for (int j = 0; j < dim; j++){
-      dataXY[i][j] = ( dataXY[i][j] - meanXY[j] )/stdXY[j];
-    }
-  }
-  */
+  // ANN points reference the columns of Xmatrix in place: the X
+  // marginal is the leading dimX coordinates of the joint points and
+  // the Y marginal starts at offset dimX
+  std::vector<ANNpoint> dataXY, dataY;
+  ann_point_array(Xmatrix, 0, dataXY);
+  ann_point_array(Xmatrix, dimX, dataY);
 
   // Get knn-distances for Xmatrix
   RealVector XYdistances(num_samples);
@@ -2191,44 +2370,26 @@ Real NonDBayesCalibration::knn_mutual_info(RealMatrix& Xmatrix, int dimX,
   int k = 6;
   k_vec.putScalar(k); // for self distances, need k+1
   double eps = 0.0;
-  ann_dist(dataXY, dataXY, XYdistances, num_samples, num_samples, dim, 
-      	   k_vec, eps);
+  ANNkd_tree* kdTreeXY = new ANNkd_tree(&dataXY[0], num_samples, dim);
+  ann_batch_query(kdTreeXY, &dataXY[0], num_samples, num_samples, false, eps,
+		  k_vec, XYdistances);
+  delete kdTreeXY;
   
-  // Build marginals
-  ANNpointArray dataX, dataY;
-  dataX = annAllocPts(num_samples, dimX);
-  dataY = annAllocPts(num_samples, dimY);
-  //RealMatrix chainX(dimX, num_samples);
-  //RealMatrix chainY(dimY, num_samples);
-  for(int i = 0; i < num_samples; i++){
-    col = Teuchos::getCol(Teuchos::View, Xmatrix, i);
-    //Cout << "col = " << col << '\n';
-    for(int j = 0; j < dimX; j++){
-      //dataX[i][j] = dataXY[i][j];
-      //Cout << "col " << j << " = " << col[j] << '\n';
-      //chainX[i][j] = col[j];
-      dataX[i][j] = col[j];
-    }
-    for(int j = 0; j < dimY; j++){
-      //dataY[i][j] = dataXY[i][dimX+j];
-      //chainY[i][j] = col[dimX+j];
-      dataY[i][j] = col[dimX+j];
-    }
-  }
-  //Cout << "chainX = " << chainX;
-  ANNkd_tree* kdTreeX;
-  ANNkd_tree* kdTreeY;
-  kdTreeX = new ANNkd_tree(dataX, num_samples, dimX);
-  kdTreeY = new ANNkd_tree(dataY, num_samples, dimY);
+  // Count the marginal neighbors within the joint kNN distances
+  bool own_tree_X = (kd_tree_X == NULL);
+  if (own_tree_X)
+    kd_tree_X = new ANNkd_tree(&dataXY[0], num_samples, dimX);
+  ANNkd_tree* kdTreeY = new ANNkd_tree(&dataY[0], num_samples, dimY);
+  IntVector n_x(num_samples), n_y(num_samples);
+  ann_batch_query(kd_tree_X, &dataXY[0], num_samples, num_samples, true, eps,
+		  n_x, XYdistances);
+  ann_batch_query(kdTreeY, &dataY[0], num_samples, num_samples, true, eps,
+		  n_y, XYdistances);
 
   double marg_sum = 0.0;
   for(int i = 0; i < num_samples; i++){
-    int n_x = kdTreeX->annkFRSearch(dataX[i], XYdistances[i], 0, NULL, 
-				    NULL, eps);
-    int n_y = kdTreeY->annkFRSearch(dataY[i], XYdistances[i], 0, NULL,
-				    NULL, eps);
-    double psiX = boost::math::digamma(n_x);
-    double psiY = boost::math::digamma(n_y);
+    double psiX = boost::math::digamma(n_x[i]);
+    double psiY = boost::math::digamma(n_y[i]);
     //double psiX = boost::math::digamma(n_x+1);
     //double psiY = boost::math::digamma(n_y+1);
     marg_sum += psiX + psiY;
@@ -2246,11 +2407,9 @@ Real NonDBayesCalibration::knn_mutual_info(RealMatrix& Xmatrix, int dimX,
   //test_stream << "MI_est = " << MI_est << '\n';
 
   // Dealloc memory
-  delete kdTreeX;
   delete kdTreeY;
-  annDeallocPts(dataX);
-  annDeallocPts(dataY);
-  annDeallocPts(dataXY);
+  if (own_tree_X)
+    { delete kd_tree_X; annClose(); }
 
   approxnn::normSelector::instance().reset();
 
@@ -2264,43 +2423,144 @@ Real NonDBayesCalibration::knn_mutual_info(RealMatrix& Xmatrix, int dimX,
 
 }
 
-void NonDBayesCalibration::ann_dist(const ANNpointArray matrix1, 
-     const ANNpointArray matrix2, RealVector& distances, int NX, int NY, 
-     int dim2, IntVector& k_vec, double eps)
+/** The ANN points reference the columns of samples, offset by
+    row_offset, without copying. */
+void NonDBayesCalibration::
+ann_point_array(RealMatrix& samples, int row_offset,
+		std::vector<ANNpoint>& points)
 {
+  int i, num_samples = samples.numCols();
+  points.resize(num_samples);
+  for (i=0; i<num_samples; ++i)
+    points[i] = samples[i] + row_offset;
+}
 
-  ANNkd_tree* kdTree;
-  kdTree = new ANNkd_tree( matrix2, NY, dim2 );
-  for (unsigned int i = 0; i < NX; ++i){
-    int k_i = k_vec[i] ;
-    ANNdistArray knn_dist = new ANNdist[k_i+1];
-    ANNidxArray knn_ind = new ANNidx[k_i+1];
+
+/// evaluate queries [begin, end) of a batch (see
+/// NonDBayesCalibration::ann_batch_query())
+static void
+ann_query_range(ANNkd_tree* kd_tree, const ANNpointArray query_pts,
+		int begin, int end, int num_data, bool fixed_radius,
+		double eps, IntVector& k_vec, RealVector& distances)
+{
+  int i, j;
+  if (fixed_radius) {
+    for (i=begin; i<end; ++i)
+      k_vec[i] = kd_tree->annkFRSearch(query_pts[i], distances[i], 0, NULL,
+				       NULL, eps);
+    return;
+  }
+
+  // neighbor buffers are reused across queries and grow only as needed
+  std::vector<ANNdist> knn_dist;
+  std::vector<ANNidx>  knn_ind;
+  for (i=begin; i<end; ++i) {
+    int k_i = k_vec[i], num_nn = k_i + 1;
+    if (knn_dist.size() < num_nn)
+      { knn_dist.resize(num_nn); knn_ind.resize(num_nn); }
     //calc min number of distances needed
-    kdTree->annkSearch(matrix1[ i ], k_i+1, knn_ind, knn_dist, eps);
+    kd_tree->annkSearch(query_pts[i], num_nn, &knn_ind[0], &knn_dist[0], eps);
     double dist = knn_dist[k_i];
-    if (dist == 0.0){
-      ANNdistArray knn_dist_i = new ANNdist[NY];
-      ANNidxArray knn_ind_i = new ANNidx[NY];
-      //calc distances for whole array
-      kdTree->annkSearch(matrix1[ i ], NY, knn_ind_i, knn_dist_i, eps); 
-      for (unsigned int j = k_i+1; j < NY; ++j){
-	if (knn_dist_i[j] > 0.0){
-	  dist = knn_dist_i[j];
+    // coincident points: advance k to the nearest neighbor at a positive
+    // distance, doubling the search rather than sorting all num_data
+    while (dist == 0.0 && num_nn < num_data) {
+      int prev_nn = num_nn;
+      num_nn = std::min(2 * num_nn, num_data);
+      if (knn_dist.size() < num_nn)
+	{ knn_dist.resize(num_nn); knn_ind.resize(num_nn); }
+      kd_tree->annkSearch(query_pts[i], num_nn, &knn_ind[0], &knn_dist[0],
+			  eps);
+      for (j=prev_nn; j<num_nn; ++j)
+	if (knn_dist[j] > 0.0) {
+	  dist = knn_dist[j];
 	  k_vec[i] = j;
 	  break;
 	}
-      }
-      delete [] knn_ind_i;
-      delete [] knn_dist_i;
     }
     distances[i] = dist;
-    delete [] knn_ind;
-    delete [] knn_dist;
   }
-  delete kdTree;
-  annClose();
 }
 
+
+#ifdef DAKOTA_HAVE_PTHREADS
+/// a contiguous range of queries evaluated by one thread of
+/// NonDBayesCalibration::ann_batch_query()
+struct ANNQueryRange {
+  ANNkd_tree* kdTree;
+  ANNpointArray queryPts;
+  int begin, end, numData;
+  bool fixedRadius;
+  double eps;
+  IntVector* kVec;
+  RealVector* distances;
+};
+
+/// pthread entry point for an ANNQueryRange
+static void* ann_query_range_thread(void* range)
+{
+  ANNQueryRange* qr = static_cast<ANNQueryRange*>(range);
+  ann_query_range(qr->kdTree, qr->queryPts, qr->begin, qr->end, qr->numData,
+		  qr->fixedRadius, qr->eps, *qr->kVec, *qr->distances);
+  return NULL;
+}
+#endif
+
+
+/** Evaluates a batch of num_query queries against a kd-tree over
+    num_data points.  For k-NN queries, k_vec holds the neighbor index
+    k of each query on entry and distances returns the distance to
+    neighbor k, where k is advanced past any coincident points.  For
+    fixed-radius queries (fixed_radius = true), distances holds the
+    radius of each query and k_vec returns the number of points within
+    it.  With pthreads, contiguous ranges of queries are evaluated
+    concurrently: the tree is not modified by a search, the ANN search
+    state is thread local, and each query writes only its own entries
+    of k_vec and distances. */
+void NonDBayesCalibration::
+ann_batch_query(ANNkd_tree* kd_tree, const ANNpointArray query_pts,
+		int num_query, int num_data, bool fixed_radius, double eps,
+		IntVector& k_vec, RealVector& distances)
+{
+#ifdef DAKOTA_HAVE_PTHREADS
+  // ranges of fewer queries than this are not worth a thread
+  const int MIN_QUERIES_PER_THREAD = 64;
+  long num_procs = sysconf(_SC_NPROCESSORS_ONLN);
+  int i, num_threads = std::min((long)(num_query / MIN_QUERIES_PER_THREAD),
+				(num_procs > 0) ? num_procs : 1L);
+  if (num_threads > 1) {
+    std::vector<ANNQueryRange> ranges(num_threads);
+    std::vector<pthread_t> threads(num_threads);
+    std::vector<bool> started(num_threads, false);
+    for (i=0; i<num_threads; ++i) {
+      ANNQueryRange& qr = ranges[i];
+      qr.kdTree = kd_tree;         qr.queryPts = query_pts;
+      qr.begin  = (int)((long)num_query * i / num_threads);
+      qr.end    = (int)((long)num_query * (i+1) / num_threads);
+      qr.numData = num_data;       qr.fixedRadius = fixed_radius;
+      qr.eps = eps; qr.kVec = &k_vec; qr.distances = &distances;
+      // the calling thread evaluates the first range
+      if (i)
+	started[i] = (pthread_create(&threads[i], NULL,
+				     ann_query_range_thread, &qr) == 0);
+    }
+    ann_query_range(kd_tree, query_pts, ranges[0].begin, ranges[0].end,
+		    num_data, fixed_radius, eps, k_vec, distances);
+    for (i=1; i<num_threads; ++i)
+      if (started[i])
+	pthread_join(threads[i], NULL);
+      else // thread creation failed: evaluate its range here
+	ann_query_range(kd_tree, query_pts, ranges[i].begin, ranges[i].end,
+			num_data, fixed_radius, eps, k_vec, distances);
+    return;
+  }
+#endif
+
+  ann_query_range(kd_tree, query_pts, 0, num_query, num_data, fixed_radius,
+		  eps, k_vec, distances);
+}
+
+
+
 void NonDBayesCalibration::print_kl(std::ostream& s)
 {
   s << "Information gained from prior to posterior = " << kl_est;
@@ -18,6 +18,7 @@
 #include "NonDCalibration.hpp"
 #include "InvGammaRandomVariable.hpp"
 #include "ANN/ANN.h" 
+#include <boost/random/mersenne_twister.hpp>
 
 namespace Dakota {
 
@@ -76,7 +77,8 @@ public:
   // compute information metrics
   static Real knn_kl_div(RealMatrix& distX_samples, RealMatrix& distY_samples,
       		size_t dim); 
-  static Real knn_mutual_info(RealMatrix& Xmatrix, int dimX, int dimY);
+  static Real knn_mutual_info(RealMatrix& Xmatrix, int dimX, int dimY,
+			      ANNkd_tree* kd_tree_X = NULL);
 
 protected:
 
@@ -154,6 +156,15 @@ protected:
   Real
   log_likelihood(const RealVector& residuals, const RealVector& hyper_params);
 
+  /// generate a random walk Metropolis chain from init_pt, evaluating
+  /// the proposals along all accept/reject paths of the next
+  /// prefetchDepth steps concurrently on residualModel
+  void prefetch_metropolis(const RealVector& init_pt,
+			   const RealSymMatrix& prop_cov,
+			   const RealVector& lower, const RealVector& upper,
+			   boost::mt19937& rng, RealMatrix& chain,
+			   RealVector& log_likes);
+
   /// compute priorCovCholFactor based on prior distributions for random
   /// variables and any hyperparameters
   void prior_cholesky_factorization();
@@ -210,6 +221,12 @@ protected:
   /// number of update cycles for MCMC chain (implemented by restarting
   /// of short chains)
   int chainCycles;
+  /// number of independent chains stored consecutively within
+  /// acceptanceChain; burn-in and sub-sampling are applied to each
+  int chainBlocks;
+  /// depth of the proposal tree evaluated concurrently by
+  /// prefetch_metropolis(); 0 disables prefetching
+  int prefetchDepth;
   /// random seed for MCMC process
   int randomSeed;
 
@@ -383,9 +400,14 @@ protected:
   void kl_post_prior(RealMatrix& acceptanceChain);
   void prior_sample_matrix(RealMatrix& prior_dist_samples);
   void mutual_info_buildX();
-  static void ann_dist(const ANNpointArray matrix1, const ANNpointArray matrix2, 
-     		RealVector& distances, int NX, int NY, int dim2, IntVector& k, 
-		double eps);
+  /// reference the columns of samples (from row_offset) as ANN points
+  static void ann_point_array(RealMatrix& samples, int row_offset,
+			      std::vector<ANNpoint>& points);
+  /// evaluate a batch of k-NN or fixed-radius queries on a kd-tree
+  static void ann_batch_query(ANNkd_tree* kd_tree,
+			      const ANNpointArray query_pts, int num_query,
+			      int num_data, bool fixed_radius, double eps,
+			      IntVector& k_vec, RealVector& distances);
   Real kl_est;	
   void print_kl(std::ostream& stream);		
 
@@ -30,7 +30,7 @@ using std::string;
 
 static const char rcsId[]="@(#) $Id$";
 
-// five forwards to the class static functions
+// six forwards to the class static functions
 // BMA TODO: change interface to pass function pointers and
 // initializers and remove these globals
 
@@ -76,6 +76,14 @@ double sample_likelihood (int par_num, double zp[])
   return Dakota::NonDDREAMBayesCalibration::sample_likelihood(par_num, zp);
 }
 
+/// forwarder to sample_likelihood_batch needed by DREAM
+void sample_likelihood_batch (int sample_num, int par_num, double zp[],
+			      double fit[])
+{
+  Dakota::NonDDREAMBayesCalibration::
+    sample_likelihood_batch(sample_num, par_num, zp, fit);
+}
+
 
 } // namespace dream
 
@@ -110,6 +118,8 @@ NonDDREAMBayesCalibration(ProblemDescDB& problem_db, Model& model):
     Cout << "WARN (DREAM): Increasing requested chains to minimum (3)"
 	 << std::endl;
   }
+  // the proposals of all chains within a generation are evaluated together
+  maxEvalConcurrency *= numChains;
 
   numGenerations = std::floor((Real)chainSamples/numChains);
   if (numGenerations < 2) {
@@ -303,9 +313,62 @@ double NonDDREAMBayesCalibration::sample_likelihood(int par_num, double zp[])
   nonDDREAMInstance->residualModel.evaluate();
   const RealVector& residuals = 
     nonDDREAMInstance->residualModel.current_response().function_values();
-  double log_like = nonDDREAMInstance->log_likelihood(residuals, all_params);
+  return nonDDREAMInstance->compute_log_likelihood(residuals, all_params);
+}
+
+
+/** Static callback function to evaluate the likelihoods of the
+    sample_num points stored consecutively in zp, e.g., the proposals
+    of all chains within a generation.  When the residual model
+    supports asynchronous evaluation, all points are scheduled with
+    evaluate_nowait() and collected with a single synchronize(). */
+void NonDDREAMBayesCalibration::
+sample_likelihood_batch(int sample_num, int par_num, double zp[], double fit[])
+{
+  Model& resid_model = nonDDREAMInstance->residualModel;
+  int i;
+  if (!resid_model.asynch_flag()) {
+    for (i=0; i<sample_num; ++i)
+      fit[i] = sample_likelihood(par_num, zp + i*par_num);
+    return;
+  }
+
+  // schedule the evaluations of all points, tracking their batch indices
+  IntIntMap eval_indices;
+  for (i=0; i<sample_num; ++i) {
+    RealVector all_params(Teuchos::View, zp + i*par_num, par_num);
+    resid_model.continuous_variables(all_params);
+    resid_model.evaluate_nowait();
+    eval_indices[resid_model.evaluation_id()] = i;
+  }
+
+  // compute the likelihoods in batch order, independent of completion order
+  const IntResponseMap& resp_map = resid_model.synchronize();
+  IntRespMCIter r_cit;
+  for (IntIntMIter e_it=eval_indices.begin(); e_it!=eval_indices.end();
+       ++e_it) {
+    r_cit = resp_map.find(e_it->first);
+    if (r_cit == resp_map.end()) {
+      Cerr << "\nError: response for evaluation " << e_it->first
+	   << " missing from DREAM likelihood batch." << std::endl;
+      abort_handler(METHOD_ERROR);
+    }
+    i = e_it->second;
+    RealVector all_params(Teuchos::View, zp + i*par_num, par_num);
+    fit[i] = nonDDREAMInstance->
+      compute_log_likelihood(r_cit->second.function_values(), all_params);
+  }
+}
+
+
+/** Compute the log likelihood from the residuals at all_params, with
+    diagnostic output at DEBUG_OUTPUT. */
+double NonDDREAMBayesCalibration::
+compute_log_likelihood(const RealVector& residuals, const RealVector& all_params)
+{
+  double log_like = log_likelihood(residuals, all_params);
 
-  if (nonDDREAMInstance->outputLevel >= DEBUG_OUTPUT) {
+  if (outputLevel >= DEBUG_OUTPUT) {
     Cout << "Log likelihood is " << log_like << " Likelihood is "
          << std::exp(log_like) << '\n';
 
@@ -313,7 +376,8 @@ double NonDDREAMBayesCalibration::sample_likelihood(int par_num, double zp[])
     LogLikeOutput.open("NonDDREAMLogLike.txt", std::ios::out | std::ios::app);
     // Note: parameter values are in scaled space, if scaling is
     // active; residuals may be scaled by covariance
-    for (size_t i=0; i<par_num;  ++i) LogLikeOutput << zp[i] << ' ' ;
+    for (size_t i=0; i<all_params.length(); ++i)
+      LogLikeOutput << all_params[i] << ' ' ;
     for (size_t i=0; i<residuals.length(); ++i)
       LogLikeOutput << residuals(i) << ' ' ;
     LogLikeOutput << log_like << '\n';
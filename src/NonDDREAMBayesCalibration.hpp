@@ -74,6 +74,17 @@ public:
   //   returns: real valued log-likelihood
   /// Likelihood function for call-back from DREAM to DAKOTA for evaluation
   static double sample_likelihood (int par_num, double zp[]);
+
+  // Called by chain_init and dream_algm
+  //   sample_num: number of points, e.g., one per chain
+  //   par_num:    number of parameters
+  //   zp:         points at which to sample the likelihood, stored
+  //               consecutively (par_num x sample_num)
+  //   fit:        returns the real valued log-likelihoods
+  /// Batched likelihood function for call-back from DREAM to DAKOTA for
+  /// concurrent evaluation
+  static void sample_likelihood_batch (int sample_num, int par_num,
+				       double zp[], double fit[]);
          
 protected:
 
@@ -90,6 +101,9 @@ protected:
   static void cache_chain(const double* const z);
   /// save the final x-space acceptance chain and corresponding function values
   void archive_acceptance_chain();
+  /// compute the log likelihood for residuals evaluated at all_params
+  double compute_log_likelihood(const RealVector& residuals,
+				const RealVector& all_params);
 
   //
   //- Heading: Data
@@ -231,45 +231,26 @@ void NonDMultilevelSampling::multilevel_mc_Ysum(size_t model_form)
   SizetArray raw_N_l(num_lev, 0);
 
   // now converge on sample counts per level (N_l)
+  IntResponseMapArray level_resp_maps;
   while (Pecos::l1_norm(delta_N_l) && iter <= max_iter) {
 
-    // set initial surrogate responseMode and model indices for lev 0
-    iteratedModel.surrogate_response_mode(UNCORRECTED_SURROGATE); // LF
-    iteratedModel.surrogate_model_indices(model_form, 0); // solution level 0
+    // evaluate the sample increments for all levels as a single batch
+    evaluate_level_increments(model_form, delta_N_l, iter, level_resp_maps);
 
     sum_sqrt_var_cost = 0.;
     for (lev=0; lev<num_lev; ++lev) {
 
       lev_cost = cost[lev];
-      if (lev) {
-	if (lev == 1) // update responseMode for levels 1:num_lev-1
-	  iteratedModel.surrogate_response_mode(AGGREGATED_MODELS); // {LF,HF}
-	iteratedModel.surrogate_model_indices(model_form, lev-1);
-	iteratedModel.truth_model_indices(model_form,     lev);
-	lev_cost += cost[lev-1]; // discrepancies incur 2 level costs
-      }
-
-      // set the number of current samples from the defined increment
-      numSamples = delta_N_l[lev];
+      if (lev) lev_cost += cost[lev-1]; // discrepancies incur 2 level costs
 
       // aggregate variances across QoI for estimating N_l (justification:
       // for independent QoI, sum of QoI variances = variance of QoI sum)
       Real& agg_var_l = agg_var[lev]; // carried over from prev iter if no samp
-      if (numSamples) {
-
-	// generate new MC parameter sets
-	get_parameter_sets(iteratedModel);// pull dist params from any model
-
-	// export separate output files for each data set.  surrogate_model()
-	// has the correct model_form index for all levels.
-	if (exportSampleSets)
-	  export_all_samples("ml_", iteratedModel.surrogate_model(), iter, lev);
-
-	// compute allResponses from allVariables using hierarchical model
-	evaluate_parameter_sets(iteratedModel, true, false);
+      if (delta_N_l[lev]) {
 
-	// process allResponses: accumulate new samples for each qoi and
-	// update number of successful samples for each QoI
+	// process the responses for this level: accumulate new samples for
+	// each qoi and update number of successful samples for each QoI
+	std::swap(allResponses, level_resp_maps[lev]);
 	accumulate_ml_Ysums(sum_Y, sum_YY, lev, N_l[lev]);
 	if (outputLevel == DEBUG_OUTPUT) {
 	  Cout << "Accumulated sums (Y1, Y2, Y3, Y4, Y1sq):\n";
@@ -278,7 +259,7 @@ void NonDMultilevelSampling::multilevel_mc_Ysum(size_t model_form)
 	  write_data(Cout, sum_YY);   Cout << std::endl;
 	}
 	// update raw evaluation counts
-	raw_N_l[lev] += numSamples;
+	raw_N_l[lev] += delta_N_l[lev];
 
 	// compute estimator variance from current sample accumulation:
 	if (outputLevel >= DEBUG_OUTPUT)
@@ -374,45 +355,26 @@ void NonDMultilevelSampling::multilevel_mc_Qsum(size_t model_form)
   SizetArray raw_N_l(num_lev, 0);
 
   // now converge on sample counts per level (N_l)
+  IntResponseMapArray level_resp_maps;
   while (Pecos::l1_norm(delta_N_l) && iter <= max_iter) {
 
-    // set initial surrogate responseMode and model indices for lev 0
-    iteratedModel.surrogate_response_mode(UNCORRECTED_SURROGATE); // LF
-    iteratedModel.surrogate_model_indices(model_form, 0); // solution level 0
+    // evaluate the sample increments for all levels as a single batch
+    evaluate_level_increments(model_form, delta_N_l, iter, level_resp_maps);
 
     sum_sqrt_var_cost = 0.;
     for (lev=0; lev<num_lev; ++lev) {
 
       lev_cost = cost[lev];
-      if (lev) {
-	if (lev == 1) // update responseMode for levels 1:num_lev-1
-	  iteratedModel.surrogate_response_mode(AGGREGATED_MODELS); // {LF,HF}
-	iteratedModel.surrogate_model_indices(model_form, lev-1);
-	iteratedModel.truth_model_indices(model_form,     lev);
-	lev_cost += cost[lev-1]; // discrepancies incur 2 level costs
-      }
-
-      // set the number of current samples from the defined increment
-      numSamples = delta_N_l[lev];
+      if (lev) lev_cost += cost[lev-1]; // discrepancies incur 2 level costs
 
       // aggregate variances across QoI for estimating N_l (justification:
       // for independent QoI, sum of QoI variances = variance of QoI sum)
       Real& agg_var_l = agg_var[lev]; // carried over from prev iter if no samp
-      if (numSamples) {
-
-	// generate new MC parameter sets
-	get_parameter_sets(iteratedModel);// pull dist params from any model
-
-	// export separate output files for each data set.  surrogate_model()
-	// has the correct model_form index for all levels.
-	if (exportSampleSets)
-	  export_all_samples("ml_", iteratedModel.surrogate_model(), iter, lev);
-
-	// compute allResponses from allVariables using hierarchical model
-	evaluate_parameter_sets(iteratedModel, true, false);
+      if (delta_N_l[lev]) {
 
-	// process allResponses: accumulate new samples for each qoi and
-	// update number of successful samples for each QoI
+	// process the responses for this level: accumulate new samples for
+	// each qoi and update number of successful samples for each QoI
+	std::swap(allResponses, level_resp_maps[lev]);
 	accumulate_ml_Qsums(sum_Ql, sum_Qlm1, sum_QlQlm1, lev, N_l[lev]);
 	if (outputLevel == DEBUG_OUTPUT) {
 	  Cout << "Accumulated sums (Ql[1,2], Qlm1[1,2]):\n";
@@ -421,7 +383,7 @@ void NonDMultilevelSampling::multilevel_mc_Qsum(size_t model_form)
 	  Cout << std::endl;
 	}
 	// update raw evaluation counts
-	raw_N_l[lev] += numSamples;
+	raw_N_l[lev] += delta_N_l[lev];
 
 	// compute estimator variance from current sample accumulation:
 	if (outputLevel >= DEBUG_OUTPUT)
@@ -1317,40 +1279,52 @@ initialize_mlcv_sums(IntRealMatrixMap& sum_Ll, IntRealMatrixMap& sum_Llm1,
 }
 
 
+/** The function values of allResponses are gathered into contiguous
+    per-function columns, such that the power sums for each QoI are
+    accumulated in a single streaming pass over the samples, with the
+    accumulator lookups hoisted out of the sample loop. */
 void NonDMultilevelSampling::
 accumulate_ml_Qsums(IntRealMatrixMap& sum_Q, size_t lev, SizetArray& num_Q)
 {
   using boost::math::isfinite;
-  Real q_l, q_l_prod;
-  int ord, active_ord; size_t qoi;
-  IntRespMCIter r_it; IntRMMIter q_it;
-
-  for (r_it=allResponses.begin(); r_it!=allResponses.end(); ++r_it) {
-    const RealVector& fn_vals = r_it->second.function_values();
-
-    for (qoi=0; qoi<numFunctions; ++qoi) {
-      q_l_prod = q_l = fn_vals[qoi];
+  RealMatrix fn_cols;
+  pack_response_columns(fn_cols);
+
+  // columns of the accumulators for this level, indexed by order
+  size_t k, num_ord = sum_Q.size(); int max_ord = 0;
+  IntArray ords(num_ord); std::vector<Real*> sum_cols(num_ord);
+  IntRMMIter q_it;
+  for (k=0, q_it=sum_Q.begin(); q_it!=sum_Q.end(); ++k, ++q_it) {
+    ords[k] = q_it->first; sum_cols[k] = q_it->second[lev];
+    if (ords[k] > max_ord) max_ord = ords[k];
+  }
 
+  Real q_l, q_l_prod;
+  RealVector pow_sums(max_ord);
+  size_t qoi, s, num_samp = fn_cols.numRows(), num_finite;
+  int ord;
+  for (qoi=0; qoi<numFunctions; ++qoi) {
+    const Real* q_l_col = fn_cols[qoi];
+    pow_sums.putScalar(0.); num_finite = 0;
+    for (s=0; s<num_samp; ++s) {
+      q_l = q_l_col[s];
       if (isfinite(q_l)) { // neither NaN nor +/-Inf
-	q_it = sum_Q.begin(); ord = q_it->first;
-	active_ord = 1;
-	while (q_it!=sum_Q.end()) {
-    
-	  if (ord == active_ord) {
-	    q_it->second(qoi,lev) += q_l_prod; ++q_it;
-	    ord = (q_it == sum_Q.end()) ? 0 : q_it->first;
-	  }
-
-	  q_l_prod *= q_l; ++active_ord;
-	}
-	++num_Q[qoi];
+	q_l_prod = q_l;
+	for (ord=0; ord<max_ord; ++ord)
+	  { pow_sums[ord] += q_l_prod; q_l_prod *= q_l; }
+	++num_finite;
       }
     }
-    //Cout << r_it->first << ": "; write_data(Cout, sum_Q[1]);
+    for (k=0; k<num_ord; ++k)
+      sum_cols[k][qoi] += pow_sums[ords[k]-1];
+    num_Q[qoi] += num_finite;
   }
 }
 
 
+/** As for accumulate_ml_Qsums(IntRealMatrixMap&, size_t, SizetArray&),
+    with the Ql and Qlm1 columns streamed together since their sample
+    counts are synchronized. */
 void NonDMultilevelSampling::
 accumulate_ml_Qsums(IntRealMatrixMap& sum_Ql, IntRealMatrixMap& sum_Qlm1,
 		    IntIntPairRealMatrixMap& sum_QlQlm1, size_t lev,
@@ -1360,63 +1334,87 @@ accumulate_ml_Qsums(IntRealMatrixMap& sum_Ql, IntRealMatrixMap& sum_Qlm1,
     accumulate_ml_Qsums(sum_Ql, lev, num_Q);
   else {
     using boost::math::isfinite;
-    Real q_l, q_lm1, q_l_prod, q_lm1_prod, qq_prod;
-    int l1_ord, l2_ord, active_ord; size_t qoi;
-    IntRespMCIter r_it; IntRMMIter l1_it, l2_it; IntIntPair pr;
-
-    for (r_it=allResponses.begin(); r_it!=allResponses.end(); ++r_it) {
-      const RealVector& fn_vals = r_it->second.function_values();
-
-      for (qoi=0; qoi<numFunctions; ++qoi) {
-	// response mode AGGREGATED_MODELS orders LF followed by HF
-	q_l_prod   = q_l   = fn_vals[qoi+numFunctions];
-	q_lm1_prod = q_lm1 = fn_vals[qoi];
-
+    RealMatrix fn_cols;
+    pack_response_columns(fn_cols);
+
+    // columns of the accumulators for this level, indexed by order
+    size_t k, num_l_ord = sum_Ql.size(), num_lm1_ord = sum_Qlm1.size();
+    int max_l_ord = 0, max_lm1_ord = 0;
+    IntArray l_ords(num_l_ord), lm1_ords(num_lm1_ord);
+    std::vector<Real*> l_cols(num_l_ord), lm1_cols(num_lm1_ord);
+    IntRMMIter q_it;
+    for (k=0, q_it=sum_Ql.begin(); q_it!=sum_Ql.end(); ++k, ++q_it) {
+      l_ords[k] = q_it->first; l_cols[k] = q_it->second[lev];
+      if (l_ords[k] > max_l_ord) max_l_ord = l_ords[k];
+    }
+    for (k=0, q_it=sum_Qlm1.begin(); q_it!=sum_Qlm1.end(); ++k, ++q_it) {
+      lm1_ords[k] = q_it->first; lm1_cols[k] = q_it->second[lev];
+      if (lm1_ords[k] > max_lm1_ord) max_lm1_ord = lm1_ords[k];
+    }
+    IntIntPair pr(1,1);
+    Real* ll11_col = sum_QlQlm1[pr][lev];  pr.second = 2;
+    Real* ll12_col = sum_QlQlm1[pr][lev];  pr.first = 2; pr.second = 1;
+    Real* ll21_col = sum_QlQlm1[pr][lev];  pr.second = 2;
+    Real* ll22_col = sum_QlQlm1[pr][lev];
+
+    Real q_l, q_lm1, q_l_prod, q_lm1_prod, qq_prod, qq11, qq12, qq21, qq22;
+    RealVector l_sums(max_l_ord), lm1_sums(max_lm1_ord);
+    size_t qoi, s, num_samp = fn_cols.numRows(), num_finite;
+    int ord;
+    for (qoi=0; qoi<numFunctions; ++qoi) {
+      // response mode AGGREGATED_MODELS orders LF followed by HF
+      const Real *q_l_col = fn_cols[qoi+numFunctions],
+	*q_lm1_col = fn_cols[qoi];
+      l_sums.putScalar(0.); lm1_sums.putScalar(0.);
+      qq11 = qq12 = qq21 = qq22 = 0.; num_finite = 0;
+      for (s=0; s<num_samp; ++s) {
+	q_l = q_l_col[s]; q_lm1 = q_lm1_col[s];
 	// sync sample counts for Ql and Qlm1
 	if (isfinite(q_l) && isfinite(q_lm1)) { // neither NaN nor +/-Inf
-
 	  // covariance terms: products of q_l and q_lm1
-	  pr.first = pr.second = 1;
-	  qq_prod = q_l_prod * q_lm1_prod;
-	  sum_QlQlm1[pr](qoi,lev) += qq_prod;
-	  pr.second = 2;
-	  sum_QlQlm1[pr](qoi,lev) += qq_prod * q_lm1_prod;
-	  pr.first = 2; pr.second = 1;
-	  qq_prod *= q_l_prod;
-	  sum_QlQlm1[pr](qoi,lev) += qq_prod;
-	  pr.second = 2;
-	  sum_QlQlm1[pr](qoi,lev) += qq_prod * q_lm1_prod;
-
+	  qq_prod = q_l * q_lm1;
+	  qq11 += qq_prod;  qq12 += qq_prod * q_lm1;
+	  qq_prod *= q_l;
+	  qq21 += qq_prod;  qq22 += qq_prod * q_lm1;
 	  // mean,variance terms: products of q_l or products of q_lm1
-	  l1_it  = sum_Ql.begin();
-	  l2_it  = sum_Qlm1.begin();
-	  l1_ord = (l1_it == sum_Ql.end())   ? 0 : l1_it->first;
-	  l2_ord = (l2_it == sum_Qlm1.end()) ? 0 : l2_it->first;
-	  active_ord = 1;
-	  while (l1_it != sum_Ql.end() || l2_it != sum_Qlm1.end()) {
-
-	    // Low: Ll, Llm1
-	    if (l1_ord == active_ord) {
-	      l1_it->second(qoi,lev) += q_l_prod; ++l1_it;
-	      l1_ord = (l1_it == sum_Ql.end()) ? 0 : l1_it->first;
-	    }
-	    if (l2_ord == active_ord) {
-	      l2_it->second(qoi,lev) += q_lm1_prod; ++l2_it;
-	      l2_ord = (l2_it == sum_Qlm1.end()) ? 0 : l2_it->first;
-	    }
-
-	    q_l_prod *= q_l; q_lm1_prod *= q_lm1; ++active_ord;
-	  }
-	  ++num_Q[qoi];
+	  q_l_prod = q_l;
+	  for (ord=0; ord<max_l_ord; ++ord)
+	    { l_sums[ord] += q_l_prod; q_l_prod *= q_l; }
+	  q_lm1_prod = q_lm1;
+	  for (ord=0; ord<max_lm1_ord; ++ord)
+	    { lm1_sums[ord] += q_lm1_prod; q_lm1_prod *= q_lm1; }
+	  ++num_finite;
 	}
       }
-      //Cout << r_it->first << ": ";
-      //write_data(Cout, sum_Ql[1]); write_data(Cout, sum_Qlm1[1]);
+      for (k=0; k<num_l_ord; ++k)
+	l_cols[k][qoi]   += l_sums[l_ords[k]-1];
+      for (k=0; k<num_lm1_ord; ++k)
+	lm1_cols[k][qoi] += lm1_sums[lm1_ords[k]-1];
+      ll11_col[qoi] += qq11; ll12_col[qoi] += qq12;
+      ll21_col[qoi] += qq21; ll22_col[qoi] += qq22;
+      num_Q[qoi] += num_finite;
     }
   }
 }
 
 
+/** Gathers the function values of allResponses into fn_cols, with one
+    contiguous column of samples per response function. */
+void NonDMultilevelSampling::pack_response_columns(RealMatrix& fn_cols) const
+{
+  size_t s, fn, num_samp = allResponses.size(), num_fns = (num_samp) ?
+    allResponses.begin()->second.num_functions() : 0;
+  fn_cols.shapeUninitialized(num_samp, num_fns);
+  IntRespMCIter r_cit;
+  for (s=0, r_cit=allResponses.begin(); r_cit!=allResponses.end();
+       ++s, ++r_cit) {
+    const RealVector& fn_vals = r_cit->second.function_values();
+    for (fn=0; fn<num_fns; ++fn)
+      fn_cols(s,fn) = fn_vals[fn];
+  }
+}
+
+
 void NonDMultilevelSampling::
 accumulate_ml_Ysums(IntRealMatrixMap& sum_Y, RealMatrix& sum_YY, size_t lev,
 		    SizetArray& num_Y)
@@ -2065,6 +2063,81 @@ accumulate_mlcv_Qsums(const IntResponseMap& lf_resp_map,
 }
 
 
+/** The sample increments delta_N_l for each level of model_form are
+    generated and evaluated using the hierarchical model: level 0 in
+    UNCORRECTED_SURROGATE mode and the discrepancy levels in
+    AGGREGATED_MODELS mode.  When the model supports asynchronous
+    evaluation, the increments for all levels are queued before a single
+    synchronization, such that inexpensive coarse level evaluations can
+    fill the evaluation servers around the expensive fine level
+    evaluations rather than waiting at a barrier for each level.  The
+    responses for each level are returned in level_resp_maps. */
+void NonDMultilevelSampling::
+evaluate_level_increments(size_t model_form, const SizetArray& delta_N_l,
+			  size_t iter, IntResponseMapArray& level_resp_maps)
+{
+  size_t i, lev, num_lev = delta_N_l.size(), num_evals;
+  bool asynch_flag = iteratedModel.asynch_flag();
+  IntIntMap eval_levels; // evaluation id to level for queued evaluations
+  level_resp_maps.resize(num_lev);
+  for (lev=0; lev<num_lev; ++lev) {
+    level_resp_maps[lev].clear();
+    // set the number of current samples from the defined increment
+    numSamples = delta_N_l[lev];
+    if (!numSamples)
+      continue;
+
+    // update responseMode and model indices for this level
+    if (lev == 0) {
+      iteratedModel.surrogate_response_mode(UNCORRECTED_SURROGATE); // LF
+      iteratedModel.surrogate_model_indices(model_form, 0);
+    }
+    else {
+      iteratedModel.surrogate_response_mode(AGGREGATED_MODELS); // {LF,HF}
+      iteratedModel.surrogate_model_indices(model_form, lev-1);
+      iteratedModel.truth_model_indices(model_form,     lev);
+    }
+
+    // generate new MC parameter sets
+    get_parameter_sets(iteratedModel);// pull dist params from any model
+
+    // export separate output files for each data set.  surrogate_model()
+    // has the correct model_form index for all levels.
+    if (exportSampleSets)
+      export_all_samples("ml_", iteratedModel.surrogate_model(), iter, lev);
+
+    if (asynch_flag) { // queue this level; synchronize all levels below
+      num_evals = (compactMode) ? allSamples.numCols() : allVariables.size();
+      for (i=0; i<num_evals; ++i) {
+	if (compactMode) update_model_from_sample(iteratedModel, allSamples[i]);
+	else update_model_from_variables(iteratedModel, allVariables[i]);
+	iteratedModel.evaluate_nowait(activeSet);
+	eval_levels[iteratedModel.evaluation_id()] = (int)lev;
+      }
+    }
+    else {
+      // compute allResponses from allVariables using hierarchical model
+      evaluate_parameter_sets(iteratedModel, true, false);
+      std::swap(level_resp_maps[lev], allResponses);
+    }
+  }
+
+  if (!eval_levels.empty()) {
+    // HierarchSurrModel combines each evaluation using the response mode
+    // with which it was queued
+    const IntResponseMap& resp_map = iteratedModel.synchronize();
+    IntRespMCIter r_cit; IntIntMCIter l_cit;
+    for (r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++r_cit) {
+      l_cit = eval_levels.find(r_cit->first);
+      if (l_cit != eval_levels.end()) {
+	IntResponseMap& lev_resp_map = level_resp_maps[l_cit->second];
+	lev_resp_map.insert(lev_resp_map.end(), *r_cit);
+      }
+    }
+  }
+}
+
+
 void NonDMultilevelSampling::shared_increment(size_t iter, size_t lev)
 {
   if (iter == _NPOS)  Cout << "\nCVMC sample increments: ";
@@ -2696,14 +2769,30 @@ export_all_samples(String root_prepend, const Model& model, size_t iter,
   // Rather than hard override, rely on output_precision user spec
   //int save_wp = write_precision;
   //write_precision = 16; // override
+  bool binary = (exportSamplesFormat & TABULAR_BINARY);
   std::ofstream tabular_stream;
-  TabularIO::open_file(tabular_stream, tabular_filename, context_message);
-  TabularIO::write_header_tabular(tabular_stream, vars, no_resp_labels,
-				  cntr_label, exportSamplesFormat);
-  for (i=0; i<num_samp; ++i) {
-    sample_to_variables(allSamples[i], vars); // NonDSampling version
-    TabularIO::write_data_tabular(tabular_stream, vars, iface_id, i+1,
-				  exportSamplesFormat);
+  TabularIO::open_file(tabular_stream, tabular_filename, context_message,
+		       binary);
+  if (binary) {
+    TabularIO::BinaryTabularWriter binary_writer;
+    binary_writer.write_header(tabular_stream, vars, no_resp_labels,
+			       cntr_label);
+    RealVector no_resp_vals;
+    for (i=0; i<num_samp; ++i) {
+      sample_to_variables(allSamples[i], vars); // NonDSampling version
+      binary_writer.write_row(tabular_stream, vars, iface_id, no_resp_vals,
+			      i+1);
+    }
+    binary_writer.flush(tabular_stream);
+  }
+  else {
+    TabularIO::write_header_tabular(tabular_stream, vars, no_resp_labels,
+				    cntr_label, exportSamplesFormat);
+    for (i=0; i<num_samp; ++i) {
+      sample_to_variables(allSamples[i], vars); // NonDSampling version
+      TabularIO::write_data_tabular(tabular_stream, vars, iface_id, i+1,
+				    exportSamplesFormat);
+    }
   }
 
   TabularIO::close_file(tabular_stream, tabular_filename, context_message);
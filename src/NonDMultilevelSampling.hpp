@@ -83,6 +83,12 @@ private:
   void multilevel_control_variate_mc_Qcorr(size_t lf_model_form,
 					   size_t hf_model_form);
 
+  /// generate and evaluate the sample increments for all discretization
+  /// levels of a model form, overlapping the levels when the model
+  /// supports asynchronous evaluation
+  void evaluate_level_increments(size_t model_form,
+				 const SizetArray& delta_N_l, size_t iter,
+				 IntResponseMapArray& level_resp_maps);
   /// perform a shared increment of LF and HF samples for purposes of
   /// computing/updating the evaluation ratio and the MSE ratio
   void shared_increment(size_t iter, size_t lev);
@@ -137,6 +143,9 @@ private:
 			    IntRealMatrixMap& sum_Hl_Hlm1,
 			    IntRealMatrixMap& sum_Hlm1_Hlm1,
 			    size_t num_ml_lev, size_t num_cv_lev);
+  /// gather the function values of allResponses into contiguous
+  /// columns, one per response function
+  void pack_response_columns(RealMatrix& fn_cols) const;
 
   /// update running QoI sums for one model (sum_Q) using set of model
   /// evaluations within allResponses; used for level 0 from other accumulators
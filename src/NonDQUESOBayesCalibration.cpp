@@ -19,9 +19,12 @@
 #include "ParallelLibrary.hpp"
 #include "DakotaModel.hpp"
 #include "PRPMultiIndex.hpp"
+#include "IteratorScheduler.hpp"
 // then list QUESO headers
 #include "queso/StatisticalInverseProblem.h"
 #include "queso/StatisticalInverseProblemOptions.h"
+#include "queso/SequenceOfVectors.h"
+#include "queso/ScalarSequence.h"
 #include "queso/MetropolisHastingsSGOptions.h"
 #include "queso/SequenceStatisticalOptions.h"
 #include "queso/GslVector.h"
@@ -232,10 +235,31 @@ NonDQUESOBayesCalibration(ProblemDescDB& problem_db, Model& model):
   NonDBayesCalibration(problem_db, model),
   mcmcType(probDescDB.get_string("method.nond.mcmc_type")),
   precondRequestValue(0),
-  logitTransform(probDescDB.get_bool("method.nond.logit_transform"))
+  logitTransform(probDescDB.get_bool("method.nond.logit_transform")),
+  numChains(probDescDB.get_int("method.nond.mcmc_chains")),
+  prefetchRNG(randomSeed)
 {
   init_queso_environment();
 
+  if (prefetchDepth) {
+    if (mcmcType == "multilevel") {
+      Cerr << "\nError: prefetch_depth is not supported with multilevel "
+	   << "MCMC." << std::endl;
+      abort_handler(METHOD_ERROR);
+    }
+    else if (mcmcType != "metropolis_hastings")
+      Cerr << "\nWarning: prefetch_depth uses random walk Metropolis; "
+	   << "adaptation and\n         delayed rejection for " << mcmcType
+	   << " are not applied." << std::endl;
+  }
+
+  if (numChains > 1 && adaptPosteriorRefine) {
+    Cerr << "\nWarning: multiple chains are not supported with adaptive "
+	 << "posterior refinement;\n         running a single chain."
+	 << std::endl;
+    numChains = 1;
+  }
+
   // BMA TODO: Want to support these options independently
   if (obsErrorMultiplierMode > 0 && !calibrationData) {
     Cerr << "\nError: you are attempting to calibrate the measurement error " 
@@ -301,6 +325,7 @@ void NonDQUESOBayesCalibration::calibrate()
       }
 
       // execute MCMC chain, optionally in batches
+      map_pre_solve();
       run_chain_with_restarting();
       ++num_mcmc;
 
@@ -308,15 +333,20 @@ void NonDQUESOBayesCalibration::calibrate()
       //adapt_metric = assess_posterior_convergence();
     }
   }
-  else
-    run_chain_with_restarting();
+  else {
+    map_pre_solve();
+    if (numChains > 1)
+      run_concurrent_chains();
+    else
+      run_chain_with_restarting();
+  }
 
   // Generate useful stats from the posterior samples
   compute_statistics();
 }
 
 
-void NonDQUESOBayesCalibration::run_chain_with_restarting()
+void NonDQUESOBayesCalibration::map_pre_solve()
 {
   // Pre-solve for MAP point using optimization prior to MCMC.
   // Management of pre_solve spec options occurs in NonDBayesCalibration ctor,
@@ -350,7 +380,11 @@ void NonDQUESOBayesCalibration::run_chain_with_restarting()
     copy_gsl_partial(map_c_vars, *paramInitials, 0);
     if (adaptPosteriorRefine) copy_data(map_c_vars, mapSoln);//deep copy of view
   }
+}
+
 
+void NonDQUESOBayesCalibration::run_chain_with_restarting()
+{
   if (outputLevel >= NORMAL_OUTPUT) {
     if (chainCycles > 1)
       Cout << "Running chain in batches of " << chainSamples << " with "
@@ -418,6 +452,201 @@ void NonDQUESOBayesCalibration::run_chain_with_restarting()
 }
 
 
+/** The chains are independent, so they are run in forked local
+    processes when the scheduler supports them (Dakota iterators and
+    models are not reentrant, precluding threads); otherwise they are
+    run in sequence.  Since a chain may run concurrent evaluations of
+    its own, at most local_server_concurrency() / maxEvalConcurrency
+    chains run at once.  A process may not fork after MPI
+    initialization, so the chains are always run in sequence within MPI
+    runs (see ParallelLibrary::fork_allowed()).  The
+    evaluations performed by forked chains are not added to the
+    evaluation cache, restart file, or evaluation counts of this
+    process, whose final evaluation summary only reflects its own
+    evaluations.  The first chain starts from the initial (or MAP)
+    point and the others from independent draws from the prior.  The
+    merged acceptanceChain stores the chains consecutively. */
+void NonDQUESOBayesCalibration::run_concurrent_chains()
+{
+  int c, num_params = numContinuousVars + numHyperparams,
+    chain_len = chainSamples * chainCycles;
+  RealMatrix all_chain(num_params,   numChains * chain_len, false),
+           all_fn_vals(numFunctions, numChains * chain_len, false);
+  std::map<Real, RealVector> all_best;
+  QUESO::GslVector init_pt(*paramInitials);
+  boost::mt19937 start_rng(randomSeed);
+
+  // each chain may itself run maxEvalConcurrency evaluations at once, so
+  // the chain processes share the local concurrency among them
+  IteratorScheduler chain_sched(parallelLib, true, 0, 0, DEFAULT_SCHEDULING,
+				numChains);
+  int num_servers = chain_sched.local_server_concurrency()
+    / std::max(1, maxEvalConcurrency);
+  if (num_servers > 1) {
+    if (outputLevel >= NORMAL_OUTPUT)
+      Cout << "Running " << numChains << " MCMC chains in up to "
+	   << num_servers << " concurrent local processes; their\n"
+	   << "evaluations are not included in the evaluation counts, "
+	   << "cache, or restart file\nof this process.\n" << std::endl;
+    int num_started = 0, num_active = 0;
+    for (int i=0; i<numChains; ++i) {
+      // chains are started in order, so that their initial points match
+      for (; num_started < numChains && num_active < num_servers;
+	   ++num_started, ++num_active) {
+	initialize_chain(num_started, init_pt, start_rng);
+	if (chain_sched.fork_local_server(num_started)) {
+	  run_chain_with_restarting();
+	  MPIPackBuffer send_buffer;
+	  send_buffer << acceptanceChain << acceptedFnVals << bestSamples;
+	  chain_sched.exit_local_server(num_started, send_buffer); // no return
+	}
+      }
+      MPIUnpackBuffer recv_buffer;
+      c = chain_sched.wait_local_server(recv_buffer);
+      --num_active;
+      recv_buffer >> acceptanceChain >> acceptedFnVals >> bestSamples;
+      merge_chain(c, all_chain, all_fn_vals, all_best);
+    }
+  }
+  else
+    for (c=0; c<numChains; ++c) {
+      if (outputLevel >= NORMAL_OUTPUT)
+	Cout << "Running MCMC chain " << c+1 << " of " << numChains << ".\n";
+      initialize_chain(c, init_pt, start_rng);
+      run_chain_with_restarting();
+      merge_chain(c, all_chain, all_fn_vals, all_best);
+    }
+
+  acceptanceChain = all_chain;
+  acceptedFnVals  = all_fn_vals;
+  bestSamples     = all_best;
+  chainBlocks     = numChains;
+  compute_chain_diagnostics();
+}
+
+
+void NonDQUESOBayesCalibration::
+initialize_chain(int chain_index, const QUESO::GslVector& init_pt,
+		 boost::mt19937& start_rng)
+{
+  // independent random number sequences for each chain
+  quesoEnv->resetSeed(randomSeed + chain_index);
+  prefetchRNG.seed(randomSeed + chain_index);
+
+  if (chain_index == 0)
+    *paramInitials = init_pt;
+  else {
+    RealVector prior_pt;
+    prior_sample(start_rng, prior_pt);
+    copy_gsl(prior_pt, *paramInitials);
+  }
+  if (outputLevel > NORMAL_OUTPUT)
+    Cout << "Initial point for MCMC chain " << chain_index+1 << ":\n"
+	 << *paramInitials << '\n';
+}
+
+
+void NonDQUESOBayesCalibration::
+merge_chain(int chain_index, RealMatrix& all_chain, RealMatrix& all_fn_vals,
+	    std::map<Real, RealVector>& all_best)
+{
+  int i, j, chain_len = acceptanceChain.numCols(),
+    offset = chain_index * chain_len, num_params = acceptanceChain.numRows(),
+    num_fns = acceptedFnVals.numRows();
+  for (j=0; j<chain_len; ++j) {
+    const Real* chain_j = acceptanceChain[j];
+    Real* all_chain_j = all_chain[offset+j];
+    for (i=0; i<num_params; ++i)
+      all_chain_j[i] = chain_j[i];
+    const Real* fn_vals_j = acceptedFnVals[j];
+    Real* all_fn_vals_j = all_fn_vals[offset+j];
+    for (i=0; i<num_fns; ++i)
+      all_fn_vals_j[i] = fn_vals_j[i];
+  }
+
+  // retain the MAP estimate across all chains
+  all_best.insert(bestSamples.begin(), bestSamples.end());
+  while (all_best.size() > 1)
+    all_best.erase(all_best.begin()); // pop front (lowest prob)
+}
+
+
+/** The Gelman-Rubin potential scale reduction factor and the
+    multi-chain effective sample size (Gelman et al., Bayesian Data
+    Analysis, 3rd ed., Sec. 11.4-11.5) are computed for each parameter
+    from the chain blocks of acceptanceChain following burn-in.  The
+    autocorrelation sum is truncated by Geyer's initial positive
+    sequence. */
+void NonDQUESOBayesCalibration::compute_chain_diagnostics()
+{
+  int m = chainBlocks, num_params = acceptanceChain.numRows(),
+    block_len = acceptanceChain.numCols() / m,
+    burnin = (burnInSamples > 0) ? burnInSamples : 0, n = block_len - burnin;
+  if (m < 2 || n < 4) {
+    chainRhat.size(0); chainESS.size(0);
+    return;
+  }
+  chainRhat.sizeUninitialized(num_params);
+  chainESS.sizeUninitialized(num_params);
+
+  // contiguous copy of each chain for one parameter (n x m)
+  RealMatrix param_chains(n, m, false);
+  RealVector chain_means(m), chain_vars(m);
+  int c, i, p, t;
+  for (p=0; p<num_params; ++p) {
+    Real mean_of_means = 0., W = 0., B_n = 0., diff;
+    for (c=0; c<m; ++c) {
+      Real* x = param_chains[c]; Real& mean = chain_means[c];
+      Real& var = chain_vars[c];
+      mean = 0.;
+      for (i=0; i<n; ++i)
+	mean += x[i] = acceptanceChain(p, c*block_len + burnin + i);
+      mean /= n;
+      var = 0.;
+      for (i=0; i<n; ++i)
+	{ diff = x[i] - mean; var += diff * diff; }
+      var /= n - 1;
+      mean_of_means += mean; W += var;
+    }
+    mean_of_means /= m; W /= m;
+    for (c=0; c<m; ++c)
+      { diff = chain_means[c] - mean_of_means; B_n += diff * diff; }
+    B_n /= m - 1;
+    Real var_plus = (n - 1) * W / n + B_n;
+    if (W <= 0.) {
+      chainRhat[p] = chainESS[p] = std::numeric_limits<Real>::quiet_NaN();
+      continue;
+    }
+    chainRhat[p] = std::sqrt(var_plus / W);
+
+    // autocorrelation at lag t from the variogram, summed in pairs
+    // while the pair sums remain positive
+    Real rho[2], sum_pairs = 0.;
+    int k, lag;
+    for (t=0; t+1<n; t+=2) {
+      for (k=0; k<2; ++k) {
+	lag = t + k;
+	if (lag == 0)
+	  { rho[k] = 1.; continue; }
+	Real variogram = 0.;
+	for (c=0; c<m; ++c) {
+	  const Real* x = param_chains[c];
+	  for (i=lag; i<n; ++i)
+	    { diff = x[i] - x[i-lag]; variogram += diff * diff; }
+	}
+	variogram /= m * (n - lag);
+	rho[k] = 1. - variogram / (2. * var_plus);
+      }
+      if (rho[0] + rho[1] <= 0.)
+	break;
+      sum_pairs += rho[0] + rho[1];
+    }
+    Real tau = 2. * sum_pairs - 1.;
+    chainESS[p] = (tau > 0.) ? m * n / tau : (Real)(m * n);
+  }
+}
+
+
 /** The input filename is only passed by GPMSA as there's no way to
     override the C++ options with file-based options for the QUESO
     ctors. */
@@ -587,6 +816,9 @@ void NonDQUESOBayesCalibration::precondition_proposal()
 
 void NonDQUESOBayesCalibration::run_queso_solver()
 {
+  if (prefetchDepth)
+    { run_prefetch_chain(); return; }
+
   Cout << "Running Bayesian Calibration with QUESO " << mcmcType << " using "
        << calIpMhOptionsValues->m_rawChainSize << " MCMC samples." << std::endl;
   if (outputLevel > NORMAL_OUTPUT)
@@ -624,6 +856,66 @@ void NonDQUESOBayesCalibration::run_queso_solver()
 }
 
 
+/** The chain is generated by NonDBayesCalibration::prefetch_metropolis()
+    from paramInitials using proposalCovMatrix.  It is stored in QUESO
+    sequences so that the chain post-processing is shared with the
+    QUESO solvers. */
+void NonDQUESOBayesCalibration::run_prefetch_chain()
+{
+  unsigned int num_samples = calIpMhOptionsValues->m_rawChainSize;
+  int i, j, num_params = numContinuousVars + numHyperparams;
+  Cout << "Running Bayesian Calibration with prefetching Metropolis using "
+       << num_samples << " MCMC samples and up to " << (1 << prefetchDepth) - 1
+       << " concurrent proposals." << std::endl;
+  if (outputLevel > NORMAL_OUTPUT)
+    Cout << "\n  Calibrating " << numHyperparams << " error hyperparameters."
+	 << std::endl;
+
+  RealVector init_pt, lower, upper;
+  copy_gsl(*paramInitials, init_pt);
+  copy_gsl(paramDomain->minValues(), lower);
+  copy_gsl(paramDomain->maxValues(), upper);
+  RealSymMatrix prop_cov(num_params, false);
+  for (i=0; i<num_params; ++i)
+    for (j=0; j<=i; ++j)
+      prop_cov(i, j) = (*proposalCovMatrix)(i, j);
+
+  RealMatrix chain(num_params, num_samples, false);
+  RealVector log_likes(num_samples, false);
+  prefetch_metropolis(init_pt, prop_cov, lower, upper, prefetchRNG, chain,
+		      log_likes);
+
+  prefetchChain.reset(new
+    QUESO::SequenceOfVectors<QUESO::GslVector,QUESO::GslMatrix>(*paramSpace,
+    num_samples, "prefetch_chain"));
+  prefetchLogLikes.reset(new QUESO::ScalarSequence<double>(*quesoEnv,
+    num_samples, "prefetch_loglike"));
+  QUESO::GslVector qv(paramSpace->zeroVector());
+  for (j=0; j<num_samples; ++j) {
+    for (i=0; i<num_params; ++i)
+      qv[i] = chain(i, j);
+    prefetchChain->setPositionValues(j, qv);
+    (*prefetchLogLikes)[j] = log_likes[j];
+  }
+}
+
+
+const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>&
+NonDQUESOBayesCalibration::mcmc_sequence() const
+{
+  if (prefetchDepth) return *prefetchChain;
+  else               return inverseProb->chain();
+}
+
+
+const QUESO::ScalarSequence<double>&
+NonDQUESOBayesCalibration::mcmc_log_likelihoods() const
+{
+  if (prefetchDepth) return *prefetchLogLikes;
+  else               return inverseProb->logLikelihoodValues();
+}
+
+
 /** Populate a subset of 
     acceptanceChain(num_params, chainSamples * chainCycles) and 
     acceptedFnVals(numFunctions, chainSamples * chainCycles) */
@@ -640,7 +932,7 @@ void NonDQUESOBayesCalibration::aggregate_acceptance_chain(size_t cycle_num)
   ParamResponsePair lookup_pr(lookup_vars, interface_id, lookup_resp);
 
   const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>&
-    mcmc_chain = inverseProb->chain();
+    mcmc_chain = mcmc_sequence();
   unsigned int num_mcmc = mcmc_chain.subSequenceSize();
 
   // The posterior may include GPMSA hyper-parameters, so use the postRv space
@@ -733,7 +1025,7 @@ filter_chain_by_probability(size_t update_cntr, unsigned short batch_size)
   if (outputLevel >= NORMAL_OUTPUT)
     Cout << "Filtering chain by posterior probability: extracting best "
 	 << batch_size << " from MCMC chain " << update_cntr << " containing "
-	 << inverseProb->chain().subSequenceSize() << " samples.\n";
+	 << mcmc_sequence().subSequenceSize() << " samples.\n";
 
   std::/*multi*/map<Real, size_t> local_best;
   chain_to_local(batch_size, local_best);
@@ -757,7 +1049,7 @@ filter_chain_by_conditioning(size_t update_cntr, unsigned short batch_size)
   // filter chain -or- extract full chain and sort on likelihood values
   if (outputLevel >= NORMAL_OUTPUT)
     Cout << "Accumulating samples from MCMC chain " << update_cntr
-	 << " containing " << inverseProb->chain().subSequenceSize()
+	 << " containing " << mcmc_sequence().subSequenceSize()
 	 << " samples.\n";
 
   if (adaptPosteriorRefine) { // extract best MCMC samples from current batch
@@ -782,7 +1074,7 @@ filter_chain_by_conditioning(size_t update_cntr, unsigned short batch_size)
 void NonDQUESOBayesCalibration::accumulate_chain(size_t update_cntr)
 {
   const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>&
-    mcmc_chain = inverseProb->chain();
+    mcmc_chain = mcmc_sequence();
   unsigned int num_mcmc = mcmc_chain.subSequenceSize();
   QUESO::GslVector q_sample(paramSpace->zeroVector()),
               prev_q_sample(paramSpace->zeroVector());
@@ -837,9 +1129,9 @@ chain_to_local(unsigned short batch_size, std::map<Real, size_t>& local_best)
   // and statistics functions.
 
   const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>& mcmc_chain
-    = inverseProb->chain();
+    = mcmc_sequence();
   const QUESO::ScalarSequence<double>& loglike_vals
-    = inverseProb->logLikelihoodValues();
+    = mcmc_log_likelihoods();
   unsigned int num_mcmc = mcmc_chain.subSequenceSize();
   if (num_mcmc != loglike_vals.subSequenceSize()) {
     Cerr << "Error (NonDQUESO): final mcmc chain has length " << num_mcmc 
@@ -879,7 +1171,7 @@ local_to_aggregated(unsigned short batch_size,
   // Merge local std::map<Real, size_t> into aggregate/class-scope
   // std::map<Real, QUESO::GslVector> 
   const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>&
-    mcmc_chain = inverseProb->chain();
+    mcmc_chain = mcmc_sequence();
   std::/*multi*/map<Real, size_t>::const_iterator cit;
   QUESO::GslVector mcmc_sample(paramSpace->zeroVector());
   RealVector mcmc_sample_rv;
@@ -926,7 +1218,7 @@ local_to_all(const std::map<Real, size_t>& local_best)
   if (allSamples.numCols() != num_best)
     allSamples.shapeUninitialized(numContinuousVars, num_best);
   const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>&
-    mcmc_chain = inverseProb->chain();
+    mcmc_chain = mcmc_sequence();
   QUESO::GslVector mcmc_sample(paramSpace->zeroVector());
   std::/*multi*/map<Real, size_t>::const_iterator cit; size_t i;
   if (outputLevel >= NORMAL_OUTPUT) Cout << "Chain filtering results:\n";
@@ -945,7 +1237,7 @@ local_to_all(const std::map<Real, size_t>& local_best)
 void NonDQUESOBayesCalibration::update_center()
 {
   const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>& 
-    mcmc_chain = inverseProb->chain();
+    mcmc_chain = mcmc_sequence();
   unsigned int num_mcmc = mcmc_chain.subSequenceSize();
 
   // extract GSL sample vector from QUESO vector sequence:
@@ -955,7 +1247,7 @@ void NonDQUESOBayesCalibration::update_center()
   mcmc_chain.getPositionValues(last_index, *paramInitials);
   if (outputLevel > NORMAL_OUTPUT)
     Cout << "New center:\n" << *paramInitials << "Log likelihood = "
-	 << inverseProb->logLikelihoodValues()[last_index] << std::endl;
+	 << mcmc_log_likelihoods()[last_index] << std::endl;
 }
 
 
@@ -1518,6 +1810,15 @@ void NonDQUESOBayesCalibration::print_results(std::ostream& s)
     << "\n<<<<< Best log posterior       ="
     << "\n                     " << std::setw(wpp7) << log_post << std::endl;
 
+  // cross-chain convergence diagnostics for the calibrated parameters
+  if (!chainRhat.empty()) {
+    s << "<<<<< Chain diagnostics (" << chainBlocks
+      << " chains): R-hat, effective sample size =\n";
+    for (size_t j=0; j<chainRhat.length(); ++j)
+      s << "                     " << std::setw(wpp7) << chainRhat[j] << ' '
+	<< std::setw(wpp7) << chainESS[j] << ' ' << combined_labels[j] << '\n';
+  }
+
   /*
   // --------------------------
   // Multipoint results summary
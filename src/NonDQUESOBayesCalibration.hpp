@@ -16,6 +16,7 @@
 #define NOND_QUESO_BAYES_CALIBRATION_H
 
 #include "NonDBayesCalibration.hpp"
+#include <boost/random/mersenne_twister.hpp>
 
 // forward declare isolate QUESO includes to Dakota .cpp files
 namespace QUESO {
@@ -29,6 +30,9 @@ namespace QUESO {
   template<class V, class M> class BaseVectorRV;
   template<class V, class M> class GenericVectorRV;
   template<class V, class M> class StatisticalInverseProblem;
+  template<class V, class M> class BaseVectorSequence;
+  template<class V, class M> class SequenceOfVectors;
+  template<class T> class ScalarSequence;
   class SipOptionsValues;
   class MhOptionsValues;
 }
@@ -88,10 +92,29 @@ protected:
   /// perform the MCMC process
   void run_queso_solver();
 
+  /// pre-solve for the maximum a posteriori point, if active, and use
+  /// it as the starting point of the MCMC chain
+  void map_pre_solve();
+
   /// short term option to restart the MCMC chain with updated proposal
   /// density computed from the emulator at a new starting point
   void run_chain_with_restarting();
 
+  /// run numChains independent chains, concurrently within forked local
+  /// processes when available, and merge them within acceptanceChain
+  void run_concurrent_chains();
+  /// reset the QUESO seed and starting point for the chain_index-th chain
+  void initialize_chain(int chain_index, const QUESO::GslVector& init_pt,
+			boost::mt19937& start_rng);
+  /// copy the results of the most recent chain into block chain_index of
+  /// the merged chain and fold its best samples into all_best
+  void merge_chain(int chain_index, RealMatrix& all_chain,
+		   RealMatrix& all_fn_vals,
+		   std::map<Real, RealVector>& all_best);
+  /// compute the potential scale reduction factor (R-hat) and the
+  /// effective sample size of each parameter across the chain blocks
+  void compute_chain_diagnostics();
+
   /// accumulate unique samples drawn from the acceptance chain
   void accumulate_chain(size_t update_cntr);
   /// accumulate the acceptance chain across multiple restart cycles,
@@ -157,6 +180,15 @@ protected:
   /// update MH-specific inverse problem options calIpMhOptionsValues
   void update_chain_size(unsigned int size);
 
+  /// generate the chain using prefetch_metropolis() in place of the
+  /// QUESO solver
+  void run_prefetch_chain();
+  /// the most recent MCMC chain, from QUESO or from run_prefetch_chain()
+  const QUESO::BaseVectorSequence<QUESO::GslVector,QUESO::GslMatrix>&
+    mcmc_sequence() const;
+  /// the log-likelihood values of the most recent MCMC chain
+  const QUESO::ScalarSequence<double>& mcmc_log_likelihoods() const;
+
   //The likelihood routine is in the format that QUESO requires, 
   //with a particular argument list that QUESO expects. 
   //We are not using all of these arguments but may in the future.
@@ -199,6 +231,14 @@ protected:
   /** this option is useful for preventing rejection or resampling for
       out-of-bounds samples by transforming bounded domains to [-inf,inf]. */
   bool logitTransform;
+  /// number of independent MCMC chains
+  int numChains;
+  /// potential scale reduction factor for each parameter across chains
+  RealVector chainRhat;
+  /// multi-chain effective sample size for each parameter
+  RealVector chainESS;
+  /// random number generator for the prefetching Metropolis proposals
+  boost::mt19937 prefetchRNG;
 
 
 
@@ -246,6 +286,12 @@ protected:
   boost::shared_ptr<QUESO::StatisticalInverseProblem<QUESO::GslVector,
     QUESO::GslMatrix> > inverseProb;
 
+  /// chain generated by run_prefetch_chain() when prefetchDepth > 0
+  boost::shared_ptr<QUESO::SequenceOfVectors<QUESO::GslVector,
+    QUESO::GslMatrix> > prefetchChain;
+  /// log-likelihood values of prefetchChain
+  boost::shared_ptr<QUESO::ScalarSequence<double> > prefetchLogLikes;
+
   /// Pointer to current class instance for use in static callback functions
   static NonDQUESOBayesCalibration* nonDQUESOInstance;
 
@@ -22,6 +22,13 @@
 #include "ResultsManager.hpp"
 #include "DakotaBuildInfo.hpp"
 #include "dakota_tabular_io.hpp"
+#include <algorithm>
+#ifdef DAKOTA_HAVE_PTHREADS
+#include <signal.h>
+#endif
+#if defined(DAKOTA_HAVE_PTHREADS) || defined(HAVE_WORKING_FORK)
+#include <unistd.h>
+#endif
 
 //#define OUTMGR_DEBUG 1
 
@@ -39,12 +46,13 @@ void start_dakota_heartbeat(int);
 
 OutputManager::OutputManager():
   graph2DFlag(false), tabularDataFlag(false), resultsOutputFlag(false), 
-  worldRank(0), mpirunFlag(false), 
+  resultsOutputCompression(0), worldRank(0), mpirunFlag(false), 
   redirCalled(false), 
-  coutRedirector(dakota_cout, &std::cout), 
+  coutRedirector(dakota_cout, &std::cout, true), 
   cerrRedirector(dakota_cerr, &std::cerr),
   tabularFormat(TABULAR_ANNOTATED),
-  graphicsCntr(1), tabularCntrLabel("eval_id"), outputLevel(NORMAL_OUTPUT)
+  graphicsCntr(1), tabularCntrLabel("eval_id"), outputLevel(NORMAL_OUTPUT),
+  archiveEvalsFlag(false), evalStreamNotifyFd(-1)
 {  /* empty ctor */  }
 
 
@@ -54,11 +62,12 @@ OutputManager::
 OutputManager(const ProgramOptions& prog_opts, int dakota_world_rank,
 	      bool dakota_mpirun_flag):
   graph2DFlag(false), tabularDataFlag(false), resultsOutputFlag(false),
-  worldRank(dakota_world_rank), mpirunFlag(dakota_mpirun_flag), 
+  resultsOutputCompression(0), worldRank(dakota_world_rank), mpirunFlag(dakota_mpirun_flag), 
   redirCalled(false), 
-  coutRedirector(dakota_cout, &std::cout), 
+  coutRedirector(dakota_cout, &std::cout, true), 
   cerrRedirector(dakota_cerr, &std::cerr),
-  graphicsCntr(1), tabularCntrLabel("eval_id"), outputLevel(NORMAL_OUTPUT)
+  graphicsCntr(1), tabularCntrLabel("eval_id"), outputLevel(NORMAL_OUTPUT),
+  archiveEvalsFlag(false), evalStreamNotifyFd(-1)
 {
   // This call will redirect based on command-line options
   initial_redirects(prog_opts);
@@ -100,7 +109,10 @@ void OutputManager::initial_redirects(const ProgramOptions& prog_opts)
 
 void OutputManager::close_streams()
 {
-  // cout/cerr will be restored to default when the redirector is destroyed
+  // cout/cerr will be restored to default when the redirector is destroyed,
+  // but an abort exits first, so write any output still pending
+  coutRedirector.drain();
+  cerrRedirector.drain();
 
   // any remaining restart files will be closed at the destructor...
   //restartDestinations.clear();
@@ -116,8 +128,14 @@ void OutputManager::close_streams()
       dakotaGraphics.close();
     // only close tabular stream if initialization was previously performed
     // not an error when not open so all ranks can call this
-    if (tabularDataFlag && tabularDataFStream.is_open())
+    if (tabularDataFlag && tabularDataFStream.is_open()) {
+      if (tabularFormat & TABULAR_BINARY)
+	tabularBinaryWriter.flush(*tabularDataStream);
+      // drain the asynchronous buffer before closing its target
+      tabularDataStream.reset();
+      tabularAsyncBuffer.reset();
       tabularDataFStream.close();
+    }
 
     // could omit entirely or do this unconditionally...
     graphicsCntr = 1;
@@ -135,6 +153,8 @@ void OutputManager::parse(const ProgramOptions& prog_opts,
   tabularDataFile = problem_db.get_string("environment.tabular_graphics_file");
   resultsOutputFlag = problem_db.get_bool("environment.results_output");
   resultsOutputFile = problem_db.get_string("environment.results_output_file");
+  resultsOutputCompression
+    = problem_db.get_int("environment.results_output_compression");
   tabularFormat = problem_db.get_ushort("environment.tabular_format");
 
   int db_write_precision = problem_db.get_int("environment.output_precision");
@@ -195,13 +215,31 @@ push_output_tag(const String& iterator_tag, const ProgramOptions& prog_opts,
   // for now protect results DB from more than one call
   if (!redirCalled) {
     if (resultsOutputFlag)
-      iterator_results_db.initialize(resultsOutputFile + file_tag);
+      iterator_results_db.initialize(resultsOutputFile + file_tag,
+				     resultsOutputCompression);
     redirCalled = true;
   }
 
 }
 
 
+/** The child continues with copies of the parent's open tabular
+    stream and of any rows buffered for it, which it neither writes
+    nor flushes; the AsyncOutputBuffers were drained before the fork,
+    so closing the copied file only releases the child's descriptor.
+    Tabular data, graphics, and evaluation archives requested by the
+    child's iterators are not output. */
+void OutputManager::detach_forked_child()
+{
+  graph2DFlag = tabularDataFlag = archiveEvalsFlag = false;
+  iterator_results_db.detach_forked_child();
+  tabularDataStream.reset();
+  tabularAsyncBuffer.reset();
+  if (tabularDataFStream.is_open())
+    tabularDataFStream.close();
+}
+
+
 String OutputManager::build_output_tag() const
 {  return std::accumulate(fileTags.begin(), fileTags.end(), String());  }
 
@@ -297,6 +335,29 @@ void OutputManager::append_restart(const ParamResponsePair& prp)
 }
 
 
+/** The stream is fed from add_datapoint(), such that it includes the
+    evaluations of the iterator's top-level model whether or not they
+    are written to restart (e.g., surrogate evaluations or a
+    deactivated restart file); the caller enables auto_graphics() on
+    that model. */
+void OutputManager::evaluation_stream(const String& stream_filename,
+				      int notify_fd)
+{
+  if (evalStreamFStream.is_open())
+    evalStreamFStream.close();
+  evalStreamNotifyFd = notify_fd;
+  if (!stream_filename.empty()) {
+    evalStreamFStream.open(stream_filename.c_str(),
+			   std::ios::binary | std::ios::trunc);
+    if (!evalStreamFStream) {
+      Cerr << "\nError: could not open evaluation stream file "
+	   << stream_filename << std::endl;
+      abort_handler(-1);
+    }
+  }
+}
+
+
 /** Opens the tabular data file stream and prints headings, one for
     each active continuous and discrete variable and one for each response
     function, using the variable and response function labels. This
@@ -315,13 +376,20 @@ create_tabular_datastream(const Variables& vars, const Response& response)
   if (!tabularDataFStream.is_open()) {
     String file_tag = build_output_tag();
     TabularIO::open_file(tabularDataFStream, tabularDataFile + file_tag, 
-			 "DakotaGraphics");
+			 "DakotaGraphics", tabularFormat & TABULAR_BINARY);
+    // rows are formatted into memory and written by a writer thread,
+    // off the evaluation path
+    tabularAsyncBuffer.reset(new AsyncOutputBuffer(tabularDataFStream.rdbuf()));
+    tabularDataStream.reset(new std::ostream(tabularAsyncBuffer.get()));
   }
 
   // tabular graphics data only supports annotated format, active AND inactive
   // TODO: only write header if newly opened?
-  TabularIO::write_header_tabular(tabularDataFStream, vars, response, "eval_id",
-				  tabularFormat);
+  if (tabularFormat & TABULAR_BINARY)
+    tabularBinaryWriter.write_header(*tabularDataStream, vars, response);
+  else
+    TabularIO::write_header_tabular(*tabularDataStream, vars, response,
+				    "eval_id", tabularFormat);
 }
 
 
@@ -364,8 +432,36 @@ add_datapoint(const Variables& vars, const String& iface,
     // Since this tabular data file is used for multiple top-level
     // Iterator outputs, the counter may not be that from an interface
 
-    TabularIO::write_data_tabular(tabularDataFStream, vars, iface, response,
-     				  graphicsCntr, tabularFormat);
+    if (tabularFormat & TABULAR_BINARY)
+      tabularBinaryWriter.write_row(*tabularDataStream, vars, iface, response,
+				    graphicsCntr);
+    else
+      TabularIO::write_data_tabular(*tabularDataStream, vars, iface, response,
+				    graphicsCntr, tabularFormat);
+  }
+
+  if (archiveEvalsFlag)
+    iterator_results_db.insert_evaluation(evalArchiveId, iface, vars, response,
+					  graphicsCntr);
+
+  if (evalStreamFStream.is_open()) {
+    ParamResponsePair prp(vars, iface, response, graphicsCntr, false);
+    MPIPackBuffer prp_buffer;
+    prp_buffer << prp;
+    int buffer_len = prp_buffer.size();
+    evalStreamFStream.write((const char*)&buffer_len, sizeof(int));
+    evalStreamFStream.write(prp_buffer.buf(), buffer_len);
+    // flush so that a consumer sees each complete record without delay
+    evalStreamFStream.flush();
+#ifdef HAVE_WORKING_FORK
+    // a full pipe already signals unread records, so a failed write of
+    // the non-blocking descriptor is ignored
+    if (evalStreamNotifyFd >= 0) {
+      char notify = 0;
+      ssize_t written = write(evalStreamNotifyFd, &notify, 1);
+      (void)written;
+    }
+#endif
   }
 
   // Only increment the graphics counter if posting data (incrementing on every
@@ -378,6 +474,28 @@ void OutputManager::tabular_counter_label(const std::string& label)
 { tabularCntrLabel = label; }
 
 
+/** The evaluation history is archived per iterator run; only the
+    database decides whether it is stored. */
+void OutputManager::archive_evaluations(const StrStrSizet& iterator_id)
+{
+  archiveEvalsFlag = iterator_results_db.active();
+  evalArchiveId = iterator_id;
+}
+
+
+/** Evaluations only format their output into memory, so this is
+    called where waiting on the file system is acceptable. */
+void OutputManager::flush_output()
+{
+  if (tabularAsyncBuffer) {
+    if (tabularFormat & TABULAR_BINARY)
+      tabularBinaryWriter.flush(*tabularDataStream);
+    tabularAsyncBuffer->drain();
+  }
+  coutRedirector.drain();
+}
+
+
 void OutputManager::graphics_counter(int cntr)
 { graphicsCntr = cntr; }
 
@@ -539,7 +657,7 @@ void OutputManager::read_write_restart(bool restart_requested,
 OutputWriter::OutputWriter(std::ostream* output_stream)
 { outputStream = output_stream; }
 
-OutputWriter::OutputWriter(const String& output_filename):
+OutputWriter::OutputWriter(const String& output_filename, bool asynch):
   outputFilename(output_filename)
 {
   outputFS.open(output_filename.c_str(), std::ios::out);
@@ -548,7 +666,21 @@ OutputWriter::OutputWriter(const String& output_filename):
 	 << std::endl;
     abort_handler(-1);
   }
-  outputStream = &outputFS;
+  if (asynch) {
+    asyncBuffer.reset(new AsyncOutputBuffer(outputFS.rdbuf()));
+    asyncStream.reset(new std::ostream(asyncBuffer.get()));
+    outputStream = asyncStream.get();
+  }
+  else
+    outputStream = &outputFS;
+}
+
+void OutputWriter::drain()
+{
+  if (asyncBuffer)
+    asyncBuffer->drain();
+  else
+    outputStream->flush();
 }
 
 const String& OutputWriter::filename() const
@@ -560,8 +692,10 @@ std::ostream* OutputWriter::output_stream()
 
 
 ConsoleRedirector::
-ConsoleRedirector(std::ostream* & dakota_stream, std::ostream* default_dest):
-  ostreamHandle(dakota_stream), defaultOStream(default_dest)
+ConsoleRedirector(std::ostream* & dakota_stream, std::ostream* default_dest,
+		  bool asynch_files):
+  ostreamHandle(dakota_stream), defaultOStream(default_dest),
+  asynchFiles(asynch_files)
 { 
 #ifdef OUTMGR_DEBUG
   std::cerr << "Constructing ConsoleRedirector with handle " << ostreamHandle
@@ -618,7 +752,7 @@ void ConsoleRedirector::push_back(const String& output_filename)
 		<< output_filename << std::endl;
 #endif 
     boost::shared_ptr<OutputWriter> 
-      out_writer_ptr(new OutputWriter(output_filename));
+      out_writer_ptr(new OutputWriter(output_filename, asynchFiles));
     ostreamDestinations.push_back(out_writer_ptr);
   }
   // otherwise keep using the same stream
@@ -658,6 +792,234 @@ void ConsoleRedirector::pop_back()
 }
 
 
+void ConsoleRedirector::drain()
+{
+  if (ostreamDestinations.empty())
+    ostreamHandle->flush();
+  else
+    ostreamDestinations.back()->drain();
+}
+
+
+std::vector<AsyncOutputBuffer*> AsyncOutputBuffer::activeBuffers;
+
+
+AsyncOutputBuffer::
+AsyncOutputBuffer(std::streambuf* target_buf, size_t buffer_size):
+  targetBuf(target_buf), frontBuffer(std::max(buffer_size, (size_t)1)),
+  backBuffer(frontBuffer.size()), backLength(0), frontOffset(0),
+  inHandOff(0)
+{
+  std::streampos target_pos =
+    targetBuf->pubseekoff(0, std::ios_base::cur, std::ios_base::out);
+  if (target_pos != std::streampos(-1))
+    frontOffset = target_pos;
+  setp(&frontBuffer[0], &frontBuffer[0] + frontBuffer.size());
+
+#ifdef DAKOTA_HAVE_PTHREADS
+  stopWriter = false; writingFlush = false; writerPid = getpid();
+  pendingFlush.reserve(frontBuffer.size());
+  pthread_mutex_init(&bufferMutex, NULL);
+  pthread_cond_init(&bufferCond, NULL);
+  // the writer blocks all signals, so that abort_handler only runs on
+  // threads that produce output
+  sigset_t all_signals, prev_signals;
+  sigfillset(&all_signals);
+  pthread_sigmask(SIG_SETMASK, &all_signals, &prev_signals);
+  // if the thread cannot be created, output is written synchronously
+  writerStarted =
+    (pthread_create(&writerThread, NULL, writer_entry, this) == 0);
+  pthread_sigmask(SIG_SETMASK, &prev_signals, NULL);
+#endif
+  activeBuffers.push_back(this);
+}
+
+
+AsyncOutputBuffer::~AsyncOutputBuffer()
+{
+  drain();
+#ifdef DAKOTA_HAVE_PTHREADS
+  if (asynch_active()) {
+    inHandOff = 1;
+    pthread_mutex_lock(&bufferMutex);
+    stopWriter = true;
+    pthread_cond_broadcast(&bufferCond);
+    pthread_mutex_unlock(&bufferMutex);
+    pthread_join(writerThread, NULL);
+  }
+  pthread_cond_destroy(&bufferCond);
+  pthread_mutex_destroy(&bufferMutex);
+#endif
+  activeBuffers.erase(std::find(activeBuffers.begin(), activeBuffers.end(),
+				this));
+}
+
+
+bool AsyncOutputBuffer::asynch_active() const
+{
+#ifdef DAKOTA_HAVE_PTHREADS
+  return writerStarted && getpid() == writerPid;
+#else
+  return false;
+#endif
+}
+
+
+/** Output is passed to the writer in order: a flush that finds the
+    writer busy is appended to pendingFlush, and later output is not
+    handed off until the writer has taken pendingFlush.  A signal
+    handler interrupting a hand off (or drain) must not wait on the
+    mutex its own thread holds, so its output remains pending. */
+bool AsyncOutputBuffer::hand_off(bool wait_for_writer)
+{
+  size_t len = pptr() - pbase();
+  if (len == 0)
+    return true;
+  if (inHandOff)
+    return false;
+
+  inHandOff = 1;
+#ifdef DAKOTA_HAVE_PTHREADS
+  if (asynch_active()) {
+    pthread_mutex_lock(&bufferMutex);
+    if ((backLength || !pendingFlush.empty()) && !wait_for_writer) {
+      // record the flush for the writer to write once idle
+      bool fits = (pendingFlush.size() + len <= frontBuffer.size());
+      if (fits) {
+	pendingFlush.insert(pendingFlush.end(), pbase(), pptr());
+	pthread_cond_broadcast(&bufferCond);
+      }
+      pthread_mutex_unlock(&bufferMutex);
+      if (fits) {
+	frontOffset += len;
+	setp(&frontBuffer[0], &frontBuffer[0] + frontBuffer.size());
+      }
+      inHandOff = 0;
+      return fits;
+    }
+    while (backLength || !pendingFlush.empty())
+      pthread_cond_wait(&bufferCond, &bufferMutex);
+    frontBuffer.swap(backBuffer);
+    backLength = len;
+    pthread_cond_broadcast(&bufferCond);
+    pthread_mutex_unlock(&bufferMutex);
+  }
+  else
+#endif
+    targetBuf->sputn(pbase(), len);
+
+  frontOffset += len;
+  setp(&frontBuffer[0], &frontBuffer[0] + frontBuffer.size());
+  inHandOff = 0;
+  return true;
+}
+
+
+AsyncOutputBuffer::int_type AsyncOutputBuffer::overflow(int_type c)
+{
+  hand_off(true);
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+
+/** Called for each std::endl or flush, so waits on the writer only
+    when a previous pending flush leaves no room for this one; without
+    a writer thread the target is synced as before. */
+int AsyncOutputBuffer::sync()
+{
+  if (!hand_off(false))
+    hand_off(true);
+  if (!asynch_active())
+    return targetBuf->pubsync();
+  return 0;
+}
+
+
+std::streampos AsyncOutputBuffer::
+seekoff(std::streamoff off, std::ios_base::seekdir way,
+	std::ios_base::openmode which)
+{
+  if (off == 0 && way == std::ios_base::cur && (which & std::ios_base::out))
+    return frontOffset + (pptr() - pbase());
+  return std::streampos(-1); // only position queries are supported
+}
+
+
+void AsyncOutputBuffer::drain()
+{
+  if (inHandOff)
+    return; // a signal handler interrupted a hand off or drain
+  hand_off(true);
+#ifdef DAKOTA_HAVE_PTHREADS
+  if (asynch_active()) {
+    inHandOff = 1;
+    pthread_mutex_lock(&bufferMutex);
+    while (backLength || !pendingFlush.empty() || writingFlush)
+      pthread_cond_wait(&bufferCond, &bufferMutex);
+    pthread_mutex_unlock(&bufferMutex);
+    inHandOff = 0;
+  }
+#endif
+  targetBuf->pubsync();
+}
+
+
+void AsyncOutputBuffer::drain_all()
+{
+  for (size_t i=0; i<activeBuffers.size(); ++i)
+    activeBuffers[i]->drain();
+}
+
+
+#ifdef DAKOTA_HAVE_PTHREADS
+void* AsyncOutputBuffer::writer_entry(void* async_buf)
+{
+  static_cast<AsyncOutputBuffer*>(async_buf)->write_loop();
+  return NULL;
+}
+
+
+/** backBuffer is only swapped by the producer while backLength is 0,
+    so it is written without holding the lock.  A pending flush follows
+    the buffer handed off before it and precedes any handed off after
+    it, so it is taken and written as soon as backBuffer is done. */
+void AsyncOutputBuffer::write_loop()
+{
+  pthread_mutex_lock(&bufferMutex);
+  for (;;) {
+    while (!backLength && pendingFlush.empty() && !stopWriter)
+      pthread_cond_wait(&bufferCond, &bufferMutex);
+    if (!backLength && pendingFlush.empty()) // stopping and idle
+      break;
+    if (backLength) {
+      pthread_mutex_unlock(&bufferMutex);
+      targetBuf->sputn(&backBuffer[0], backLength);
+      targetBuf->pubsync();
+      pthread_mutex_lock(&bufferMutex);
+      backLength = 0;
+    }
+    if (!pendingFlush.empty()) {
+      flushBuffer.swap(pendingFlush);
+      writingFlush = true;
+      pthread_cond_broadcast(&bufferCond);
+      pthread_mutex_unlock(&bufferMutex);
+      targetBuf->sputn(&flushBuffer[0], flushBuffer.size());
+      targetBuf->pubsync();
+      flushBuffer.clear();
+      pthread_mutex_lock(&bufferMutex);
+      writingFlush = false;
+    }
+    pthread_cond_broadcast(&bufferCond);
+  }
+  pthread_mutex_unlock(&bufferMutex);
+}
+#endif
+
+
 RestartWriter::RestartWriter()
 {  /* empty ctor */  }
 
@@ -18,7 +18,14 @@
 #include <boost/archive/binary_iarchive.hpp>
 #include "dakota_data_types.hpp"
 #include "dakota_global_defs.hpp"
+#include "dakota_results_types.hpp"
 #include "DakotaGraphics.hpp"
+#include "dakota_tabular_io.hpp"
+#include <csignal>
+#ifdef DAKOTA_HAVE_PTHREADS
+#include <pthread.h>
+#include <sys/types.h>
+#endif
 
 
 namespace Dakota {
@@ -28,6 +35,109 @@ class ProblemDescDB;
 class ParamResponsePair;
 
 
+/** Stream buffer that decouples formatting output from writing it.
+    Output is formatted into a front buffer, which is handed to a
+    writer thread when full or when the stream is flushed, while
+    formatting continues into the other buffer.  Memory is bounded by
+    the two buffers and a pending flush buffer: a full front buffer
+    waits only if the previous one is still being written, and a flush
+    that finds the writer busy moves its output to the pending flush
+    buffer, which the writer writes once idle (waiting only if that
+    buffer is also full).  drain() waits for all output to reach the
+    target.  Without pthreads, or in a
+    forked child, output is written through synchronously. */
+class AsyncOutputBuffer: public std::streambuf {
+
+public:
+
+  /// constructor taking the buffer of the destination stream, which
+  /// must outlive this buffer
+  AsyncOutputBuffer(std::streambuf* target_buf, size_t buffer_size = 65536);
+  /// destructor drains pending output and stops the writer thread
+  ~AsyncOutputBuffer();
+
+  /// write all pending output to the target and sync it
+  void drain();
+
+  /// drain all AsyncOutputBuffers in this process, e.g., prior to a
+  /// fork so that children do not replicate pending output
+  static void drain_all();
+
+protected:
+
+  /// hand off the full front buffer, then buffer c
+  int_type overflow(int_type c);
+  /// hand off the front buffer, or record it as a pending flush if
+  /// the writer is busy
+  int sync();
+  /// report the output position for tellp(), including pending output
+  std::streampos seekoff(std::streamoff off, std::ios_base::seekdir way,
+			 std::ios_base::openmode which);
+
+private:
+
+  /// pass the front buffer to the writer (or write it through); a
+  /// busy writer is waited on if wait_for_writer, else the output is
+  /// appended to pendingFlush when it fits; returns false if the
+  /// output remains in the front buffer
+  bool hand_off(bool wait_for_writer);
+  /// whether output is handed to the writer thread
+  bool asynch_active() const;
+
+#ifdef DAKOTA_HAVE_PTHREADS
+  /// writer thread entry point
+  static void* writer_entry(void* async_buf);
+  /// writes each handed off buffer to the target until stopped
+  void write_loop();
+#endif
+
+  /// destination stream buffer
+  std::streambuf* targetBuf;
+  /// buffer being filled by formatted output
+  std::vector<char> frontBuffer;
+  /// buffer being written by the writer thread
+  std::vector<char> backBuffer;
+  /// number of bytes in backBuffer awaiting write (0 if writer idle)
+  size_t backLength;
+  /// output position of the start of frontBuffer
+  std::streamoff frontOffset;
+  /// set while this thread hands off or drains, so that a signal
+  /// handler does not wait on a lock held by the code it interrupted
+  volatile std::sig_atomic_t inHandOff;
+
+#ifdef DAKOTA_HAVE_PTHREADS
+  /// whether the writer thread was started
+  bool writerStarted;
+  /// whether the writer thread should exit once idle
+  bool stopWriter;
+  /// process that started the writer thread (threads do not survive fork)
+  pid_t writerPid;
+  /// output flushed while the writer was busy, written after backBuffer
+  std::vector<char> pendingFlush;
+  /// pendingFlush as taken by the writer thread while it is written
+  std::vector<char> flushBuffer;
+  /// whether the writer thread is writing flushBuffer
+  bool writingFlush;
+  /// the writer thread
+  pthread_t writerThread;
+  /// protects backBuffer, backLength, pendingFlush, writingFlush, and
+  /// stopWriter
+  pthread_mutex_t bufferMutex;
+  /// signals changes in backLength, pendingFlush, writingFlush, and
+  /// stopWriter
+  pthread_cond_t bufferCond;
+#endif
+
+  /// all live instances, for drain_all()
+  static std::vector<AsyncOutputBuffer*> activeBuffers;
+
+  /// copy constructor is disallowed
+  AsyncOutputBuffer(const AsyncOutputBuffer&);
+  /// assignment is disallowed
+  AsyncOutputBuffer& operator=(const AsyncOutputBuffer&);
+};
+
+
 /** Component to manage a redirected output or error stream */
 class OutputWriter {
 
@@ -37,8 +147,12 @@ public:
   /// stream, e.g., std::cout
   OutputWriter(std::ostream* output_stream);
 
-  /// file redirect constructor; opens an overwriting file stream to given name
-  OutputWriter(const String& output_filename);
+  /// file redirect constructor; opens an overwriting file stream to
+  /// given name, optionally written through an AsyncOutputBuffer
+  OutputWriter(const String& output_filename, bool asynch = false);
+
+  /// write all pending output to the file
+  void drain();
 
   /// the (possibly empty) file name for this stream
   const String& filename() const;
@@ -54,6 +168,13 @@ protected:
   /// file output stream for console text; only open if string non-empty
   std::ofstream outputFS;
 
+  /// asynchronous buffer over outputFS (declared after it so it is
+  /// drained before outputFS closes)
+  boost::scoped_ptr<AsyncOutputBuffer> asyncBuffer;
+
+  /// stream formatting into asyncBuffer
+  boost::scoped_ptr<std::ostream> asyncStream;
+
   /// pointer to the stream for this writer
   std::ostream* outputStream;
 
@@ -70,8 +191,10 @@ class ConsoleRedirector {
 public:
 
   /// Constructor taking a reference to the Dakota Cout/Cerr handle
-  /// and a default destination to use when no redirection (or destruct)
-  ConsoleRedirector(std::ostream* & dakota_stream, std::ostream* default_dest);
+  /// and a default destination to use when no redirection (or
+  /// destruct); asynch_files writes redirection files asynchronously
+  ConsoleRedirector(std::ostream* & dakota_stream, std::ostream* default_dest,
+		    bool asynch_files = false);
 
   /// when the redirector stack is destroyed, it will rebind the
   /// output handle to the default ostream, then destroy open files
@@ -87,6 +210,9 @@ public:
   /// pop the last redirection
   void pop_back();
 
+  /// write all pending output to the current redirection file
+  void drain();
+
 protected:
   /// The handle (target ostream) through which output is sent;
   /// typically dakota_cout or dakota_cerr.  Will be rebound to
@@ -101,6 +227,9 @@ protected:
   /// to potentially share the same ostream at multiple levels
   std::vector<boost::shared_ptr<OutputWriter> > ostreamDestinations;
 
+  /// whether redirection files are written through an AsyncOutputBuffer
+  bool asynchFiles;
+
 private:
   // private ctors since current implementation with streams isn't
   // easily copied.
@@ -211,6 +340,10 @@ public:
   /// (Potentially) remove an output context and rebind streams
   void pop_output_tag();
 
+  /// in a child forked from this process, stop output to the tabular
+  /// stream and results database it shares with the parent
+  void detach_forked_child();
+
 
   // -----
   // Convenience functions to generate output
@@ -229,6 +362,13 @@ public:
   /// append a parameter/response set to the restart file
   void append_restart(const ParamResponsePair& prp);
 
+  /// additionally write each evaluation posted by add_datapoint() to
+  /// the named file as a length-prefixed MPIPackBuffer, so that another
+  /// process may consume evaluations as they complete (an empty name
+  /// closes the stream); if notify_fd is a valid descriptor (e.g., the
+  /// write end of a pipe), a byte is written to it after each record
+  void evaluation_stream(const String& stream_filename, int notify_fd = -1);
+
 
   // -----
   // Graphics and tabular output
@@ -245,6 +385,14 @@ public:
   /// close tabular datastream
   void close_tabular();
 
+  /// write all buffered console and tabular output, e.g., at iterator
+  /// boundaries
+  void flush_output();
+
+  /// archive subsequent datapoints to the results database under
+  /// iterator_id
+  void archive_evaluations(const StrStrSizet& iterator_id);
+
   /// set graphicsCntr equal to cntr
   void graphics_counter(int cntr);
 
@@ -271,6 +419,7 @@ public:
 
   String tabularDataFile;   ///< filename for tabulation of graphics data
   String resultsOutputFile; ///< filename for results data
+  int resultsOutputCompression; ///< deflate level for HDF5 results data
 
 private:
 
@@ -313,6 +462,11 @@ private:
   /// redirection. All remain open until popped or destroyed.
   std::vector<boost::shared_ptr<RestartWriter> > restartDestinations;
 
+  /// stream of length-prefixed evaluation records (see evaluation_stream())
+  std::ofstream evalStreamFStream;
+  /// non-blocking descriptor notified of each evaluation stream record
+  int evalStreamNotifyFd;
+
   /// message to print at startup when proceeding to instantiate objects
   String startupMessage;
 
@@ -333,6 +487,15 @@ private:
 
   /// file stream for tabulation of graphics data within compute_response
   std::ofstream tabularDataFStream;
+  /// asynchronous buffer over tabularDataFStream
+  boost::scoped_ptr<AsyncOutputBuffer> tabularAsyncBuffer;
+
+  /// stream through which tabular data is formatted into tabularAsyncBuffer
+  boost::scoped_ptr<std::ostream> tabularDataStream;
+
+  /// buffers rows and writes column blocks to tabularDataStream when
+  /// tabularFormat is TABULAR_BINARY
+  TabularIO::BinaryTabularWriter tabularBinaryWriter;
 
   /// label for counter used in first line comment w/i the tabular data file
   std::string tabularCntrLabel;
@@ -340,6 +503,11 @@ private:
   /// output level (for debugging only; not passed in)
   short outputLevel;
 
+  /// whether datapoints are archived to the results database
+  bool archiveEvalsFlag;
+  /// iterator run under which datapoints are archived
+  StrStrSizet evalArchiveId;
+
 };  // class OutputManager
 
 
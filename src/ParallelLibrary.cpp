@@ -1079,7 +1079,8 @@ void ParallelLibrary::push_output_tag(const ParallelLevel& pl)
 		    << outputManager.tabularDataFlag 
 		    << outputManager.tabularDataFile
 		    << outputManager.resultsOutputFlag 
-		    << outputManager.resultsOutputFile;
+		    << outputManager.resultsOutputFile
+		    << outputManager.resultsOutputCompression;
 	int buffer_len = send_buffer.size();
 	bcast(buffer_len,  pl.hubServerIntraComm);
 	bcast(send_buffer, pl.hubServerIntraComm);
@@ -1094,7 +1095,8 @@ void ParallelLibrary::push_output_tag(const ParallelLevel& pl)
 		    >> outputManager.tabularDataFlag 
 		    >> outputManager.tabularDataFile
 		    >> outputManager.resultsOutputFlag 
-		    >> outputManager.resultsOutputFile;
+		    >> outputManager.resultsOutputFile
+		    >> outputManager.resultsOutputCompression;
       }
     }
   }
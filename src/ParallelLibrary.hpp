@@ -885,6 +885,9 @@ public:
   int world_size() const; ///< return MPIManager::worldSize
   int world_rank() const; ///< return MPIManager::worldRank
   bool mpirun_flag() const;   ///< return MPIManager::mpirunFlag
+  /// returns false once MPI is in use, since forked children may not
+  /// use MPI and MPI implementations need not support fork
+  bool fork_allowed() const;
   bool is_null() const;       ///< return dummyFlag
   Real parallel_time() const; ///< returns current MPI wall clock time
 
@@ -1062,6 +1065,10 @@ inline bool ParallelLibrary::mpirun_flag() const
 { return mpiManager.mpirun_flag(); }
 
 
+inline bool ParallelLibrary::fork_allowed() const
+{ return !mpiManager.mpirun_flag() && mpiManager.world_size() == 1; }
+
+
 inline bool ParallelLibrary::is_null() const
 { return dummyFlag; }
 
@@ -2299,6 +2299,7 @@ const String& ProblemDescDB::get_string(const String& entry_name) const
 	{"jega.convergence_type", P convergenceType},
 	{"jega.niching_type", P nichingType},
 	{"jega.postprocessor_type", P postProcessorType},
+	{"jega.synchronization", P evalSynchronize},
 	{"lipschitz", P lipschitzType},
 	{"log_file", P logFile},
 	{"low_fidelity_model_pointer", P lowFidModelPointer},
@@ -2364,6 +2365,7 @@ const String& ProblemDescDB::get_string(const String& entry_name) const
 	{"surrogate.import_build_points_file", P importBuildPtsFile},
 	{"surrogate.kriging_opt_method", P krigingOptMethod},
 	{"surrogate.mars_interpolation", P marsInterpolation},
+	{"surrogate.model_cache_prefix", P modelCachePrefix},
 	{"surrogate.model_export_prefix", P modelExportPrefix},
 	{"surrogate.point_reuse", P approxPointReuse},
 	{"surrogate.refine_cv_metric", P refineCVMetric},
@@ -2453,6 +2455,7 @@ const Real& ProblemDescDB::get_real(const String& entry_name) const
 	{"coliny.local_balance_parameter", P localBalanceParam},
 	{"coliny.max_boxsize_limit", P maxBoxSize},
 	{"coliny.threshold_delta", P threshDelta},
+	{"concurrent.match_tolerance", P concurrentMatchTol},
 	{"confidence_level", P wilksConfidenceLevel},
 	{"constraint_penalty", P constraintPenalty},
 	{"constraint_tolerance", P constraintTolerance},
@@ -2543,6 +2546,7 @@ int ProblemDescDB::get_int(const String& entry_name) const
     static KW<int, DataEnvironmentRep> Ide[] = { 
       // must be sorted by string (key)
         {"output_precision", P outputPrecision},
+        {"results_output_compression", P resultsOutputCompression},
         {"stop_restart", P stopRestart}};
     #undef P
 
@@ -2564,6 +2568,7 @@ int ProblemDescDB::get_int(const String& entry_name) const
 	{"coliny.new_solutions_generated", P newSolnsGenerated},
 	{"coliny.number_retained", P numberRetained},
 	{"coliny.total_pattern_size", P totalPatternSize},
+	{"concurrent.converged_starts", P concurrentConvergedStarts},
 	{"concurrent.random_jobs", P concurrentRandomJobs},
 	{"dream.crossover_chain_pairs", P crossoverChainPairs},
 	{"dream.jump_step", P jumpStep},
@@ -2571,6 +2576,7 @@ int ProblemDescDB::get_int(const String& entry_name) const
 	{"dream.num_cr", P numCR},
 	{"fsu_cvt.num_trials", P numTrials},
 	{"iterator_servers", P iteratorServers},
+	{"local_iterator_servers", P localIteratorServers},
 	{"max_function_evaluations", P maxFunctionEvaluations},
 	{"max_hifi_evaluations", P maxHifiEvals},
 	{"max_iterations", P maxIterations},
@@ -2579,6 +2585,8 @@ int ProblemDescDB::get_int(const String& entry_name) const
 	{"nond.chain_samples", P chainSamples},
 	{"nond.max_refinement_iterations", P maxRefineIterations},
 	{"nond.max_solver_iterations", P maxSolverIterations},
+	{"nond.mcmc_chains", P mcmcChains},
+	{"nond.mcmc_prefetch_depth", P mcmcPrefetchDepth},
 	{"nond.proposal_covariance_updates", P proposalCovUpdates},
 	{"nond.samples_on_emulator", P samplesOnEmulator},
 	{"nond.surrogate_order", P emulatorOrder},
@@ -2610,11 +2618,14 @@ int ProblemDescDB::get_int(const String& entry_name) const
 	{"max_function_evals", P maxFunctionEvals},
 	{"max_iterations", P maxIterations},
 	{"nested.iterator_servers", P subMethodServers},
+	{"nested.local_iterator_servers", P subMethodLocalServers},
 	{"nested.processors_per_iterator", P subMethodProcs},
         {"rf.expansion_bases", P subspaceDimension},
         {"soft_convergence_limit", P softConvergenceLimit},
+        {"surrogate.build_concurrency", P buildConcurrency},
         {"surrogate.decomp_support_layers", P decompSupportLayers},
         {"surrogate.folds", P numFolds},
+        {"surrogate.inducing_points", P inducingPoints},
         {"surrogate.points_total", P pointsTotal},
         {"surrogate.refine_cv_folds", P refineCVFolds}};
     #undef P
@@ -3038,6 +3049,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
 	{"derivative_usage", P methodUseDerivsFlag},
 	{"fixed_seed", P fixedSeedFlag},
 	{"fsu_quasi_mc.fixed_sequence", P fixedSequenceFlag},
+	{"hybrid.pipelined", P hybridPipelined},
 	{"import_approx_active_only", P importApproxActive},
 	{"import_build_active_only", P importBuildActive},
 	{"latinize", P latinizeFlag},
@@ -3091,6 +3103,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
 	{"active_subspace.truncation_method.cv", P subspaceIdCV},
 	{"active_subspace.truncation_method.energy", P subspaceIdEnergy},
 	{"hierarchical_tags", P hierarchicalTags},
+	{"nested.memoize_results", P subMethodMemoize},
 	{"surrogate.auto_refine", P autoRefine},
 	{"surrogate.challenge_points_file_active", P importChallengeActive},
 	{"surrogate.cross_validate", P crossValidateFlag},
@@ -16,6 +16,7 @@
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
 #include "WorkdirHelper.hpp"
+#include "OutputManager.hpp"
 #include <algorithm>
 
 namespace Dakota {
@@ -135,8 +136,11 @@ pid_t ProcessHandleApplicInterface::create_evaluation_process(bool block_flag)
   }
   // Cout must be flushed prior to the fork to clear the stdout buffer.
   // Otherwise, the intermediate process receives a copy of the contents of
-  // this buffer and outputs the contents on the next buffer flush.
+  // this buffer and outputs the contents on the next buffer flush.  Output
+  // still queued for an asynchronous writer thread is drained as well, since
+  // that thread does not exist in the child.
   Cout << std::flush;
+  AsyncOutputBuffer::drain_all();
 
   pid_t pid = 0;
   if (iFilterName.empty() && oFilterName.empty() && numAnalysisDrivers == 1) {
@@ -414,28 +414,32 @@ void RecastModel::derived_evaluate_nowait(const ActiveSet& set)
   // that uses an ActiveSubspaceModel as LF and the original model as HF).
   recastIdMap[subModel.evaluation_id()] = recastModelEvalCntr;
 
-  // bookkeep variables for use in primaryRespMapping/secondaryRespMapping
+  // bookkeep variables for use in primaryRespMapping/secondaryRespMapping.
+  // Within large batches, the Variables retired by transform_response_map()
+  // are reused rather than allocating new deep copies for each evaluation.
   if (respMapping) {
     recastSetMap[recastModelEvalCntr]  = set;
-    recastVarsMap[recastModelEvalCntr] = currentVariables.copy();
+    recastVarsMap[recastModelEvalCntr]
+      = pooled_variables_copy(currentVariables, recastVarsPool);
     if (variablesMapping)
       subModelVarsMap[recastModelEvalCntr]
-	= subModel.current_variables().copy();
+	= pooled_variables_copy(subModel.current_variables(), subModelVarsPool);
   }
 }
 
 
 const IntResponseMap& RecastModel::derived_synchronize()
 {
-  recastResponseMap.clear();
-
   if (respMapping) {
+    recycle_recast_responses();
     IntResponseMap resp_map_rekey;
     rekey_synch(subModel, true, recastIdMap, resp_map_rekey);
     transform_response_map(resp_map_rekey, recastResponseMap);
   }
-  else
+  else {
+    recastResponseMap.clear();
     rekey_synch(subModel, true, recastIdMap, recastResponseMap);
+  }
 
   return recastResponseMap;
 }
@@ -443,15 +447,16 @@ const IntResponseMap& RecastModel::derived_synchronize()
 
 const IntResponseMap& RecastModel::derived_synchronize_nowait()
 {
-  recastResponseMap.clear();
-
   if (respMapping) {
+    recycle_recast_responses();
     IntResponseMap resp_map_rekey;
     rekey_synch(subModel, false, recastIdMap, resp_map_rekey);
     transform_response_map(resp_map_rekey, recastResponseMap);
   }
-  else
+  else {
+    recastResponseMap.clear();
     rekey_synch(subModel, false, recastIdMap, recastResponseMap);
+  }
 
   return recastResponseMap;
 }
@@ -461,7 +466,12 @@ void RecastModel::
 transform_response_map(const IntResponseMap& old_resp_map,
 		       IntResponseMap& new_resp_map)
 {
+  // A completed batch is mapped in a single pass: bookkeeping entries are
+  // retired to the Variables pools as they are consumed and new recast
+  // responses are drawn from recastRespPool when available, such that
+  // repeated batches through a stack of RecastModels avoid reallocation.
   IntRespMCIter r_cit; IntASMIter s_it; IntVarsMIter v_it, sm_v_it;
+  IntResponseMap::iterator new_it = new_resp_map.begin();
   for (r_cit=old_resp_map.begin(); r_cit!=old_resp_map.end(); ++r_cit) {
     int native_id = r_cit->first;
     s_it =  recastSetMap.find(native_id);
@@ -469,15 +479,69 @@ transform_response_map(const IntResponseMap& old_resp_map,
     if (variablesMapping) sm_v_it = subModelVarsMap.find(native_id);
     else                  sm_v_it = v_it;
 
-    Response new_resp(currentResponse.copy()); // correct size, labels, etc.
+    Response new_resp(pooled_recast_response()); // correct size, labels, etc.
     new_resp.active_set(s_it->second);
     transform_response(v_it->second, sm_v_it->second, r_cit->second, new_resp);
-    new_resp_map[native_id] = new_resp;
+    // old_resp_map is ordered by id, so append using the insertion hint
+    new_it = new_resp_map.insert(new_it, std::make_pair(native_id, new_resp));
 
     // cleanup
+    recastVarsPool.push_back(v_it->second);
     recastSetMap.erase(s_it);  recastVarsMap.erase(v_it);
-    if (variablesMapping) subModelVarsMap.erase(sm_v_it);
+    if (variablesMapping) {
+      subModelVarsPool.push_back(sm_v_it->second);
+      subModelVarsMap.erase(sm_v_it);
+    }
+  }
+}
+
+
+Variables RecastModel::
+pooled_variables_copy(const Variables& vars, VariablesList& pool)
+{
+  // retired instances share the layout of the vars they were copied from;
+  // discard any that are inconsistent following a change in view or size.
+  // An instance is only reused when this handle is its sole owner, since
+  // a response mapping may have retained a shallow copy.
+  while (!pool.empty()) {
+    Variables pooled_vars = pool.front(); pool.pop_front();
+    if (pooled_vars.reference_count() == 1 &&
+	pooled_vars.view() == vars.view() && pooled_vars.acv()  == vars.acv()
+	&& pooled_vars.adiv() == vars.adiv() && pooled_vars.adsv() == vars.adsv()
+	&& pooled_vars.adrv() == vars.adrv()) {
+      pooled_vars.all_variables(vars); // copy values without reallocation
+      return pooled_vars;
+    }
   }
+  return vars.copy();
+}
+
+
+Response RecastModel::pooled_recast_response()
+{
+  if (recastRespPool.empty())
+    return currentResponse.copy();
+  Response recast_resp = recastRespPool.front(); recastRespPool.pop_front();
+  recast_resp.reset(); // clear data from the prior evaluation
+  return recast_resp;
+}
+
+
+void RecastModel::recycle_recast_responses()
+{
+  // responses still referenced by the caller of a previous synchronization
+  // are released; the remainder are only held by this map and may be reused
+  // (a change in the number of recast functions invalidates the pool)
+  if (!recastRespPool.empty() && recastRespPool.front().num_functions() !=
+      currentResponse.num_functions())
+    recastRespPool.clear();
+  size_t num_fns = currentResponse.num_functions();
+  for (IntRespMIter r_it=recastResponseMap.begin();
+       r_it!=recastResponseMap.end(); ++r_it)
+    if (r_it->second.reference_count() == 1 &&
+	r_it->second.num_functions() == num_fns)
+      recastRespPool.push_back(r_it->second);
+  recastResponseMap.clear();
 }
 
 
@@ -380,6 +380,16 @@ protected:
   void init_constraints(size_t num_recast_secondary_fns,
 			size_t recast_secondary_offset, bool reshape_vars);
 
+  /// return a Variables instance holding the values of vars, reusing a
+  /// retired instance from pool when its shape is consistent with vars
+  Variables pooled_variables_copy(const Variables& vars, VariablesList& pool);
+  /// return a recast Response drawn from recastRespPool, or a new copy
+  /// of currentResponse if the pool is empty
+  Response pooled_recast_response();
+  /// move the responses in recastResponseMap that are no longer shared
+  /// into recastRespPool and clear the map
+  void recycle_recast_responses();
+
   //
   //- Heading: Data members
   //
@@ -407,6 +417,16 @@ protected:
   /// mapping from subModel evaluation ids to RecastModel evaluation ids
   IntIntMap recastIdMap;
 
+  /// recast variables retired by transform_response_map(), reused by
+  /// derived_evaluate_nowait() in place of a new deep copy
+  VariablesList recastVarsPool;
+  /// subModel variables retired by transform_response_map(), reused by
+  /// derived_evaluate_nowait() in place of a new deep copy
+  VariablesList subModelVarsPool;
+  /// recast responses from a previous synchronization that are no longer
+  /// referenced by the caller, reused by transform_response_map()
+  ResponseList recastRespPool;
+
 private:
 
   //
@@ -0,0 +1,214 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014 Sandia Corporation.
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:        ResultsDBHDF5
+//- Description:  Implementation of non-templated portion of ResultsDBHDF5
+//- Owner:        Brian Adams
+//- Version: $Id:$
+
+#include "ResultsDBHDF5.hpp"
+#include "DakotaVariables.hpp"
+#include "DakotaResponse.hpp"
+#include "dakota_data_util.hpp"
+
+namespace Dakota {
+
+ResultsDBHDF5::
+ResultsDBHDF5(bool in_core, const String& base_filename, int compress_level,
+	      size_t chunk_rows):
+  hdf5Stream(new HDF5BinaryStream(base_filename +
+				  (in_core ? ".tmp.h5" : ".h5"),
+				  in_core, false)),
+  compressLevel(compress_level), chunkRows(std::max(chunk_rows, (size_t)1)),
+  detachedChild(false)
+{ }
+
+
+ResultsDBHDF5::ResultsDBHDF5(const String& filename):
+  hdf5Stream(new HDF5BinaryStream(filename, false, true, false)),
+  compressLevel(0), chunkRows(1), detachedChild(false)
+{ }
+
+
+ResultsDBHDF5::~ResultsDBHDF5()
+{
+  // the stream is closed after this body, so write buffered rows first;
+  // a detached child's rows are the parent's to write
+  if (detachedChild)
+    return;
+  std::map<String, EvaluationArchive>::const_iterator a_it;
+  for (a_it=evalArchives.begin(); a_it!=evalArchives.end(); ++a_it)
+    flush_archive(a_it->first);
+}
+
+
+void ResultsDBHDF5::
+insert_evaluation(const StrStrSizet& iterator_id, const String& iface_id,
+		  const Variables& vars, const Response& response, int eval_id)
+{
+  if (detachedChild)
+    return;
+
+  String archive = archive_name(iterator_id, iface_id);
+  std::map<String, EvaluationArchive>::iterator a_it
+    = evalArchives.find(archive);
+  if (a_it == evalArchives.end()) {
+    a_it = evalArchives.insert(std::make_pair(archive,
+					      EvaluationArchive())).first;
+    create_archive(archive, vars, response, a_it->second);
+  }
+  EvaluationArchive& eval_archive = a_it->second;
+
+  const RealVector& cv  = vars.all_continuous_variables();
+  const IntVector&  div = vars.all_discrete_int_variables();
+  const RealVector& drv = vars.all_discrete_real_variables();
+  const RealVector& fn_vals = response.function_values();
+  const ShortArray& asv = response.active_set_request_vector();
+  if (cv.length()  != eval_archive.numCV  ||
+      div.length() != eval_archive.numDIV ||
+      drv.length() != eval_archive.numDRV ||
+      fn_vals.length() != eval_archive.numFns) {
+    Cerr << "\nWarning: evaluation " << eval_id << " does not match the "
+	 << "dimensions of results archive\n  " << archive
+	 << "\nand is not archived." << std::endl;
+    return;
+  }
+
+  eval_archive.evalIds.push_back(eval_id);
+  eval_archive.cvRows.insert(eval_archive.cvRows.end(), cv.values(),
+			     cv.values() + cv.length());
+  eval_archive.divRows.insert(eval_archive.divRows.end(), div.values(),
+			      div.values() + div.length());
+  eval_archive.drvRows.insert(eval_archive.drvRows.end(), drv.values(),
+			      drv.values() + drv.length());
+  for (size_t i=0; i<eval_archive.numFns; ++i)
+    eval_archive.fnRows.push_back( (asv[i] & 1) ? fn_vals[i] :
+				   std::numeric_limits<Real>::quiet_NaN() );
+
+  if (++eval_archive.numPending >= chunkRows)
+    flush_archive(archive);
+}
+
+
+void ResultsDBHDF5::flush()
+{
+  std::map<String, EvaluationArchive>::const_iterator a_it;
+  for (a_it=evalArchives.begin(); a_it!=evalArchives.end(); ++a_it)
+    flush_archive(a_it->first);
+  hdf5Stream->flush();
+}
+
+
+/** The parent's buffered evaluations are discarded and the shared
+    file is neither written nor closed by this process. */
+void ResultsDBHDF5::detach_forked_child()
+{
+  detachedChild = true;
+  evalArchives.clear();
+  hdf5Stream->detach();
+}
+
+
+void ResultsDBHDF5::
+read_evaluation_labels(const StrStrSizet& iterator_id, const String& iface_id,
+		       const String& data_name, StringArray& labels)
+{
+  hdf5Stream->read_data(archive_name(iterator_id, iface_id) + '/' + data_name
+			+ "_labels", labels);
+}
+
+
+/** Datasets are only created for the types of data present, since an
+    HDF5 chunk may not be empty. */
+void ResultsDBHDF5::
+create_archive(const String& archive, const Variables& vars,
+	       const Response& response, EvaluationArchive& eval_archive)
+{
+  eval_archive.numCV  = vars.acv();
+  eval_archive.numDIV = vars.adiv();
+  eval_archive.numDRV = vars.adrv();
+  eval_archive.numFns = response.num_functions();
+  eval_archive.numPending = 0;
+
+  hdf5Stream->create_extensible_dataset<int>(archive + "/eval_ids", 1,
+					     chunkRows, compressLevel);
+
+  StringArray labels;
+  if (eval_archive.numCV) {
+    hdf5Stream->create_extensible_dataset<Real>(archive +
+      "/continuous_variables", eval_archive.numCV, chunkRows, compressLevel);
+    copy_data(vars.all_continuous_variable_labels(), labels);
+    hdf5Stream->store_data(archive + "/continuous_variables_labels", labels);
+  }
+  if (eval_archive.numDIV) {
+    hdf5Stream->create_extensible_dataset<int>(archive +
+      "/discrete_integer_variables", eval_archive.numDIV, chunkRows,
+      compressLevel);
+    copy_data(vars.all_discrete_int_variable_labels(), labels);
+    hdf5Stream->store_data(archive + "/discrete_integer_variables_labels",
+			   labels);
+  }
+  if (eval_archive.numDRV) {
+    hdf5Stream->create_extensible_dataset<Real>(archive +
+      "/discrete_real_variables", eval_archive.numDRV, chunkRows,
+      compressLevel);
+    copy_data(vars.all_discrete_real_variable_labels(), labels);
+    hdf5Stream->store_data(archive + "/discrete_real_variables_labels",
+			   labels);
+  }
+  if (eval_archive.numFns) {
+    hdf5Stream->create_extensible_dataset<Real>(archive + "/responses",
+      eval_archive.numFns, chunkRows, compressLevel);
+    hdf5Stream->store_data(archive + "/responses_labels",
+			   response.function_labels());
+  }
+
+  // reserve one chunk so that buffering does not reallocate
+  eval_archive.evalIds.reserve(chunkRows);
+  eval_archive.cvRows.reserve(chunkRows * eval_archive.numCV);
+  eval_archive.divRows.reserve(chunkRows * eval_archive.numDIV);
+  eval_archive.drvRows.reserve(chunkRows * eval_archive.numDRV);
+  eval_archive.fnRows.reserve(chunkRows * eval_archive.numFns);
+}
+
+
+void ResultsDBHDF5::flush_archive(const String& archive)
+{
+  std::map<String, EvaluationArchive>::iterator a_it
+    = evalArchives.find(archive);
+  if (a_it == evalArchives.end() || a_it->second.numPending == 0)
+    return;
+  EvaluationArchive& eval_archive = a_it->second;
+  size_t num_rows = eval_archive.numPending;
+
+  hdf5Stream->append_rows(archive + "/eval_ids", &eval_archive.evalIds[0],
+			  num_rows);
+  if (eval_archive.numCV)
+    hdf5Stream->append_rows(archive + "/continuous_variables",
+			    &eval_archive.cvRows[0], num_rows);
+  if (eval_archive.numDIV)
+    hdf5Stream->append_rows(archive + "/discrete_integer_variables",
+			    &eval_archive.divRows[0], num_rows);
+  if (eval_archive.numDRV)
+    hdf5Stream->append_rows(archive + "/discrete_real_variables",
+			    &eval_archive.drvRows[0], num_rows);
+  if (eval_archive.numFns)
+    hdf5Stream->append_rows(archive + "/responses", &eval_archive.fnRows[0],
+			    num_rows);
+  // write the chunk through to the file, so an interrupted run retains
+  // all completed chunks
+  hdf5Stream->flush();
+
+  // clear() retains capacity, so the buffers stay one chunk in size
+  eval_archive.evalIds.clear(); eval_archive.cvRows.clear();
+  eval_archive.divRows.clear(); eval_archive.drvRows.clear();
+  eval_archive.fnRows.clear();
+  eval_archive.numPending = 0;
+}
+
+}  // namespace Dakota
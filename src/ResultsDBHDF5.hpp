@@ -20,23 +20,40 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
+#include <map>
 
 namespace Dakota {
 
-
+class Variables;
+class Response;
+
+
+/// HDF5 results database: final iterator results and the evaluation
+/// history of each iterator run
+/** Final results are stored as they are inserted.  Evaluations are
+    buffered per iterator run and interface and appended a chunk of
+    rows at a time to extensible, chunked datasets (optionally
+    deflated) below /method/id/exec/evaluations/interface/, so memory
+    use is bounded by one chunk per archive regardless of run length.
+    Each evaluation is one row of the datasets eval_ids,
+    continuous_variables, discrete_integer_variables,
+    discrete_real_variables, and responses (NaN for values not
+    computed); column labels are stored once in <dataset>_labels. */
 class ResultsDBHDF5
 {
 
 public:
 
-  ResultsDBHDF5(bool in_core, const String& base_filename):
-    hdf5Stream(new HDF5BinaryStream(base_filename + 
-				    (in_core ? ".tmp.h5" : ".h5"), 
-				    in_core, false)
-	       )
-  { 
+  /// create base_filename.h5 to write results to, deflating evaluation
+  /// chunks of chunk_rows rows at compress_level (0 = no compression)
+  ResultsDBHDF5(bool in_core, const String& base_filename,
+		int compress_level = 0, size_t chunk_rows = 256);
 
-  }
+  /// open an existing results file read-only for post-processing
+  ResultsDBHDF5(const String& filename);
+
+  /// destructor writes any buffered evaluations
+  ~ResultsDBHDF5();
 
   /// insert a RealMatrix with metadata
   template<typename StoredType>
@@ -85,8 +102,73 @@ public:
   }
 
 
+  /// buffer an evaluation of interface iface_id by iterator_id, writing
+  /// the archive's rows to the file when a chunk is full
+  void insert_evaluation(const StrStrSizet& iterator_id, const String& iface_id,
+			 const Variables& vars, const Response& response,
+			 int eval_id);
+
+  /// write all buffered evaluations and flush the file
+  void flush();
+
+  /// in a forked child, drop buffered evaluations and leave the
+  /// parent's file unwritten and unclosed, including at destruction
+  void detach_forked_child();
+
+  /// read up to num_evals archived evaluations of data_name (e.g.,
+  /// "continuous_variables") starting at first_eval, one column per
+  /// evaluation as for sample matrices
+  template<typename T>
+  void read_evaluations(const StrStrSizet& iterator_id, const String& iface_id,
+			const String& data_name,
+			Teuchos::SerialDenseMatrix<int,T>& data,
+			size_t first_eval = 0,
+			size_t num_evals = std::numeric_limits<size_t>::max())
+  {
+    flush_archive(archive_name(iterator_id, iface_id));
+
+    std::vector<T> rows; size_t num_cols = 0;
+    hdf5Stream->read_rows(archive_name(iterator_id, iface_id) + '/' +
+			  data_name, rows, num_cols, first_eval, num_evals);
+    // rows are contiguous, so each becomes a column
+    data.shapeUninitialized(num_cols, (num_cols) ? rows.size()/num_cols : 0);
+    std::copy(rows.begin(), rows.end(), data.values());
+  }
+
+  /// read the column labels of an archived evaluation dataset
+  void read_evaluation_labels(const StrStrSizet& iterator_id,
+			      const String& iface_id, const String& data_name,
+			      StringArray& labels);
+
 private:
 
+  /// evaluations buffered for one iterator run and interface
+  struct EvaluationArchive
+  {
+    size_t numCV;      ///< continuous variables per evaluation
+    size_t numDIV;     ///< discrete integer variables per evaluation
+    size_t numDRV;     ///< discrete real variables per evaluation
+    size_t numFns;     ///< response functions per evaluation
+    size_t numPending; ///< buffered evaluations not yet written
+    IntArray  evalIds; ///< buffered evaluation ids
+    RealArray cvRows;  ///< buffered continuous variables, by evaluation
+    IntArray  divRows; ///< buffered discrete integer variables
+    RealArray drvRows; ///< buffered discrete real variables
+    RealArray fnRows;  ///< buffered function values
+  };
+
+  /// create the datasets and labels of a new evaluation archive
+  void create_archive(const String& archive, const Variables& vars,
+		      const Response& response, EvaluationArchive& eval_archive);
+
+  /// append an archive's buffered evaluations to its datasets
+  void flush_archive(const String& archive);
+
+  /// Group name for the evaluations of interface iface_id by iterator_id
+  String archive_name(const StrStrSizet& iterator_id, const String& iface_id)
+  { return dataset_name(iterator_id, "evaluations/" +
+			(iface_id.empty() ? String("NO_ID") : iface_id)); }
+
   /// Create a dataset name from the unique identifiers passed
   String dataset_name(const StrStrSizet& iterator_id, const String& data_name)
   {
@@ -109,6 +191,15 @@ private:
   /// default construct an output handler
   boost::scoped_ptr<HDF5BinaryStream> hdf5Stream;
 
+  /// deflate level for evaluation chunks; 0 disables compression
+  int compressLevel;
+  /// evaluations per chunk, which bounds the buffered rows per archive
+  size_t chunkRows;
+  /// buffered evaluations, keyed by archive group name
+  std::map<String, EvaluationArchive> evalArchives;
+  /// whether this copy was detached in a forked child
+  bool detachedChild;
+
 
 };
 
@@ -73,7 +73,8 @@ size_t ResultsID::get_id(const std::string& method_name,
 }
 
 
-void ResultsManager::initialize(const std::string& base_filename)
+void ResultsManager::
+initialize(const std::string& base_filename, int compress_level)
 {
   coreDBActive = true;
   coreDBFilename = base_filename + ".txt";
@@ -82,7 +83,7 @@ void ResultsManager::initialize(const std::string& base_filename)
 #ifdef DAKOTA_HAVE_HDF5
   hdf5DBActive = true;
   bool in_core = false;
-  hdf5DB.reset(new ResultsDBHDF5(in_core, base_filename));
+  hdf5DB.reset(new ResultsDBHDF5(in_core, base_filename, compress_level));
 #endif
 }
 
@@ -92,6 +93,27 @@ bool ResultsManager::active() const
   return (coreDBActive || hdf5DBActive);
 }
 
+
+bool ResultsManager::hdf5_active() const
+{
+  return hdf5DBActive;
+}
+
+
+/** The child's copy of the HDF5 database holds the parent's open file
+    and buffered evaluations, which it must not write, so it is
+    detached.  Results of the child are returned to the parent, which
+    stores them. */
+void ResultsManager::detach_forked_child()
+{
+  coreDBActive = false;
+#ifdef DAKOTA_HAVE_HDF5
+  if (hdf5DB)
+    hdf5DB->detach_forked_child();
+  hdf5DBActive = false;
+#endif
+}
+
 void ResultsManager::write_databases()
 {
   if (coreDBActive) {
@@ -100,6 +122,10 @@ void ResultsManager::write_databases()
     std::ofstream results_file(coreDBFilename.c_str());
     coreDB->print_data(results_file);
   }
+#ifdef DAKOTA_HAVE_HDF5
+  if (hdf5DBActive)
+    hdf5DB->flush();
+#endif
 }
 
 } // namespace Dakota
@@ -30,6 +30,11 @@ namespace Dakota {
 }
 #endif
 
+namespace Dakota {
+  class Variables;
+  class Response;
+}
+
 
 // Design notes (BMA, Fall 2012)
 
@@ -235,16 +240,38 @@ public:
   { /* no-op*/ }
 
   /// initialize the results manager to manage an in-core database,
-  /// writing to the specified file name
-  void initialize(const std::string& base_filename);
+  /// writing to the specified file name; compress_level is the
+  /// deflate level for the evaluation history in the HDF5 database
+  void initialize(const std::string& base_filename, int compress_level = 0);
 
   /// whether any databases are active
   bool active() const;
 
+  /// whether the HDF5 database, which archives evaluations, is active
+  bool hdf5_active() const;
+
+  /// in a child forked from this process, deactivate the databases
+  /// without writing or closing the parent's files
+  void detach_forked_child();
+
   // TODO: const
   /// Write in-core databases to file
   void write_databases();
 
+  /// archive an evaluation performed for iterator_id; only the file
+  /// database stores the evaluation history, as it is written
+  /// incrementally rather than held in core
+  void insert_evaluation(const StrStrSizet& iterator_id,
+			 const std::string& iface_id, const Variables& vars,
+			 const Response& response, int eval_id)
+  {
+#ifdef DAKOTA_HAVE_HDF5
+    if (hdf5DBActive)
+      hdf5DB->insert_evaluation(iterator_id, iface_id, vars, response,
+				eval_id);
+#endif
+  }
+
   /// Copy of valid results names for when manager is passed around
   ResultsNames results_names;
 
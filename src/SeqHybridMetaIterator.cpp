@@ -16,6 +16,14 @@
 #include "ParallelLibrary.hpp"
 #include "ParamResponsePair.hpp"
 #include "dakota_data_io.hpp"
+#include <boost/filesystem/operations.hpp>
+#include <cerrno>
+#include <fstream>
+#ifdef HAVE_WORKING_FORK
+#include <fcntl.h>      // for fcntl
+#include <sys/select.h> // for select
+#include <unistd.h>     // for pipe, read, close
+#endif
 
 static const char rcsId[]="@(#) $Id: SeqHybridMetaIterator.cpp 6972 2010-09-17 22:18:50Z briadam $";
 
@@ -23,7 +31,9 @@ static const char rcsId[]="@(#) $Id: SeqHybridMetaIterator.cpp 6972 2010-09-17 2
 namespace Dakota {
 
 SeqHybridMetaIterator::SeqHybridMetaIterator(ProblemDescDB& problem_db):
-  MetaIterator(problem_db), singlePassedModel(false)
+  MetaIterator(problem_db),
+  pipelinedHybrid(problem_db.get_bool("method.hybrid.pipelined")),
+  singlePassedModel(false)
   //seqHybridType(problem_db.get_string("method.hybrid.type")),
   //progressThreshold(problem_db.get_real("method.hybrid.progress_threshold"))
 {
@@ -65,7 +75,9 @@ SeqHybridMetaIterator::SeqHybridMetaIterator(ProblemDescDB& problem_db):
 
 SeqHybridMetaIterator::
 SeqHybridMetaIterator(ProblemDescDB& problem_db, Model& model):
-  MetaIterator(problem_db, model), singlePassedModel(true)
+  MetaIterator(problem_db, model),
+  pipelinedHybrid(problem_db.get_bool("method.hybrid.pipelined")),
+  singlePassedModel(true)
   //seqHybridType(problem_db.get_string("method.hybrid.type")),
   //progressThreshold(problem_db.get_real("method.hybrid.progress_threshold"))
 {
@@ -267,15 +279,21 @@ void SeqHybridMetaIterator::derived_free_communicators(ParLevLIter pl_iter)
 
 void SeqHybridMetaIterator::core_run()
 {
+  // results retained from local servers by a previous run are stale
+  bestVariablesArray.clear(); bestResponseArray.clear();
+
   if (seqHybridType == "adaptive") run_sequential_adaptive();
+  else if (pipelinedHybrid)        run_pipelined();
   else                             run_sequential();
 }
 
 
 /** In the sequential nonadaptive case, there is no interference with
     the iterators.  Each runs until its own convergence criteria is
-    satisfied.  Status: fully operational. */
-void SeqHybridMetaIterator::run_sequential()
+    satisfied.  Status: fully operational.  A start_index beyond the
+    first iterator continues a sequence for which parameterSets has
+    already been defined (see run_pipelined()). */
+void SeqHybridMetaIterator::run_sequential(size_t start_index)
 {
   size_t num_iterators = methodStrings.size();
   int server_id =  iterSched.iteratorServerId;
@@ -287,7 +305,7 @@ void SeqHybridMetaIterator::run_sequential()
   const ParallelLevel& parent_pl = (iterSched.miPLIndex) ? 
     methodPCIter->mi_parallel_level(iterSched.miPLIndex - 1) : mi_pl;
 
-  for (seqCount=0; seqCount<num_iterators; seqCount++) {
+  for (seqCount=start_index; seqCount<num_iterators; seqCount++) {
 
     // each of these is safe for all processors
     Iterator& curr_iterator = selectedIterators[seqCount];
@@ -436,6 +454,12 @@ void SeqHybridMetaIterator::run_sequential()
       }
     }
   }
+
+  // the final iterator jobs ran in local servers, so their results are
+  // only available from prpResults
+  if (rank0 && !iterSched.messagePass && iterSched.numIteratorJobs > 1 &&
+      iterSched.local_server_concurrency() > 1)
+    retain_best_results();
 }
 
 
@@ -499,6 +523,324 @@ void SeqHybridMetaIterator::run_sequential_adaptive()
 }
 
 
+/** In the pipelined case, the first iterator in the sequence runs in
+    a forked local server that streams its evaluations back to this
+    process.  Whenever a local server is free and the incumbent (the
+    best streamed objective) has improved since the last assignment,
+    the second iterator is started from it, such that refinement of
+    promising points overlaps the first iterator rather than waiting
+    for it to complete.  Once the first iterator completes, any of its
+    final solutions that were not already used as starting points are
+    assigned as well, and the remaining iterators in the sequence then
+    proceed as in run_sequential().  Since each iterator runs in its
+    own process, no iterator or model is required to be reentrant. */
+void SeqHybridMetaIterator::run_pipelined()
+{
+  size_t i, num_iterators = methodStrings.size();
+  int num_servers = iterSched.local_server_concurrency();
+  const Model& first_model
+    = (selectedModels.empty()) ? iteratedModel : selectedModels[0];
+  if (num_iterators < 2 || num_servers < 2 ||
+      selectedIterators[1].accepts_multiple_points() ||
+      ( first_model.num_primary_fns() != 1 &&
+	first_model.primary_fn_type() != CALIB_TERMS ) ) {
+    if (summaryOutputFlag)
+      Cerr << "Warning: pipelined hybrid requires a single-point second "
+	   << "iterator, a single objective\n         or least squares "
+	   << "terms, and at least two local iterator servers.  Reverting\n"
+	   << "         to a sequential hybrid.\n";
+    run_sequential();
+    return;
+  }
+
+  Cout << "\n>>>>> Running Pipelined Sequential Hybrid with iterators "
+       << methodStrings[0] << " and " << methodStrings[1] << ".\n";
+
+  // job 0 runs the first iterator and streams its evaluations, writing
+  // a byte to a pipe after each so that this process can block on it
+  int notify_fds[2] = { -1, -1 };
+#ifdef HAVE_WORKING_FORK
+  if (pipe(notify_fds) == -1) {
+    Cerr << "\nError: could not create pipe for pipelined hybrid; error code "
+	 << errno << std::endl;
+    abort_handler(-1);
+  }
+  fcntl(notify_fds[1], F_SETFL, O_NONBLOCK);
+  fcntl(notify_fds[1], F_SETFD, FD_CLOEXEC); // not held by analysis drivers
+#endif
+  seqCount = 0;
+  if (iterSched.fork_local_server(0)) {
+#ifdef HAVE_WORKING_FORK
+    close(notify_fds[0]);
+#endif
+    Model& stream_model
+      = (selectedModels.empty()) ? iteratedModel : selectedModels[0];
+    stream_model.auto_graphics(true); // evaluations are streamed when posted
+    parallelLib.output_manager().
+      evaluation_stream(iterSched.local_stream_file(0), notify_fds[1]);
+    iterSched.run_iterator(selectedIterators[0]);
+    PRPArray prp_results;
+    update_local_results(prp_results, 1);
+    MPIPackBuffer send_buffer;
+    send_buffer << prp_results;
+    iterSched.exit_local_server(0, send_buffer); // does not return
+  }
+
+  // jobs 1, 2, ... run the second iterator, with results in prpResults[job-1]
+  seqCount = 1;
+  const Model& next_model
+    = (selectedModels.empty()) ? iteratedModel : selectedModels[1];
+  const BoolDeque& max_sense = first_model.primary_response_fn_sense();
+  bool maximize = (!max_sense.empty() && max_sense[0]), first_active = true,
+    new_incumbent = false;
+  String stream_file = iterSched.local_stream_file(0);
+  std::streamoff stream_offset = 0;
+  Real incumbent_obj = 0., obj;
+  Variables incumbent_vars;
+  VariablesArray start_points, pending_points;
+  PRPArray first_results;
+  int num_active = 1, num_jobs = 1, num_early = 0,
+    notify_fd = notify_fds[0];
+#ifdef HAVE_WORKING_FORK
+  close(notify_fds[1]); // end of file once the first iterator exits
+#endif
+  prpResults.clear(); parameterSets.clear();
+  while (num_active || !pending_points.empty()) {
+
+    // stream in the latest evaluations of the first iterator and track
+    // the incumbent; points not matching the second model are skipped
+    if (first_active) {
+      PRPArray new_evals;
+      read_evaluation_stream(stream_file, stream_offset, new_evals);
+      size_t num_evals = new_evals.size();
+      for (i=0; i<num_evals; ++i) {
+	const Variables& vars = new_evals[i].variables();
+	if (!pipeline_objective(new_evals[i].response(), obj) ||
+	    vars.cv()  != next_model.cv()  || vars.div() != next_model.div() ||
+	    vars.dsv() != next_model.dsv() || vars.drv() != next_model.drv())
+	  continue;
+	if (incumbent_vars.is_null() ||
+	    ( (maximize) ? obj > incumbent_obj : obj < incumbent_obj ) ) {
+	  incumbent_obj  = obj;
+	  incumbent_vars = vars.copy();
+	  new_incumbent  = true;
+	}
+      }
+      // start the second iterator from a new incumbent on a free server
+      if (new_incumbent && num_active < num_servers) {
+	Cout << "Pipelined hybrid: starting " << methodStrings[1]
+	     << " job " << num_jobs << " from incumbent objective "
+	     << incumbent_obj << '\n';
+	start_points.push_back(incumbent_vars);
+	prpResults.resize(num_jobs);
+	fork_pipeline_job(num_jobs++, incumbent_vars);
+	++num_active; ++num_early; new_incumbent = false;
+      }
+    }
+
+    // start the second iterator from final solutions of the first
+    while (!pending_points.empty() && num_active < num_servers) {
+      start_points.push_back(pending_points.front());
+      prpResults.resize(num_jobs);
+      fork_pipeline_job(num_jobs++, pending_points.front());
+      pending_points.erase(pending_points.begin());
+      ++num_active;
+    }
+
+    // retrieve any completed results.  While a server is free for a new
+    // incumbent, block on the stream of the first iterator; otherwise
+    // block on the local servers.
+    MPIUnpackBuffer recv_buffer;
+    int job_index = -1;
+    if (first_active && notify_fd >= 0 && num_active < num_servers) {
+      wait_evaluation_stream(notify_fd);
+      job_index = iterSched.wait_local_server(recv_buffer, false);
+    }
+    else if (num_active)
+      job_index = iterSched.wait_local_server(recv_buffer, true);
+    if (job_index == 0) {
+      recv_buffer >> first_results;
+      first_active = false;
+      boost::system::error_code ec; // ignore removal failures
+      boost::filesystem::remove(stream_file, ec);
+      // final solutions not already used as starting points are pending
+      size_t j, num_starts = start_points.size(),
+	num_first = first_results.size();
+      for (i=0; i<num_first; ++i) {
+	const Variables& vars = first_results[i].variables();
+	for (j=0; j<num_starts; ++j)
+	  if (vars == start_points[j])
+	    break;
+	if (j == num_starts)
+	  pending_points.push_back(vars);
+      }
+      --num_active;
+    }
+    else if (job_index > 0) {
+      recv_buffer >> prpResults[job_index-1];
+      --num_active;
+    }
+  }
+#ifdef HAVE_WORKING_FORK
+  if (notify_fd >= 0)
+    close(notify_fd);
+#endif
+  Cout << "Pipelined hybrid: " << num_early << " of " << num_jobs - 1
+       << " runs of " << methodStrings[1] << " were started before "
+       << methodStrings[0] << " completed.\n";
+
+  // collect the results of the second iterator for the rest of the sequence
+  size_t j, num_prp_i, num_results = prpResults.size();
+  for (i=0; i<num_results; ++i) {
+    const PRPArray& prp_results_i = prpResults[i];
+    num_prp_i = prp_results_i.size();
+    for (j=0; j<num_prp_i; ++j)
+      parameterSets.push_back(prp_results_i[j].variables());
+  }
+  if (num_iterators > 2)
+    run_sequential(2);
+  else // the second iterator is final
+    retain_best_results();
+}
+
+
+/** The child process updates the second model from start_vars, runs
+    the second iterator, and returns its final solutions to the parent
+    using the local server conventions of IteratorScheduler. */
+void SeqHybridMetaIterator::
+fork_pipeline_job(int job_index, const Variables& start_vars)
+{
+  if (iterSched.fork_local_server(job_index)) {
+    Model& next_model
+      = (selectedModels.empty()) ? iteratedModel : selectedModels[1];
+    next_model.active_variables(start_vars);
+    iterSched.run_iterator(selectedIterators[1]);
+    PRPArray prp_results;
+    update_local_results(prp_results, job_index+1);
+    MPIPackBuffer send_buffer;
+    send_buffer << prp_results;
+    iterSched.exit_local_server(job_index, send_buffer); // does not return
+  }
+}
+
+
+/** Blocks until the first iterator has streamed another evaluation or
+    has exited, in which case notify_fd is closed and set to -1. */
+void SeqHybridMetaIterator::wait_evaluation_stream(int& notify_fd)
+{
+#ifdef HAVE_WORKING_FORK
+  fd_set read_fds;
+  FD_ZERO(&read_fds);
+  FD_SET(notify_fd, &read_fds);
+  if (select(notify_fd + 1, &read_fds, NULL, NULL, NULL) == -1) {
+    if (errno == EINTR)
+      return;
+    Cerr << "\nError: wait on pipelined hybrid evaluation stream failed; "
+	 << "error code " << errno << std::endl;
+    abort_handler(-1);
+  }
+  // drain the notifications, since the records are read from the file
+  char notify[256];
+  if (read(notify_fd, notify, sizeof(notify)) <= 0) {
+    close(notify_fd);
+    notify_fd = -1;
+  }
+#endif
+}
+
+
+/** Records are written by OutputManager::evaluation_stream() as an int
+    length followed by a packed ParamResponsePair.  A record that is
+    only partially written is left for a subsequent call. */
+void SeqHybridMetaIterator::
+read_evaluation_stream(const String& stream_file, std::streamoff& stream_offset,
+		       PRPArray& new_evals)
+{
+  std::ifstream stream_fs(stream_file.c_str(), std::ios::binary);
+  if (!stream_fs) // not yet created by the first iterator
+    return;
+  stream_fs.seekg(0, std::ios::end);
+  std::streamoff stream_end = stream_fs.tellg(),
+    len_size = (std::streamoff)sizeof(int);
+  int buffer_len;
+  while (stream_end - stream_offset >= len_size) {
+    stream_fs.seekg(stream_offset);
+    stream_fs.read((char*)&buffer_len, sizeof(int));
+    if (!stream_fs.good() || stream_end - stream_offset - len_size < buffer_len)
+      break;
+    char* data = new char [buffer_len];
+    stream_fs.read(data, buffer_len);
+    MPIUnpackBuffer recv_buffer;
+    recv_buffer.setup(data, buffer_len, true); // buffer owns data
+    if (!stream_fs.good())
+      break;
+    ParamResponsePair prp;
+    recv_buffer >> prp;
+    new_evals.push_back(prp);
+    stream_offset += len_size + buffer_len;
+  }
+}
+
+
+bool SeqHybridMetaIterator::
+pipeline_objective(const Response& resp, Real& obj) const
+{
+  const Model& first_model
+    = (selectedModels.empty()) ? iteratedModel : selectedModels[0];
+  size_t i, num_primary = first_model.num_primary_fns();
+  if (resp.is_null() || resp.num_functions() < num_primary)
+    return false;
+  const ShortArray& asv = resp.active_set_request_vector();
+  for (i=0; i<num_primary; ++i)
+    if (!(asv[i] & 1))
+      return false;
+  if (num_primary == 1)
+    obj = resp.function_value(0);
+  else { // least squares terms
+    obj = 0.;
+    for (i=0; i<num_primary; ++i)
+      obj += std::pow(resp.function_value(i), 2);
+  }
+  return true;
+}
+
+
+/** Without a single objective or least squares terms to rank them,
+    the first of the results is retained. */
+void SeqHybridMetaIterator::retain_best_results()
+{
+  const Model& final_model = (selectedModels.empty()) ?
+    iteratedModel : selectedModels[methodStrings.size()-1];
+  const BoolDeque& max_sense = final_model.primary_response_fn_sense();
+  bool maximize = (!max_sense.empty() && max_sense[0]), found = false,
+    rank = ( final_model.num_primary_fns() == 1 ||
+	     final_model.primary_fn_type() == CALIB_TERMS );
+  size_t i, j, num_prp_i, num_results = prpResults.size();
+  Real best_obj = 0., obj;
+  bestVariablesArray.clear(); bestResponseArray.clear();
+  for (i=0; i<num_results; ++i) {
+    const PRPArray& prp_results_i = prpResults[i];
+    num_prp_i = prp_results_i.size();
+    for (j=0; j<num_prp_i; ++j) {
+      const ParamResponsePair& prp = prp_results_i[j];
+      if (prp.variables().is_null())
+	continue;
+      if (!rank) {
+	bestVariablesArray.assign(1, prp.variables());
+	bestResponseArray.assign(1, prp.response());
+	return;
+      }
+      if (pipeline_objective(prp.response(), obj) &&
+	  ( !found || ( (maximize) ? obj > best_obj : obj < best_obj ) ) ) {
+	best_obj = obj; found = true;
+	bestVariablesArray.assign(1, prp.variables());
+	bestResponseArray.assign(1, prp.response());
+      }
+    }
+  }
+}
+
+
 void SeqHybridMetaIterator::
 update_local_results(PRPArray& prp_results, int job_id)
 {
@@ -543,7 +885,8 @@ void SeqHybridMetaIterator::print_results(std::ostream& s)
 {
   // provide a final summary in cases where the default iterator output
   // is insufficient
-  if (iterSched.messagePass) {// || numIteratorJobs > 1
+  if (iterSched.messagePass || pipelinedHybrid ||
+      iterSched.local_server_concurrency() > 1) {// || numIteratorJobs > 1
     size_t i, j, cntr = 0, num_prp_res = prpResults.size(), num_prp_i;
     s << "\n<<<<< Sequential hybrid final solution sets:\n";
     for (i=0; i<num_prp_res; ++i) {
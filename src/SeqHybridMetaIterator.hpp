@@ -26,16 +26,19 @@ namespace Dakota {
 /// optimization and nonlinear least squares methods on multiple
 /// models of varying fidelity.
 
-/** Sequential hybrid meta-iteration supports two approaches: (1) the
-    non-adaptive sequential hybrid runs one method to completion,
+/** Sequential hybrid meta-iteration supports three approaches: (1)
+    the non-adaptive sequential hybrid runs one method to completion,
     passes its best results as the starting point for a subsequent
     method, and continues this succession until all methods have been
     executed (the stopping rules are controlled internally by each
-    iterator), and (2) the adaptive sequential hybrid uses adaptive
+    iterator), (2) the adaptive sequential hybrid uses adaptive
     stopping rules for the iterators that are controlled externally by
-    this method.  Any iterator may be used so long as it defines the
-    notion of a final solution which can be passed as starting data
-    for subsequent iterators. */
+    this method, and (3) the pipelined sequential hybrid starts the
+    second method from improving intermediate results of the first
+    while the first is still running, using forked local servers.
+    Any iterator may be used so long as it defines the notion of a
+    final solution which can be passed as starting data for
+    subsequent iterators. */
 
 class SeqHybridMetaIterator: public MetaIterator
 {
@@ -95,8 +98,28 @@ private:
   //- Heading: Convenience member functions
   //
 
-  void run_sequential();          ///< run a sequential hybrid
+  /// run a sequential hybrid, beginning with the iterator at start_index
+  void run_sequential(size_t start_index = 0);
   void run_sequential_adaptive(); ///< run a sequential adaptive hybrid
+  void run_pipelined();           ///< run a pipelined sequential hybrid
+
+  /// fork a local server that runs the second iterator in the sequence
+  /// from start_vars (pipelined hybrid)
+  void fork_pipeline_job(int job_index, const Variables& start_vars);
+  /// block until the first iterator in the sequence streams another
+  /// evaluation or exits (pipelined hybrid)
+  void wait_evaluation_stream(int& notify_fd);
+  /// append the complete evaluation records written since stream_offset
+  /// by the first iterator in the sequence (pipelined hybrid)
+  void read_evaluation_stream(const String& stream_file,
+			      std::streamoff& stream_offset,
+			      PRPArray& new_evals);
+  /// compute the objective (or least squares sum) for a response from
+  /// the first iterator; returns false if the response does not define it
+  bool pipeline_objective(const Response& resp, Real& obj) const;
+  /// retain the best of the final results in prpResults, which were
+  /// computed in local servers, as the results of the hybrid
+  void retain_best_results();
 
   /// convert num_sets and job_index into a start_index and job_size for
   /// extraction from parameterSets
@@ -115,6 +138,9 @@ private:
   //
 
   String   seqHybridType; ///< empty (default) or "adaptive"
+  /// overlap the first two iterators in the sequence by starting the
+  /// second from intermediate results of the first
+  bool pipelinedHybrid;
 
   /// the list of method pointer or method name identifiers
   StringArray methodStrings;
@@ -175,12 +201,23 @@ inline IntIntPair SeqHybridMetaIterator::estimate_partition_bounds()
 }
 
 
+/** A pipelined hybrid, or a sequential hybrid with local iterator
+    servers, may run its final iterator in local servers, in which
+    case the best of their results is retained locally. */
 inline const Variables& SeqHybridMetaIterator::variables_results() const
-{ return selectedIterators[methodStrings.size()-1].variables_results(); }
+{
+  return (bestVariablesArray.empty()) ?
+    selectedIterators[methodStrings.size()-1].variables_results() :
+    bestVariablesArray.front();
+}
 
 
 inline const Response& SeqHybridMetaIterator::response_results() const
-{ return selectedIterators[methodStrings.size()-1].response_results(); }
+{
+  return (bestResponseArray.empty()) ?
+    selectedIterators[methodStrings.size()-1].response_results() :
+    bestResponseArray.front();
+}
 
 
 inline void SeqHybridMetaIterator::
@@ -0,0 +1,481 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014 Sandia Corporation.
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:	 SparseGaussProcApproximation
+//- Description: Class implementation for sparse Gaussian Process
+//-              Approximation
+//- Owner:
+//- Checked by:
+//- Version:
+
+#include "SparseGaussProcApproximation.hpp"
+#include "dakota_data_types.hpp"
+#include "DakotaIterator.hpp"
+#include "DakotaVariables.hpp"
+#ifdef HAVE_NCSU
+#include "NCSUOptimizer.hpp"
+#endif
+#include "ProblemDescDB.hpp"
+
+#include "Teuchos_BLAS.hpp"
+#include "Teuchos_LAPACK.hpp"
+#include <cfloat>
+
+//#define DEBUG
+
+
+namespace Dakota {
+
+//initialization of statics
+SparseGaussProcApproximation* SparseGaussProcApproximation::SGPinstance(NULL);
+
+
+SparseGaussProcApproximation::
+SparseGaussProcApproximation(const ProblemDescDB& problem_db,
+			     const SharedApproxData& shared_data,
+			     const String& approx_label):
+  Approximation(BaseConstructor(), problem_db, shared_data, approx_label),
+  numInducingSpec(problem_db.get_int("model.surrogate.inducing_points")),
+  noiseRatio(1.e-6), procVar(1.)
+{
+  const String& trend_string
+    = problem_db.get_string("model.surrogate.trend_order");
+  if (trend_string == "constant")               trendOrder = 0;
+  else if (trend_string == "linear")            trendOrder = 1;
+  else if (trend_string == "reduced_quadratic") trendOrder = 2;
+  else {
+    Cerr << "\nError (global_sparse_gaussian): unsupported trend "
+	 << trend_string << "; valid options are constant, linear, or "
+	 << "reduced_quadratic" << std::endl;
+    abort_handler(-1);
+  }
+
+#ifdef HAVE_NCSU
+  Cout << "Using NCSU DIRECT to optimize correlation coefficients."<<std::endl;
+#else
+  Cerr << "Error: NCSU DIRECT Optimizer is not available to calculate "
+       << "the correlation coefficients governing the Gaussian process."
+       << "Aborting process. " << std::endl;
+  abort_handler(-1);
+#endif
+}
+
+
+int SparseGaussProcApproximation::min_coefficients() const
+{
+  // as for GaussProcApproximation: number of design variables + 1
+  return sharedDataRep->numVars + 1;
+}
+
+
+int SparseGaussProcApproximation::num_constraints() const
+{ return (approxData.anchor()) ? 1 : 0; }
+
+
+void SparseGaussProcApproximation::build()
+{
+  // base class implementation checks data set against min required
+  Approximation::build();
+
+  size_t i, j, offset = 0, num_v = sharedDataRep->numVars;
+  numObs = approxData.points();
+  // the anchorPoint is treated as another currentPoint
+  if (approxData.anchor()) {
+    offset  = 1;
+    numObs += 1;
+  }
+
+  // Transfer the training data, one point per column
+  normTrainPoints.shapeUninitialized(num_v, numObs);
+  trainResiduals.sizeUninitialized(numObs);
+  if (approxData.anchor()) {
+    const RealVector& c_vars = approxData.anchor_continuous_variables();
+    for (j=0; j<num_v; ++j)
+      normTrainPoints(j,0) = c_vars[j];
+    trainResiduals[0] = approxData.anchor_function();
+  }
+  for (i=offset; i<numObs; ++i) {
+    const RealVector& c_vars = approxData.continuous_variables(i-offset);
+    for (j=0; j<num_v; ++j)
+      normTrainPoints(j,i) = c_vars[j];
+    trainResiduals[i] = approxData.response_function(i-offset);
+  }
+
+  normalize_training_data();
+  fit_trend();
+  select_inducing_points();
+
+  if (sharedDataRep->outputLevel > NORMAL_OUTPUT)
+    Cout << "\nBuilding sparse GP using " << numObs << " training points and "
+	 << numInducing << " inducing points...\n";
+  optimize_theta_global();
+  // final factors use every training point
+  if (compute_factors(1) >= 5.e100) {
+    Cerr << "\nError: sparse GP covariance factorization failed for the "
+	 << "optimal correlation\n       parameters; consider fewer "
+	 << "inducing_points." << std::endl;
+    abort_handler(-1);
+  }
+
+#ifdef DEBUG
+  Cout << "Theta:\n" << thetaParams << "noise ratio = " << noiseRatio
+       << "\nprocess variance = " << procVar << std::endl;
+#endif //DEBUG
+}
+
+
+Real SparseGaussProcApproximation::value(const Variables& vars)
+{
+  const RealVector& c_vars = vars.continuous_variables();
+  get_cov_vector(c_vars);
+
+  RealVector basis;
+  trend_basis(approxPoint.values(), basis);
+  approxValue = basis.dot(betaCoeffs) + covVector.dot(meanWeights);
+  return approxValue;
+}
+
+
+const RealVector& SparseGaussProcApproximation::
+gradient(const Variables& vars)
+{
+  const RealVector& c_vars = vars.continuous_variables();
+  get_cov_vector(c_vars);
+
+  size_t i, j, num_v = sharedDataRep->numVars;
+  approxGradient.size(num_v); // init to 0
+  // d/dx of exp(-sum_i exp(theta_i) (x_i - z_i)^2)
+  for (j=0; j<numInducing; ++j) {
+    Real wk = meanWeights[j] * covVector[j];
+    for (i=0; i<num_v; ++i)
+      approxGradient[i] -= 2. * wk * std::exp(thetaParams[i]) *
+	(approxPoint[i] - inducingPoints(i,j));
+  }
+  // add trend derivative and account for the input scaling
+  for (i=0; i<num_v; ++i) {
+    switch (trendOrder) {
+    case 1: approxGradient[i] += betaCoeffs[i+1];                     break;
+    case 2: approxGradient[i] += betaCoeffs[i+1] +
+	      2. * betaCoeffs[num_v+i+1] * approxPoint[i];            break;
+    }
+    approxGradient[i] /= trainStdvs[i];
+  }
+  return approxGradient;
+}
+
+
+Real SparseGaussProcApproximation::
+prediction_variance(const Variables& vars)
+{
+  const RealVector& c_vars = vars.continuous_variables();
+  get_cov_vector(c_vars);
+
+  // t1 = Lmm^{-1} k, t2 = LA^{-1} t1;
+  // var = procVar * (1 - t1^T t1 + noiseRatio * t2^T t2)
+  Teuchos::BLAS<int, Real> blas;
+  int m = numInducing;
+  RealVector t1(covVector), t2;
+  blas.TRSM(Teuchos::LEFT_SIDE, Teuchos::LOWER_TRI, Teuchos::NO_TRANS,
+	    Teuchos::NON_UNIT_DIAG, m, 1, 1., cholKmm.values(), m,
+	    t1.values(), m);
+  t2 = t1;
+  blas.TRSM(Teuchos::LEFT_SIDE, Teuchos::LOWER_TRI, Teuchos::NO_TRANS,
+	    Teuchos::NON_UNIT_DIAG, m, 1, 1., cholA.values(), m,
+	    t2.values(), m);
+  approxVariance = procVar * (1. - t1.dot(t1) + noiseRatio * t2.dot(t2));
+  if (approxVariance < 0.) approxVariance = 0.;
+  return approxVariance;
+}
+
+
+void SparseGaussProcApproximation::normalize_training_data()
+{
+  size_t i, j, num_v = sharedDataRep->numVars;
+  trainMeans.size(num_v);
+  trainStdvs.size(num_v);
+  for (j=0; j<numObs; ++j)
+    for (i=0; i<num_v; ++i)
+      trainMeans[i] += normTrainPoints(i,j);
+  for (i=0; i<num_v; ++i)
+    trainMeans[i] /= (Real)numObs;
+  for (j=0; j<numObs; ++j)
+    for (i=0; i<num_v; ++i) {
+      normTrainPoints(i,j) -= trainMeans[i];
+      trainStdvs[i] += normTrainPoints(i,j) * normTrainPoints(i,j);
+    }
+  for (i=0; i<num_v; ++i) {
+    trainStdvs[i] = std::sqrt(trainStdvs[i] / (Real)(numObs-1));
+    if (trainStdvs[i] <= 0.) trainStdvs[i] = 1.; // constant input
+  }
+  for (j=0; j<numObs; ++j)
+    for (i=0; i<num_v; ++i)
+      normTrainPoints(i,j) /= trainStdvs[i];
+}
+
+
+void SparseGaussProcApproximation::
+trend_basis(const Real* x, RealVector& basis) const
+{
+  size_t i, num_v = sharedDataRep->numVars;
+  basis.sizeUninitialized(1 + trendOrder * num_v);
+  basis[0] = 1.;
+  if (trendOrder > 0)
+    for (i=0; i<num_v; ++i) {
+      basis[i+1] = x[i];
+      if (trendOrder == 2)
+	basis[num_v+i+1] = x[i] * x[i];
+    }
+}
+
+
+void SparseGaussProcApproximation::fit_trend()
+{
+  // ordinary least squares via the normal equations, accumulated one
+  // point at a time so that no n x p matrix is formed
+  size_t i, j, num_v = sharedDataRep->numVars;
+  int p = 1 + trendOrder * num_v;
+  RealSymMatrix FtF(p);  // init to 0
+  RealVector Fty(p), basis;
+  for (j=0; j<numObs; ++j) {
+    trend_basis(normTrainPoints[j], basis);
+    for (int r=0; r<p; ++r) {
+      Fty[r] += basis[r] * trainResiduals[j];
+      for (int c=0; c<=r; ++c)
+	FtF(r,c) += basis[r] * basis[c];
+    }
+  }
+
+  // small ridge keeps the solve well posed for degenerate designs
+  Teuchos::LAPACK<int, Real> lapack;
+  RealMatrix L(p, p);
+  for (int r=0; r<p; ++r) {
+    for (int c=0; c<=r; ++c)
+      L(r,c) = FtF(r,c);
+    L(r,r) += 1.e-10 * (FtF(r,r) + 1.);
+  }
+  int info;
+  lapack.POTRF('L', p, L.values(), p, &info);
+  if (info) {
+    Cerr << "Error: trend least squares failed in "
+	 << "SparseGaussProcApproximation." << std::endl;
+    abort_handler(-1);
+  }
+  betaCoeffs = Fty;
+  lapack.POTRS('L', p, 1, L.values(), p, betaCoeffs.values(), p, &info);
+
+  for (j=0; j<numObs; ++j) {
+    trend_basis(normTrainPoints[j], basis);
+    trainResiduals[j] -= basis.dot(betaCoeffs);
+  }
+}
+
+
+void SparseGaussProcApproximation::select_inducing_points()
+{
+  size_t i, j, k, num_v = sharedDataRep->numVars;
+  if (numInducingSpec > 0)
+    numInducing = std::min((size_t)numInducingSpec, numObs);
+  else // default scales with the dimension, not with the data size
+    numInducing = std::min(numObs, std::max((size_t)50, 10*num_v));
+
+  // greedy farthest-point traversal in normalized space, started from
+  // the point nearest the centroid (the origin after normalization);
+  // O(n m) distance evaluations
+  RealVector min_dist(numObs);
+  size_t next = 0;
+  for (j=0; j<numObs; ++j) {
+    Real d = 0.;
+    for (i=0; i<num_v; ++i)
+      d += normTrainPoints(i,j) * normTrainPoints(i,j);
+    min_dist[j] = d;
+    if (d < min_dist[next]) next = j;
+  }
+  inducingPoints.shapeUninitialized(num_v, numInducing);
+  for (k=0; k<numInducing; ++k) {
+    const Real* z = normTrainPoints[next];
+    for (i=0; i<num_v; ++i)
+      inducingPoints(i,k) = z[i];
+    size_t farthest = 0;
+    for (j=0; j<numObs; ++j) {
+      const Real* x = normTrainPoints[j];
+      Real d = 0.;
+      for (i=0; i<num_v; ++i)
+	d += (x[i] - z[i]) * (x[i] - z[i]);
+      if (k == 0 || d < min_dist[j]) min_dist[j] = d;
+      if (min_dist[j] > min_dist[farthest]) farthest = j;
+    }
+    next = farthest;
+  }
+}
+
+
+Real SparseGaussProcApproximation::
+correlation(const Real* x1, const Real* x2) const
+{
+  size_t i, num_v = sharedDataRep->numVars;
+  Real sume = 0.;
+  for (i=0; i<num_v; ++i)
+    sume += std::exp(thetaParams[i]) * (x1[i] - x2[i]) * (x1[i] - x2[i]);
+  return std::exp(-sume);
+}
+
+
+Real SparseGaussProcApproximation::compute_factors(size_t stride)
+{
+  Teuchos::BLAS<int, Real>   blas;
+  Teuchos::LAPACK<int, Real> lapack;
+  int i, j, info, m = numInducing;
+
+  // inducing point correlation matrix and its Cholesky factor; as in
+  // GaussProcApproximation, a growing nugget handles near singularity
+  cholKmm.shapeUninitialized(m, m);
+  Real nugget = 1.e-10;
+  do {
+    for (j=0; j<m; ++j)
+      for (i=j; i<m; ++i)
+	cholKmm(i,j) = correlation(inducingPoints[i], inducingPoints[j]);
+    for (j=0; j<m; ++j)
+      cholKmm(j,j) += nugget;
+    lapack.POTRF('L', m, cholKmm.values(), m, &info);
+    nugget *= 10.;
+  } while (info > 0 && nugget < 1.e-2);
+  if (info)
+    return 5.e100;
+
+  // accumulate A = noiseRatio*I + V V^T, V y, y^T y, and trace(V V^T)
+  // over blocks of training points, V = Lmm^{-1} Kmn; memory is O(m^2)
+  const int block = 256;
+  RealMatrix V_b(m, block, false);
+  cholA.shape(m, m);    // init to 0
+  RealVector Vy(m);     // init to 0
+  Real yty = 0., trace_q = 0.;
+  size_t n = 0, pt = 0;
+  while (pt < numObs) {
+    int nb = 0;
+    RealVector y_b(block);
+    for (; nb < block && pt < numObs; ++nb, pt += stride, ++n) {
+      const Real* x = normTrainPoints[pt];
+      for (i=0; i<m; ++i)
+	V_b(i,nb) = correlation(inducingPoints[i], x);
+      y_b[nb] = trainResiduals[pt];
+      yty += y_b[nb] * y_b[nb];
+    }
+    blas.TRSM(Teuchos::LEFT_SIDE, Teuchos::LOWER_TRI, Teuchos::NO_TRANS,
+	      Teuchos::NON_UNIT_DIAG, m, nb, 1., cholKmm.values(), m,
+	      V_b.values(), m);
+    blas.SYRK(Teuchos::LOWER_TRI, Teuchos::NO_TRANS, m, nb, 1.,
+	      V_b.values(), m, 1., cholA.values(), m);
+    blas.GEMV(Teuchos::NO_TRANS, m, nb, 1., V_b.values(), m, y_b.values(),
+	      1, 1., Vy.values(), 1);
+    for (j=0; j<nb; ++j)
+      for (i=0; i<m; ++i)
+	trace_q += V_b(i,j) * V_b(i,j);
+  }
+  for (i=0; i<m; ++i)
+    cholA(i,i) += noiseRatio;
+  lapack.POTRF('L', m, cholA.values(), m, &info);
+  if (info)
+    return 5.e100;
+
+  // c = LA^{-1} V y;  y^T (Q + noiseRatio I)^{-1} y = (y^T y - c^T c)/ratio
+  RealVector c(Vy);
+  blas.TRSM(Teuchos::LEFT_SIDE, Teuchos::LOWER_TRI, Teuchos::NO_TRANS,
+	    Teuchos::NON_UNIT_DIAG, m, 1, 1., cholA.values(), m,
+	    c.values(), m);
+  Real quad = (yty - c.dot(c)) / noiseRatio;
+  procVar = std::max(quad / (Real)n, DBL_MIN);
+
+  // predictive mean weights: Lmm^{-T} LA^{-T} c
+  meanWeights = c;
+  blas.TRSM(Teuchos::LEFT_SIDE, Teuchos::LOWER_TRI, Teuchos::TRANS,
+	    Teuchos::NON_UNIT_DIAG, m, 1, 1., cholA.values(), m,
+	    meanWeights.values(), m);
+  blas.TRSM(Teuchos::LEFT_SIDE, Teuchos::LOWER_TRI, Teuchos::TRANS,
+	    Teuchos::NON_UNIT_DIAG, m, 1, 1., cholKmm.values(), m,
+	    meanWeights.values(), m);
+
+  // negative VFE bound (times 2, constants dropped), process variance
+  // profiled out:  n log(procVar) + log|Q + ratio I| + tr(K - Q)/ratio
+  Real log_det = (Real)(n - m) * std::log(noiseRatio);
+  for (i=0; i<m; ++i)
+    log_det += 2. * std::log(cholA(i,i));
+  return (Real)n * std::log(procVar) + log_det
+    + ((Real)n - trace_q) / noiseRatio;
+}
+
+
+void SparseGaussProcApproximation::optimize_theta_global()
+{
+  SGPinstance = this;
+  Iterator nll_optimizer; // empty envelope
+
+  // log correlation parameters use the GaussProcApproximation bounds;
+  // the last parameter is the log of the noise to process variance ratio
+  size_t i, num_v = sharedDataRep->numVars;
+  RealVector lbnds(num_v+1, false), ubnds(num_v+1, false);
+  for (i=0; i<num_v; ++i)
+    { lbnds[i] = -9.; ubnds[i] = 5.; }
+  lbnds[num_v] = std::log(1.e-8); ubnds[num_v] = std::log(1.e-1);
+  thetaParams.sizeUninitialized(num_v);
+
+#ifdef HAVE_NCSU
+  // NCSU DIRECT optimize of the negative VFE bound
+  int max_iterations = 1000, max_fn_evals = 2000;
+  nll_optimizer.assign_rep(
+    new NCSUOptimizer(lbnds,ubnds,max_iterations,max_fn_evals,
+		      negloglikNCSU),false);
+  nll_optimizer.run(); // no pl_iter needed for this optimization
+  const Variables& vars_star = nll_optimizer.variables_results();
+  const RealVector& x_star = vars_star.continuous_variables();
+  for (i=0; i<num_v; ++i)
+    thetaParams[i] = x_star[i];
+  noiseRatio = std::exp(x_star[num_v]);
+
+#ifdef DEBUG
+  const Response&  resp_star = nll_optimizer.response_results();
+  Cout << "Optimal negative VFE bound = " << resp_star.function_value(0)
+       << '\n';
+#endif //DEBUG
+#endif //HAVE_NCSU
+}
+
+
+// function maps a single point x to function value f
+double SparseGaussProcApproximation::negloglikNCSU(const RealVector &x)
+{
+  size_t i, num_v = SGPinstance->sharedDataRep->numVars;
+  for (i=0; i<num_v; ++i)
+    SGPinstance->thetaParams[i] = x[i];
+  SGPinstance->noiseRatio = std::exp(x[num_v]);
+
+  // the bound is evaluated over a strided subset of the training data
+  // so each objective evaluation is O(min(n, n_fit) m^2)
+  size_t max_fit_pts = std::max((size_t)2000, 4*SGPinstance->numInducing),
+    stride = (SGPinstance->numObs + max_fit_pts - 1) / max_fit_pts;
+  return SGPinstance->compute_factors(stride);
+}
+
+
+void SparseGaussProcApproximation::get_cov_vector(const RealVector& c_vars)
+{
+  size_t i, j, num_v = sharedDataRep->numVars;
+  if (c_vars.length() != num_v) {
+    Cerr << "Error: Dimension mismatch in SparseGaussProcApproximation"
+	 << std::endl;
+    abort_handler(-1);
+  }
+  approxPoint.sizeUninitialized(num_v);
+  for (i=0; i<num_v; ++i)
+    approxPoint[i] = (c_vars[i] - trainMeans[i]) / trainStdvs[i];
+
+  covVector.sizeUninitialized(numInducing);
+  for (j=0; j<numInducing; ++j)
+    covVector[j] = correlation(approxPoint.values(), inducingPoints[j]);
+}
+
+} // namespace Dakota
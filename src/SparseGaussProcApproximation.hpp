@@ -0,0 +1,191 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014 Sandia Corporation.
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:	 SparseGaussProcApproximation
+//- Description: Class implementation of a sparse (inducing point) Gaussian
+//-              Process Approximation
+//- Owner:
+//- Checked by:
+//- Version:
+
+#ifndef SPARSE_GAUSS_PROC_APPROXIMATION_H
+#define SPARSE_GAUSS_PROC_APPROXIMATION_H
+
+#include "dakota_data_types.hpp"
+#include "DakotaApproximation.hpp"
+
+
+namespace Dakota {
+
+class ProblemDescDB;
+
+/// Derived approximation class for a sparse Gaussian process using
+/// inducing points
+
+/** The SparseGaussProcApproximation class provides a global Gaussian
+    process approximation for large training sets.  The process is
+    projected onto m inducing points chosen from the build data, and
+    the covariance parameters maximize the variational free energy
+    (VFE) bound of Titsias (2009), with the process variance profiled
+    out.  Build is O(n m^2) in time and O(m^2) in memory, and
+    predictions cost O(m) for the mean and O(m^2) for the variance.
+    The covariance function and trend options follow
+    GaussProcApproximation. */
+
+class SparseGaussProcApproximation: public Approximation
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  /// default constructor
+  SparseGaussProcApproximation();
+  /// alternate constructor
+  SparseGaussProcApproximation(const SharedApproxData& shared_data);
+  /// standard constructor
+  SparseGaussProcApproximation(const ProblemDescDB& problem_db,
+			       const SharedApproxData& shared_data,
+			       const String& approx_label);
+  /// destructor
+  ~SparseGaussProcApproximation();
+
+protected:
+
+  //
+  //- Heading: Virtual function redefinitions
+  //
+
+  int min_coefficients() const;
+
+  int num_constraints()  const;
+
+  /// select inducing points, fit the covariance parameters, and
+  /// compute the factors used for prediction
+  void build();
+
+  /// retrieve the function value for a given parameter set
+  Real value(const Variables& vars);
+
+  /// retrieve the function gradient at the predicted value
+  /// for a given parameter set
+  const RealVector& gradient(const Variables& vars);
+
+  /// retrieve the variance of the predicted value for a given parameter set
+  Real prediction_variance(const Variables& vars);
+
+private:
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// normalizes the training inputs to zero mean and unit variance
+  void normalize_training_data();
+  /// evaluates the trend basis (1, x, x.^2 by trendOrder) at a
+  /// normalized point
+  void trend_basis(const Real* x, RealVector& basis) const;
+  /// fits the trend by ordinary least squares and forms the residuals
+  /// modeled by the process
+  void fit_trend();
+  /// greedy farthest-point selection of the inducing points
+  void select_inducing_points();
+  /// correlation between two normalized points
+  Real correlation(const Real* x1, const Real* x2) const;
+  /// accumulates the inducing point factors over every stride-th
+  /// training point and returns the negative log of the VFE bound;
+  /// returns a large value if a factorization fails
+  Real compute_factors(size_t stride);
+  /// sets up and performs the optimization of the negative VFE bound
+  /// over the correlation parameters and the noise ratio using
+  /// NCSUDirect
+  void optimize_theta_global();
+  /// maps a point to normalized space and forms its correlation
+  /// vector with the inducing points
+  void get_cov_vector(const RealVector& c_vars);
+
+  /// function used by NCSUOptimizer to optimize the VFE objective
+  static double negloglikNCSU(const RealVector &x);
+
+  //
+  //- Heading: Data
+  //
+
+  /// pointer to the active object instance used within the static evaluator
+  static SparseGaussProcApproximation* SGPinstance;
+
+  /// value of the approximation returned by value()
+  Real approxValue;
+  /// value of the approximation returned by prediction_variance()
+  Real approxVariance;
+
+  /// normalized training points, stored one point per column
+  /// (num vars x num obs) so each point is contiguous
+  RealMatrix normTrainPoints;
+  /// training responses less the fitted trend
+  RealVector trainResiduals;
+  /// The mean of each input variable over the training points
+  RealVector trainMeans;
+  /// The standard deviation of each input variable over the training points
+  RealVector trainStdvs;
+  /// coefficients of the trend basis
+  RealVector betaCoeffs;
+  /// normalized inducing points, one per column (num vars x numInducing)
+  RealMatrix inducingPoints;
+  /// lower Cholesky factor of the inducing point correlation matrix
+  RealMatrix cholKmm;
+  /// lower Cholesky factor of noiseRatio*I + V V^T, V = cholKmm^{-1} Kmn
+  RealMatrix cholA;
+  /// weights on the inducing point correlations for the predictive mean
+  RealVector meanWeights;
+  /// correlations between the prediction point and the inducing points
+  RealVector covVector;
+  /// prediction point in normalized space
+  RealVector approxPoint;
+
+  /// The number of observations on which the GP surface is built
+  size_t numObs;
+  /// The number of inducing points
+  size_t numInducing;
+  /// The requested number of inducing points (0 = default)
+  int numInducingSpec;
+  /// The order of the basis function for the mean of the GP
+  /// (0 = constant, 1 = linear, 2 = reduced quadratic)
+  short trendOrder;
+  /// log correlation parameters: the correlation function is
+  /// exp(-sum_i exp(thetaParams[i]) (x1_i - x2_i)^2)
+  RealVector thetaParams;
+  /// ratio of noise (nugget) variance to process variance
+  Real noiseRatio;
+  /// The process variance, the multiplier of the correlation matrix
+  Real procVar;
+};
+
+
+inline SparseGaussProcApproximation::SparseGaussProcApproximation():
+  numInducingSpec(0), trendOrder(2), noiseRatio(1.e-6), procVar(1.)
+{ }
+
+
+/** alternate constructor used by iterators that do not use a problem
+    database; defaults are a quadratic trend and a default number of
+    inducing points. */
+inline SparseGaussProcApproximation::
+SparseGaussProcApproximation(const SharedApproxData& shared_data):
+  Approximation(NoDBBaseConstructor(), shared_data), numInducingSpec(0),
+  trendOrder(2), noiseRatio(1.e-6), procVar(1.)
+{ }
+
+
+inline SparseGaussProcApproximation::~SparseGaussProcApproximation()
+{ }
+
+} // namespace Dakota
+
+#endif
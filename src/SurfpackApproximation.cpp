@@ -446,24 +446,7 @@ void SurfpackApproximation::build()
     surfData = surrogates_to_surf_data();
  
     // set bounds at run time since they are updated by some methods (e.g., SBO)
-    if (!sharedDataRep->approxCLowerBnds.empty() ||
-	!sharedDataRep->approxDILowerBnds.empty() ||
-	!sharedDataRep->approxDRLowerBnds.empty()) {
-      RealArray lb;
-      shared_surf_data_rep->merge_variable_arrays(
-	sharedDataRep->approxCLowerBnds, sharedDataRep->approxDILowerBnds,
-	sharedDataRep->approxDRLowerBnds, lb);
-      factory->add("lower_bounds", fromVec<Real>(lb));
-    }
-    if (!sharedDataRep->approxCUpperBnds.empty() ||
-	!sharedDataRep->approxDIUpperBnds.empty() ||
-	!sharedDataRep->approxDRUpperBnds.empty()) {
-      RealArray ub;
-      shared_surf_data_rep->merge_variable_arrays(
-	sharedDataRep->approxCUpperBnds, sharedDataRep->approxDIUpperBnds,
-	sharedDataRep->approxDRUpperBnds, ub);
-      factory->add("upper_bounds", fromVec<Real>(ub));
-    }
+    add_factory_bounds();
 
     if (model) {
       delete model;
@@ -545,6 +528,113 @@ void SurfpackApproximation::export_model(const String& fn_label,
   }    
 }
 
+bool SurfpackApproximation::model_archive_available()
+{
+  return SurfpackInterface::HasFeature("model_save") &&
+    SurfpackInterface::HasFeature("model_load");
+}
+
+
+String SurfpackApproximation::model_settings()
+{
+  // run-time bounds are added to the factory parameters within build()
+  // and are accounted for separately; verbosity does not affect the fit.
+  // The random seed, which determines stochastic fits (e.g., ANN and
+  // RBF), is always included, also when left to the Surfpack default.
+  const ParamMap& params = factory->parameters();
+  ParamMap::const_iterator it = params.find("seed");
+  String settings(sharedDataRep->approxType);
+  settings += " seed=" + ((it == params.end()) ? String() : it->second);
+  for (it=params.begin(); it!=params.end(); ++it)
+    if (it->first != "lower_bounds" && it->first != "upper_bounds" &&
+	it->first != "verbosity" && it->first != "seed")
+      settings += ' ' + it->first + '=' + it->second;
+  return settings;
+}
+
+
+void SurfpackApproximation::save_model(std::ostream& s)
+{
+  try {
+    SurfpackInterface::Save(model, s, true);
+  }
+  catch (std::string& e) {
+    Cerr << "Error: exception caught saving surrogate model:\n" << e
+	 << std::endl;
+    abort_handler(-1);
+  }
+}
+
+
+/** An archive written by another Surfpack or Boost version may pass
+    the header check and still fail to deserialize, in which case the
+    current model is kept and the surface is rebuilt. */
+bool SurfpackApproximation::load_model(std::istream& s)
+{
+  SurfpackModel* loaded_model = NULL;
+  try {
+    loaded_model = SurfpackInterface::LoadModel(s, true);
+  }
+  catch (const std::exception& e) {
+    Cerr << "Warning: surrogate model archive could not be loaded:\n  "
+	 << e.what() << std::endl;
+    return false;
+  }
+  catch (std::string& e) {
+    Cerr << "Warning: surrogate model archive could not be loaded:\n  " << e
+	 << std::endl;
+    return false;
+  }
+
+  if (model)
+    delete model;
+  model = loaded_model;
+  try {
+    // the build data are needed by diagnostics on the restored model
+    if (surfData) {
+      delete surfData;
+      surfData = NULL;
+    }
+    surfData = surrogates_to_surf_data();
+    // the bounds used by cross-validation builds are set as in build()
+    add_factory_bounds();
+  }
+  catch (std::string& e) {
+    Cerr << "Error: exception caught loading surrogate model:\n" << e
+	 << std::endl;
+    abort_handler(-1);
+  }
+  return true;
+}
+
+
+/** The factory builds the cross-validation models, so its bounds are
+    set both for a build and for a model restored from an archive. */
+void SurfpackApproximation::add_factory_bounds()
+{
+  SharedSurfpackApproxData* shared_surf_data_rep
+    = (SharedSurfpackApproxData*)sharedDataRep;
+  if (!sharedDataRep->approxCLowerBnds.empty() ||
+      !sharedDataRep->approxDILowerBnds.empty() ||
+      !sharedDataRep->approxDRLowerBnds.empty()) {
+    RealArray lb;
+    shared_surf_data_rep->merge_variable_arrays(
+      sharedDataRep->approxCLowerBnds, sharedDataRep->approxDILowerBnds,
+      sharedDataRep->approxDRLowerBnds, lb);
+    factory->add("lower_bounds", fromVec<Real>(lb));
+  }
+  if (!sharedDataRep->approxCUpperBnds.empty() ||
+      !sharedDataRep->approxDIUpperBnds.empty() ||
+      !sharedDataRep->approxDRUpperBnds.empty()) {
+    RealArray ub;
+    shared_surf_data_rep->merge_variable_arrays(
+      sharedDataRep->approxCUpperBnds, sharedDataRep->approxDIUpperBnds,
+      sharedDataRep->approxDRUpperBnds, ub);
+    factory->add("upper_bounds", fromVec<Real>(ub));
+  }
+}
+
+
 Real SurfpackApproximation::value(const Variables& vars)
 { 
   //static int times_called = 0;
@@ -77,6 +77,16 @@ protected:
   void export_model(const String& fn_label, const String& export_prefix = "", 
                     const unsigned short export_format = NO_MODEL_FORMAT);
 
+  /// true when Surfpack is compiled with model serialization support
+  bool model_archive_available();
+  /// the Surfpack model type and factory parameters
+  String model_settings();
+  /// save the Surfpack model to a binary archive
+  void save_model(std::ostream& s);
+  /// restore the Surfpack model from a binary archive and regenerate
+  /// the SurfData used for diagnostics
+  bool load_model(std::istream& s);
+
   // return #coefficients
   //RealVector approximation_coefficients(bool normalized) const;
   // set #coefficients
@@ -138,6 +148,9 @@ private:
   /// copy from SurrogateData to SurfPoint/SurfData
   SurfData* surrogates_to_surf_data();
 
+  /// add the current approximation bounds to the factory parameters
+  void add_factory_bounds();
+
   /// set the anchor point (including gradient and hessian if present)
   /// into surf_data
   void add_anchor_to_surfdata(SurfData& surf_data);
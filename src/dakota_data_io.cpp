@@ -141,11 +141,21 @@ read_config_vars_singlefile(const std::string& basename, int num_expts, int ncv,
 void 
 read_field_values(const std::string& basename, int expt_num, RealVectorArray& field_vars){
 
-  std::ifstream s;
+  // each column of the file is a field; the records (rows of the file)
+  // are parsed into the columns of a contiguous matrix
   std::string filename = basename + "." + convert_to_string(expt_num) + ".dat";
-  TabularIO::open_file(s, filename, "read_field_values");
-  bool row_major = false;
-  read_unsized_data(s, field_vars, row_major);
+  RealMatrix records;
+  size_t num_cols = 0; // inferred from the first line
+  int i, j, num_rows = TabularIO::
+    read_numeric_tabular(filename, "read_field_values", TABULAR_NONE,
+			 num_cols, records);
+  field_vars.resize(num_cols);
+  for (i=0; i<num_cols; ++i) {
+    RealVector& field_i = field_vars[i];
+    field_i.sizeUninitialized(num_rows);
+    for (j=0; j<num_rows; ++j)
+      field_i[j] = records(i, j);
+  }
 }
 
 //----------------------------------------------------------------
@@ -163,12 +173,8 @@ read_field_values(const std::string& basename, int expt_num, RealVector& field_v
 void 
 read_coord_values(const std::string& basename, int expt_num, RealMatrix& coords){
 
-  std::ifstream s;
   std::string filename = basename + "." + convert_to_string(expt_num) + ".coords";
-  TabularIO::open_file(s, filename, "read_coord_values");
-  RealVectorArray va;
-  read_unsized_data(s, va);
-  copy_data(va, coords);
+  read_coord_values(filename, coords);
 }
 
 //----------------------------------------------------------------
@@ -176,11 +182,13 @@ read_coord_values(const std::string& basename, int expt_num, RealMatrix& coords)
 void 
 read_coord_values(const std::string& basename, RealMatrix& coords){
 
-  std::ifstream s;
-  TabularIO::open_file(s, basename, "read_coord_values");
-  RealVectorArray va;
-  read_unsized_data(s, va);
-  copy_data(va, coords);
+  // records (one coordinate point per row of the file) are parsed into
+  // the columns of a contiguous matrix; coords has one point per row
+  RealMatrix records;
+  size_t num_dims = 0; // inferred from the first line
+  TabularIO::read_numeric_tabular(basename, "read_coord_values", TABULAR_NONE,
+				  num_dims, records);
+  coords = RealMatrix(records, Teuchos::TRANS);
 }
 
 //----------------------------------------------------------------
@@ -155,6 +155,7 @@ typedef std::map<IntIntPair, RealMatrix> IntIntPairRealMatrixMap;
 typedef std::map<RealRealPair, Real>     RealRealPairRealMap;
 typedef std::vector<IntIntPairRealMap>   IntIntPairRealMapArray;
 typedef std::vector<RealRealPairRealMap> RealRealPairRealMapArray;
+typedef std::vector<IntResponseMap>      IntResponseMapArray;
 typedef std::multimap<RealRealPair, ParamResponsePair> RealPairPRPMultiMap;
 //typedef std::multimap<Real, ParamResponsePair> RealPRPMultiMap;
 typedef std::map<SizetSizet2DPair, DiscrepancyCorrection> DiscrepCorrMap;
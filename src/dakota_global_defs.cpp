@@ -32,6 +32,10 @@
 #include <unistd.h> 
 #endif 
 
+#ifdef HAVE_WORKING_FORK
+#include <unistd.h> // for _exit
+#endif
+
 
 static const char rcsId[]="@(#) $Id: dakota_global_defs.cpp 6716 2010-04-03 18:35:08Z wjbohnh $";
 
@@ -95,6 +99,13 @@ void abort_handler(int code)
   Cout << std::flush; // flush cout or ofstream redirection
   Cerr << std::flush; // flush cerr or ofstream redirection
 
+#ifdef HAVE_WORKING_FORK
+  // a forked child must not clean up or close the files it shares with
+  // its parent, which detects the failure from the exit status
+  if (abort_mode == ABORT_CHILD_EXITS)
+    _exit(256 + code);
+#endif
+
   if (Dak_pddb) {
     // cleanup parameters/results files
     InterfaceList &ifaces = Dak_pddb->interface_list();
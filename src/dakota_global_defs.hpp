@@ -61,8 +61,9 @@ enum {
   OTHER_ERROR     = -1  // the historical Dakota default error
 };
 
-/// enum for dakota abort behaviors
-enum {ABORT_EXITS, ABORT_THROWS};
+/// enum for dakota abort behaviors; ABORT_CHILD_EXITS is for a forked
+/// child sharing files and streams with its parent, which cleans them up
+enum {ABORT_EXITS, ABORT_THROWS, ABORT_CHILD_EXITS};
 
 /// enum for active subspace cross validation identification
 enum {CV_ID_DEFAULT = 0, MINIMUM_METRIC, RELATIVE_TOLERANCE, DECREASE_TOLERANCE};
@@ -120,7 +121,10 @@ enum { TABULAR_NONE = 0, TABULAR_HEADER = 1,
        // experiment data annotated has header and exp_id
        TABULAR_EXPER_ANNOT = TABULAR_HEADER | TABULAR_EVAL_ID,
        // default for tabular files is fully annotated as of Dakota 6.1
-       TABULAR_ANNOTATED = TABULAR_HEADER | TABULAR_EVAL_ID | TABULAR_IFACE_ID };
+       TABULAR_ANNOTATED = TABULAR_HEADER | TABULAR_EVAL_ID | TABULAR_IFACE_ID,
+       // binary columnar format; the file records its own leading
+       // columns and labels, so the other bits are not used with it
+       TABULAR_BINARY = 8 };
 
 /// options for results file format
 enum {FLEXIBLE_RESULTS, LABELED_RESULTS};
@@ -11,6 +11,23 @@
 #include "DakotaVariables.hpp"
 #include "DakotaResponse.hpp"
 #include "ParamResponsePair.hpp"
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>    // for open
+#include <sys/mman.h> // for mmap
+#include <sys/stat.h> // for fstat
+#include <unistd.h>   // for close
+#endif
+#ifdef DAKOTA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 namespace Dakota {
 
@@ -21,7 +38,9 @@ namespace TabularIO {
 String format_name(unsigned short tabular_format)
 {
   String file_format("annotated");
-  if (tabular_format == TABULAR_NONE)
+  if (tabular_format & TABULAR_BINARY)
+    file_format = "binary";
+  else if (tabular_format == TABULAR_NONE)
     file_format = "freeform";
   else if (tabular_format < TABULAR_ANNOTATED)
     file_format = "custom_annotated";
@@ -33,6 +52,13 @@ void print_expected_format(std::ostream& s, unsigned short tabular_format,
 			   size_t num_rows, size_t num_cols)
 {
   s << "\nExpected " << format_name(tabular_format) << " tabular file:";
+  if (tabular_format & TABULAR_BINARY) {
+    s << "\n  * identifier, schema, and column blocks as written by Dakota";
+    if (num_cols > 0)
+      s << "\n  * " << num_cols << " numeric data columns";
+    s << std::endl;
+    return;
+  }
   if (tabular_format > TABULAR_NONE) {
     if (tabular_format & TABULAR_HEADER) 
       s << "\n  * header row with labels";
@@ -82,10 +108,14 @@ void open_file(std::ifstream& data_stream, const std::string& input_filename,
 
 
 void open_file(std::ofstream& data_stream, const std::string& output_filename, 
-	       const std::string& context_message) 
+	       const std::string& context_message, bool binary) 
 {
   // TODO: try/catch
-  data_stream.open(output_filename.c_str());
+  if (binary)
+    data_stream.open(output_filename.c_str(),
+		     std::ios_base::out | std::ios_base::binary);
+  else
+    data_stream.open(output_filename.c_str());
   if (!data_stream.good()) {
     Cerr << "\nError (" << context_message << "): Could not open file " 
 	 << output_filename << " for writing tabular data." << std::endl;
@@ -277,10 +307,763 @@ void write_data_tabular(const std::string& output_filename,
 }
 
 
+/** Determines the tabular column of each continuous, discrete
+    integer, discrete string, and discrete real variable (in storage
+    order) by reading a record of column indices through
+    Variables::read_tabular(), so that fast numeric reads and binary
+    writes honor the same CDV/DDV/UV/CSV ordering. */
+static void variables_tabular_columns(const Variables& vars, bool active_only,
+				      SizetArray& cv_cols, SizetArray& div_cols,
+				      SizetArray& dsv_cols,
+				      SizetArray& drv_cols)
+{
+  Variables index_vars = vars.copy();
+  size_t i, num_vars = active_only ? 
+    vars.cv() + vars.div() + vars.dsv() + vars.drv() : vars.tv();
+  std::stringstream index_record;
+  for (i=0; i<num_vars; ++i)
+    index_record << i << ' ';
+  index_vars.read_tabular(index_record, (active_only ? ACTIVE_VARS : ALL_VARS));
+
+  const RealVector& c_vars  = active_only ? index_vars.continuous_variables()
+    : index_vars.all_continuous_variables();
+  const IntVector&  di_vars = active_only ? index_vars.discrete_int_variables()
+    : index_vars.all_discrete_int_variables();
+  StringMultiArrayConstView ds_vars = active_only ?
+    index_vars.discrete_string_variables() :
+    index_vars.all_discrete_string_variables();
+  const RealVector& dr_vars = active_only ?
+    index_vars.discrete_real_variables() :
+    index_vars.all_discrete_real_variables();
+  cv_cols.resize(c_vars.length());
+  for (i=0; i<cv_cols.size(); ++i)  cv_cols[i]  = (size_t)c_vars[i];
+  div_cols.resize(di_vars.length());
+  for (i=0; i<div_cols.size(); ++i) div_cols[i] = (size_t)di_vars[i];
+  dsv_cols.resize(ds_vars.size());
+  for (i=0; i<dsv_cols.size(); ++i)
+    dsv_cols[i] = (size_t)std::atoi(ds_vars[i].c_str());
+  drv_cols.resize(dr_vars.length());
+  for (i=0; i<drv_cols.size(); ++i) drv_cols[i] = (size_t)dr_vars[i];
+}
+
+
+/// identifier at the start of a TABULAR_BINARY file; the last byte
+/// is the format version
+static const char BINARY_TABULAR_ID[8] =
+  { 'D', 'A', 'K', 'T', 'A', 'B', '\0', '\1' };
+
+/// record and column types within a TABULAR_BINARY file
+enum { BINARY_SCHEMA_RECORD = 'S', BINARY_BLOCK_RECORD = 'B' };
+enum { BINARY_REAL_COLUMN = 0, BINARY_INT_COLUMN, BINARY_STRING_COLUMN };
+
+
+static void append_varint(String& buf, boost::uint64_t val)
+{
+  for ( ; val >= 0x80; val >>= 7)
+    buf += (char)((val & 0x7f) | 0x80);
+  buf += (char)val;
+}
+
+
+static bool extract_varint(const unsigned char*& p, const unsigned char* end,
+			   boost::uint64_t& val)
+{
+  val = 0;
+  for (unsigned short shift=0; p != end && shift < 64; shift += 7) {
+    unsigned char b = *p++;
+    val |= (boost::uint64_t)(b & 0x7f) << shift;
+    if (!(b & 0x80))
+      return true;
+  }
+  return false;
+}
+
+
+/** Each value is XOR'd with the previous value in the column, which
+    zeroes the sign, exponent, and leading mantissa bytes shared by
+    nearby values; a control byte holds the number of leading and
+    trailing zero bytes of the result, followed by the remaining
+    bytes, most significant first. */
+static void append_real_column(String& buf, const Real* vals, size_t stride,
+			       size_t num_vals)
+{
+  boost::uint64_t prev = 0, bits, x;
+  for (size_t i=0; i<num_vals; ++i, vals += stride) {
+    std::memcpy(&bits, vals, sizeof(Real));
+    x = bits ^ prev; prev = bits;
+    if (x == 0)
+      { buf += (char)0x80; continue; }
+    int lead = 0, trail = 0, b;
+    while (!((x >> (8*(7-lead))) & 0xff)) ++lead;
+    while (!((x >> (8*trail)) & 0xff))    ++trail;
+    buf += (char)((lead << 4) | trail);
+    for (b=7-lead; b>=trail; --b)
+      buf += (char)((x >> (8*b)) & 0xff);
+  }
+}
+
+
+static bool extract_real_column(const unsigned char* p,
+				const unsigned char* end, Real* vals,
+				size_t stride, size_t num_vals)
+{
+  boost::uint64_t prev = 0, x;
+  for (size_t i=0; i<num_vals; ++i, vals += stride) {
+    if (p == end)
+      return false;
+    int lead = *p >> 4, trail = *p & 0xf, b;
+    ++p;
+    if (lead + trail > 8 || end - p < 8 - lead - trail)
+      return false;
+    for (x=0, b=7-lead; b>=trail; --b)
+      x |= (boost::uint64_t)(*p++) << (8*b);
+    prev ^= x;
+    std::memcpy(vals, &prev, sizeof(Real));
+  }
+  return p == end;
+}
+
+
+/// integers are written as zigzag-encoded varint deltas
+static void append_int_column(String& buf, const Real* vals, size_t stride,
+			      size_t num_vals)
+{
+  boost::int64_t prev = 0, val, delta;
+  for (size_t i=0; i<num_vals; ++i, vals += stride) {
+    val = (boost::int64_t)*vals; delta = val - prev; prev = val;
+    append_varint(buf, ((boost::uint64_t)delta << 1) ^
+		  (boost::uint64_t)(delta >> 63));
+  }
+}
+
+
+static bool extract_int_column(const unsigned char* p,
+			       const unsigned char* end, Real* vals,
+			       size_t stride, size_t num_vals)
+{
+  boost::int64_t prev = 0;
+  boost::uint64_t z;
+  for (size_t i=0; i<num_vals; ++i, vals += stride) {
+    if (!extract_varint(p, end, z))
+      return false;
+    prev += (boost::int64_t)(z >> 1) ^ -(boost::int64_t)(z & 1);
+    *vals = (Real)prev;
+  }
+  return p == end;
+}
+
+
+/// strings are written as length + 1 and the characters, or as 0 if
+/// repeating the previous string in the column
+static void append_string_column(String& buf, const String* vals,
+				 size_t stride, size_t num_vals)
+{
+  const String* prev = NULL;
+  for (size_t i=0; i<num_vals; ++i, vals += stride) {
+    if (prev && *prev == *vals)
+      append_varint(buf, 0);
+    else {
+      append_varint(buf, vals->size() + 1);
+      buf += *vals;
+    }
+    prev = vals;
+  }
+}
+
+
+static bool extract_string_column(const unsigned char* p,
+				  const unsigned char* end, String* vals,
+				  size_t num_vals)
+{
+  boost::uint64_t len;
+  for (size_t i=0; i<num_vals; ++i) {
+    if (!extract_varint(p, end, len) || (len == 0 && i == 0) ||
+	len > (boost::uint64_t)(end - p) + 1)
+      return false;
+    if (len)
+      { vals[i].assign((const char*)p, len - 1); p += len - 1; }
+    else
+      vals[i] = vals[i-1];
+  }
+  return p == end;
+}
+
+
+BinaryTabularWriter::BinaryTabularWriter(size_t block_rows):
+  blockRows(std::max(block_rows, (size_t)1)), numRows(0), numVarCols(0),
+  numFnCols(0)
+{ }
+
+
+void BinaryTabularWriter::
+write_header(std::ostream& s, const Variables& vars, const Response& response)
+{ write_header(s, vars, response.function_labels()); }
+
+
+/** The counter (e.g., eval id) and interface id columns are always
+    included, as the schema makes them self-describing. */
+void BinaryTabularWriter::
+write_header(std::ostream& s, const Variables& vars,
+	     const StringArray& fn_labels, const String& counter_label)
+{
+  flush(s);
+  if (s.tellp() == std::streampos(0))
+    s.write(BINARY_TABULAR_ID, sizeof(BINARY_TABULAR_ID));
+
+  SizetArray dsv_cols;
+  variables_tabular_columns(vars, false, cvCols, divCols, dsv_cols, drvCols);
+  numVarCols = vars.tv(); numFnCols = fn_labels.size();
+  size_t i, num_cols = numVarCols + numFnCols;
+  columnTypes.assign(num_cols, BINARY_REAL_COLUMN);
+  for (i=0; i<divCols.size(); ++i)
+    columnTypes[divCols[i]] = BINARY_INT_COLUMN;
+  SizetArray string_var(numVarCols, _NPOS);
+  for (i=0; i<dsv_cols.size(); ++i) {
+    columnTypes[dsv_cols[i]] = BINARY_STRING_COLUMN;
+    string_var[dsv_cols[i]] = i;
+  }
+  stringVars.clear();
+  for (i=0; i<numVarCols; ++i)
+    if (string_var[i] != _NPOS)
+      stringVars.push_back(string_var[i]);
+
+  // labels in tabular order, as written by write_header_tabular()
+  StringArray labels;
+  labels.push_back(counter_label); labels.push_back("interface");
+  std::stringstream label_stream;
+  vars.write_tabular_labels(label_stream);
+  String label;
+  while (label_stream >> label)
+    labels.push_back(label);
+  labels.insert(labels.end(), fn_labels.begin(), fn_labels.end());
+  if (labels.size() != num_cols + 2) {
+    Cerr << "\nError (BinaryTabularWriter): variables labels do not match "
+	 << "the number of variables." << std::endl;
+    abort_handler(-1);
+  }
+
+  String record(1, (char)BINARY_SCHEMA_RECORD);
+  record += (char)(TABULAR_EVAL_ID | TABULAR_IFACE_ID); // leading columns
+  append_varint(record, labels.size());
+  for (i=0; i<labels.size(); ++i) {
+    if (i == 0)      record += (char)BINARY_INT_COLUMN;
+    else if (i == 1) record += (char)BINARY_STRING_COLUMN;
+    else             record += (char)columnTypes[i-2];
+    append_varint(record, labels[i].size());
+    record += labels[i];
+  }
+  s.write(record.data(), record.size());
+}
+
+
+void BinaryTabularWriter::
+write_row(std::ostream& s, const Variables& vars, const String& iface_id,
+	  const Response& response, int eval_id)
+{
+  const RealVector& fn_vals = response.function_values();
+  const ShortArray& asv = response.active_set_request_vector();
+  size_t i, num_fns = fn_vals.length();
+  for (i=0; i<num_fns; ++i)
+    if (!(asv[i] & 1))
+      break;
+  if (i == num_fns)
+    write_row(s, vars, iface_id, fn_vals, eval_id);
+  else {
+    // inactive values are written as NaN
+    RealVector active_vals(fn_vals);
+    for ( ; i<num_fns; ++i)
+      if (!(asv[i] & 1))
+	active_vals[i] = std::numeric_limits<Real>::quiet_NaN();
+    write_row(s, vars, iface_id, active_vals, eval_id);
+  }
+}
+
+
+void BinaryTabularWriter::
+write_row(std::ostream& s, const Variables& vars, const String& iface_id,
+	  const RealVector& fn_vals, int eval_id)
+{
+  if (vars.tv() != numVarCols || fn_vals.length() != numFnCols) {
+    Cerr << "\nError (BinaryTabularWriter): row does not match the tabular "
+	 << "header." << std::endl;
+    abort_handler(-1);
+  }
+  evalIds.push_back(eval_id); ifaceIds.push_back(iface_id);
+
+  size_t i, row_len = numVarCols + numFnCols, row_start = numericRows.size();
+  numericRows.resize(row_start + row_len, 0.);
+  Real* row = &numericRows[row_start];
+  const RealVector& ac_vars  = vars.all_continuous_variables();
+  const IntVector&  adi_vars = vars.all_discrete_int_variables();
+  const RealVector& adr_vars = vars.all_discrete_real_variables();
+  for (i=0; i<cvCols.size(); ++i)  row[cvCols[i]]  = ac_vars[i];
+  for (i=0; i<divCols.size(); ++i) row[divCols[i]] = adi_vars[i];
+  for (i=0; i<drvCols.size(); ++i) row[drvCols[i]] = adr_vars[i];
+  if (!stringVars.empty()) {
+    StringMultiArrayConstView ads_vars = vars.all_discrete_string_variables();
+    for (i=0; i<stringVars.size(); ++i)
+      stringRows.push_back(ads_vars[stringVars[i]]);
+  }
+  for (i=0; i<numFnCols; ++i)
+    row[numVarCols+i] = fn_vals[i];
+
+  if (++numRows >= blockRows)
+    flush(s);
+}
+
+
+/** Each column is preceded by its length in bytes, so readers may
+    skip columns they do not need. */
+void BinaryTabularWriter::flush(std::ostream& s)
+{
+  if (!numRows)
+    return;
+
+  size_t i, row_len = numVarCols + numFnCols, num_str = stringVars.size(),
+    str_col = 0;
+  String record(1, (char)BINARY_BLOCK_RECORD), column;
+  append_varint(record, numRows);
+
+  RealArray ids(evalIds.begin(), evalIds.end());
+  append_int_column(column, &ids[0], 1, numRows);
+  append_varint(record, column.size()); record += column;
+  column.clear();
+  append_string_column(column, &ifaceIds[0], 1, numRows);
+  append_varint(record, column.size()); record += column;
+  for (i=0; i<row_len; ++i) {
+    column.clear();
+    switch (columnTypes[i]) {
+    case BINARY_REAL_COLUMN:
+      append_real_column(column, &numericRows[i], row_len, numRows); break;
+    case BINARY_INT_COLUMN:
+      append_int_column(column, &numericRows[i], row_len, numRows);  break;
+    case BINARY_STRING_COLUMN:
+      append_string_column(column, &stringRows[str_col++], num_str, numRows);
+      break;
+    }
+    append_varint(record, column.size()); record += column;
+  }
+  s.write(record.data(), record.size());
+  s.flush();
+
+  numRows = 0; evalIds.clear(); ifaceIds.clear();
+  numericRows.clear(); stringRows.clear();
+}
+
+
 //
 //- Utilities for tabular read
 //
 
+MappedFileView::MappedFileView(const std::string& filename):
+  fileData(NULL), fileSize(0)
+{
+#ifdef _WIN32
+  std::ifstream data_file(filename.c_str(), std::ios::in | std::ios::binary);
+  if (data_file) {
+    fileBuffer.assign(std::istreambuf_iterator<char>(data_file),
+		      std::istreambuf_iterator<char>());
+    if (!fileBuffer.empty())
+      { fileData = &fileBuffer[0]; fileSize = fileBuffer.size(); }
+  }
+#else
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    return;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+    void* addr = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED)
+      { fileData = (const char*)addr; fileSize = file_stat.st_size; }
+  }
+  close(fd); // the mapping remains valid
+#endif
+}
+
+
+MappedFileView::~MappedFileView()
+{
+#ifndef _WIN32
+  if (fileData)
+    munmap((void*)fileData, fileSize);
+#endif
+}
+
+
+/// whitespace as skipped by stream extraction
+static inline bool is_tabular_space(char c)
+{
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' ||
+    c == '\f';
+}
+
+
+/** Converts the token [tok, tok_end) in place when a delimiter follows
+    it; the last token in the data may not be followed by anything, so
+    it is converted from a terminated copy.  Returns false unless the
+    whole token is a number. */
+static bool parse_tabular_real(const char* tok, const char* tok_end,
+			       const char* data_end, Real& val)
+{
+  char* conv_end;
+  if (tok_end != data_end) {
+    val = std::strtod(tok, &conv_end);
+    return conv_end == tok_end;
+  }
+  String last_tok(tok, tok_end);
+  val = std::strtod(last_tok.c_str(), &conv_end);
+  return conv_end == last_tok.c_str() + last_tok.size();
+}
+
+
+/// a range of whole lines of a text tabular file, parsed by one thread
+/// of parse_numeric_tabular()
+struct TabularChunk {
+  const char* begin;      ///< first byte of the chunk
+  const char* end;        ///< one past its last byte (after a newline)
+  const char* dataEnd;    ///< end of all the data
+  size_t numTokens;       ///< number of tokens in the chunk
+  size_t firstToken;      ///< index in the data of its first token
+  size_t recordTokens;    ///< tokens per record, leading columns included
+  size_t numLead;         ///< leading (eval/iface id) tokens per record
+  bool readEvalId;        ///< whether the first leading token is an eval id
+  Real* recordValues;     ///< column-major records of all the data
+  IntArray* evalIds;      ///< eval id of each record
+  StringArray* ifaceIds;  ///< interface id of each record
+  bool valid;             ///< false if a token of the chunk is malformed
+};
+
+
+/// counts the tokens of a TabularChunk
+static void* count_tabular_chunk(void* chunk_ptr)
+{
+  TabularChunk& chunk = *static_cast<TabularChunk*>(chunk_ptr);
+  size_t num_tokens = 0;
+  for (const char* p = chunk.begin; p != chunk.end; ) {
+    if (is_tabular_space(*p))
+      ++p;
+    else {
+      ++num_tokens;
+      while (p != chunk.end && !is_tabular_space(*p)) ++p;
+    }
+  }
+  chunk.numTokens = num_tokens;
+  return NULL;
+}
+
+
+/** Converts each token directly into its place in the records, which
+    follows from its index in the data since records need not coincide
+    with lines. */
+static void* convert_tabular_chunk(void* chunk_ptr)
+{
+  TabularChunk& chunk = *static_cast<TabularChunk*>(chunk_ptr);
+  size_t record_len = chunk.recordTokens - chunk.numLead,
+    r = chunk.firstToken / chunk.recordTokens,
+    t = chunk.firstToken % chunk.recordTokens, k;
+  Real* rec_val = chunk.recordValues + r * record_len
+    + ((t > chunk.numLead) ? t - chunk.numLead : 0);
+  const char *p = chunk.begin, *tok_end;
+  chunk.valid = true;
+  for (k=0; k<chunk.numTokens; ++k, p=tok_end) {
+    // a token remains, so the scan cannot pass the end of the chunk
+    while (is_tabular_space(*p)) ++p;
+    for (tok_end = p; tok_end != chunk.end && !is_tabular_space(*tok_end); )
+      ++tok_end;
+    if (t >= chunk.numLead) {
+      if (!parse_tabular_real(p, tok_end, chunk.dataEnd, *rec_val++))
+	{ chunk.valid = false; return NULL; }
+    }
+    else if (t == 0 && chunk.readEvalId) {
+      Real id;
+      if (!parse_tabular_real(p, tok_end, chunk.dataEnd, id) || id != (int)id)
+	{ chunk.valid = false; return NULL; }
+      (*chunk.evalIds)[r] = (int)id;
+    }
+    else {
+      String& iface_id = (*chunk.ifaceIds)[r];
+      iface_id.assign(p, tok_end);
+      // (Dakota 6.1 used EMPTY for missing ID)
+      if (iface_id == "NO_ID" || iface_id == "EMPTY")
+	iface_id.clear();
+    }
+    if (++t == chunk.recordTokens)
+      { t = 0; ++r; }
+  }
+  return NULL;
+}
+
+
+/// applies chunk_fn to each of chunks, on concurrent threads when
+/// available; the calling thread processes the first chunk
+static void process_tabular_chunks(std::vector<TabularChunk>& chunks,
+				   void* (*chunk_fn)(void*))
+{
+  size_t i, num_chunks = chunks.size();
+#ifdef DAKOTA_HAVE_PTHREADS
+  std::vector<pthread_t> threads(num_chunks);
+  std::vector<bool> started(num_chunks, false);
+  for (i=1; i<num_chunks; ++i)
+    started[i] = (pthread_create(&threads[i], NULL, chunk_fn, &chunks[i])==0);
+  chunk_fn(&chunks[0]);
+  for (i=1; i<num_chunks; ++i)
+    if (started[i]) pthread_join(threads[i], NULL);
+    else            chunk_fn(&chunks[i]); // thread creation failed
+#else
+  for (i=0; i<num_chunks; ++i)
+    chunk_fn(&chunks[i]);
+#endif
+}
+
+
+/** Two passes are made over the data: the first counts the tokens so
+    that records can be sized once, and the second converts each token
+    directly into its place in records, avoiding any per-row
+    temporaries.  With pthreads, large data are split at newlines into
+    one chunk per processor and both passes process the chunks
+    concurrently; the token counts of the chunks give the record and
+    column at which each starts converting. */
+bool parse_numeric_tabular(const char* data, size_t len,
+			   unsigned short tabular_format, size_t& record_len,
+			   RealMatrix& records, IntArray& eval_ids,
+			   StringArray& iface_ids)
+{
+  if (tabular_format & TABULAR_BINARY)
+    return parse_binary_tabular(data, len, record_len, records, eval_ids,
+				iface_ids);
+
+  const char *start = data, *end = data + len, *p;
+
+  // discard the header row, as in read_header_tabular()
+  if (tabular_format & TABULAR_HEADER) {
+    while (start != end && is_tabular_space(*start)) ++start;
+    while (start != end && *start != '\n') ++start;
+  }
+  bool read_eval_id  = (tabular_format & TABULAR_EVAL_ID),
+       read_iface_id = (tabular_format & TABULAR_IFACE_ID);
+  size_t num_lead = 0;
+  if (read_eval_id)  ++num_lead;
+  if (read_iface_id) ++num_lead;
+
+  // split the data at newlines into chunks of at least MIN_CHUNK_BYTES
+  size_t i, num_chunks = 1;
+#ifdef DAKOTA_HAVE_PTHREADS
+  const size_t MIN_CHUNK_BYTES = 1 << 20;
+  long num_procs = sysconf(_SC_NPROCESSORS_ONLN);
+  num_chunks = std::max((size_t)1, std::min((size_t)(end - start) /
+    MIN_CHUNK_BYTES, (size_t)((num_procs > 0) ? num_procs : 1)));
+#endif
+  std::vector<TabularChunk> chunks(num_chunks);
+  for (i=0, p=start; i<num_chunks; ++i) {
+    TabularChunk& chunk = chunks[i];
+    chunk.begin = p;
+    if (i+1 < num_chunks) {
+      p = std::max(p, start + (end - start) * (i+1) / num_chunks);
+      while (p != end && *p != '\n') ++p;
+      if (p != end) ++p;
+    }
+    else
+      p = end;
+    chunk.end = p; chunk.dataEnd = end;
+    chunk.numLead = num_lead; chunk.readEvalId = read_eval_id;
+    chunk.evalIds = &eval_ids; chunk.ifaceIds = &iface_ids;
+  }
+
+  // count all tokens
+  process_tabular_chunks(chunks, count_tabular_chunk);
+  size_t num_tokens = 0;
+  for (i=0; i<num_chunks; ++i)
+    { chunks[i].firstToken = num_tokens; num_tokens += chunks[i].numTokens; }
+
+  if (record_len == 0) {
+    // infer the record length from the tokens on the first data line
+    size_t num_first_line = 0;
+    for (p = start; p != end; ) {
+      if (is_tabular_space(*p)) {
+	if (*p == '\n' && num_first_line)
+	  break;
+	++p;
+      }
+      else {
+	++num_first_line;
+	while (p != end && !is_tabular_space(*p)) ++p;
+      }
+    }
+    if (num_first_line <= num_lead) {
+      if (num_tokens)
+	return false;
+      records.shape(0, 0); eval_ids.clear(); iface_ids.clear();
+      return true;
+    }
+    record_len = num_first_line - num_lead;
+  }
+  size_t record_tokens = num_lead + record_len;
+  if (num_tokens % record_tokens)
+    return false; // incomplete final record
+  size_t num_records = num_tokens / record_tokens;
+
+  records.shapeUninitialized(record_len, num_records);
+  eval_ids.assign(num_records, 0);
+  iface_ids.assign(num_records, String());
+
+  // records is contiguous, so each chunk fills its columns in order
+  for (i=0; i<num_chunks; ++i) {
+    chunks[i].recordTokens = record_tokens;
+    chunks[i].recordValues = records.values();
+  }
+  process_tabular_chunks(chunks, convert_tabular_chunk);
+  for (i=0; i<num_chunks; ++i)
+    if (!chunks[i].valid)
+      return false;
+  return true;
+}
+
+
+/** The records are walked once to validate them and count the rows,
+    so that records can be sized once, and then each column of each
+    block is decoded directly into its row of records. */
+bool parse_binary_tabular(const char* data, size_t len, size_t& record_len,
+			  RealMatrix& records, IntArray& eval_ids,
+			  StringArray& iface_ids)
+{
+  if (!data || len < sizeof(BINARY_TABULAR_ID) ||
+      std::memcmp(data, BINARY_TABULAR_ID, sizeof(BINARY_TABULAR_ID)))
+    return false;
+  const unsigned char *p = (const unsigned char*)data + sizeof(BINARY_TABULAR_ID),
+    *end = (const unsigned char*)data + len;
+
+  // schema (types of all columns, leading columns first) for each block
+  std::vector<UShortArray> schemas;
+  UShortArray lead_flags;
+  std::vector<const unsigned char*> block_starts;
+  SizetArray block_rows, block_schema;
+  size_t i, num_records = 0;
+  boost::uint64_t num, label_len, col_len;
+  while (p != end) {
+    unsigned char record_type = *p++;
+    if (record_type == BINARY_SCHEMA_RECORD) {
+      if (p == end)
+	return false;
+      unsigned short lead = *p++ & (TABULAR_EVAL_ID | TABULAR_IFACE_ID);
+      size_t num_lead = ((lead & TABULAR_EVAL_ID)  ? 1 : 0) +
+	                ((lead & TABULAR_IFACE_ID) ? 1 : 0);
+      if (!extract_varint(p, end, num) || num < num_lead)
+	return false;
+      UShortArray types(num);
+      for (i=0; i<num; ++i) {
+	if (p == end)
+	  return false;
+	types[i] = *p++;
+	if (types[i] > BINARY_STRING_COLUMN ||
+	    !extract_varint(p, end, label_len) ||
+	    label_len > (boost::uint64_t)(end - p))
+	  return false;
+	p += label_len;
+      }
+      // only numeric data can be returned in records
+      size_t num_data = num - num_lead;
+      if ((lead & TABULAR_EVAL_ID) && types[0] != BINARY_INT_COLUMN)
+	return false;
+      if ((lead & TABULAR_IFACE_ID) && types[num_lead-1]!=BINARY_STRING_COLUMN)
+	return false;
+      for (i=num_lead; i<num; ++i)
+	if (types[i] == BINARY_STRING_COLUMN)
+	  return false;
+      if (record_len == 0)
+	record_len = num_data;
+      else if (num_data != record_len)
+	return false;
+      schemas.push_back(types); lead_flags.push_back(lead);
+    }
+    else if (record_type == BINARY_BLOCK_RECORD) {
+      if (schemas.empty() || !extract_varint(p, end, num))
+	return false;
+      block_rows.push_back(num); block_schema.push_back(schemas.size() - 1);
+      block_starts.push_back(p);
+      for (i=0; i<schemas.back().size(); ++i) {
+	if (!extract_varint(p, end, col_len) ||
+	    col_len > (boost::uint64_t)(end - p))
+	  return false;
+	p += col_len;
+      }
+      num_records += num;
+    }
+    else
+      return false;
+  }
+
+  records.shapeUninitialized(record_len, num_records);
+  eval_ids.assign(num_records, 0);
+  iface_ids.assign(num_records, String());
+  RealArray ids;
+  size_t b, r0 = 0;
+  for (b=0; b<block_starts.size(); r0 += block_rows[b], ++b) {
+    const UShortArray& types = schemas[block_schema[b]];
+    unsigned short lead = lead_flags[block_schema[b]];
+    size_t num_rows = block_rows[b], data_col = 0;
+    Real* rec_vals = (num_rows) ? records[r0] : NULL;
+    p = block_starts[b];
+    for (i=0; i<types.size(); ++i) {
+      extract_varint(p, end, col_len); // validated above
+      const unsigned char* col_end = p + col_len;
+      bool valid;
+      if (i == 0 && (lead & TABULAR_EVAL_ID)) {
+	ids.resize(num_rows);
+	valid = extract_int_column(p, col_end, &ids[0], 1, num_rows);
+	for (size_t r=0; r<num_rows; ++r)
+	  eval_ids[r0+r] = (int)ids[r];
+      }
+      else if (types[i] == BINARY_STRING_COLUMN)
+	valid = extract_string_column(p, col_end, &iface_ids[r0], num_rows);
+      else if (types[i] == BINARY_INT_COLUMN)
+	valid = extract_int_column(p, col_end, rec_vals + data_col++,
+				   record_len, num_rows);
+      else
+	valid = extract_real_column(p, col_end, rec_vals + data_col++,
+				    record_len, num_rows);
+      if (!valid)
+	return false;
+      p = col_end;
+    }
+  }
+  return true;
+}
+
+
+size_t read_numeric_tabular(const std::string& input_filename, 
+			    const std::string& context_message,
+			    unsigned short tabular_format, size_t& record_len,
+			    RealMatrix& records, IntArray& eval_ids,
+			    StringArray& iface_ids)
+{
+  // use the stream open for its diagnostics on a missing file
+  std::ifstream input_stream;
+  open_file(input_stream, input_filename, context_message);
+  close_file(input_stream, input_filename, context_message);
+
+  MappedFileView view(input_filename);
+  if (!parse_numeric_tabular(view.data(), view.size(), tabular_format,
+			     record_len, records, eval_ids, iface_ids)) {
+    Cerr << "\nError (" << context_message << "): could not read numeric "
+	 << "data from file " << input_filename << ".";
+    print_expected_format(Cerr, tabular_format, 0, record_len);
+    abort_handler(-1);
+  }
+  return records.numCols();
+}
+
+
+size_t read_numeric_tabular(const std::string& input_filename, 
+			    const std::string& context_message,
+			    unsigned short tabular_format, size_t& record_len,
+			    RealMatrix& records)
+{
+  IntArray eval_ids; StringArray iface_ids;
+  return read_numeric_tabular(input_filename, context_message, tabular_format,
+			      record_len, records, eval_ids, iface_ids);
+}
+
+
 /** Discard header row from tabular file; alternate could read into a
     string array.  Requires header to be delimited by a newline. */
 void read_header_tabular(std::istream& input_stream,
@@ -384,6 +1167,38 @@ void read_data_tabular(const std::string& input_filename,
 }
 
 
+/** Sets the variables from a numeric record laid out per
+    variables_tabular_columns(); returns false if an integer variable
+    has a non-integral value. */
+static bool set_tabular_variables(const Real* record, bool active_only,
+				  const SizetArray& cv_cols,
+				  const SizetArray& div_cols,
+				  const SizetArray& drv_cols, Variables& vars)
+{
+  size_t i;
+  for (i=0; i<div_cols.size(); ++i) {
+    Real val = record[div_cols[i]];
+    if (val != (int)val)
+      return false;
+    if (active_only) vars.discrete_int_variable((int)val, i);
+    else             vars.all_discrete_int_variable((int)val, i);
+  }
+  if (active_only) {
+    for (i=0; i<cv_cols.size(); ++i)
+      vars.continuous_variable(record[cv_cols[i]], i);
+    for (i=0; i<drv_cols.size(); ++i)
+      vars.discrete_real_variable(record[drv_cols[i]], i);
+  }
+  else {
+    for (i=0; i<cv_cols.size(); ++i)
+      vars.all_continuous_variable(record[cv_cols[i]], i);
+    for (i=0; i<drv_cols.size(); ++i)
+      vars.all_discrete_real_variable(record[drv_cols[i]], i);
+  }
+  return true;
+}
+
+
 // New prototype to support mixed variable reads
 void read_data_tabular(const std::string& input_filename, 
 		       const std::string& context_message,
@@ -398,12 +1213,52 @@ void read_data_tabular(const std::string& input_filename,
     abort_handler(-1);
   }
 
-  std::ifstream input_stream;
-  open_file(input_stream, input_filename, context_message);
-
   size_t num_vars = active_only ? 
     vars.cv() + vars.div() + vars.dsv() + vars.drv() : vars.tv();
 
+  // fast path: parse the mapped file directly into one matrix of
+  // records, then reorder the variables into [cv, div, drv] rows of
+  // vars_matrix; falls back to the stream read on malformed data,
+  // except for binary files, which only the fast path reads
+  {
+    RealMatrix records; IntArray eval_ids; StringArray iface_ids;
+    size_t record_len = num_vars + num_fns;
+    bool parsed = true;
+    if (tabular_format & TABULAR_BINARY)
+      read_numeric_tabular(input_filename, context_message, tabular_format,
+			   record_len, records, eval_ids, iface_ids);
+    else {
+      MappedFileView view(input_filename);
+      parsed = parse_numeric_tabular(view.data(), view.size(), tabular_format,
+				     record_len, records, eval_ids, iface_ids)
+	&& records.numCols() > 0;
+    }
+    if (parsed) {
+      SizetArray cv_cols, div_cols, dsv_cols, drv_cols;
+      variables_tabular_columns(vars, active_only, cv_cols, div_cols,
+				dsv_cols, drv_cols);
+      size_t i, r, num_records = records.numCols(),
+	num_cv = cv_cols.size(), num_div = div_cols.size();
+      vars_matrix.shapeUninitialized(num_records, num_vars);
+      resp_matrix.shapeUninitialized(num_records, num_fns);
+      for (r=0; r<num_records; ++r) {
+	const Real* record = records[r];
+	for (i=0; i<num_cv; ++i)
+	  vars_matrix(r, i) = record[cv_cols[i]];
+	for (i=0; i<num_div; ++i)
+	  vars_matrix(r, num_cv+i) = record[div_cols[i]];
+	for (i=0; i<drv_cols.size(); ++i)
+	  vars_matrix(r, num_cv+num_div+i) = record[drv_cols[i]];
+	for (i=0; i<num_fns; ++i)
+	  resp_matrix(r, i) = record[num_vars+i];
+      }
+      return;
+    }
+  }
+
+  std::ifstream input_stream;
+  open_file(input_stream, input_filename, context_message);
+
   RealVectorArray work_vars_va;
   RealVectorArray work_resp_va;
   RealVector work_vars_vec(num_vars);
@@ -570,6 +1425,70 @@ void read_data_tabular(const std::string& input_filename,
 		       unsigned short tabular_format, bool verbose,
 		       bool active_only)
 {
+  // fast path for numeric data: parse the mapped file into one matrix
+  // of records and set each PRP from its column, rather than extracting
+  // every value through the Variables and Response stream readers;
+  // falls back to the stream read below on string variables or
+  // malformed data (for its diagnostics)
+  bool no_strings = (active_only) ? vars.dsv() == 0 : vars.adsv() == 0;
+  if (tabular_format & TABULAR_BINARY) {
+    // binary files are only read by the fast path
+    if (!no_strings) {
+      Cerr << "\nError (" << context_message << "): string variables are "
+	   << "not supported for binary tabular import." << std::endl;
+      abort_handler(-1);
+    }
+    std::ifstream input_stream; // for the diagnostics on a missing file
+    open_file(input_stream, input_filename, context_message);
+    close_file(input_stream, input_filename, context_message);
+  }
+  if (no_strings) {
+    size_t num_vars = active_only ? vars.cv() + vars.div() + vars.drv() :
+      vars.tv(), num_fns = resp.num_functions(),
+      record_len = num_vars + num_fns;
+    MappedFileView view(input_filename);
+    RealMatrix records; IntArray eval_ids; StringArray iface_ids;
+    if (view.data() &&
+	parse_numeric_tabular(view.data(), view.size(), tabular_format,
+			      record_len, records, eval_ids, iface_ids)) {
+      SizetArray cv_cols, div_cols, dsv_cols, drv_cols;
+      variables_tabular_columns(vars, active_only, cv_cols, div_cols,
+				dsv_cols, drv_cols);
+      size_t r, num_records = records.numCols();
+      bool integral = true;
+      for (r=0; r<num_records && integral; ++r)
+	for (size_t i=0; i<div_cols.size() && integral; ++i) {
+	  Real val = records(div_cols[i], r);
+	  integral = (val == (int)val);
+	}
+      if (integral) {
+	for (r=0; r<num_records; ++r) {
+	  const Real* record = records[r];
+	  set_tabular_variables(record, active_only, cv_cols, div_cols,
+				drv_cols, vars);
+	  for (size_t i=0; i<num_fns; ++i)
+	    resp.function_value(record[num_vars+i], i);
+	  if (verbose) {
+	    Cout << "Variables read:\n" << vars;
+	    if (!iface_ids[r].empty())
+	      Cout << "\nInterface identifier = " << iface_ids[r] << '\n';
+	    Cout << "\nResponse read:\n" << resp;
+	  }
+	  // append deep copy of vars,resp as PRP
+	  input_prp.push_back(ParamResponsePair(vars, iface_ids[r], resp,
+						eval_ids[r]));
+	}
+	return;
+      }
+    }
+    if (tabular_format & TABULAR_BINARY) {
+      Cerr << "\nError (" << context_message << "): could not read "
+	   << "variables and responses from file " << input_filename << ".";
+      print_expected_format(Cerr, tabular_format, 0, record_len);
+      abort_handler(-1);
+    }
+  }
+
   std::ifstream data_stream;
   int eval_id; String iface_id;
   open_file(data_stream, input_filename, context_message);
@@ -621,6 +1540,20 @@ void read_data_tabular(const std::string& input_filename,
 		       size_t num_rows, size_t num_cols,
 		       unsigned short tabular_format, bool verbose)
 {
+  if (tabular_format & TABULAR_BINARY) {
+    // one record per row, transposed from the record layout
+    RealMatrix records;
+    size_t record_len = num_cols;
+    if (read_numeric_tabular(input_filename, context_message, tabular_format,
+			     record_len, records) != num_rows) {
+      Cerr << "\nError (" << context_message << "): expected " << num_rows
+	   << " records in file " << input_filename << "." << std::endl;
+      abort_handler(-1);
+    }
+    input_matrix = RealMatrix(records, Teuchos::TRANS);
+    return;
+  }
+
   std::ifstream input_stream;
   open_file(input_stream, input_filename, context_message);
 
@@ -664,54 +1597,17 @@ void read_data_tabular(const std::string& input_filename,
 		       RealMatrix& input_matrix, size_t record_len,
 		       unsigned short tabular_format, bool verbose)
 {
-  std::ifstream input_stream;
-  open_file(input_stream, input_filename, context_message);
-
-  RealVectorArray rva;
-  RealVector read_rv(record_len);
-  try {
-
-    read_header_tabular(input_stream, tabular_format);
-
-    input_stream >> std::ws;
-    while (input_stream.good() && !input_stream.eof()) {
-
-      // discard any leading columns; annotated is unlikely in this case
-      read_leading_columns(input_stream, tabular_format);
-
-      // read the (required) coefficients of length num_fns
-      read_rv = std::numeric_limits<Real>::quiet_NaN();
-      if (input_stream >> read_rv) {
-	if (verbose) { Cout << "read:\n"; write_data(Cout, read_rv); }
-	rva.push_back(read_rv);
-      }
-      else {
-	Cerr << "\nError (" << context_message << "): unexpected row read "
-	     << "error in file " << input_filename << ".\nread:\n";
-	write_data(Cerr, read_rv);
-	abort_handler(-1);
-      }
-      input_stream >> std::ws; // advance to next input for EOF detection
+  // records are parsed directly into the (record_len X num_records)
+  // layout, since the natural place to store the ith record is as
+  // input_matrix[i], a Teuchos column vector.
+  size_t num_records = read_numeric_tabular(input_filename, context_message,
+					    tabular_format, record_len,
+					    input_matrix);
+  if (verbose)
+    for (size_t i=0; i<num_records; ++i) {
+      Cout << "read:\n";
+      write_data(Cout, RealVector(Teuchos::View, input_matrix[i], record_len));
     }
-  }
-  catch (const std::ios_base::failure& failorbad_except) {
-    Cerr << "\nError (" << context_message << "): could not read file " 
-	 << input_filename << ".";
-    print_expected_format(Cerr, tabular_format, 0, record_len);
-    abort_handler(-1);
-  }
-  catch(...) {
-    Cerr << "\nError (" << context_message << "): could not read file " 
-	 << input_filename << " (unknown error).";
-    abort_handler(-1);
-  }
-
-  // this transposes the rva tabular layout (num_records X record_len) into the
-  // rm layout (record_len X num_records), since the natural place to store the
-  // ith vector rva[i] is as rm[i], a Teuchos column vector.
-  copy_data_transpose(rva, input_matrix);
-
-  close_file(input_stream, input_filename, context_message);
 }
 
 
@@ -723,6 +1619,60 @@ size_t read_data_tabular(const std::string& input_filename,
 			 bool active_only, Variables vars)
 {
   size_t num_evals = 0, num_vars = vars.tv();
+
+  // fast path for numeric data, as for the PRP reader: parse the mapped
+  // file into one matrix of records and set the lists from its columns;
+  // falls back to the stream read below on string variables or
+  // malformed data, except for binary files, which only it reads
+  bool no_strings = (active_only) ? vars.dsv() == 0 : vars.adsv() == 0;
+  if (tabular_format & TABULAR_BINARY && !no_strings) {
+    Cerr << "\nError (" << context_message << "): string variables are "
+	 << "not supported for binary tabular import." << std::endl;
+    abort_handler(-1);
+  }
+  if (no_strings) {
+    size_t record_len = active_only ? vars.cv() + vars.div() + vars.drv() :
+      num_vars;
+    RealMatrix records; IntArray eval_ids; StringArray iface_ids;
+    bool parsed = true;
+    if (tabular_format & TABULAR_BINARY)
+      read_numeric_tabular(input_filename, context_message, tabular_format,
+			   record_len, records, eval_ids, iface_ids);
+    else {
+      MappedFileView view(input_filename);
+      parsed = view.data() &&
+	parse_numeric_tabular(view.data(), view.size(), tabular_format,
+			      record_len, records, eval_ids, iface_ids);
+    }
+    if (parsed) {
+      SizetArray cv_cols, div_cols, dsv_cols, drv_cols;
+      variables_tabular_columns(vars, active_only, cv_cols, div_cols,
+				dsv_cols, drv_cols);
+      size_t r, num_records = records.numCols(), num_prev = cva.size();
+      cva.resize(num_prev + num_records);  diva.resize(num_prev + num_records);
+      drva.resize(num_prev + num_records);
+      for (r=0; r<num_records && parsed; ++r) {
+	parsed = set_tabular_variables(records[r], active_only, cv_cols,
+				       div_cols, drv_cols, vars);
+	// deep copies of the views returned by the accessors
+	copy_data(vars.continuous_variables(),    cva[num_prev+r]);
+	copy_data(vars.discrete_int_variables(),  diva[num_prev+r]);
+	copy_data(vars.discrete_real_variables(), drva[num_prev+r]);
+      }
+      if (parsed) {
+	dsva.resize(boost::extents[num_records][vars.dsv()]);
+	return num_records;
+      }
+      cva.resize(num_prev); diva.resize(num_prev); drva.resize(num_prev);
+    }
+    if (tabular_format & TABULAR_BINARY) {
+      Cerr << "\nError (" << context_message << "): could not read "
+	   << "variables from file " << input_filename << ".";
+      print_expected_format(Cerr, tabular_format, 0, record_len);
+      abort_handler(-1);
+    }
+  }
+
   // temporary dynamic container to read string variables
   std::vector<StringMultiArray> list_dsv_points;
 
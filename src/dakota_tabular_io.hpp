@@ -84,9 +84,10 @@ void open_file(std::ifstream& data_file, const std::string& input_filename,
 	       const std::string& context_message);
 
 /// open the file specified by name for writing, using passed output
-/// stream, presenting context-specific error on failure
+/// stream, presenting context-specific error on failure; binary
+/// suppresses newline translation for TABULAR_BINARY output
 void open_file(std::ofstream& data_file, const std::string& output_filename, 
-	       const std::string& context_message);
+	       const std::string& context_message, bool binary = false);
 
 /// close the file specified by name after reading, using passed input
 /// stream, presenting context-specific error on failure
@@ -149,10 +150,153 @@ void write_data_tabular(const std::string& output_filename,
 			const UShort2DArray& output_indices);
 
 
+/// Writer for the binary columnar tabular format (TABULAR_BINARY)
+
+/** The file starts with an identifier and is followed by schema and
+    block records.  A schema record lists the columns (eval id,
+    interface id, then the variables in tabular order and the
+    responses) with their types and labels.  Rows are buffered and
+    written as a block record of up to blockRows rows, stored column by
+    column: reals as the XOR with the previous value in the column
+    without its zero bytes, integers as zigzag varint deltas, and
+    strings with repeats elided.  No index or trailer is written, so
+    files may be appended to, and a new schema record may be written
+    at any point (e.g., for a new iterator).  Inactive response values
+    are written as NaN.  The caller owns the stream and must flush()
+    before closing it. */
+class BinaryTabularWriter
+{
+public:
+  /// constructor
+  BinaryTabularWriter(size_t block_rows = 1024);
+
+  /// write any pending rows, then a schema record for vars and
+  /// response (preceded by the file identifier at the start of s)
+  void write_header(std::ostream& s, const Variables& vars,
+		    const Response& response);
+  /// write any pending rows, then a schema record for vars and
+  /// additional columns not tied to a response (e.g., MCMC chain
+  /// values or variances), led by the counter_label column
+  void write_header(std::ostream& s, const Variables& vars,
+		    const StringArray& fn_labels,
+		    const String& counter_label = "eval_id");
+  /// buffer a row of all variables and the function values, writing a
+  /// block once blockRows rows are pending
+  void write_row(std::ostream& s, const Variables& vars,
+		 const String& iface_id, const Response& response,
+		 int eval_id);
+  /// buffer a row of all variables and the values of the additional
+  /// columns of the header
+  void write_row(std::ostream& s, const Variables& vars,
+		 const String& iface_id, const RealVector& fn_vals,
+		 int eval_id);
+  /// write any pending rows as a block
+  void flush(std::ostream& s);
+
+private:
+  /// maximum number of rows per block
+  size_t blockRows;
+  /// number of rows pending
+  size_t numRows;
+  /// number of variables columns in the current schema
+  size_t numVarCols;
+  /// number of response columns in the current schema
+  size_t numFnCols;
+  /// column of each continuous variable (all view)
+  SizetArray cvCols;
+  /// column of each discrete integer variable
+  SizetArray divCols;
+  /// column of each discrete real variable
+  SizetArray drvCols;
+  /// type of each variables and response column
+  UShortArray columnTypes;
+  /// discrete string variable in each string column, in column order
+  SizetArray stringVars;
+  /// pending eval ids
+  IntArray evalIds;
+  /// pending interface ids
+  StringArray ifaceIds;
+  /// pending numeric values, row-major, with placeholders in the
+  /// string columns
+  RealArray numericRows;
+  /// pending string variable values, row-major in stringVars order
+  StringArray stringRows;
+};
+
+
 //
 //- Utilities for tabular read
 //
 
+/// read-only view of the contents of a file, memory mapped where
+/// supported (else read into a buffer), so that it can be parsed or
+/// deserialized without an intermediate stream; data() is NULL if the
+/// file could not be opened or is empty
+class MappedFileView
+{
+public:
+  /// map the named file
+  MappedFileView(const std::string& filename);
+  /// unmap the file
+  ~MappedFileView();
+
+  /// start of the file contents
+  const char* data() const { return fileData; }
+  /// length of the file contents in bytes
+  size_t size() const { return fileSize; }
+
+private:
+  /// not copyable, as the mapping is released on destruction
+  MappedFileView(const MappedFileView&);
+  /// not assignable
+  MappedFileView& operator=(const MappedFileView&);
+
+  /// start of the mapped (or buffered) file contents
+  const char* fileData;
+  /// length of the file contents
+  size_t fileSize;
+  /// storage for the file contents where mapping is not supported
+  std::vector<char> fileBuffer;
+};
+
+/// parse whitespace-separated numeric records, each consisting of the
+/// leading columns indicated by tabular_format followed by record_len
+/// reals, from a block of memory into records (record_len x
+/// num_records, one record per column); if record_len is 0 it is
+/// inferred from the first data line.  Returns false, without
+/// diagnostics, if a token is not numeric or the records are incomplete.
+/// Dispatches to parse_binary_tabular() for TABULAR_BINARY.
+bool parse_numeric_tabular(const char* data, size_t len,
+			   unsigned short tabular_format, size_t& record_len,
+			   RealMatrix& records, IntArray& eval_ids,
+			   StringArray& iface_ids);
+
+/// parse a TABULAR_BINARY file from a block of memory into records,
+/// eval_ids, and iface_ids as for parse_numeric_tabular(); returns
+/// false if the data is not a valid binary tabular file, does not
+/// match a nonzero record_len, or contains string variables
+bool parse_binary_tabular(const char* data, size_t len, size_t& record_len,
+			  RealMatrix& records, IntArray& eval_ids,
+			  StringArray& iface_ids);
+
+/// High-throughput read of numeric tabular data: the file is memory
+/// mapped and parsed in place by parse_numeric_tabular() directly into
+/// the contiguous column-major matrix records (record_len x
+/// num_records), preserving any leading eval and interface ids.
+/// Aborts with a diagnostic on malformed data; returns num_records.
+size_t read_numeric_tabular(const std::string& input_filename, 
+			    const std::string& context_message,
+			    unsigned short tabular_format, size_t& record_len,
+			    RealMatrix& records, IntArray& eval_ids,
+			    StringArray& iface_ids);
+
+/// High-throughput read of numeric tabular data, discarding any
+/// leading columns; see above
+size_t read_numeric_tabular(const std::string& input_filename, 
+			    const std::string& context_message,
+			    unsigned short tabular_format, size_t& record_len,
+			    RealMatrix& records);
+
 /// Check if an input stream contains unexpected additional data
 bool exists_extra_data(std::istream& tabular_file);
 
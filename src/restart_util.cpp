@@ -21,6 +21,7 @@
 #include "dakota_data_types.hpp"
 #include "ParamResponsePair.hpp"
 #include "PRPMultiIndex.hpp"
+#include "dakota_tabular_io.hpp"
 #ifdef HAVE_PDB_H
 #include <pdb.h>
 #endif
@@ -64,6 +65,7 @@ int main(int argc, char* argv[])
   std::string util_command;                 // restart utility mode
   std::vector<std::string> pos_args;        // all remaining positional args
   bool freeform = false;                    // whether freeform requested
+  bool binary = false;                      // whether binary requested
   std::vector<std::string> tabular_opts;    // custom_annotated options
   int tabular_precision = write_precision;  // tabular write precision
   try {
@@ -77,6 +79,7 @@ int main(int argc, char* argv[])
        bpo::value<std::vector<std::string> >(&tabular_opts)->multitoken(), 
        "tabular file options: header, eval_id, interface_id")
       ("freeform", "tabular file: freeform format")
+      ("binary", "tabular file: binary columnar format")
       ("output_precision", 
        bpo::value<int>(&tabular_precision)->default_value(write_precision),
        "set tabular output precision")
@@ -114,9 +117,12 @@ int main(int argc, char* argv[])
     }
     if (vm.count("freeform"))
       freeform = true;
-    if (vm.count("freeform") && vm.count("custom_annotated")) {
-      Cerr << "\nError: options --freeform and --custom_annotated are mutually "
-	   << "exclusive.\n";
+    if (vm.count("binary"))
+      binary = true;
+    if (vm.count("freeform") + vm.count("custom_annotated") +
+	vm.count("binary") > 1) {
+      Cerr << "\nError: options --freeform, --custom_annotated, and --binary "
+	   << "are mutually exclusive.\n";
       return -1;
     }
     if (tabular_precision < 1) {
@@ -132,6 +138,8 @@ int main(int argc, char* argv[])
   unsigned short tabular_format = TABULAR_ANNOTATED;  // default
   if (freeform)
     tabular_format = TABULAR_NONE;
+  else if (binary)
+    tabular_format = TABULAR_BINARY;
   else if (!tabular_opts.empty()) {
     bool found_error = false;
     tabular_format = TABULAR_NONE;
@@ -189,7 +197,7 @@ void print_usage(std::ostream& s)
 #ifdef HAVE_PDB_H
     << "    dakota_restart_util to_pdb <restart_file> <pdb_file>\n"
 #endif
-    << "    dakota_restart_util to_tabular <restart_file> <text_file> [--custom_annotated [header] [eval_id] [interface_id]] [--output_precision <int>]\n"
+    << "    dakota_restart_util to_tabular <restart_file> <text_file> [--custom_annotated [header] [eval_id] [interface_id] | --freeform | --binary] [--output_precision <int>]\n"
     << "    dakota_restart_util remove <double> <old_restart_file> <new_restart_file>\n"
     << "    dakota_restart_util remove_ids <int_1> ... <int_n> <old_restart_file> <new_restart_file>\n"
     << "    dakota_restart_util cat <restart_file_1> ... <restart_file_n> <new_restart_file>" 
@@ -276,7 +284,8 @@ void print_restart(StringArray pos_args, String print_dest)
 
     Unrolls all data associated with a particular tag for all
     evaluations and then writes this data in a tabular format
-    (e.g., to a PDB database or MATLAB/TECPLOT data file). */
+    (e.g., to a PDB database or MATLAB/TECPLOT data file), or in the
+    binary columnar format for fast re-import. */
 void print_restart_pdb(StringArray pos_args, String print_dest)
 {
   if (pos_args.size() != 2) {
@@ -445,8 +454,12 @@ void print_restart_tabular(StringArray pos_args, String print_dest,
   boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
 
   size_t num_evals = 0;
-  cout << "Writing tabular text file " << pos_args[1] << '\n';
-  std::ofstream tabular_text(pos_args[1].c_str());
+  bool binary = (tabular_format & TABULAR_BINARY);
+  cout << "Writing tabular " << (binary ? "binary" : "text") << " file "
+       << pos_args[1] << '\n';
+  std::ofstream tabular_text(pos_args[1].c_str(), (binary) ?
+    std::ios_base::out | std::ios_base::binary : std::ios_base::out);
+  TabularIO::BinaryTabularWriter binary_writer;
   // to track changes in interface and/or labels
   String curr_interf;
   StringMultiArray curr_acv_labels;
@@ -499,16 +512,28 @@ void print_restart_tabular(StringArray pos_args, String print_dest,
 	curr_adrv_labels = curr_vars.all_discrete_real_variable_labels();
 	curr_resp_labels = current_pair.response().function_labels();
 	// write the new header
-	current_pair.write_tabular_labels(tabular_text, tabular_format);
+	if (binary)
+	  binary_writer.write_header(tabular_text, curr_vars,
+				     current_pair.response());
+	else
+	  current_pair.write_tabular_labels(tabular_text, tabular_format);
       }
     }
-    current_pair.write_tabular(tabular_text, tabular_format);  // also writes IDs
+    if (binary)
+      binary_writer.write_row(tabular_text, current_pair.variables(),
+			      current_pair.interface_id(),
+			      current_pair.response(), current_pair.eval_id());
+    else
+      current_pair.write_tabular(tabular_text, tabular_format); // also writes IDs
     ++num_evals;
 
     // peek to force EOF if the last restart record was read
     restart_input_fs.peek();
   }
 
+  if (binary)
+    binary_writer.flush(tabular_text);
+
   cout << "Restart file processing completed: " << num_evals
        << " evaluations tabulated.\n";
 
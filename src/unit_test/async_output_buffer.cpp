@@ -0,0 +1,169 @@
+#include "OutputManager.hpp"
+
+#include <sstream>
+#include <string>
+#ifdef DAKOTA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+#include <unistd.h>
+
+#include <Teuchos_UnitTestHarness.hpp>
+
+using namespace Dakota;
+
+namespace {
+
+  /// lines of differing length, so that hand offs split them
+  std::string expected_lines(int num_lines) {
+    std::ostringstream lines;
+    for( int i = 0; i < num_lines; ++i )
+      lines << "line " << i << ' ' << std::string(i%7, 'x') << '\n';
+    return lines.str();
+  }
+
+  /// target whose first write is slow, so that the writer thread is
+  /// busy when later output is flushed
+  class SlowTarget: public std::streambuf {
+  public:
+    SlowTarget(): numWrites(0) {
+#ifdef DAKOTA_HAVE_PTHREADS
+      pthread_mutex_init(&dataMutex, NULL);
+#endif
+    }
+    ~SlowTarget() {
+#ifdef DAKOTA_HAVE_PTHREADS
+      pthread_mutex_destroy(&dataMutex);
+#endif
+    }
+    std::string str() {
+      lock(); std::string data_copy(data); unlock();
+      return data_copy;
+    }
+  protected:
+    std::streamsize xsputn(const char* s, std::streamsize n) {
+      if (numWrites++ == 0)
+	usleep(200000);
+      lock(); data.append(s, n); unlock();
+      return n;
+    }
+    int_type overflow(int_type c) {
+      if (!traits_type::eq_int_type(c, traits_type::eof()))
+	{ char ch = traits_type::to_char_type(c); xsputn(&ch, 1); }
+      return traits_type::not_eof(c);
+    }
+  private:
+    void lock() {
+#ifdef DAKOTA_HAVE_PTHREADS
+      pthread_mutex_lock(&dataMutex);
+#endif
+    }
+    void unlock() {
+#ifdef DAKOTA_HAVE_PTHREADS
+      pthread_mutex_unlock(&dataMutex);
+#endif
+    }
+    int numWrites;
+    std::string data;
+#ifdef DAKOTA_HAVE_PTHREADS
+    pthread_mutex_t dataMutex;
+#endif
+  };
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(async_output_buffer, round_trip)
+{
+  const int NLINES = 500;
+  std::ostringstream target;
+  // a small buffer so that most output is handed off mid-line
+  AsyncOutputBuffer async_buf(target.rdbuf(), 16);
+  std::ostream async_stream(&async_buf);
+
+  for( int i = 0; i < NLINES; ++i ) {
+    async_stream << "line " << i << ' ' << std::string(i%7, 'x') << '\n';
+    if( i%50 == 0 )
+      async_stream << std::flush;
+  }
+  async_buf.drain();
+
+  TEST_EQUALITY( expected_lines(NLINES), target.str() );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(async_output_buffer, tellp_counts_pending)
+{
+  std::ostringstream target;
+  target << "header\n";
+  AsyncOutputBuffer async_buf(target.rdbuf(), 1024);
+  std::ostream async_stream(&async_buf);
+
+  // positions continue from the target's and include unwritten output
+  TEST_EQUALITY( 7, (int)async_stream.tellp() );
+  async_stream << "0123456789";
+  TEST_EQUALITY( 17, (int)async_stream.tellp() );
+
+  async_buf.drain();
+  TEST_EQUALITY( 17, (int)async_stream.tellp() );
+  TEST_EQUALITY( std::string("header\n0123456789"), target.str() );
+
+  // only position queries are supported
+  TEST_EQUALITY( -1, (int)async_buf.pubseekoff(0, std::ios_base::beg,
+					       std::ios_base::out) );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(async_output_buffer, drain_all)
+{
+  const int NLINES = 100;
+  std::ostringstream target1, target2;
+  AsyncOutputBuffer async_buf1(target1.rdbuf(), 32), async_buf2(target2.rdbuf());
+  std::ostream async_stream1(&async_buf1), async_stream2(&async_buf2);
+
+  for( int i = 0; i < NLINES; ++i ) {
+    async_stream1 << "line " << i << ' ' << std::string(i%7, 'x') << '\n';
+    async_stream2 << "line " << i << ' ' << std::string(i%7, 'x') << std::endl;
+  }
+  AsyncOutputBuffer::drain_all();
+
+  TEST_EQUALITY( expected_lines(NLINES), target1.str() );
+  TEST_EQUALITY( expected_lines(NLINES), target2.str() );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(async_output_buffer, destructor_drains)
+{
+  const int NLINES = 200;
+  std::ostringstream target;
+  {
+    AsyncOutputBuffer async_buf(target.rdbuf(), 64);
+    std::ostream async_stream(&async_buf);
+    for( int i = 0; i < NLINES; ++i )
+      async_stream << "line " << i << ' ' << std::string(i%7, 'x') << '\n';
+  }
+
+  TEST_EQUALITY( expected_lines(NLINES), target.str() );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(async_output_buffer, flush_while_writer_busy)
+{
+  SlowTarget target;
+  AsyncOutputBuffer async_buf(&target, 1024);
+  std::ostream async_stream(&async_buf);
+
+  // the second flush finds the writer busy with the first, and must be
+  // written once the writer is idle, without further output or drain()
+  async_stream << "first" << std::endl;
+  async_stream << "second" << std::endl;
+  for( int i = 0; i < 100 && target.str().size() < 13; ++i )
+    usleep(20000);
+
+  TEST_EQUALITY( std::string("first\nsecond\n"), target.str() );
+}
+
+//----------------------------------------------------------------
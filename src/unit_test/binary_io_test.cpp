@@ -368,6 +368,58 @@ void test_write_read_array_of_teuchos_matrices(const std::string& file_name)
 
 }
 
+void test_append_read_extensible_rows(const std::string& file_name)
+{
+  bool db_is_incore = false;
+  bool file_exist = true;
+  herr_t status;
+
+  std::size_t num_cols = 3, num_rows = 10;
+  std::vector<double> rows_out;
+  for (std::size_t i=0; i<num_rows; ++i)
+    for (std::size_t j=0; j<num_cols; ++j)
+      rows_out.push_back(10.*i + j);
+
+  // scope within which file write takes place
+  {
+    bool write_file = true;
+    HDF5BinaryStream binary_file(file_name, db_is_incore, file_exist,
+                                 write_file);
+
+    // chunks smaller than an append, with compression
+    status = binary_file.create_extensible_dataset<double>("/Extensible/Rows",
+               num_cols, 4, 6);
+    assert(status >= 0);
+
+    status = binary_file.append_rows("/Extensible/Rows", &rows_out[0], 7);
+    assert(status >= 0);
+    status = binary_file.append_rows("/Extensible/Rows",
+               &rows_out[7*num_cols], num_rows - 7);
+    assert(status >= 0);
+  }
+
+  // scope within which file read takes place
+  {
+    bool write_file = false;
+    HDF5BinaryStream binary_file(file_name, db_is_incore, file_exist,
+                                 write_file);
+
+    std::vector<double> rows_in;
+    std::size_t num_cols_in = 0;
+    status = binary_file.read_rows("/Extensible/Rows", rows_in, num_cols_in);
+    assert(status >= 0);
+    assert(num_cols_in == num_cols);
+    assert(rows_in == rows_out);
+
+    // partial read past the end returns the available rows
+    status = binary_file.read_rows("/Extensible/Rows", rows_in, num_cols_in,
+               8, 5);
+    assert(status >= 0);
+    assert(rows_in.size() == 2*num_cols);
+    assert(rows_in[0] == rows_out[8*num_cols]);
+  }
+}
+
 herr_t testHDF5fileDB(const std::string& file_name)
 {
   double rval_out = 3.14159;
@@ -428,6 +480,7 @@ herr_t testHDF5fileDB(const std::string& file_name)
 
   test_write_read_string(file_name);
   test_write_read_string_array(file_name);
+  test_append_read_extensible_rows(file_name);
 
 
   // WJB - ToDo: split out into functions
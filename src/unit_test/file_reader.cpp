@@ -1,7 +1,11 @@
 
 #include "dakota_data_io.hpp"
 #include "dakota_tabular_io.hpp"
+#include "DakotaVariables.hpp"
+#include "DakotaResponse.hpp"
 
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <sstream>
 #include <string>
 
 #include <Teuchos_UnitTestHarness.hpp> 
@@ -179,6 +183,240 @@ TEUCHOS_UNIT_TEST(file_reader, read_unsized_data)
 
 //----------------------------------------------------------------
 
+TEUCHOS_UNIT_TEST(file_reader, read_numeric_tabular)
+{
+  const int NUM_RESP = 9;
+  const int RESP_DIM = 4;
+  const std::string filename("test_numeric_tabular");
+  RealVectorArray field_data = create_test_array(NUM_RESP, RESP_DIM, true);
+  create_field_data_file(filename, field_data);
+
+  RealMatrix records;
+  size_t record_len = 0; // inferred from the first line
+  /////////////////  What we want to test
+  size_t num_records = TabularIO::
+    read_numeric_tabular(filename, "unit test read_numeric_tabular",
+			 TABULAR_NONE, record_len, records);
+  /////////////////  What we want to test
+
+  // Verify each row of the file became a column of the matrix
+  TEST_EQUALITY( NUM_RESP, num_records );
+  TEST_EQUALITY( RESP_DIM, record_len );
+  TEST_EQUALITY( RESP_DIM, records.numRows() );
+  for( int i=0; i<NUM_RESP; ++i )
+    for( int j=0; j<RESP_DIM; ++j )
+      TEST_FLOATING_EQUALITY( field_data[i][j], records(j,i), 1.e-14 );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(file_reader, parse_numeric_tabular_annotated)
+{
+  const std::string data("%eval_id interface x1 x2 f\n"
+			 "1 NO_ID 0.5 -2 1.e-3\n"
+			 "2 sim  1.5e2 3 -4.25");
+  RealMatrix records;
+  IntArray eval_ids;
+  StringArray iface_ids;
+  size_t record_len = 3;
+  /////////////////  What we want to test
+  bool parsed = TabularIO::
+    parse_numeric_tabular(data.c_str(), data.size(), TABULAR_ANNOTATED,
+			  record_len, records, eval_ids, iface_ids);
+  /////////////////  What we want to test
+
+  TEST_ASSERT( parsed );
+  TEST_EQUALITY( 2, records.numCols() );
+  TEST_EQUALITY( 2, eval_ids[1] );
+  TEST_ASSERT( iface_ids[0].empty() );
+  TEST_EQUALITY( std::string("sim"), iface_ids[1] );
+  TEST_FLOATING_EQUALITY( 1.e-3,  records(2,0), 1.e-14 );
+  TEST_FLOATING_EQUALITY( 150.,   records(0,1), 1.e-14 );
+  TEST_FLOATING_EQUALITY( -4.25,  records(2,1), 1.e-14 );
+
+  // An incomplete final record or a non-numeric value is rejected
+  record_len = 4;
+  TEST_ASSERT( !TabularIO::
+	       parse_numeric_tabular(data.c_str(), data.size(),
+				     TABULAR_ANNOTATED, record_len, records,
+				     eval_ids, iface_ids) );
+  const std::string bad_data("1 2 3\n4 five 6\n");
+  record_len = 0;
+  TEST_ASSERT( !TabularIO::
+	       parse_numeric_tabular(bad_data.c_str(), bad_data.size(),
+				     TABULAR_NONE, record_len, records,
+				     eval_ids, iface_ids) );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(file_reader, parse_numeric_tabular_binary)
+{
+  // identifier; schema of eval_id, interface, and x; one block of two
+  // rows with x = 1, 2 (XOR'd with the previous value), eval ids 1, 2
+  // (deltas), and interface "a" then a repeat
+  const unsigned char data[] = { 'D', 'A', 'K', 'T', 'A', 'B', 0, 1,
+    'S', 6, 3, 1, 7, 'e', 'v', 'a', 'l', '_', 'i', 'd',
+    2, 9, 'i', 'n', 't', 'e', 'r', 'f', 'a', 'c', 'e', 0, 1, 'x',
+    'B', 2, 2, 2, 2, 3, 2, 'a', 0, 6, 0x06, 0x3f, 0xf0, 0x06, 0x7f, 0xf0 };
+  RealMatrix records;
+  IntArray eval_ids;
+  StringArray iface_ids;
+  size_t record_len = 0;
+  /////////////////  What we want to test
+  bool parsed = TabularIO::
+    parse_numeric_tabular((const char*)data, sizeof(data), TABULAR_BINARY,
+			  record_len, records, eval_ids, iface_ids);
+  /////////////////  What we want to test
+
+  TEST_ASSERT( parsed );
+  TEST_EQUALITY( 1, record_len );
+  TEST_EQUALITY( 2, records.numCols() );
+  TEST_EQUALITY( 2, eval_ids[1] );
+  TEST_EQUALITY( std::string("a"), iface_ids[1] );
+  TEST_FLOATING_EQUALITY( 1., records(0,0), 1.e-14 );
+  TEST_FLOATING_EQUALITY( 2., records(0,1), 1.e-14 );
+
+  // A mismatched record length or a truncated block is rejected
+  record_len = 2;
+  TEST_ASSERT( !TabularIO::
+	       parse_numeric_tabular((const char*)data, sizeof(data),
+				     TABULAR_BINARY, record_len, records,
+				     eval_ids, iface_ids) );
+  record_len = 0;
+  TEST_ASSERT( !TabularIO::
+	       parse_numeric_tabular((const char*)data, sizeof(data) - 1,
+				     TABULAR_BINARY, record_len, records,
+				     eval_ids, iface_ids) );
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(file_reader, binary_tabular_round_trip)
+{
+  // two continuous, one discrete integer, and one discrete real design
+  // variable, in that tabular order, and two response functions
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV] = 2; vc_totals[TOTAL_DDIV] = 1;
+  vc_totals[TOTAL_DDRV] = 1;
+  SharedVariablesData svd(std::make_pair((short)MIXED_DESIGN,
+					 (short)EMPTY_VIEW), vc_totals);
+  Variables vars(svd);
+  vars.continuous_variable_label("x1", 0);
+  vars.continuous_variable_label("x2", 1);
+  vars.discrete_int_variable_label("i1", 0);
+  vars.discrete_real_variable_label("r1", 0);
+  ActiveSet set(2, 2);
+  Response resp(SIMULATION_RESPONSE, set);
+
+  // blocks of at most two rows: 2 + 2 + 1 rows under the first schema,
+  // then 2 rows under a second schema record; f2 is inactive in row 3
+  const int NUM_ROWS = 7, SCHEMA_ROW = 5, INACTIVE_ROW = 2;
+  std::stringstream s;
+  TabularIO::BinaryTabularWriter writer(2);
+  /////////////////  What we want to test
+  for (int r=0; r<NUM_ROWS; ++r) {
+    if (r == 0 || r == SCHEMA_ROW)
+      writer.write_header(s, vars, resp);
+    vars.continuous_variable(0.5 + r, 0);
+    vars.continuous_variable(-1.25 * r, 1);
+    vars.discrete_int_variable(3 - r, 0);
+    vars.discrete_real_variable(1.e-3 * r, 0);
+    ShortArray asv(2, 1);
+    if (r == INACTIVE_ROW) asv[1] = 0;
+    resp.active_set_request_vector(asv);
+    resp.function_value(10. * r, 0);
+    resp.function_value(-0.1 * r, 1);
+    writer.write_row(s, vars, (r % 2) ? "sim" : "", resp, r + 1);
+  }
+  writer.flush(s);
+  const std::string data(s.str());
+  RealMatrix records;
+  IntArray eval_ids;
+  StringArray iface_ids;
+  size_t record_len = 0;
+  bool parsed = TabularIO::
+    parse_binary_tabular(data.data(), data.size(), record_len, records,
+			 eval_ids, iface_ids);
+  /////////////////  What we want to test
+
+  TEST_ASSERT( parsed );
+  TEST_EQUALITY( 6, record_len );
+  TEST_EQUALITY( NUM_ROWS, records.numCols() );
+  for (int r=0; r<NUM_ROWS; ++r) {
+    TEST_EQUALITY( r + 1, eval_ids[r] );
+    TEST_EQUALITY( std::string((r % 2) ? "sim" : ""), iface_ids[r] );
+    TEST_FLOATING_EQUALITY( 0.5 + r,      records(0,r), 1.e-14 );
+    TEST_EQUALITY( -1.25 * r,             records(1,r) );
+    TEST_EQUALITY( (Real)(3 - r),         records(2,r) );
+    TEST_EQUALITY( 1.e-3 * r,             records(3,r) );
+    TEST_EQUALITY( 10. * r,               records(4,r) );
+    if (r == INACTIVE_ROW)
+      { TEST_ASSERT( boost::math::isnan(records(5,r)) ); }
+    else
+      { TEST_EQUALITY( -0.1 * r, records(5,r) ); }
+  }
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(file_reader, binary_tabular_labeled_values)
+{
+  // one continuous design variable with values not tied to a response
+  // (as for chain and sample exports), then variables only
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV] = 1;
+  SharedVariablesData svd(std::make_pair((short)MIXED_DESIGN,
+					 (short)EMPTY_VIEW), vc_totals);
+  Variables vars(svd);
+  vars.continuous_variable_label("x1", 0);
+  StringArray val_labels(2);
+  val_labels[0] = "f1_var"; val_labels[1] = "f2_var";
+
+  const int NUM_ROWS = 3;
+  std::stringstream s, s_vars;
+  TabularIO::BinaryTabularWriter writer, vars_writer;
+  /////////////////  What we want to test
+  writer.write_header(s, vars, val_labels, "pred_config");
+  vars_writer.write_header(s_vars, vars, StringArray(), "sample_id");
+  RealVector vals(2), no_vals;
+  for (int r=0; r<NUM_ROWS; ++r) {
+    vars.continuous_variable(2. * r, 0);
+    vals[0] = r; vals[1] = -r;
+    writer.write_row(s, vars, "", vals, r + 1);
+    vars_writer.write_row(s_vars, vars, "", no_vals, r + 1);
+  }
+  writer.flush(s);
+  vars_writer.flush(s_vars);
+  const std::string data(s.str()), vars_data(s_vars.str());
+  RealMatrix records, vars_records;
+  IntArray eval_ids;
+  StringArray iface_ids;
+  size_t record_len = 0, vars_record_len = 0;
+  bool parsed = TabularIO::
+    parse_binary_tabular(data.data(), data.size(), record_len, records,
+			 eval_ids, iface_ids);
+  bool vars_parsed = TabularIO::
+    parse_binary_tabular(vars_data.data(), vars_data.size(), vars_record_len,
+			 vars_records, eval_ids, iface_ids);
+  /////////////////  What we want to test
+
+  TEST_ASSERT( parsed );
+  TEST_EQUALITY( 3, record_len );
+  TEST_ASSERT( vars_parsed );
+  TEST_EQUALITY( 1, vars_record_len );
+  TEST_EQUALITY( NUM_ROWS, vars_records.numCols() );
+  for (int r=0; r<NUM_ROWS; ++r) {
+    TEST_EQUALITY( 2. * r,    records(0,r) );
+    TEST_EQUALITY( (Real)r,   records(1,r) );
+    TEST_EQUALITY( (Real)-r,  records(2,r) );
+    TEST_EQUALITY( 2. * r,    vars_records(0,r) );
+    TEST_EQUALITY( r + 1,     eval_ids[r] );
+  }
+}
+
+//----------------------------------------------------------------
+
 TEUCHOS_UNIT_TEST(file_reader, read_sigma_scalar)
 {
   const int NUM_RESP = 1;
@@ -0,0 +1,100 @@
+#include "ResultsDBHDF5.hpp"
+#include "DakotaVariables.hpp"
+#include "DakotaResponse.hpp"
+
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <string>
+
+#include <Teuchos_UnitTestHarness.hpp>
+
+using namespace Dakota;
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(results_db_hdf5, evaluation_round_trip)
+{
+  // two continuous and one discrete integer design variable and two
+  // response functions
+  SizetArray vc_totals(NUM_VC_TOTALS, 0);
+  vc_totals[TOTAL_CDV] = 2; vc_totals[TOTAL_DDIV] = 1;
+  SharedVariablesData svd(std::make_pair((short)MIXED_DESIGN,
+					 (short)EMPTY_VIEW), vc_totals);
+  Variables vars(svd);
+  vars.continuous_variable_label("x1", 0);
+  vars.continuous_variable_label("x2", 1);
+  vars.discrete_int_variable_label("i1", 0);
+  ActiveSet set(2, 2);
+  Response resp(SIMULATION_RESPONSE, set);
+
+  StrStrSizet iterator_id = boost::make_tuple(String("sampling"),
+					      String("NO_ID"), (size_t)1);
+  String iface_id("sim");
+
+  // chunks of two rows, so that two chunks are written as they fill and
+  // the last row by flush(); f2 is inactive in evaluation 3
+  const int NUM_EVALS = 5, INACTIVE_EVAL = 2;
+  /////////////////  What we want to test
+  {
+    ResultsDBHDF5 db_out(false, "results_db_hdf5_test", 6, 2);
+    for (int e=0; e<NUM_EVALS; ++e) {
+      vars.continuous_variable(0.5 + e, 0);
+      vars.continuous_variable(-1.25 * e, 1);
+      vars.discrete_int_variable(3 - e, 0);
+      ShortArray asv(2, 1);
+      if (e == INACTIVE_EVAL) asv[1] = 0;
+      resp.active_set_request_vector(asv);
+      resp.function_value(10. * e, 0);
+      resp.function_value(-0.1 * e, 1);
+      db_out.insert_evaluation(iterator_id, iface_id, vars, resp, e + 1);
+    }
+    db_out.flush();
+  }
+
+  ResultsDBHDF5 db_in("results_db_hdf5_test.h5");
+  IntMatrix eval_ids, div_rows;
+  RealMatrix cv_rows, fn_rows, fn_subset;
+  db_in.read_evaluations(iterator_id, iface_id, "eval_ids", eval_ids);
+  db_in.read_evaluations(iterator_id, iface_id, "continuous_variables",
+			 cv_rows);
+  db_in.read_evaluations(iterator_id, iface_id, "discrete_integer_variables",
+			 div_rows);
+  db_in.read_evaluations(iterator_id, iface_id, "responses", fn_rows);
+  db_in.read_evaluations(iterator_id, iface_id, "responses", fn_subset, 1, 2);
+  StringArray cv_labels, fn_labels;
+  db_in.read_evaluation_labels(iterator_id, iface_id, "continuous_variables",
+			       cv_labels);
+  db_in.read_evaluation_labels(iterator_id, iface_id, "responses", fn_labels);
+  /////////////////  What we want to test
+
+  // one column per evaluation
+  TEST_EQUALITY( 1, eval_ids.numRows() );
+  TEST_EQUALITY( NUM_EVALS, eval_ids.numCols() );
+  TEST_EQUALITY( 2, cv_rows.numRows() );
+  TEST_EQUALITY( NUM_EVALS, cv_rows.numCols() );
+  TEST_EQUALITY( 1, div_rows.numRows() );
+  TEST_EQUALITY( 2, fn_rows.numRows() );
+  TEST_EQUALITY( NUM_EVALS, fn_rows.numCols() );
+  for (int e=0; e<NUM_EVALS; ++e) {
+    TEST_EQUALITY( e + 1,      eval_ids(0,e) );
+    TEST_EQUALITY( 0.5 + e,    cv_rows(0,e) );
+    TEST_EQUALITY( -1.25 * e,  cv_rows(1,e) );
+    TEST_EQUALITY( 3 - e,      div_rows(0,e) );
+    TEST_EQUALITY( 10. * e,    fn_rows(0,e) );
+    if (e == INACTIVE_EVAL)
+      { TEST_ASSERT( boost::math::isnan(fn_rows(1,e)) ); }
+    else
+      { TEST_EQUALITY( -0.1 * e, fn_rows(1,e) ); }
+  }
+
+  // a range of evaluations
+  TEST_EQUALITY( 2, fn_subset.numCols() );
+  TEST_EQUALITY( 10., fn_subset(0,0) );
+  TEST_ASSERT( boost::math::isnan(fn_subset(1,1)) );
+
+  TEST_EQUALITY( 2, cv_labels.size() );
+  TEST_EQUALITY( std::string("x2"), cv_labels[1] );
+  TEST_EQUALITY( 2, fn_labels.size() );
+}
+
+//----------------------------------------------------------------
@@ -343,6 +343,131 @@ void test_single_full_block_covariance_matrix()
   
 }
 
+void test_single_banded_block_covariance_matrix()
+{
+  std::vector<RealMatrix> matrices;
+  std::vector<RealVector> diagonals;
+  RealVector scalars;
+  IntVector matrix_map_indices, diagonal_map_indices, scalar_map_indices;
+
+  // tridiagonal covariance (the 1D Laplacian), stored in banded form
+  int num_matrices = 1;
+  int num_matrix_rows = 8;
+  matrix_map_indices.sizeUninitialized( num_matrices );
+  matrix_map_indices[0] = 0;
+  matrices.resize( num_matrices );
+  matrices[0].shape( num_matrix_rows, num_matrix_rows );
+  for ( int i=0; i<num_matrix_rows; i++ ){
+    matrices[0](i,i) = 2.;
+    if ( i > 0 )
+      matrices[0](i,i-1) = matrices[0](i-1,i) = -1.;
+  }
+
+  ExperimentCovariance exper_cov; 
+  exper_cov.set_covariance_matrices( matrices, diagonals, scalars,
+				     matrix_map_indices,
+				     diagonal_map_indices, 
+				     scalar_map_indices );
+
+  // Test determinant and log_determinant: det = n+1
+  BOOST_CHECK_CLOSE(exper_cov.determinant(), 9., 1.0e-12);
+  BOOST_CHECK_CLOSE(exper_cov.log_determinant(), std::log(9.), 1.0e-12);
+
+  // Test application of the covariance inverse to a vector of ones: the
+  // entries of the inverse sum to n(n+1)(n+2)/12
+  RealVector residual( num_matrix_rows, false );
+  residual = 1.;
+  Real prod = exper_cov.apply_experiment_covariance( residual );
+  BOOST_CHECK_CLOSE( prod, 60., 1.0e-10 );
+
+  RealVector result;
+  exper_cov.apply_experiment_covariance_inverse_sqrt( residual, result );
+  BOOST_CHECK_CLOSE( result.dot( result ), 60., 1.0e-10 );
+
+  // Test application of the sqrt of the covariance inverse to matrix of 
+  // gradient vectors
+  RealMatrix grads( 2, num_matrix_rows, false ), scaled_grads;
+  for ( int j=0; j<num_matrix_rows; j++ )
+    { grads(0,j) = 1.; grads(1,j) = 2.; }
+  exper_cov.apply_experiment_covariance_inverse_sqrt_to_gradients( grads, 
+								   scaled_grads);
+  RealMatrix grammian( grads.numRows(), grads.numRows(), false );
+  grammian.multiply( Teuchos::NO_TRANS, Teuchos::TRANS, 1.0, scaled_grads, 
+		     scaled_grads, 0. );
+  BOOST_CHECK_CLOSE( grammian(0,0), 60., 1.0e-10 );
+  BOOST_CHECK_CLOSE( grammian(0,1), 120., 1.0e-10 );
+  BOOST_CHECK_CLOSE( grammian(1,1), 240., 1.0e-10 );
+
+  // Test extraction of main diagonal and the dense covariance
+  RealVector diagonal;
+  exper_cov.get_main_diagonal( diagonal );
+  for ( int i=0; i<num_matrix_rows; i++ )
+    BOOST_CHECK( diagonal[i] == 2. );
+
+  RealSymMatrix dense_cov;
+  exper_cov.dense_covariance( dense_cov );
+  BOOST_CHECK( dense_cov(3,2) == -1. );
+  BOOST_CHECK( dense_cov(5,2) == 0. );
+}
+
+void test_single_tapered_block_covariance_matrix()
+{
+  std::vector<RealMatrix> matrices;
+  std::vector<RealVector> diagonals;
+  RealVector scalars;
+  IntVector matrix_map_indices, diagonal_map_indices, scalar_map_indices;
+
+  // squared exponential covariance with a unit correlation length on a
+  // unit grid: no entry is zero, but those more than five points apart
+  // are below the band tolerance
+  int num_matrices = 1;
+  int num_matrix_rows = 40;
+  matrix_map_indices.sizeUninitialized( num_matrices );
+  matrix_map_indices[0] = 0;
+  matrices.resize( num_matrices );
+  matrices[0].shape( num_matrix_rows, num_matrix_rows );
+  RealSymMatrix ref_factor( num_matrix_rows );
+  for ( int j=0; j<num_matrix_rows; j++ )
+    for ( int i=0; i<num_matrix_rows; i++ ){
+      matrices[0](i,j) = 3.*std::exp( -(Real)((i-j)*(i-j)) );
+      if ( i >= j ) ref_factor(i,j) = matrices[0](i,j);
+    }
+
+  ExperimentCovariance exper_cov; 
+  exper_cov.set_covariance_matrices( matrices, diagonals, scalars,
+				     matrix_map_indices,
+				     diagonal_map_indices, 
+				     scalar_map_indices );
+
+  // reference values from the dense Cholesky factorization
+  Teuchos::SerialSpdDenseSolver<int, Real> ref_slvr;
+  ref_slvr.setMatrix( Teuchos::rcp(&ref_factor, false) );
+  BOOST_CHECK( ref_slvr.factor() == 0 );
+  Real ref_log_det = 0.;
+  for ( int i=0; i<num_matrix_rows; i++ )
+    ref_log_det += 2.*std::log( ref_factor(i,i) );
+  RealMatrix ones( num_matrix_rows, 1 ), ref_solution( num_matrix_rows, 1 );
+  ones = 1.;
+  ref_slvr.setVectors( Teuchos::rcp(&ref_solution, false),
+		       Teuchos::rcp(&ones, false) );
+  ref_slvr.solve();
+  Real ref_prod = 0.;
+  for ( int i=0; i<num_matrix_rows; i++ )
+    ref_prod += ref_solution(i,0);
+
+  BOOST_CHECK_CLOSE( exper_cov.log_determinant(), ref_log_det, 1.0e-10 );
+  RealVector residual( num_matrix_rows, false );
+  residual = 1.;
+  BOOST_CHECK_CLOSE( exper_cov.apply_experiment_covariance( residual ),
+		     ref_prod, 1.0e-10 );
+
+  // entries outside the band read back as zero
+  RealSymMatrix dense_cov;
+  exper_cov.dense_covariance( dense_cov );
+  BOOST_CHECK_CLOSE( dense_cov(7,2), 3.*std::exp(-25.), 1.0e-12 );
+  BOOST_CHECK( dense_cov(8,2) == 0. );
+}
+
 void test_mixed_scalar_diagonal_full_block_covariance_matrix()
 {
   std::vector<RealMatrix> matrices;
@@ -977,6 +1102,8 @@ BOOST_AUTO_TEST_CASE( test_main )
   test_multiple_scalar_covariance_matrix();
   test_single_diagonal_block_covariance_matrix();
   test_single_full_block_covariance_matrix();
+  test_single_banded_block_covariance_matrix();
+  test_single_tapered_block_covariance_matrix();
   test_mixed_scalar_diagonal_full_block_covariance_matrix();
 
   // Test field interpolation functions